@@ -3,63 +3,169 @@
  */
 
 #include "AnimationPlayer.h"
+#include "AssetPack.h"
+#include "DisplayDriver.h"
+
+AnimationPlayer* AnimationPlayer::first = nullptr;
 
 AnimationPlayer::AnimationPlayer() :
   display(nullptr),
+  assets(nullptr),
   currentAnimation(nullptr),
   currentFrame(0),
   lastFrameTime(0),
   posX(0),
   posY(0),
-  playing(false)
+  zoom(1),
+  loopsLeft(0),
+  playing(false),
+  shownFrame(-1),
+  surfaceEpoch(0),
+  pending(false),
+  windowFrames(0),
+  windowStart(0),
+  next(first)
 {
+  first = this;
+  resetStats();
 }
 
-void AnimationPlayer::init(DisplayDriver* disp) {
+AnimationPlayer::~AnimationPlayer() {
+  for (AnimationPlayer** link = &first; *link; link = &(*link)->next) {
+    if (*link == this) {
+      *link = next;
+      break;
+    }
+  }
+}
+
+void AnimationPlayer::init(DisplayDriver* disp, AssetPack* pack) {
   display = disp;
+  assets = pack;
 }
 
-void AnimationPlayer::play(const Animation* anim, int16_t x, int16_t y) {
-  if (!anim || !display) return;
+void AnimationPlayer::play(const Animation* anim, int16_t x, int16_t y, uint8_t scale, uint8_t loops) {
+  if (!anim || !display || anim->frameCount == 0 || !anim->keyframe) return;
   
+  if (loops == ANIMATION_LOOPS_DEFAULT) {
+    loops = anim->loop ? ANIMATION_LOOPS_FOREVER : 1;
+  }
   currentAnimation = anim;
   currentFrame = 0;
   posX = x;
   posY = y;
+  zoom = max<uint8_t>(scale, 1);
+  loopsLeft = loops == ANIMATION_LOOPS_FOREVER ? 0xFF : loops - 1;
   playing = true;
+  shownFrame = -1;  // Starts with the keyframe
   lastFrameTime = millis();
+  windowStart = lastFrameTime;
+  windowFrames = 0;
+}
+
+bool AnimationPlayer::play(const char* name, int16_t x, int16_t y, uint8_t scale, uint8_t loops) {
+  const Animation* anim = assets ? assets->findAnimation(name) : nullptr;
+  if (!anim) return false;
+  play(anim, x, y, scale, loops);
+  return true;
 }
 
 void AnimationPlayer::stop() {
   playing = false;
   currentAnimation = nullptr;
+  shownFrame = -1;
+}
+
+void AnimationPlayer::resetStats() {
+  stats.frames = 0;
+  stats.dropped = 0;
+  stats.fpsX10 = 0;
 }
 
-void AnimationPlayer::update() {
-  if (!playing || !currentAnimation || !display) return;
+// Move to the frame that is due at `now`; true if that is a new one
+bool AnimationPlayer::advance(unsigned long now) {
+  if (now - lastFrameTime > ANIMATION_MAX_CATCHUP_MS) {
+    // Stalled (network, flash writes): carry on from here instead of
+    // racing through the backlog
+    lastFrameTime = now - frameDelay(currentFrame);
+  }
   
+  uint16_t steps = 0;
+  while (now - lastFrameTime >= frameDelay(currentFrame)) {
+    uint8_t following = currentFrame + 1;
+    if (following >= currentAnimation->frameCount) {
+      if (loopsLeft == 0) {
+        playing = false;  // Stays on the last frame
+        break;
+      }
+      if (loopsLeft != 0xFF) loopsLeft--;
+      following = 0;
+    }
+    lastFrameTime += frameDelay(currentFrame);
+    currentFrame = following;
+    steps++;
+  }
+  if (steps == 0) return false;
+  
+  stats.frames++;
+  stats.dropped += steps - 1;
+  windowFrames++;
+  if (now - windowStart >= ANIMATION_FPS_WINDOW_MS) {
+    stats.fpsX10 = windowFrames * 10000UL / (now - windowStart);
+    windowFrames = 0;
+    windowStart = now;
+  }
+  return true;
+}
+
+// Deltas from the frame on screen to the current one, or the whole chain
+// from the keyframe. Each delta only holds what changed since the one before,
+// so skipped frames cannot be left out; drawing direct, each one goes to the
+// panel.
+void AnimationPlayer::draw(bool full) {
+  int16_t from = shownFrame;
+  if (full || from < 0) {
+    display->drawRleFrame(currentAnimation->keyframe, posX, posY, zoom);
+    from = 0;
+  }
+  while (from != currentFrame) {
+    from = (from + 1) % currentAnimation->frameCount;
+    display->drawRleFrame(currentAnimation->frames[from].image, posX, posY, zoom);
+  }
+}
+
+void AnimationPlayer::updateAll() {
   unsigned long now = millis();
-  const AnimationFrame& frame = currentAnimation->frames[currentFrame];
+  DisplayDriver* target = nullptr;
+  
+  for (AnimationPlayer* p = first; p; p = p->next) {
+    p->pending = false;
+    if (!p->playing || !p->display) continue;
+    if (p->surfaceEpoch != p->display->getSurfaceEpoch()) {
+      p->shownFrame = -1;  // Cleared or drawn over since
+    }
+    p->pending = p->advance(now) || p->shownFrame < 0;
+    if (p->pending) target = p->display;
+  }
+  if (!target) return;
   
-  // Check if it's time for next frame
-  if (now - lastFrameTime >= frame.delay_ms) {
-    // Draw current frame
-    // For now, we'll use a simple pixel-by-pixel approach
-    // In production, you'd use DMA or optimized methods
-    
-    // Move to next frame
-    currentFrame++;
-    
-    // Check if animation is complete
-    if (currentFrame >= currentAnimation->frameCount) {
-      if (currentAnimation->loop) {
-        currentFrame = 0;  // Loop back
-      } else {
-        stop();  // Stop playing
-        return;
+  target->renderFrame([&]() {
+    // Banded strips start blank: every player on screen goes into each one
+    bool banding = target->getSurfaceId() == 0;
+    for (AnimationPlayer* p = first; p; p = p->next) {
+      if (p->display != target || !p->currentAnimation) continue;
+      if (p->pending || (banding && p->shownFrame >= 0)) {
+        p->draw(banding);
       }
     }
-    
-    lastFrameTime = now;
+  });
+  
+  uint32_t epoch = target->getSurfaceEpoch();
+  for (AnimationPlayer* p = first; p; p = p->next) {
+    if (p->display != target || !p->currentAnimation) continue;
+    if (p->pending) {
+      p->shownFrame = p->currentFrame;
+    }
+    p->surfaceEpoch = epoch;
   }
 }
@@ -1,20 +1,39 @@
 /*
  * Animation Player
  * Plays frame-by-frame animations on the display
+ *
+ * Each player shows one animation at its own position. Frames keep their
+ * delay_ms on a fixed timeline: a frame is due a whole delay after the one
+ * before was due, not after it was drawn, so late updates do not add up to
+ * drift. A player that falls behind skips straight to the frame that is
+ * due (counted as dropped frames). Its deltas still go into the back buffer
+ * or strips and only the result reaches the panel, so dropping only saves
+ * SPI time in buffered render modes: drawing direct (DISPLAY_RENDER_DIRECT,
+ * or no buffer memory) pushes every skipped delta too, and dropping just
+ * keeps the timeline.
+ *
+ * update() serves every player at once: all due frames are drawn in one
+ * display frame and go out in one DMA flush. Players must not overlap.
  */
 
 #ifndef ANIMATION_PLAYER_H
 #define ANIMATION_PLAYER_H
 
 #include <Arduino.h>
-#include "DisplayDriver.h"
+#include "RleFrame.h"
+
+class AssetPack;
+class DisplayDriver;
+
+#define ANIMATION_LOOPS_DEFAULT  0xFF  // Animation::loop: forever, or once
+#define ANIMATION_LOOPS_FOREVER  0
+#define ANIMATION_MAX_CATCHUP_MS 1000  // Longest stall playback skips ahead over
+#define ANIMATION_FPS_WINDOW_MS  1000
 
 // Animation frame structure
 struct AnimationFrame {
-  const uint16_t* data;  // RGB565 pixel data
-  uint16_t width;
-  uint16_t height;
-  uint16_t delay_ms;     // Delay before next frame
+  const RleFrame* image;  // Delta from the previous frame (tools/rle_frames.py)
+  uint16_t delay_ms;      // Delay before next frame
 };
 
 // Animation structure
@@ -22,31 +41,67 @@ struct Animation {
   const AnimationFrame* frames;
   uint8_t frameCount;
   bool loop;
+  const RleFrame* keyframe;  // First frame in full, the deltas start from it
+};
+
+struct AnimationStats {
+  uint32_t frames;    // Frames drawn
+  uint32_t dropped;   // Frames skipped to stay on time
+  uint16_t fpsX10;    // Frames drawn per second over the last window, x10
 };
 
 class AnimationPlayer {
 public:
   AnimationPlayer();
+  ~AnimationPlayer();
   
-  void init(DisplayDriver* disp);
+  // assets: where play() by name looks animations up
+  void init(DisplayDriver* disp, AssetPack* assets = nullptr);
   
-  // Play animation
-  void play(const Animation* anim, int16_t x, int16_t y);
+  // Play animation with its top-left corner at (x, y), scaled by zoom.
+  // loops: passes before stopping on the last frame (0: forever)
+  void play(const Animation* anim, int16_t x, int16_t y, uint8_t zoom = 1,
+            uint8_t loops = ANIMATION_LOOPS_DEFAULT);
+  // Play an animation from the asset pack; false if it has none by that name
+  bool play(const char* name, int16_t x, int16_t y, uint8_t zoom = 1,
+            uint8_t loops = ANIMATION_LOOPS_DEFAULT);
   void stop();
   
-  // Update (call in loop)
-  void update();
+  // Update every playing instance (call in loop)
+  void update() { updateAll(); }
+  static void updateAll();
   
   // Check if playing
   bool isPlaying() const { return playing; }
   
+  const AnimationStats& getStats() const { return stats; }
+  void resetStats();
+  
 private:
+  bool advance(unsigned long now);
+  void draw(bool full);
+  uint16_t frameDelay(uint8_t frame) const { return max<uint16_t>(currentAnimation->frames[frame].delay_ms, 1); }
+  
   DisplayDriver* display;
+  AssetPack* assets;
   const Animation* currentAnimation;
   uint8_t currentFrame;
-  unsigned long lastFrameTime;
+  unsigned long lastFrameTime;  // When currentFrame was due
   int16_t posX, posY;
+  uint8_t zoom;
+  uint8_t loopsLeft;            // Passes still to start after this one (0xFF: forever)
   bool playing;
+  
+  int16_t shownFrame;           // On screen, -1 if nothing (or it was drawn over)
+  uint32_t surfaceEpoch;        // Display epoch shownFrame was drawn on
+  bool pending;                 // Needs drawing in this update
+  
+  AnimationStats stats;
+  uint16_t windowFrames;        // Frames drawn in the current FPS window
+  unsigned long windowStart;
+  
+  AnimationPlayer* next;        // All instances
+  static AnimationPlayer* first;
 };
 
 #endif // ANIMATION_PLAYER_H
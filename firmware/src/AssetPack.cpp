@@ -0,0 +1,190 @@
+/*
+ * Flash Asset Pack Implementation
+ */
+
+#include "AssetPack.h"
+
+// On-flash records (tools/asset_pack.py), little endian and naturally
+// aligned like the C3 itself
+struct PackHeader {
+  char magic[4];
+  uint32_t size;
+  uint16_t count;
+  uint16_t reserved;
+};
+
+struct PackEntry {
+  char name[ASSET_NAME_SIZE];
+  uint32_t offset;
+};
+
+struct PackAnimation {
+  uint16_t width, height;
+  uint16_t frameCount;
+  uint16_t colors;
+  uint8_t bits;
+  uint8_t loop;
+  uint16_t reserved;
+  uint32_t palette;
+};
+
+struct PackFrame {
+  uint16_t x, y;
+  uint16_t width, height;
+  uint16_t delayMs;
+  uint8_t delta;
+  uint8_t reserved;
+  uint32_t data;
+  uint32_t length;  // Bytes of token data
+};
+
+static_assert(sizeof(PackHeader) == 12, "pack header layout");
+static_assert(sizeof(PackEntry) == 28, "pack directory layout");
+static_assert(sizeof(PackAnimation) == 16, "pack animation layout");
+static_assert(sizeof(PackFrame) == 20, "pack frame layout");
+
+AssetPack::AssetPack() :
+  base(nullptr),
+  size(0),
+  count(0),
+  handle(0),
+  loaded(nullptr)
+{
+}
+
+AssetPack::~AssetPack() {
+  while (loaded) {
+    Loaded* next = loaded->next;
+    free(loaded);
+    loaded = next;
+  }
+  if (base) {
+    spi_flash_munmap(handle);
+  }
+}
+
+bool AssetPack::begin(const char* label) {
+  if (base) return true;
+
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                              ESP_PARTITION_SUBTYPE_DATA_SPIFFS, label);
+  if (!partition) {
+    Serial.println("[ASSETS] No asset partition");
+    return false;
+  }
+
+  const void* mapped = nullptr;
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+    Serial.println("[ASSETS] Asset partition mapping failed");
+    return false;
+  }
+
+  const PackHeader* header = (const PackHeader*)mapped;
+  if (memcmp(header->magic, "KAP2", 4) != 0 || header->size > partition->size ||
+      sizeof(PackHeader) + header->count * sizeof(PackEntry) > header->size) {
+    Serial.println("[ASSETS] No asset pack in the partition (tools/asset_pack.py)");
+    spi_flash_munmap(handle);
+    return false;
+  }
+
+  base = (const uint8_t*)mapped;
+  size = header->size;
+  count = header->count;
+  Serial.printf("[ASSETS] %u assets, %u KB\n", count, (unsigned)(size / 1024));
+  return true;
+}
+
+const RleAnimation* AssetPack::findClip(const char* name) {
+  Loaded* asset = load(name);
+  return asset ? &asset->clip : nullptr;
+}
+
+const Animation* AssetPack::findAnimation(const char* name) {
+  Loaded* asset = load(name);
+  return asset ? &asset->animation : nullptr;
+}
+
+AssetPack::Loaded* AssetPack::load(const char* name) {
+  if (!base) return nullptr;
+
+  for (Loaded* asset = loaded; asset; asset = asset->next) {
+    if (strncmp(asset->name, name, ASSET_NAME_SIZE) == 0) return asset;
+  }
+
+  const PackEntry* entries = (const PackEntry*)(base + sizeof(PackHeader));
+  const PackEntry* entry = nullptr;
+  for (uint16_t i = 0; i < count && !entry; i++) {
+    if (strncmp(entries[i].name, name, ASSET_NAME_SIZE) == 0) {
+      entry = &entries[i];
+    }
+  }
+  if (!entry) return nullptr;
+
+  // Records must lie inside the pack and describe something drawable
+  if (entry->offset % 4 != 0 || entry->offset + sizeof(PackAnimation) > size) {
+    Serial.printf("[ASSETS] Asset '%s' is damaged\n", name);
+    return nullptr;
+  }
+  const PackAnimation* anim = (const PackAnimation*)(base + entry->offset);
+  uint32_t records = sizeof(PackAnimation) + (anim->frameCount + 1) * sizeof(PackFrame);
+  if (entry->offset + records > size || anim->frameCount == 0 || anim->frameCount > 255 ||
+      anim->width > RLE_MAX_WIDTH || (anim->bits != 4 && anim->bits != 8) ||
+      anim->colors == 0 || anim->colors > 256 || anim->palette % 2 != 0 ||
+      anim->palette + anim->colors * sizeof(uint16_t) > size) {
+    Serial.printf("[ASSETS] Asset '%s' is damaged\n", name);
+    return nullptr;
+  }
+  const PackFrame* packed = (const PackFrame*)(anim + 1);
+  for (uint16_t i = 0; i <= anim->frameCount; i++) {
+    if (packed[i].data > size || packed[i].length > size - packed[i].data ||
+        packed[i].x + packed[i].width > anim->width || packed[i].y + packed[i].height > anim->height ||
+        (packed[i].width > 0 && (packed[i].data == 0 || packed[i].length == 0))) {
+      Serial.printf("[ASSETS] Asset '%s' is damaged\n", name);
+      return nullptr;
+    }
+  }
+
+  // One block: the entry, keyframe plus deltas, then the frame timings
+  uint16_t frames = anim->frameCount;
+  Loaded* asset = (Loaded*)malloc(sizeof(Loaded) + (frames + 1) * sizeof(RleFrame) +
+                                  frames * sizeof(AnimationFrame));
+  if (!asset) {
+    Serial.printf("[ASSETS] No memory for asset '%s'\n", name);
+    return nullptr;
+  }
+  RleFrame* rle = (RleFrame*)(asset + 1);
+  AnimationFrame* timing = (AnimationFrame*)(rle + frames + 1);
+
+  const uint16_t* palette = (const uint16_t*)(base + anim->palette);
+  for (uint16_t i = 0; i <= frames; i++) {
+    rle[i].x = packed[i].x;
+    rle[i].y = packed[i].y;
+    rle[i].width = packed[i].width;
+    rle[i].height = packed[i].height;
+    rle[i].palette = palette;
+    rle[i].colors = anim->colors;
+    rle[i].bits = anim->bits;
+    rle[i].data = packed[i].data ? base + packed[i].data : nullptr;
+    rle[i].size = packed[i].data ? packed[i].length : 0;
+    rle[i].delta = packed[i].delta != 0;
+  }
+  for (uint16_t i = 0; i < frames; i++) {
+    timing[i].image = &rle[i + 1];
+    timing[i].delay_ms = packed[i + 1].delayMs;
+  }
+
+  strncpy(asset->name, entry->name, ASSET_NAME_SIZE - 1);
+  asset->name[ASSET_NAME_SIZE - 1] = '\0';
+  asset->clip.width = anim->width;
+  asset->clip.height = anim->height;
+  asset->clip.frameCount = frames;
+  asset->clip.keyframe = &rle[0];
+  asset->clip.deltas = &rle[1];
+  asset->animation.frames = timing;
+  asset->animation.frameCount = frames;
+  asset->animation.loop = anim->loop != 0;
+  asset->animation.keyframe = &rle[0];
+  asset->next = loaded;
+  loaded = asset;
+  return asset;
+}
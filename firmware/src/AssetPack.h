@@ -0,0 +1,54 @@
+/*
+ * Flash Asset Pack
+ *
+ * Animations stored in the 1 MB `spiffs` data partition rather than
+ * compiled into the app image, so adding one is a data upload instead of
+ * a firmware rebuild (tools/asset_pack.py writes the image, see its header
+ * for the layout). The partition is mapped with esp_partition_mmap and the
+ * token streams and palettes are decoded straight out of the flash cache;
+ * only the small RleFrame tables that point into it are built in RAM, once
+ * per asset, on its first lookup.
+ */
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "RleFrame.h"
+#include "AnimationPlayer.h"
+
+#define ASSET_NAME_SIZE 24
+
+class AssetPack {
+public:
+  AssetPack();
+  ~AssetPack();
+
+  // Map the partition; false if it is missing or holds no valid pack
+  bool begin(const char* label = "spiffs");
+  bool isMounted() const { return base != nullptr; }
+  uint16_t getAssetCount() const { return count; }
+
+  // Asset by name, or nullptr. Pointers stay valid while the pack is mapped.
+  const RleAnimation* findClip(const char* name);
+  const Animation* findAnimation(const char* name);
+
+private:
+  struct Loaded {
+    char name[ASSET_NAME_SIZE];
+    RleAnimation clip;
+    Animation animation;
+    Loaded* next;
+  };
+
+  Loaded* load(const char* name);
+
+  const uint8_t* base;            // Mapped pack
+  uint32_t size;
+  uint16_t count;
+  spi_flash_mmap_handle_t handle;
+  Loaded* loaded;                 // Assets looked up so far
+};
+
+#endif // ASSET_PACK_H
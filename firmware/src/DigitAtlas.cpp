@@ -0,0 +1,50 @@
+/*
+ * Digit Glyph Atlas Implementation
+ */
+
+#include "DigitAtlas.h"
+
+// The built-in font's code page has no reliable degree sign: draw our own
+static const uint8_t DEGREE_GLYPH[DIGIT_GLYPH_HEIGHT] = {
+  0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00
+};
+
+void DigitAtlas::build(lgfx::LovyanGFX* parent) {
+  LGFX_Sprite scratch(parent);
+  scratch.setColorDepth(16);
+  scratch.setPsram(false);
+  if (!scratch.createSprite(DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT)) {
+    Serial.println("[DISPLAY] Digit atlas scratch allocation failed - using font path");
+    return;
+  }
+  scratch.setFont(&lgfx::fonts::Font0);
+  scratch.setTextSize(1);
+  scratch.setTextColor(0xFFFF);
+
+  for (uint8_t i = 0; i < DIGIT_ATLAS_COUNT; i++) {
+    char c = DIGIT_ATLAS_CHARS[i];
+    if (c == '\xB0') {
+      memcpy(masks[i], DEGREE_GLYPH, sizeof(DEGREE_GLYPH));
+      continue;
+    }
+
+    scratch.fillSprite(0);
+    scratch.drawChar((uint8_t)c, 0, 0);
+    for (uint8_t y = 0; y < DIGIT_GLYPH_HEIGHT; y++) {
+      uint8_t bits = 0;
+      for (uint8_t x = 0; x < DIGIT_GLYPH_WIDTH; x++) {
+        if (scratch.readPixel(x, y)) bits |= 1 << x;
+      }
+      masks[i][y] = bits;
+    }
+  }
+
+  scratch.deleteSprite();
+  ready = true;
+}
+
+int8_t DigitAtlas::indexOf(char c) {
+  if (c == '\0') return -1;
+  const char* p = strchr(DIGIT_ATLAS_CHARS, c);
+  return p ? (int8_t)(p - DIGIT_ATLAS_CHARS) : -1;
+}
@@ -0,0 +1,45 @@
+/*
+ * Digit Glyph Atlas
+ *
+ * The numeric readouts (progress, temperatures, ETA, Z) use a handful of
+ * characters. Their 6x8 bitmaps are rasterized once from the built-in font at
+ * startup, so numbers can be blitted as whole cells at any integer size
+ * instead of going through LovyanGFX's per-character font path.
+ */
+
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#define LGFX_USE_V1
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+
+#define DIGIT_GLYPH_WIDTH     6   // Built-in font cell, including spacing
+#define DIGIT_GLYPH_HEIGHT    8
+#define DIGIT_ATLAS_MAX_SIZE  3   // Largest text size a cell is blitted at
+
+// Characters in the atlas; '\xB0' is the degree sign (UTF-8 "°" also works)
+#define DIGIT_ATLAS_CHARS "0123456789%/:hms.-C \xB0"
+#define DIGIT_ATLAS_COUNT (sizeof(DIGIT_ATLAS_CHARS) - 1)
+
+class DigitAtlas {
+public:
+  DigitAtlas() : ready(false) {}
+
+  // Rasterize the glyphs with the default font (needs a display to create
+  // a scratch sprite with)
+  void build(lgfx::LovyanGFX* parent);
+  bool isReady() const { return ready; }
+
+  // Atlas index of a character, or -1
+  static int8_t indexOf(char c);
+
+  // Row y of a glyph; bit x set = pixel x is ink
+  uint8_t row(uint8_t glyph, uint8_t y) const { return masks[glyph][y]; }
+
+private:
+  uint8_t masks[DIGIT_ATLAS_COUNT][DIGIT_GLYPH_HEIGHT];
+  bool ready;
+};
+
+#endif // DIGIT_ATLAS_H
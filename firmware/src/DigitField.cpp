@@ -0,0 +1,61 @@
+/*
+ * Digit Field Implementation
+ */
+
+#include "DigitField.h"
+
+DigitField::DigitField(int16_t centerX, int16_t y, uint8_t cells, uint8_t size, const char* label) :
+  centerX(centerX),
+  y(y),
+  cells(min<uint8_t>(cells, DIGIT_FIELD_MAX_CELLS)),
+  size(size),
+  label(label),
+  shownColor(0),
+  shownBg(0),
+  surface(0)
+{
+}
+
+void DigitField::draw(DisplayDriver* display, const char* text, uint16_t color) {
+  // Collapse UTF-8 "°" (C2 B0) to the atlas' single-byte degree sign
+  char glyphs[DIGIT_FIELD_MAX_CELLS];
+  uint8_t len = 0;
+  for (const char* p = text; *p && len < cells; p++) {
+    if (*p == '\xC2') continue;
+    glyphs[len++] = *p;
+  }
+
+  // Center the text in the cells, pad with blanks
+  char next[DIGIT_FIELD_MAX_CELLS];
+  uint8_t pad = (cells - len) / 2;
+  for (uint8_t i = 0; i < cells; i++) {
+    next[i] = (i >= pad && i < pad + len) ? glyphs[i - pad] : ' ';
+  }
+
+  uint16_t bg = display->getThemeColors().bg;
+  uint32_t current = display->getSurfaceId();
+  bool full = current == 0 || current != surface || color != shownColor || bg != shownBg;
+
+  int16_t cellWidth = DIGIT_GLYPH_WIDTH * size;
+  int16_t labelWidth = label ? strlen(label) * cellWidth : 0;
+  int16_t x = centerX - (labelWidth + cells * cellWidth) / 2;
+
+  if (full && label) {
+    display->setTextColor(color);
+    display->setTextSize(size);
+    display->setCursor(x, y);
+    display->print(label);
+  }
+  x += labelWidth;
+
+  for (uint8_t i = 0; i < cells; i++, x += cellWidth) {
+    if (full || next[i] != shown[i]) {
+      display->drawDigitCell(x, y, next[i], size, color, bg);
+      shown[i] = next[i];
+    }
+  }
+
+  shownColor = color;
+  shownBg = bg;
+  surface = current;
+}
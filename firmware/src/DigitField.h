@@ -0,0 +1,44 @@
+/*
+ * Digit Field
+ *
+ * A fixed-width numeric readout made of digit-atlas cells. The field
+ * remembers what each cell shows on the current surface and repaints only
+ * the cells whose glyph changed, so a temperature ticking from 214 to 215
+ * costs one cell instead of re-rendering the whole string.
+ */
+
+#ifndef DIGIT_FIELD_H
+#define DIGIT_FIELD_H
+
+#include <Arduino.h>
+#include "DisplayDriver.h"
+
+#define DIGIT_FIELD_MAX_CELLS 12
+
+class DigitField {
+public:
+  // The field (and an optional static label in front of it, drawn with the
+  // regular font) is centered on centerX; y is the top edge
+  DigitField(int16_t centerX, int16_t y, uint8_t cells, uint8_t size, const char* label = nullptr);
+
+  // Show text centered in the cells (longer text is cut off)
+  void draw(DisplayDriver* display, const char* text, uint16_t color);
+
+  // Force a full repaint on the next draw()
+  void invalidate() { surface = 0; }
+
+private:
+  int16_t centerX;
+  int16_t y;
+  uint8_t cells;
+  uint8_t size;
+  const char* label;
+
+  // What is on screen
+  char shown[DIGIT_FIELD_MAX_CELLS];
+  uint16_t shownColor;
+  uint16_t shownBg;
+  uint32_t surface;
+};
+
+#endif // DIGIT_FIELD_H
@@ -3,9 +3,70 @@
  */
 
 #include "DisplayDriver.h"
-#include <math.h>
+#include "FixedMath.h"
+#include "RoundMask.h"
+#include "PixelKernels.h"
+#include "FrameScheduler.h"
 
-DisplayDriver::DisplayDriver() : currentBrightness(255) {
+static_assert(ROUND_MASK_SIZE == SCREEN_WIDTH && ROUND_MASK_SIZE == SCREEN_HEIGHT, "Round mask must match the panel");
+
+void DirtyRect::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+  
+  // Clip to the panel
+  int16_t ax0 = max<int16_t>(x, 0);
+  int16_t ay0 = max<int16_t>(y, 0);
+  int16_t ax1 = min<int16_t>(x + w - 1, SCREEN_WIDTH - 1);
+  int16_t ay1 = min<int16_t>(y + h - 1, SCREEN_HEIGHT - 1);
+  if (ax1 < ax0 || ay1 < ay0) return;
+  
+  x0 = min(x0, ax0);
+  y0 = min(y0, ay0);
+  x1 = max(x1, ax1);
+  y1 = max(y1, ay1);
+}
+
+DisplayDriver::DisplayDriver() :
+  canvas(&tft),
+  palette(nullptr),
+  indexLines(nullptr),
+  wireLines(nullptr),
+  wireFormat(DISPLAY_WIRE_RGB565),
+  wirePacked(false),
+  flushInFlight(false),
+  wireNext(0),
+  gfx(&tft),
+  backBufferReady(false),
+  bandsReady(false),
+  frameDepth(0),
+  bandTop(0),
+  bandBottom(SCREEN_HEIGHT),
+  bandContentMask(0xFFFFFFFF),
+  transitionActive(false),
+  transitionOwnStrips(false),
+  transitionType(TRANSITION_CROSSFADE),
+  transitionDuration(TRANSITION_DURATION_MS),
+  transitionStart(0),
+  maskSavedBytes(0),
+  wireSavedBytes(0),
+  surfaceEpoch(1),
+  surfaceBlank(false),
+  blankColor(COLOR_BLACK),
+  currentBrightness(255),
+  textColor(COLOR_WHITE),
+  overlayPush(0) {
+  lastRing.surface = 0;
+  memset(&drawStats, 0, sizeof(drawStats));
+  for (Overlay& o : overlays) {
+    o.saved = nullptr;
+    o.active = false;
+  }
+  bands[0].setPsram(false);
+  bands[1].setPsram(false);
+  targets[0] = &tft;
+  targets[1] = &canvas;
+  targets[2] = &bands[0];
+  targets[3] = &bands[1];
 }
 
 void DisplayDriver::init() {
@@ -15,18 +76,85 @@ void DisplayDriver::init() {
   ledcAttachPin(3, 0);    // Attach GPIO3 to channel 0
   
   tft.init();
-  
-  // Set display rotation based on mounting angle
-  // DISPLAY_ROTATION_ANGLE = -60° (counter-clockwise)
-  // Testing hardware rotation: 90° (1) = +90°, other direction
-  // LovyanGFX rotation values: 0=0°, 1=90°, 2=180°, 3=270°
-  tft.setRotation(1);  // 90° clockwise (testing for -60° target)
-  
   tft.fillScreen(COLOR_BLACK);
   setBrightness(200);  // This will now use PWM
   
+#if DISPLAY_RENDER_MODE == DISPLAY_RENDER_FULLFRAME
+  // Back buffer must live in internal DMA-capable RAM (no PSRAM on the C3)
+  canvas.setColorDepth(16);
+  canvas.setPsram(false);
+  backBufferReady = canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr;
+  if (backBufferReady) {
+    canvas.fillSprite(COLOR_BLACK);
+  } else {
+    Serial.println("[DISPLAY] Back buffer allocation failed - drawing direct");
+  }
+#elif DISPLAY_RENDER_MODE == DISPLAY_RENDER_INDEXED
+  // LovyanGFX's palette only puts the sprite in index mode (colors are
+  // stored as given); flushes expand it through IndexedPalette instead
+  canvas.setColorDepth(8);
+  canvas.setPsram(false);
+  backBufferReady = canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr && canvas.createPalette();
+  if (backBufferReady) {
+    palette = new IndexedPalette();
+    indexLines = (uint16_t*)malloc(2 * SCREEN_WIDTH * sizeof(uint16_t));
+    backBufferReady = palette && indexLines;
+  }
+  if (!backBufferReady) {
+    delete palette;
+    palette = nullptr;
+    free(indexLines);
+    indexLines = nullptr;
+    canvas.deleteSprite();
+    Serial.println("[DISPLAY] Indexed back buffer allocation failed - drawing direct");
+  }
+#elif DISPLAY_RENDER_MODE == DISPLAY_RENDER_BANDED
+  bandsReady = true;
+  for (int i = 0; i < 2; i++) {
+    bands[i].setColorDepth(16);
+    bandsReady = bandsReady && bands[i].createSprite(SCREEN_WIDTH, DISPLAY_BAND_HEIGHT) != nullptr;
+  }
+  if (!bandsReady) {
+    bands[0].deleteSprite();
+    bands[1].deleteSprite();
+    Serial.println("[DISPLAY] Band buffer allocation failed - drawing direct");
+  }
+#endif
+  
+  // Mounting angle: resample the back buffer at flush time if enabled, or
+  // settle for the nearest quarter turn
+#if DISPLAY_ROTATION_RESAMPLE
+  if (backBufferReady && rotation.build(DISPLAY_ROTATION_ANGLE)) {
+    if (!indexLines) {
+      indexLines = (uint16_t*)malloc(2 * SCREEN_WIDTH * sizeof(uint16_t));
+    }
+    if (indexLines) {
+      gfx = &canvas;  // Every draw lands in the back buffer, upright
+    } else {
+      rotation.build(0);
+      Serial.println("[DISPLAY] Rotation line buffer allocation failed - quarter-turn rotation");
+    }
+  }
+#endif
+  if (!rotation.isReady()) {
+    tft.setRotation(DISPLAY_ROTATION_QUARTER);
+  }
+  
+  if (!backBufferReady && !bandsReady && !drawList.begin()) {
+    Serial.println("[DISPLAY] Draw list allocation failed - one transaction per primitive");
+  }
+  
   // Initialize theme system
   themeManager.init();
+  if (palette) {
+    palette->build(themeManager.getColors());
+    canvas.fillSprite(palette->indexOf(COLOR_BLACK));
+  }
+  
+  digitAtlas.build(&tft);
+#if SMOOTH_FONT
+  smoothFont.begin(&tft);
+#endif
 }
 
 void DisplayDriver::setBrightness(uint8_t brightness) {
@@ -36,94 +164,856 @@ void DisplayDriver::setBrightness(uint8_t brightness) {
   ledcWrite(0, brightness);  // Channel 0, value 0-255
 }
 
+// Indexed mode: the back buffer keeps its indices and shows the new theme
+// once flushed. Other modes repaint on the next draw as before.
+void DisplayDriver::applyTheme() {
+  if (!palette) return;
+  palette->build(themeManager.getColors());
+  dirty.add(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  if (frameDepth == 0) {
+    flushDirty();
+  }
+}
+
+void DisplayDriver::beginFrame() {
+  // Nested frames (e.g. an animation that reuses a screen) share one flush
+  if (frameDepth++ > 0) return;
+  finishFlush();  // The back buffer may still be going out
+  if (backBufferReady) {
+    gfx = &canvas;
+  } else {
+    // Straight to the panel: the whole frame is one transaction
+    tft.startWrite();
+  }
+}
+
+void DisplayDriver::endFrame() {
+  if (frameDepth == 0 || --frameDepth > 0) return;
+  drawStats.frames++;
+  if (gfx == &canvas) {
+    flushDirty();
+    if (!rotation.isReady()) gfx = &tft;
+  } else {
+    replayCommands();
+    tft.endWrite();
+    drawStats.transactions++;
+  }
+}
+
+void DisplayDriver::flush() {
+  if (frameDepth == 0 && gfx == &canvas) {
+    flushDirty();
+  }
+}
+
+const DrawStats& DisplayDriver::getDrawStats() {
+  drawStats.merged = drawList.getMerged();
+  return drawStats;
+}
+
+void DisplayDriver::resetDrawStats() {
+  memset(&drawStats, 0, sizeof(drawStats));
+  drawList.resetStats();
+}
+
+// Queue a primitive for the frame's transaction instead of drawing it now.
+// Coordinates are screen coordinates and color is final (the panel is the
+// target). Returns false if not recording.
+bool DisplayDriver::record(DrawOp op, int16_t a, int16_t b, int16_t c, int16_t d, int16_t e, uint16_t color) {
+  if (!recording()) return false;
+  drawList.add(&tft, op, a, b, c, d, e, color);
+  return true;
+}
+
+// Draw what was recorded so far; primitives that reach the panel some
+// other way (text, images) call this first to keep the drawing order
+void DisplayDriver::replayCommands() {
+  if (!drawList.isEmpty()) {
+    finishFlush();
+    drawList.replay(&tft);
+  }
+}
+
+void DisplayDriver::renderFrame(const std::function<void()>& draw) {
+  if (bandsReady && frameDepth == 0) {
+    renderBands(draw);
+  } else {
+    beginFrame();
+    draw();
+    endFrame();
+  }
+}
+
+// Point drawing at `strip` as band `band`, cleared to the background
+void DisplayDriver::startBand(LGFX_Sprite& strip, int band) {
+  uint16_t bg = getThemeColors().bg;
+  gfx = &strip;
+  bandTop = band * DISPLAY_BAND_HEIGHT;
+  bandBottom = min(bandTop + DISPLAY_BAND_HEIGHT, SCREEN_HEIGHT);
+  dirty.clear();
+  
+  strip.fillSprite(bg);
+  surfaceBlank = true;
+  blankColor = bg;
+}
+
+// Back to the panel after a banded pass
+void DisplayDriver::endBands() {
+  surfaceBlank = false;
+  dirty.clear();
+  gfx = &tft;
+  bandTop = 0;
+  bandBottom = SCREEN_HEIGHT;
+}
+
+void DisplayDriver::renderBands(const std::function<void()>& draw) {
+  uint32_t contentMask = 0;
+  bool pushedPrevious = false;
+  
+  finishFlush();  // The strips may still be going out
+  frameDepth++;
+  tft.startWrite();
+  beginWire();
+  for (int band = 0; band < DISPLAY_BAND_COUNT; band++) {
+    // This strip was last pushed two bands ago, and its final DMA may still
+    // be running. Only a push of the other strip since then has waited for
+    // it; if that band was skipped, wait here before drawing over it.
+    LGFX_Sprite& strip = bands[band & 1];
+    if (!pushedPrevious) {
+      tft.waitDMA();
+    }
+    startBand(strip, band);
+    draw();
+    
+    // Push strips with content, and strips that need their old content erased
+    uint32_t bit = 1UL << band;
+    if (!dirty.isEmpty()) {
+      contentMask |= bit;
+    }
+    pushedPrevious = ((contentMask | bandContentMask) & bit) != 0;
+    if (pushedPrevious) {
+      pushMasked((const lgfx::swap565_t*)strip.getBuffer(), bandTop,
+                 0, bandTop, SCREEN_WIDTH - 1, bandBottom - 1);
+    }
+  }
+  endFlush();
+  drawStats.frames++;
+  drawStats.transactions++;
+  
+  bandContentMask = contentMask;
+  endBands();
+  frameDepth--;
+}
+
+bool DisplayDriver::beginTransition(TransitionType type, uint16_t durationMs) {
+  // Needs the outgoing frame (back buffer, or a banded redraw) and two
+  // strips. Strips go out unrotated, so not on a resampled panel.
+  if (transitionActive || frameDepth > 0 || (!backBufferReady && !bandsReady) || rotation.isReady()) {
+    return false;
+  }
+  finishFlush();
+  transitionOwnStrips = !bandsReady;
+  if (transitionOwnStrips) {
+    for (int i = 0; i < 2; i++) {
+      bands[i].setColorDepth(16);
+      if (!bands[i].createSprite(SCREEN_WIDTH, DISPLAY_BAND_HEIGHT)) {
+        bands[0].deleteSprite();
+        return false;
+      }
+    }
+  }
+  
+  transitionActive = true;
+  transitionType = type;
+  transitionDuration = max<uint16_t>(durationMs, 1);
+  transitionStart = millis();
+  return true;
+}
+
+bool DisplayDriver::transitionStep(const std::function<void()>& from, const std::function<void()>& to,
+                                   bool skipToEnd) {
+  if (!transitionActive) return false;
+  
+  // A slow frame just skips ahead
+  uint32_t elapsed = millis() - transitionStart;
+  if (!skipToEnd && elapsed < transitionDuration) {
+    transitionFrame(transitionType, transitionEase(elapsed * 255 / transitionDuration), from, to);
+    return true;
+  }
+  // Always end on the complete new screen
+  transitionFrame(transitionType, 255, from, to);
+  transitionActive = false;
+  
+  if (transitionOwnStrips) {
+    bands[0].deleteSprite();
+    bands[1].deleteSprite();
+  }
+  
+  // The panel shows `to` on the background. Start the back buffer from the
+  // same background so the next (partial) flush matches it.
+  bandContentMask = 0xFFFFFFFF;
+  if (backBufferReady) {
+    uint16_t bg = getThemeColors().bg;
+    canvas.fillSprite(ink(&canvas, bg));
+    surfaceEpoch++;
+    surfaceBlank = true;
+    blankColor = bg;
+    overlayPush |= activeOverlays();  // Transition frames did not show them
+  }
+  return false;
+}
+
+// One transition frame, strip by strip
+void DisplayDriver::transitionFrame(TransitionType type, uint8_t progress,
+                                    const std::function<void()>& from, const std::function<void()>& to) {
+  frameDepth++;
+  tft.startWrite();
+  beginWire();
+  for (int band = 0; band < DISPLAY_BAND_COUNT; band++) {
+    // bands[1] carries the result and may still be on the wire: fill
+    // bands[0] with the outgoing screen first
+    LGFX_Sprite& outgoing = bands[0];
+    LGFX_Sprite& incoming = bands[1];
+    startBand(outgoing, band);
+    uint16_t* fromRows = (uint16_t*)outgoing.getBuffer();
+    if (backBufferReady) {
+      // Still in the back buffer
+      for (int16_t y = bandTop; y < bandBottom; y++) {
+        uint16_t* row = fromRows + (y - bandTop) * SCREEN_WIDTH;
+        if (palette) {
+          const uint8_t* src = (const uint8_t*)canvas.getBuffer() + y * SCREEN_WIDTH;
+          const uint16_t* lut = palette->getSwapped();
+          for (int16_t x = 0; x < SCREEN_WIDTH; x++) row[x] = lut[src[x]];
+        } else {
+          memcpy(row, (const uint16_t*)canvas.getBuffer() + y * SCREEN_WIDTH, SCREEN_WIDTH * sizeof(uint16_t));
+        }
+      }
+    } else {
+      from();
+    }
+    
+    tft.waitDMA();
+    startBand(incoming, band);
+    to();
+    
+    uint16_t* toRows = (uint16_t*)incoming.getBuffer();
+    for (int16_t y = bandTop; y < bandBottom; y++) {
+      int32_t offset = (int32_t)(y - bandTop) * SCREEN_WIDTH;
+      transitionRow(type, progress, y, toRows + offset, fromRows + offset, toRows + offset);
+    }
+    pushMasked((const lgfx::swap565_t*)toRows, bandTop, 0, bandTop, SCREEN_WIDTH - 1, bandBottom - 1);
+  }
+  endWire();
+  tft.endWrite();
+  drawStats.frames++;
+  drawStats.transactions++;
+  endBands();
+  frameDepth--;
+}
+
+// Records the screen-space bounds of a primitive that is about to be drawn.
+// Returns false if it lies entirely outside the strip being rasterized.
+bool DisplayDriver::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  surfaceBlank = false;
+  if (frameDepth > 0 && bandTop == 0) {
+    drawStats.calls++;  // Once per primitive, not once per strip
+  }
+  if (gfx == &canvas) {
+    dirty.add(x, y, w, h);
+  } else if (isBanding()) {
+    int16_t y0 = max(y, bandTop);
+    int16_t y1 = min<int16_t>(y + h, bandBottom);
+    if (y1 <= y0) return false;
+    dirty.add(x, y0, w, y1 - y0);
+  } else {
+    // Direct panel drawing may leave pixels a banded frame does not know about
+    finishFlush();
+    bandContentMask = 0xFFFFFFFF;
+  }
+  return true;
+}
+
+void DisplayDriver::markTextDirty(int16_t x, int16_t y, const char* text) {
+  int16_t h = gfx->fontHeight();
+  int16_t endY = gfx->getCursorY() + bandTop;
+  if (endY != y) {
+    // Text wrapped or ended with a newline - dirty every row it touched
+    markDirty(0, y, SCREEN_WIDTH, endY - y + h);
+  } else {
+    markDirty(x, y, textLayout.measure(gfx, text).width, h);
+  }
+}
+
+void DisplayDriver::flushDirty() {
+  finishFlush();
+  if (dirty.isEmpty() && !overlayPush) return;
+  
+  bool composed = composeOverlays();
+  uint8_t spanLayers = overlayPush;
+  if (rotation.isReady()) {
+    // Rotated rows cut across the overlay spans: push their boxes with the rest
+    for (uint8_t layer = 0; layer < DISPLAY_OVERLAY_LAYERS; layer++) {
+      const Overlay& o = overlays[layer];
+      if (!(overlayPush & (1 << layer))) continue;
+      dirty.add(o.x0, o.y0, o.x1 - o.x0 + 1, o.y1 - o.y0 + 1);
+    }
+    spanLayers = 0;
+  }
+  tft.startWrite();
+  beginWire();
+  if (!dirty.isEmpty()) {
+    pushCanvas(dirty.x0, dirty.y0, dirty.x1, dirty.y1);
+  }
+  for (uint8_t layer = 0; layer < DISPLAY_OVERLAY_LAYERS; layer++) {
+    if (!(spanLayers & (1 << layer))) continue;
+    forEachOverlaySpan(overlays[layer], [&](int16_t y, int16_t x0, int16_t x1) {
+      pushCanvas(x0, y, x1, y);
+    });
+  }
+  drawStats.transactions++;
+  if (composed) {
+    // Putting the saved pixels back has to wait for the DMA anyway
+    endWire();
+    tft.endWrite();
+    restoreOverlays();
+  } else {
+    endFlush();
+  }
+  
+  overlayPush = 0;
+  dirty.clear();
+}
+
+// Close a flush started with tft.startWrite() and beginWire(). Async, the
+// transaction stays open with the last rows on the wire; whatever next
+// needs the buffers or the bus calls finishFlush() first.
+void DisplayDriver::endFlush() {
+#if DISPLAY_ASYNC_FLUSH
+  flushInFlight = true;
+#else
+  endWire();
+  tft.endWrite();
+#endif
+}
+
+void DisplayDriver::finishFlush() {
+  if (!flushInFlight) return;
+  flushInFlight = false;
+  
+  uint32_t start = micros();
+  tft.waitDMA();
+  drawStats.flushWaitUs += micros() - start;
+  endWire();
+  tft.endWrite();
+}
+
+// Sprite memory holds byte-swapped RGB565, which is what the panel expects
+void DisplayDriver::pushCanvas(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  if (rotation.isReady()) {
+    pushRotated(x0, y0, x1, y1);
+  } else if (palette) {
+    pushIndexed(x0, y0, x1, y1);
+  } else {
+    pushMasked((const lgfx::swap565_t*)canvas.getBuffer(), 0, x0, y0, x1, y1);
+  }
+}
+
+bool DisplayDriver::showOverlay(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                                const std::function<void()>& draw) {
+  return placeOverlay(layer, x, y, x + w - 1, y + h - 1, 0, 0, 0, 0, draw);
+}
+
+bool DisplayDriver::showRingOverlay(uint8_t layer, int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner,
+                                    const std::function<void()>& draw, int16_t maxY) {
+  return placeOverlay(layer, cx - rOuter, cy - rOuter, cx + rOuter, min<int16_t>(cy + rOuter, maxY),
+                      cx, cy, rOuter, rInner, draw);
+}
+
+bool DisplayDriver::placeOverlay(uint8_t layer, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner,
+                                 const std::function<void()>& draw) {
+  if (!backBufferReady || layer >= DISPLAY_OVERLAY_LAYERS) return false;
+  x0 = max<int16_t>(x0, 0);
+  y0 = max<int16_t>(y0, 0);
+  x1 = min<int16_t>(x1, SCREEN_WIDTH - 1);
+  y1 = min<int16_t>(y1, SCREEN_HEIGHT - 1);
+  if (x1 < x0 || y1 < y0) return false;
+  
+  Overlay& o = overlays[layer];
+  uint8_t bit = 1 << layer;
+  bool moved = !o.active || o.x0 != x0 || o.y0 != y0 || o.x1 != x1 || o.y1 != y1 ||
+               o.cx != cx || o.cy != cy || o.rOuter != rOuter || o.rInner != rInner;
+  if (moved) {
+    // Whatever the old shape covered comes back from the back buffer
+    if (o.active || (overlayPush & bit)) {
+      dirty.add(o.x0, o.y0, o.x1 - o.x0 + 1, o.y1 - o.y0 + 1);
+    }
+    free(o.saved);
+    o.saved = nullptr;
+    o.active = false;
+    overlayPush &= ~bit;
+    
+    o.x0 = x0;
+    o.y0 = y0;
+    o.x1 = x1;
+    o.y1 = y1;
+    o.cx = cx;
+    o.cy = cy;
+    o.rOuter = rOuter;
+    o.rInner = rInner;
+    size_t pixels = 0;
+    forEachOverlaySpan(o, [&](int16_t, int16_t sx0, int16_t sx1) { pixels += sx1 - sx0 + 1; });
+    o.saved = (uint8_t*)malloc(max<size_t>(pixels * (palette ? 1 : 2), 1));
+    if (!o.saved) {
+      Serial.println("[DISPLAY] Overlay save buffer allocation failed");
+      if (frameDepth == 0) flushDirty();
+      return false;
+    }
+  }
+  
+  o.draw = draw;
+  o.active = true;
+  overlayPush |= bit;
+  if (frameDepth == 0) {
+    flushDirty();
+  }
+  return true;
+}
+
+void DisplayDriver::hideOverlay(uint8_t layer) {
+  if (!hasOverlay(layer)) return;
+  Overlay& o = overlays[layer];
+  o.active = false;
+  o.draw = nullptr;
+  free(o.saved);
+  o.saved = nullptr;
+  
+  // The shape stays set until this push has put the frame's pixels back
+  overlayPush |= 1 << layer;
+  if (frameDepth == 0) {
+    flushDirty();
+  }
+}
+
+// Rows of an overlay's shape as spans x0..x1, clipped to the glass. Ring
+// rows are split around the hole; no pixel is visited twice.
+template <typename SpanOp>
+void DisplayDriver::forEachOverlaySpan(const Overlay& o, SpanOp span) {
+  for (int16_t y = o.y0; y <= o.y1; y++) {
+    int16_t x0 = o.x0, x1 = o.x1;
+    if (!roundMaskClip(y, x0, x1)) continue;
+    if (o.rOuter == 0) {
+      span(y, x0, x1);
+      continue;
+    }
+    
+    int32_t dy = y - o.cy;
+    int32_t outer = (int32_t)o.rOuter * o.rOuter - dy * dy;
+    if (outer < 0) continue;
+    int16_t half = fxSqrt(outer);
+    x0 = max<int16_t>(x0, o.cx - half);
+    x1 = min<int16_t>(x1, o.cx + half);
+    if (x1 < x0) continue;
+    
+    int32_t inner = (int32_t)o.rInner * o.rInner - dy * dy;
+    if (inner <= 0) {
+      span(y, x0, x1);
+      continue;
+    }
+    int16_t hole = fxSqrt(inner);
+    if (x0 <= o.cx - hole) span(y, x0, min<int16_t>(x1, o.cx - hole));
+    if (o.cx + hole <= x1) span(y, max<int16_t>(x0, o.cx + hole), x1);
+  }
+}
+
+// Back buffer pixels under an overlay to its save buffer, or back
+void DisplayDriver::copyOverlay(const Overlay& o, bool save) {
+  uint8_t bytes = palette ? 1 : 2;
+  uint8_t* buf = (uint8_t*)canvas.getBuffer();
+  uint8_t* saved = o.saved;
+  forEachOverlaySpan(o, [&](int16_t y, int16_t x0, int16_t x1) {
+    uint8_t* px = buf + ((int32_t)y * SCREEN_WIDTH + x0) * bytes;
+    size_t count = (x1 - x0 + 1) * bytes;
+    if (save) {
+      memcpy(saved, px, count);
+    } else {
+      memcpy(px, saved, count);
+    }
+    saved += count;
+  });
+}
+
+uint8_t DisplayDriver::activeOverlays() const {
+  uint8_t mask = 0;
+  for (uint8_t layer = 0; layer < DISPLAY_OVERLAY_LAYERS; layer++) {
+    if (overlays[layer].active) mask |= 1 << layer;
+  }
+  return mask;
+}
+
+// Draw the overlays into the back buffer for a flush that touches them.
+// Returns true if restoreOverlays() must follow the flush.
+bool DisplayDriver::composeOverlays() {
+  bool touched = overlayPush != 0;
+  for (const Overlay& o : overlays) {
+    touched = touched || (o.active && !dirty.isEmpty() &&
+                          o.x0 <= dirty.x1 && dirty.x0 <= o.x1 && o.y0 <= dirty.y1 && dirty.y0 <= o.y1);
+  }
+  if (!touched || !activeOverlays()) return false;
+  
+  // Save under all of them before drawing any, so overlapping layers all
+  // keep the frame's own pixels
+  for (const Overlay& o : overlays) {
+    if (o.active) copyOverlay(o, true);
+  }
+  
+  // Overlay drawing must not grow the flush or change the surface state
+  DirtyRect frameDirty = dirty;
+  bool blank = surfaceBlank;
+  lgfx::LovyanGFX* target = gfx;
+  gfx = &canvas;
+  for (const Overlay& o : overlays) {
+    if (o.active) o.draw();
+  }
+  gfx = target;
+  surfaceBlank = blank;
+  dirty = frameDirty;
+  return true;
+}
+
+void DisplayDriver::restoreOverlays() {
+  // The flush DMA reads straight from the back buffer
+  tft.waitDMA();
+  for (const Overlay& o : overlays) {
+    if (o.active) copyOverlay(o, false);
+  }
+}
+
+// RGB444 goes out in pixel pairs: grow a span to an even width, on screen
+static void evenSpan(int16_t& x0, int16_t& x1) {
+  if ((x1 - x0) & 1) return;
+  if (x1 < SCREEN_WIDTH - 1) {
+    x1++;
+  } else {
+    x0--;
+  }
+}
+
+// Put the panel in the wire format for a flush. Must be called inside
+// tft.startWrite(), and matched by endWire().
+void DisplayDriver::beginWire() {
+  wirePacked = wireFormat == DISPLAY_WIRE_RGB444;
+  if (!wirePacked) return;
+  
+  tft.waitDMA();
+  tft.writeCommand(GC9A01_CMD_COLMOD);
+  tft.writeData(GC9A01_COLMOD_12BIT);
+}
+
+// Back to 16 bits for LovyanGFX once the last packed row is out
+void DisplayDriver::endWire() {
+  if (!wirePacked) return;
+  
+  tft.waitDMA();
+  tft.writeCommand(GC9A01_CMD_COLMOD);
+  tft.writeData(GC9A01_COLMOD_16BIT);
+  wirePacked = false;
+}
+
+void DisplayDriver::setWireFormat(uint8_t format) {
+#if DISPLAY_WIRE_444_ENABLE
+  if (format == DISPLAY_WIRE_RGB444 && !wireLines) {
+    wireLines = (uint8_t*)malloc(2 * SCREEN_WIDTH / 2 * 3);
+    if (!wireLines) {
+      Serial.println("[DISPLAY] RGB444 line buffer allocation failed - staying at 16 bits");
+      return;
+    }
+  }
+  wireFormat = format == DISPLAY_WIRE_RGB444 ? DISPLAY_WIRE_RGB444 : DISPLAY_WIRE_RGB565;
+#else
+  (void)format;
+#endif
+}
+
+// DMA one row span of byte-swapped RGB565 (pixels[0] is column x). When the
+// panel is in 12-bit mode w must be even; the span is packed into one of two
+// line buffers, one on the wire while the other is filled.
+void DisplayDriver::pushRow(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) {
+  if (!wirePacked) {
+    tft.pushImageDMA(x, y, w, 1, (const lgfx::swap565_t*)pixels);
+    return;
+  }
+  
+  uint8_t* line = wireLines + wireNext * (SCREEN_WIDTH / 2 * 3);
+  pxPack444(line, pixels, w, true);
+  tft.setWindow(x, y, x + w - 1, y);
+  tft.writeBytes(line, w / 2 * 3, true);
+  wireSavedBytes += w / 2;
+  wireNext ^= 1;
+}
+
+// DMA rows y0..y1 of a SCREEN_WIDTH-stride buffer whose first row is screen
+// row bufTop, each clipped to [x0, x1] and to the glass. Must be called inside
+// tft.startWrite() and beginWire().
+void DisplayDriver::pushMasked(const lgfx::swap565_t* buf, int16_t bufTop, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  int16_t runStart = -1;  // Pending block of full-width rows
+  
+  for (int16_t y = y0; y <= y1 + 1; y++) {
+    int16_t sx0 = x0, sx1 = x1;
+    bool visible = y <= y1 && roundMaskClip(y, sx0, sx1);
+    
+    // Full-width rows are contiguous in the buffer: one transfer for the
+    // block (packed rows go one at a time)
+    if (visible && !wirePacked && sx0 == 0 && sx1 == SCREEN_WIDTH - 1) {
+      if (runStart < 0) runStart = y;
+      continue;
+    }
+    if (runStart >= 0) {
+      tft.pushImageDMA(0, runStart, SCREEN_WIDTH, y - runStart, buf + (runStart - bufTop) * SCREEN_WIDTH);
+      runStart = -1;
+    }
+    if (y > y1) break;
+    
+    maskSavedBytes += (x1 - x0 + 1 - (visible ? sx1 - sx0 + 1 : 0)) * 2;
+    if (visible) {
+      if (wirePacked) evenSpan(sx0, sx1);
+      pushRow(sx0, y, sx1 - sx0 + 1, (const uint16_t*)(buf + (y - bufTop) * SCREEN_WIDTH + sx0));
+    }
+  }
+}
+
+// pushMasked() for the indexed back buffer. Each row is expanded through the
+// palette into one of two line buffers: one is on the wire while the other
+// is filled (starting a transfer waits for the one before it).
+void DisplayDriver::pushIndexed(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  const uint8_t* buf = (const uint8_t*)canvas.getBuffer();
+  const uint16_t* lut = palette->getSwapped();
+  uint8_t next = 0;
+  
+  for (int16_t y = y0; y <= y1; y++) {
+    int16_t sx0 = x0, sx1 = x1;
+    bool visible = roundMaskClip(y, sx0, sx1);
+    maskSavedBytes += (x1 - x0 + 1 - (visible ? sx1 - sx0 + 1 : 0)) * 2;
+    if (!visible) continue;
+    if (wirePacked) evenSpan(sx0, sx1);
+    
+    uint16_t* line = indexLines + next * SCREEN_WIDTH;
+    const uint8_t* src = buf + y * SCREEN_WIDTH;
+    for (int16_t x = sx0; x <= sx1; x++) {
+      line[x - sx0] = lut[src[x]];
+    }
+    pushRow(sx0, y, sx1 - sx0 + 1, line);
+    next ^= 1;
+  }
+}
+
+// pushCanvas() for a panel mounted at an angle. Every panel row that shows
+// part of the source rectangle is resampled (nearest pixel) through the
+// rotation table into one of two line buffers, one on the wire while the
+// other is filled.
+void DisplayDriver::pushRotated(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  const uint16_t* src = (const uint16_t*)canvas.getBuffer();
+  const uint8_t* srcIndexed = (const uint8_t*)canvas.getBuffer();
+  const uint16_t* lut = palette ? palette->getSwapped() : nullptr;
+  int32_t du = rotation.getStepU();
+  int32_t dv = rotation.getStepV();
+  uint8_t next = 0;
+  
+  rotation.destBounds(x0, y0, x1, y1);
+  for (int16_t y = y0; y <= y1; y++) {
+    int16_t sx0 = x0, sx1 = x1;
+    bool visible = roundMaskClip(y, sx0, sx1);
+    maskSavedBytes += (x1 - x0 + 1 - (visible ? sx1 - sx0 + 1 : 0)) * 2;
+    if (!visible) continue;
+    if (wirePacked) evenSpan(sx0, sx1);
+    
+    uint16_t* line = indexLines + next * SCREEN_WIDTH;
+    int32_t u, v;
+    rotation.source(sx0, y, u, v);
+    for (int16_t i = 0; i <= sx1 - sx0; i++, u += du, v += dv) {
+      // Negative coordinates wrap to large unsigned values
+      uint32_t su = (uint32_t)(u >> 16);
+      uint32_t sv = (uint32_t)(v >> 16);
+      if (su >= SCREEN_WIDTH || sv >= SCREEN_HEIGHT) {
+        line[i] = 0;  // Just past the source square at the rim
+        continue;
+      }
+      uint32_t at = sv * SCREEN_WIDTH + su;
+      line[i] = lut ? lut[srcIndexed[at]] : src[at];
+    }
+    pushRow(sx0, y, sx1 - sx0 + 1, line);
+    next ^= 1;
+  }
+}
+
+// Solid fill clipped to the glass and the current strip, one span per row
+void DisplayDriver::fillMasked(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  int16_t yStart = max<int16_t>(max<int16_t>(y, 0), bandTop);
+  int16_t yEnd = min<int16_t>(min<int16_t>(y + h, SCREEN_HEIGHT), bandBottom);
+  int16_t cx0 = max<int16_t>(x, 0);
+  int16_t cx1 = min<int16_t>(x + w - 1, SCREEN_WIDTH - 1);
+  if (cx0 > cx1) return;
+  
+  color = ink(color);
+  gfx->startWrite();
+  for (int16_t py = yStart; py < yEnd; py++) {
+    int16_t sx0 = cx0, sx1 = cx1;
+    bool visible = roundMaskClip(py, sx0, sx1);
+    if (gfx == &tft) {
+      maskSavedBytes += (cx1 - cx0 + 1 - (visible ? sx1 - sx0 + 1 : 0)) * 2;
+    }
+    if (visible) {
+      if (!record(DRAW_FILL_RECT, sx0, py, sx1 - sx0 + 1, 1, 0, color)) {
+        gfx->writeFastHLine(sx0, ty(py), sx1 - sx0 + 1, color);
+      }
+    }
+  }
+  gfx->endWrite();
+}
+
 void DisplayDriver::clear() {
-  tft.fillScreen(getThemeColors().bg);
+  fillScreen(getThemeColors().bg);
 }
 
 void DisplayDriver::fillScreen(uint16_t color) {
-  tft.fillScreen(color);
+  markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  fillMasked(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color);
+  surfaceEpoch++;
+  surfaceBlank = true;
+  blankColor = color;
+  if (gfx == &tft && backBufferReady) {
+    // Keep the back buffer in step with the panel so the next frame's
+    // partial flush does not resurrect stale pixels; overlays go back up
+    // with it
+    canvas.fillSprite(ink(&canvas, color));
+    overlayPush |= activeOverlays();
+  }
 }
 
 void DisplayDriver::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  tft.drawPixel(x, y, color);
+  if (!markDirty(x, y, 1, 1)) return;
+  if (record(DRAW_PIXEL, x, y, 0, 0, 0, color)) return;
+  gfx->drawPixel(x, ty(y), ink(color));
 }
 
 void DisplayDriver::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-  tft.drawLine(x0, y0, x1, y1, color);
+  if (!markDirty(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1)) return;
+  if (record(DRAW_LINE, x0, y0, x1, y1, 0, color)) return;
+  gfx->drawLine(x0, ty(y0), x1, ty(y1), ink(color));
 }
 
 void DisplayDriver::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  tft.drawRect(x, y, w, h, color);
+  if (!markDirty(x, y, w, h)) return;
+  if (record(DRAW_RECT, x, y, w, h, 0, color)) return;
+  gfx->drawRect(x, ty(y), w, h, ink(color));
 }
 
 void DisplayDriver::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  tft.fillRect(x, y, w, h, color);
+  if (!markDirty(x, y, w, h)) return;
+  if (roundMaskContains(x, y, w, h)) {
+    if (record(DRAW_FILL_RECT, x, y, w, h, 0, color)) return;
+    gfx->fillRect(x, ty(y), w, h, ink(color));
+  } else {
+    fillMasked(x, y, w, h, color);
+  }
 }
 
 void DisplayDriver::drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
-  tft.drawCircle(x, y, r, color);
+  if (!markDirty(x - r, y - r, 2 * r + 1, 2 * r + 1)) return;
+  if (record(DRAW_CIRCLE, x, y, r, 0, 0, color)) return;
+  gfx->drawCircle(x, ty(y), r, ink(color));
 }
 
 void DisplayDriver::drawTouchFeedbackRing(uint8_t alpha) {
   // Draw a fading ring around the screen perimeter
   uint16_t color = getThemeColors().highlight; // Use theme highlight color
   
-  // Simple dimming based on alpha (LovyanGFX compatible)
-  if (alpha > 128) {
-    tft.drawCircle(120, 120, 118, color);
-    tft.drawCircle(120, 120, 117, color);
-    tft.drawCircle(120, 120, 115, color);
-    tft.drawCircle(120, 120, 116, color);
+  // Fade out over the background
+  if (alpha > 0) {
+    fillArc(120, 120, 118, 115, 0, 360, blendColor(color, getThemeColors().bg, alpha));
   }
 }
 
 void DisplayDriver::fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
-  tft.fillCircle(x, y, r, color);
+  if (!markDirty(x - r, y - r, 2 * r + 1, 2 * r + 1)) return;
+  if (record(DRAW_FILL_CIRCLE, x, y, r, 0, 0, color)) return;
+  gfx->fillCircle(x, ty(y), r, ink(color));
 }
 
 void DisplayDriver::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
-  tft.drawRoundRect(x, y, w, h, r, color);
+  if (!markDirty(x, y, w, h)) return;
+  if (record(DRAW_ROUND_RECT, x, y, w, h, r, color)) return;
+  gfx->drawRoundRect(x, ty(y), w, h, r, ink(color));
 }
 
 void DisplayDriver::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
-  tft.fillRoundRect(x, y, w, h, r, color);
+  if (!markDirty(x, y, w, h)) return;
+  if (record(DRAW_FILL_ROUND_RECT, x, y, w, h, r, color)) return;
+  gfx->fillRoundRect(x, ty(y), w, h, r, ink(color));
 }
 
+// Text state is mirrored on every surface so callers can switch targets
+// between setTextColor()/setCursor() and print()
 void DisplayDriver::setTextColor(uint16_t color) {
-  tft.setTextColor(color);
+  textColor = color;
+  for (lgfx::LovyanGFX* t : targets) t->setTextColor(ink(t, color));
 }
 
 void DisplayDriver::setTextColor(uint16_t color, uint16_t bg) {
-  tft.setTextColor(color, bg);
+  textColor = color;
+  for (lgfx::LovyanGFX* t : targets) t->setTextColor(ink(t, color), ink(t, bg));
 }
 
 void DisplayDriver::setTextSize(uint8_t size) {
-  tft.setTextSize(size);
+  for (lgfx::LovyanGFX* t : targets) t->setTextSize(size);
+}
+
+void DisplayDriver::setFont(const lgfx::IFont* font) {
+  for (lgfx::LovyanGFX* t : targets) t->setFont(font);
+  textLayout.invalidate();
 }
 
 void DisplayDriver::setCursor(int16_t x, int16_t y) {
-  tft.setCursor(x, y);
+  for (lgfx::LovyanGFX* t : targets) t->setCursor(x, t == gfx ? ty(y) : y);
 }
 
 void DisplayDriver::print(const char* text) {
-  tft.print(text);
+  int16_t x = gfx->getCursorX();
+  int16_t y = gfx->getCursorY() + bandTop;
+  if (isBanding() && (y >= bandBottom || y + gfx->fontHeight() <= bandTop)) {
+    // Skip text outside the current strip (unless it may wrap into it)
+    int16_t w = textLayout.measure(gfx, text).width;
+    if (x + w <= SCREEN_WIDTH) {
+      gfx->setCursor(x + w, ty(y));
+      return;
+    }
+  }
+  claimPanel();
+  replayCommands();
+  gfx->print(text);
+  markTextDirty(x, y, text);
 }
 
 void DisplayDriver::print(String text) {
-  tft.print(text);
+  print(text.c_str());
 }
 
 void DisplayDriver::println(const char* text) {
-  tft.println(text);
+  int16_t x = gfx->getCursorX();
+  int16_t y = gfx->getCursorY() + bandTop;
+  claimPanel();
+  replayCommands();
+  gfx->println(text);
+  markTextDirty(x, y, text);
 }
 
 void DisplayDriver::println(String text) {
-  tft.println(text);
+  println(text.c_str());
 }
 
 int16_t DisplayDriver::getTextWidth(const char* text, uint8_t size) {
-  tft.setTextSize(size);
-  return tft.textWidth(text);
+  setTextSize(size);
+  return textLayout.measure(gfx, text).width;
 }
 
 int16_t DisplayDriver::getTextWidth(String text, uint8_t size) {
@@ -131,6 +1021,13 @@ int16_t DisplayDriver::getTextWidth(String text, uint8_t size) {
 }
 
 void DisplayDriver::drawCenteredText(const char* text, int16_t y, uint8_t size) {
+#if SMOOTH_FONT
+  // The indexed palette has no room for the blend ramps
+  if (size >= SMOOTH_FONT_MIN_SIZE && smoothFont.isReady() && !isIndexedTarget()) {
+    drawSmoothText(text, (SCREEN_WIDTH - smoothFont.textWidth(text)) / 2, y, textColor);
+    return;
+  }
+#endif
   setTextSize(size);
   int16_t w = getTextWidth(text, size);
   int16_t x = (SCREEN_WIDTH - w) / 2;
@@ -142,58 +1039,382 @@ void DisplayDriver::drawCenteredText(String text, int16_t y, uint8_t size) {
   drawCenteredText(text.c_str(), y, size);
 }
 
+void DisplayDriver::drawSmoothText(const char* text, int16_t x, int16_t y, uint16_t color) {
+  uint16_t bg = getThemeColors().bg;
+  smoothFont.setBackground(bg);  // A new theme rebuilds the glyphs
+  int16_t h = smoothFont.height();
+  uint16_t cell[SMOOTH_CELL_MAX_W * SMOOTH_CELL_MAX_H];
+  
+  for (const char* c = text; *c; c++) {
+    const uint16_t* glyph = smoothFont.glyph(*c, color);
+    if (!glyph) continue;
+    int16_t w = SmoothGlyphCache::width(glyph);
+    if (markDirty(x, y, w, h)) {
+      replayCommands();
+      smoothFont.expand(glyph, cell);
+      // Only the rows inside the current strip
+      int16_t y0 = max<int16_t>(y, bandTop);
+      int16_t y1 = min<int16_t>(min<int16_t>(y + h, SCREEN_HEIGHT), bandBottom);
+      if (y1 > y0) {
+        gfx->pushImage(x, ty(y0), w, y1 - y0, cell + (y0 - y) * w);
+      }
+    }
+    x += w;
+  }
+}
+
+void DisplayDriver::drawDigitCell(int16_t x, int16_t y, char c, uint8_t size, uint16_t color, uint16_t bg) {
+  size = constrain(size, 1, DIGIT_ATLAS_MAX_SIZE);
+  int16_t w = DIGIT_GLYPH_WIDTH * size;
+  int16_t h = DIGIT_GLYPH_HEIGHT * size;
+  if (!markDirty(x, y, w, h)) return;
+  replayCommands();
+  
+  int8_t glyph = DigitAtlas::indexOf(c);
+  if (glyph < 0 || !digitAtlas.isReady()) {
+    gfx->fillRect(x, ty(y), w, h, ink(bg));
+    if (glyph >= 0) {
+      // No atlas: fall back to the font path
+      char text[2] = { c, '\0' };
+      gfx->setTextSize(size);
+      gfx->setTextColor(ink(color));
+      gfx->setCursor(x, ty(y));
+      gfx->print(text);
+    }
+    return;
+  }
+  
+  if (isIndexedTarget()) {
+    // One index byte per pixel: expand straight into the back buffer
+    const uint8_t inkIndex[2] = { palette->indexOf(bg), palette->indexOf(color) };
+    uint8_t* buf = (uint8_t*)canvas.getBuffer();
+    int16_t x0 = max<int16_t>(x, 0);
+    int16_t x1 = min<int16_t>(x + w, SCREEN_WIDTH);
+    int16_t y1 = min<int16_t>(y + h, SCREEN_HEIGHT);
+    for (int16_t py = max<int16_t>(y, 0); py < y1; py++) {
+      uint8_t bits = digitAtlas.row(glyph, (py - y) / size);
+      uint8_t* out = buf + py * SCREEN_WIDTH;
+      for (int16_t px = x0; px < x1; px++) {
+        out[px] = inkIndex[(bits >> ((px - x) / size)) & 1];
+      }
+    }
+    return;
+  }
+  
+  // Expand the 1-bit glyph into a two-color cell and push it in one window
+  const uint16_t ink[2] = { bg, color };
+  uint16_t cell[DIGIT_GLYPH_WIDTH * DIGIT_ATLAS_MAX_SIZE * DIGIT_GLYPH_HEIGHT * DIGIT_ATLAS_MAX_SIZE];
+  uint16_t* out = cell;
+  for (uint8_t gy = 0; gy < DIGIT_GLYPH_HEIGHT; gy++) {
+    uint8_t bits = digitAtlas.row(glyph, gy);
+    uint16_t* rowStart = out;
+    for (uint8_t gx = 0; gx < DIGIT_GLYPH_WIDTH; gx++) {
+      uint16_t px = ink[(bits >> gx) & 1];
+      for (uint8_t i = 0; i < size; i++) *out++ = px;
+    }
+    for (uint8_t i = 1; i < size; i++, out += w) {
+      memcpy(out, rowStart, w * sizeof(uint16_t));
+    }
+  }
+  
+  // Only the rows inside the current strip
+  int16_t y0 = max<int16_t>(y, bandTop);
+  int16_t y1 = min<int16_t>(min<int16_t>(y + h, SCREEN_HEIGHT), bandBottom);
+  if (y1 <= y0) return;
+  gfx->pushImage(x, ty(y0), w, y1 - y0, cell + (y0 - y) * w);
+}
+
+void DisplayDriver::drawAlphaMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* alpha,
+                                  uint16_t color, uint16_t bg) {
+  if (!markDirty(x, y, w, h)) return;
+  replayCommands();
+  
+  int16_t stride = (w + 1) / 2;
+  int16_t x0 = max<int16_t>(x, 0);
+  int16_t x1 = min<int16_t>(x + w, SCREEN_WIDTH);
+  int16_t y0 = max<int16_t>(max<int16_t>(y, 0), bandTop);
+  int16_t y1 = min<int16_t>(min<int16_t>(y + h, SCREEN_HEIGHT), bandBottom);
+  if (x0 >= x1 || y0 >= y1) return;
+  
+  if (gfx == &tft) {
+    uint16_t shades[16];
+    uint16_t line[SCREEN_WIDTH];
+    pxMaskShades(shades, color, bg, false);
+    tft.startWrite();
+    for (int16_t py = y0; py < y1; py++) {
+      const uint8_t* row = alpha + (py - y) * stride;
+      int16_t run = -1;
+      for (int16_t px = x0; px <= x1; px++) {
+        uint8_t a = px < x1 ? (row[(px - x) >> 1] >> (((px - x) & 1) * 4)) & 0x0F : 0;
+        if (a) {
+          if (run < 0) run = px;
+          line[px - run] = shades[a];
+        } else if (run >= 0) {
+          tft.pushImage(run, py, px - run, 1, line);
+          run = -1;
+        }
+      }
+    }
+    tft.endWrite();
+    return;
+  }
+  
+  if (isIndexedTarget()) {
+    // No blending between indices: a role color fades along its ramp to
+    // the background; anything else is drawn where the mask is mostly ink
+    uint8_t* buf = (uint8_t*)canvas.getBuffer();
+    int16_t shades[16];
+    for (uint8_t a = 1; a < 16; a++) {
+      shades[a] = palette->fade(color, a * 17);
+      if (shades[a] < 0) shades[a] = a >= 8 ? palette->indexOf(color) : -1;
+    }
+    for (int16_t py = y0; py < y1; py++) {
+      const uint8_t* row = alpha + (py - y) * stride;
+      uint8_t* out = buf + py * SCREEN_WIDTH;
+      for (int16_t px = x0; px < x1; px++) {
+        uint8_t a = (row[(px - x) >> 1] >> (((px - x) & 1) * 4)) & 0x0F;
+        if (a && shades[a] >= 0) out[px] = shades[a];
+      }
+    }
+    return;
+  }
+  
+  // Sprite memory holds byte-swapped RGB565
+  uint16_t shades[16];
+  pxMaskShades(shades, color, bg, true);
+  uint16_t* buf = (uint16_t*)static_cast<LGFX_Sprite*>(gfx)->getBuffer();
+  for (int16_t py = y0; py < y1; py++) {
+    pxMaskRow(buf + ty(py) * SCREEN_WIDTH + x0, alpha + (py - y) * stride, x0 - x, x1 - x0, shades);
+  }
+}
+
 void DisplayDriver::drawArc(int16_t x, int16_t y, int16_t r, int16_t startAngle, int16_t endAngle, uint16_t color) {
-  // Draw arc using line segments
+  // Draw arc using line segments, carrying each end point to the next segment
+  if (startAngle >= endAngle) return;
+  int16_t x1, y1;
+  fxPolar(x, y, r, fxDegToAngle(startAngle), x1, y1);
   for (int angle = startAngle; angle < endAngle; angle += 2) {
-    float rad1 = angle * PI / 180.0;
-    float rad2 = (angle + 2) * PI / 180.0;
-    
-    int16_t x1 = x + r * cos(rad1);
-    int16_t y1 = y + r * sin(rad1);
-    int16_t x2 = x + r * cos(rad2);
-    int16_t y2 = y + r * sin(rad2);
-    
+    int16_t x2, y2;
+    fxPolar(x, y, r, fxDegToAngle(angle + 2), x2, y2);
     drawLine(x1, y1, x2, y2, color);
+    x1 = x2;
+    y1 = y2;
   }
 }
 
-void DisplayDriver::drawProgressRing(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress, uint16_t color) {
-  uint16_t bgColor = getThemeColors().dimmed;
-  uint16_t glowColor = getThemeColors().highlight;
-  bool isNeon = (getCurrentTheme() == THEME_NEON);
-  
-  // Draw background ring
-  for (int i = 0; i < thickness; i++) {
-    int16_t ringR = r - i;
-    drawCircle(x, y, ringR, bgColor);
+// --- Annulus sector rasterizer ---
+// Each row of a sector is the ring's span(s) on that row intersected with the
+// angular constraint, which is itself an interval of x per row: "angle >= a0"
+// and "angle < a1" are half-planes through the center. No per-pixel math.
+
+static const int16_t SPAN_INF = 0x3FFF;
+
+struct Span {
+  int16_t lo, hi;  // Inclusive; empty if lo > hi
+};
+
+static int32_t floorDiv(int32_t a, int32_t b) {
+  int32_t q = a / b;
+  return (q * b != a && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+static int32_t ceilDiv(int32_t a, int32_t b) {
+  return -floorDiv(-a, b);
+}
+
+// Clamp a span end to +-SPAN_INF
+static int16_t clampSpan(int32_t v) {
+  return (int16_t)constrain(v, (int32_t)-SPAN_INF, (int32_t)SPAN_INF);
+}
+
+// dx on row dy with cross(u, p) >= 0, i.e. at or clockwise of direction u
+static Span halfPlaneFrom(int32_t ux, int32_t uy, int32_t dy) {
+  Span s = { -SPAN_INF, SPAN_INF };
+  if (uy > 0) {
+    s.hi = clampSpan(floorDiv(ux * dy, uy));
+  } else if (uy < 0) {
+    s.lo = clampSpan(ceilDiv(ux * dy, uy));
+  } else if (ux * dy < 0) {
+    s.lo = 1; s.hi = 0;
+  }
+  return s;
+}
+
+// dx on row dy with cross(p, u) > 0, i.e. strictly counter-clockwise of u
+static Span halfPlaneBefore(int32_t ux, int32_t uy, int32_t dy) {
+  Span s = { -SPAN_INF, SPAN_INF };
+  if (uy > 0) {
+    s.lo = clampSpan(floorDiv(ux * dy, uy) + 1);
+  } else if (uy < 0) {
+    s.hi = clampSpan(ceilDiv(ux * dy, uy) - 1);
+  } else if (ux * dy >= 0) {
+    s.lo = 1; s.hi = 0;
   }
+  return s;
+}
+
+void DisplayDriver::fillArc(int16_t x, int16_t y, int16_t rOuter, int16_t rInner, int16_t startAngle, int16_t endAngle, uint16_t color) {
+  fillArcSpans(x, y, rOuter, rInner, fxDegToAngle(startAngle), fxDegToAngle(endAngle), color);
+}
+
+// Annulus sector between binary angles a0 (inclusive) and a1 (exclusive)
+void DisplayDriver::fillArcSpans(int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner, int32_t a0, int32_t a1, uint16_t color) {
+  int32_t sweep = a1 - a0;
+  if (sweep <= 0 || rOuter < 0 || rInner > rOuter) return;
+  if (rInner < 0) rInner = 0;
   
-  // Calculate progress arc
-  int endAngle = -90 + (360 * progress / 100);
+  bool fullRing = sweep >= FX_ANGLE_FULL;
+  bool wide = sweep > FX_ANGLE_HALF;  // Union of the half-planes, not intersection
+  int32_t sx = fxCos(a0), sy = fxSin(a0);
+  int32_t ex = fxCos(a1), ey = fxSin(a1);
+  
+  // Pixel centers with (rIn - 1/2)^2 < d^2 <= (rOut + 1/2)^2, in integers
+  int32_t outer2 = (int32_t)rOuter * (rOuter + 1);
+  int32_t inner2 = rInner > 0 ? (int32_t)rInner * (rInner - 1) : -1;
+  
+  int16_t yStart = max<int16_t>(max<int16_t>(cy - rOuter, 0), bandTop);
+  int16_t yEnd = min<int16_t>(min<int16_t>(cy + rOuter, SCREEN_HEIGHT - 1), bandBottom - 1);
+  int16_t minX = SPAN_INF, maxX = -SPAN_INF, minY = SPAN_INF, maxY = -SPAN_INF;
   
-  // NEON theme: outer glow effect
-  if (isNeon && progress > 0) {
-    for (int i = 0; i < 3; i++) {
-      drawArc(x, y, r + i + 1, -90, endAngle, glowColor);
+  color = ink(color);
+  claimPanel();
+  gfx->startWrite();
+  for (int16_t py = yStart; py <= yEnd; py++) {
+    int32_t dy = py - cy;
+    int32_t rest = outer2 - dy * dy;
+    if (rest < 0) continue;
+    
+    // Ring: one span, or two around the hole
+    int16_t xo = fxSqrt(rest);
+    Span ring[2] = { { (int16_t)-xo, xo }, { 1, 0 } };
+    if (dy * dy <= inner2) {
+      int16_t xi = fxSqrt(inner2 - dy * dy);
+      ring[0].hi = -xi - 1;
+      ring[1].lo = xi + 1;
+      ring[1].hi = xo;
+    }
+    
+    // Angular window: up to two intervals
+    Span window[2] = { { -SPAN_INF, SPAN_INF }, { 1, 0 } };
+    if (!fullRing) {
+      Span from = halfPlaneFrom(sx, sy, dy);
+      Span before = halfPlaneBefore(ex, ey, dy);
+      if (!wide) {
+        window[0].lo = max(from.lo, before.lo);
+        window[0].hi = min(from.hi, before.hi);
+      } else {
+        window[0] = from;
+        window[1] = before;
+      }
+    }
+    
+    for (int w = 0; w < 2; w++) {
+      for (int r = 0; r < 2; r++) {
+        int16_t lo = max(window[w].lo, ring[r].lo);
+        int16_t hi = min(window[w].hi, ring[r].hi);
+        // Union windows may overlap: clip the second against the first
+        if (w == 1 && window[0].lo <= window[0].hi) {
+          if (lo >= window[0].lo && lo <= window[0].hi) lo = window[0].hi + 1;
+          if (hi >= window[0].lo && hi <= window[0].hi) hi = window[0].lo - 1;
+        }
+        if (lo > hi) continue;
+        
+        int16_t sx0 = max<int16_t>(cx + lo, 0);
+        int16_t sx1 = min<int16_t>(cx + hi, SCREEN_WIDTH - 1);
+        if (sx0 > sx1) continue;
+        if (!record(DRAW_FILL_RECT, sx0, py, sx1 - sx0 + 1, 1, 0, color)) {
+          gfx->writeFastHLine(sx0, ty(py), sx1 - sx0 + 1, color);
+        }
+        minX = min(minX, sx0);
+        maxX = max(maxX, sx1);
+        minY = min(minY, py);
+        maxY = max(maxY, py);
+      }
     }
   }
+  gfx->endWrite();
+  
+  if (minX <= maxX) {
+    markDirty(minX, minY, maxX - minX + 1, maxY - minY + 1);
+  }
+}
+
+void DisplayDriver::drawProgressRing(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress, uint16_t color) {
+  const int32_t startAngle = fxDegToAngle(-90);
+  const int32_t highlightLag = fxDegToAngle(10);
   
-  // Draw progress arc with multiple layers
-  for (int i = 0; i < thickness + 2; i++) {
-    int16_t arcR = r - i + 1;
-    drawArc(x, y, arcR, -90, endAngle, color);
+  // Same ring already on this surface: repaint only the wedge between the old
+  // and new end angles (plus the trailing NEON highlight). Crossing the
+  // thresholds that add the glow, highlight or center dot needs a full pass.
+  const ProgressRingState& last = lastRing;
+  bool incremental = last.surface != 0 && last.surface == getSurfaceId() &&
+                     last.x == x && last.y == y && last.r == r && last.thickness == thickness &&
+                     last.color == color && last.theme == getCurrentTheme() &&
+                     (last.progress > 0) == (progress > 0) &&
+                     (last.progress > 5) == (progress > 5);
+  
+  if (incremental) {
+    if (last.progress == progress) return;
+    int32_t oldEnd = startAngle + FX_ANGLE_FULL * last.progress / 100;
+    int32_t newEnd = startAngle + FX_ANGLE_FULL * progress / 100;
+    paintProgressRing(x, y, r, thickness, progress, color,
+                      min(oldEnd, newEnd) - highlightLag, max(oldEnd, newEnd));
+  } else {
+    paintProgressRing(x, y, r, thickness, progress, color, startAngle, startAngle + FX_ANGLE_FULL);
+    
+    // Draw center dot if progress > 0
+    if (progress > 0) {
+      fillCircle(x, y, 3, color);
+      fillCircle(x, y, 1, COLOR_WHITE);
+    }
   }
   
-  // NEON theme: inner glow
-  if (isNeon && progress > 5) {
-    int16_t highlightR = r - thickness/2;
-    drawArc(x, y, highlightR, -90, endAngle - 10, COLOR_WHITE);
+  lastRing.surface = getSurfaceId();
+  lastRing.x = x;
+  lastRing.y = y;
+  lastRing.r = r;
+  lastRing.thickness = thickness;
+  lastRing.progress = progress;
+  lastRing.color = color;
+  lastRing.theme = getCurrentTheme();
+}
+
+// Paints the final look of the ring between binary angles from..to
+void DisplayDriver::paintProgressRing(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress,
+                                      uint16_t color, int32_t from, int32_t to) {
+  const ThemeColors& colors = getThemeColors();
+  bool isNeon = (getCurrentTheme() == THEME_NEON);
+  
+  // Calculate progress arc
+  int32_t startAngle = fxDegToAngle(-90);
+  int32_t endAngle = startAngle + FX_ANGLE_FULL * progress / 100;
+  from = max(from, startAngle);
+  to = min(to, startAngle + FX_ANGLE_FULL);
+  int32_t split = constrain(endAngle, from, to);
+  
+  // Progress part: arc layers r+1 .. r-thickness
+  if (split > from) {
+    // NEON theme: outer glow effect
+    if (isNeon) {
+      fillArcSpans(x, y, r + 3, r + 2, from, split, colors.highlight);
+    }
+    fillArcSpans(x, y, r + 1, r - thickness, from, split, color);
+    
+    // NEON theme: inner glow
+    if (isNeon && progress > 5) {
+      int16_t highlightR = r - thickness/2;
+      fillArcSpans(x, y, highlightR, highlightR, from, min(split, endAngle - fxDegToAngle(10)), COLOR_WHITE);
+    }
   }
   
-  // Draw center dot if progress > 0
-  if (progress > 0) {
-    fillCircle(x, y, 3, color);
-    fillCircle(x, y, 1, COLOR_WHITE);
+  // Remaining part: background ring r .. r-thickness+1, erase the rest
+  if (to > split) {
+    if (isNeon) {
+      fillArcSpans(x, y, r + 3, r + 2, split, to, colors.bg);
+    }
+    fillArcSpans(x, y, r + 1, r + 1, split, to, colors.bg);
+    fillArcSpans(x, y, r, r - thickness + 1, split, to, colors.dimmed);
+    fillArcSpans(x, y, r - thickness, r - thickness, split, to, colors.bg);
   }
 }
 
@@ -202,27 +1423,22 @@ void DisplayDriver::drawTemperatureGauge(int16_t x, int16_t y, int16_t r, float
   drawCircle(x, y, r, COLOR_GRAY);
   
   // Calculate angle based on temperature (0-300°C range)
-  float maxTemp = 300.0;
-  float tempAngle = -135 + (270 * temp / maxTemp);
-  float targetAngle = -135 + (270 * target / maxTemp);
+  const int32_t maxTemp = 300;
+  int32_t tempAngle = fxDegToAngle(-135) + (int32_t)temp * fxDegToAngle(270) / maxTemp;
+  int32_t targetAngle = fxDegToAngle(-135) + (int32_t)target * fxDegToAngle(270) / maxTemp;
   
   // Draw target marker
   if (target > 0) {
-    float rad = targetAngle * PI / 180.0;
-    int16_t x1 = x + (r - 10) * cos(rad);
-    int16_t y1 = y + (r - 10) * sin(rad);
-    int16_t x2 = x + r * cos(rad);
-    int16_t y2 = y + r * sin(rad);
+    int16_t x1, y1, x2, y2;
+    fxPolar(x, y, r - 10, targetAngle, x1, y1);
+    fxPolar(x, y, r, targetAngle, x2, y2);
     drawLine(x1, y1, x2, y2, COLOR_YELLOW);
   }
   
   // Draw temperature needle
-  float rad = tempAngle * PI / 180.0;
-  int16_t x1 = x;
-  int16_t y1 = y;
-  int16_t x2 = x + (r - 5) * cos(rad);
-  int16_t y2 = y + (r - 5) * sin(rad);
-  drawLine(x1, y1, x2, y2, color);
+  int16_t x2, y2;
+  fxPolar(x, y, r - 5, tempAngle, x2, y2);
+  drawLine(x, y, x2, y2, color);
   fillCircle(x, y, 3, color);
 }
 
@@ -237,8 +1453,7 @@ void DisplayDriver::drawEye(int16_t x, int16_t y, int16_t size, int16_t pupilX,
     
     // NEON glow effect - outer rings
     if (getCurrentTheme() == THEME_NEON) {
-      drawCircle(x, y, size + 1, glowColor);
-      drawCircle(x, y, size + 2, glowColor);
+      fillArc(x, y, size + EYES_GLOW, size + 1, 0, 360, glowColor);
     }
     drawCircle(x, y, size, getThemeColors().secondary);
     
@@ -255,7 +1470,8 @@ void DisplayDriver::drawEye(int16_t x, int16_t y, int16_t size, int16_t pupilX,
       drawCircle(x + pupilX, y + pupilY, pupilSize + 1, glowColor);
     }
   } else {
-    // Enhanced closed eye animation
+    // Enhanced closed eye animation, over the erased eye
+    fillCircle(x, y, size + EYES_GLOW, getThemeColors().bg);
     int16_t lineThickness = 3;
     for (int i = 0; i < lineThickness; i++) {
       drawLine(x - size, y + i - 1, x + size, y + i - 1, pupilColor);
@@ -268,29 +1484,31 @@ void DisplayDriver::drawRollingEyes(int16_t frame) {
   // This prevents flickering during animation
   
   // Calculate pupil position with smooth easing (sinusoidal)
-  float t = (frame % 360) / 360.0; // 0 to 1 over 360 frames
-  float easedT = (sin(t * 2 * PI - PI/2) + 1) / 2; // Smooth sine wave
+  int32_t t = (frame % 360) * FX_ANGLE_FULL / 360; // One turn over 360 frames
+  int32_t easedT = (fxSin(t - FX_ANGLE_QUARTER) + FX_Q15_ONE) >> 1; // Smooth sine wave, Q15 0..1
+  int32_t easedAngle = (easedT * FX_ANGLE_FULL) >> 15;
   
-  int16_t pupilOffset = 6 + (int16_t)(4 * sin(t * 2 * PI)); // Dynamic range 6-10
-  int16_t pupilX = pupilOffset * cos(easedT * 2 * PI);
-  int16_t pupilY = pupilOffset * sin(easedT * 2 * PI);
+  int16_t pupilOffset = 6 + fxMulQ15(4, fxSin(t)); // Dynamic range 6-10
+  int16_t pupilX = fxMulQ15(pupilOffset, fxCos(easedAngle));
+  int16_t pupilY = fxMulQ15(pupilOffset, fxSin(easedAngle));
   
-  // Blink with varying duration
-  bool blinking = ((frame % 120) < 8) || ((frame % 180) < 5); // Occasional blinks
+  // Occasional blinks, timed in milliseconds. Each spans two 10 FPS
+  // frames (one if the scheduler stretches the period), so none falls
+  // between renders.
+  uint32_t ms = (uint32_t)frame * FRAME_STEP_MS;
+  bool blinking = (ms % EYES_BLINK_PERIOD_MS) < EYES_BLINK_MS ||
+                  (ms % (EYES_BLINK_PERIOD_MS * 3 / 2)) < EYES_BLINK_MS * 4 / 5;
   
   // Draw two eyes with enhanced details
-  int16_t eyeSize = 35;
-  int16_t eyeSpacing = 55;
-  
-  drawEye(SCREEN_WIDTH/2 - eyeSpacing, SCREEN_HEIGHT/2, eyeSize, pupilX, pupilY, blinking);
-  drawEye(SCREEN_WIDTH/2 + eyeSpacing, SCREEN_HEIGHT/2, eyeSize, pupilX, pupilY, blinking);
+  drawEye(SCREEN_WIDTH/2 - EYES_SPACING, SCREEN_HEIGHT/2, EYES_SIZE, pupilX, pupilY, blinking);
+  drawEye(SCREEN_WIDTH/2 + EYES_SPACING, SCREEN_HEIGHT/2, EYES_SIZE, pupilX, pupilY, blinking);
   
   // Add subtle background breathing effect
   if (!blinking) {
-    uint8_t breath = 50 + (uint8_t)(30 * sin(frame * 0.02)); // Slow breathing
-    for (int r = 110; r < 115; r++) {
-      drawCircle(SCREEN_WIDTH/2, SCREEN_HEIGHT/2, r, tft.color565(breath, breath, breath));
-    }
+    // Slow breathing: 0.02 rad per frame ~= 13 angle units
+    uint8_t breath = 50 + fxMulQ15(30, fxSin((int32_t)frame * 13));
+    fillArc(SCREEN_WIDTH/2, SCREEN_HEIGHT/2, EYES_RING_OUTER, EYES_RING_INNER, 0, 360,
+            tft.color565(breath, breath, breath));
   }
 }
 
@@ -340,46 +1558,243 @@ void DisplayDriver::drawProgressRingNeon(int16_t x, int16_t y, int16_t r, int16_
 
 void DisplayDriver::drawGlowCircle(int16_t x, int16_t y, int16_t r, uint16_t color, uint8_t intensity) {
   if (getCurrentTheme() == THEME_NEON) {
-    for (int i = 0; i < 3; i++) {
-      drawCircle(x, y, r + i + 1, getThemeColors().highlight);
-    }
+    fillArc(x, y, r + 3, r + 1, 0, 360, getThemeColors().highlight);
   }
   fillCircle(x, y, r, color);
 }
 
+// alpha = 255 gives color1, 0 gives color2
+uint16_t DisplayDriver::blendColor(uint16_t color1, uint16_t color2, uint8_t alpha) {
+  return pxBlend(color1, color2, alpha);
+}
+
 uint16_t DisplayDriver::dimColor(uint16_t color, uint8_t amount) {
-  uint8_t r = (color >> 11) & 0x1F;
-  uint8_t g = (color >> 5) & 0x3F;
-  uint8_t b = color & 0x1F;
+  if (palette) {
+    // Stay on the role's ramp so the result follows theme swaps; ramps
+    // fade towards the theme background (black on the dark themes)
+    int16_t faded = palette->fade(color, amount);
+    if (faded >= 0) return palette->colorAt(faded);
+  }
   
-  r = (r * amount) / 255;
-  g = (g * amount) / 255;
-  b = (b * amount) / 255;
+  return pxDim(color, amount);
+}
+
+// Rows y0..y1 of the current sprite target inside the glass, clipped to
+// x..x+w-1 and to the strip; calls row(pixels, count) for each
+template <typename RowOp>
+void DisplayDriver::forEachTargetRow(int16_t x, int16_t y, int16_t w, int16_t h, RowOp row) {
+  int16_t yStart = max<int16_t>(max<int16_t>(y, 0), bandTop);
+  int16_t yEnd = min<int16_t>(min<int16_t>(y + h, SCREEN_HEIGHT), bandBottom);
+  int16_t cx0 = max<int16_t>(x, 0);
+  int16_t cx1 = min<int16_t>(x + w - 1, SCREEN_WIDTH - 1);
+  uint8_t* buf = (uint8_t*)static_cast<LGFX_Sprite*>(gfx)->getBuffer();
+  uint8_t bytes = isIndexedTarget() ? 1 : 2;
   
-  return (r << 11) | (g << 5) | b;
+  for (int16_t py = yStart; py < yEnd; py++) {
+    int16_t sx0 = cx0, sx1 = cx1;
+    if (!roundMaskClip(py, sx0, sx1)) continue;
+    row(buf + (ty(py) * SCREEN_WIDTH + sx0) * bytes, sx1 - sx0 + 1);
+  }
+}
+
+void DisplayDriver::blendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha) {
+  if (gfx == &tft) {
+    // The panel cannot be read back: blend over the background instead
+    fillRect(x, y, w, h, blendColor(color, getThemeColors().bg, alpha));
+    return;
+  }
+  if (!markDirty(x, y, w, h)) return;
+  
+  if (isIndexedTarget()) {
+    // Blend each palette entry once, then remap
+    uint8_t remap[PALETTE_SIZE];
+    for (uint16_t i = 0; i < PALETTE_SIZE; i++) {
+      remap[i] = palette->indexOf(pxBlend(color, palette->colorAt(i), alpha));
+    }
+    forEachTargetRow(x, y, w, h, [&](uint8_t* px, int16_t count) {
+      for (int16_t i = 0; i < count; i++) px[i] = remap[px[i]];
+    });
+    return;
+  }
+  
+  forEachTargetRow(x, y, w, h, [&](uint8_t* px, int16_t count) {
+    pxBlendBuffer((uint16_t*)px, count, color, alpha, true);
+  });
+}
+
+void DisplayDriver::dimRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t amount) {
+  if (gfx == &tft || !markDirty(x, y, w, h)) return;
+  
+  if (isIndexedTarget()) {
+    uint8_t remap[PALETTE_SIZE];
+    for (uint16_t i = 0; i < PALETTE_SIZE; i++) {
+      remap[i] = palette->indexOf(dimColor(palette->colorAt(i), amount));
+    }
+    forEachTargetRow(x, y, w, h, [&](uint8_t* px, int16_t count) {
+      for (int16_t i = 0; i < count; i++) px[i] = remap[px[i]];
+    });
+    return;
+  }
+  
+  forEachTargetRow(x, y, w, h, [&](uint8_t* px, int16_t count) {
+    pxDimBuffer((uint16_t*)px, count, amount, true);
+  });
 }
 
 // Rotate coordinates around screen center for display mounting angle
 void DisplayDriver::rotateCoordinates(int16_t& x, int16_t& y) {
   // Only rotate if DISPLAY_ROTATION_ANGLE is non-zero
   #if DISPLAY_ROTATION_ANGLE != 0
-    // Convert angle to radians
-    float angleRad = DISPLAY_ROTATION_ANGLE * PI / 180.0;
+    // Q15 rotation terms, looked up once
+    static const int32_t cosAngle = fxCosDeg(DISPLAY_ROTATION_ANGLE);
+    static const int32_t sinAngle = fxSinDeg(DISPLAY_ROTATION_ANGLE);
     
     // Translate to origin (center of screen)
     int16_t cx = SCREEN_WIDTH / 2;
     int16_t cy = SCREEN_HEIGHT / 2;
-    int16_t tx = x - cx;
-    int16_t ty = y - cy;
+    int32_t tx = x - cx;
+    int32_t ty = y - cy;
     
     // Rotate around origin
-    float cosAngle = cos(angleRad);
-    float sinAngle = sin(angleRad);
-    int16_t rx = (int16_t)(tx * cosAngle - ty * sinAngle);
-    int16_t ry = (int16_t)(tx * sinAngle + ty * cosAngle);
+    int16_t rx = (tx * cosAngle - ty * sinAngle + (1 << 14)) >> 15;
+    int16_t ry = (tx * sinAngle + ty * cosAngle + (1 << 14)) >> 15;
     
     // Translate back
     x = rx + cx;
     y = ry + cy;
   #endif
 }
+
+void DisplayDriver::pushImageZoom(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* data, float zoom) {
+  int16_t dw = (int16_t)(w * zoom);
+  int16_t dh = (int16_t)(h * zoom);
+  int16_t left = x - dw / 2;
+  int16_t top = y - dh / 2;
+  if (dw <= 0 || dh <= 0 || !markDirty(left, top, dw, dh)) return;
+  replayCommands();
+  surfaceEpoch++;
+  
+  int16_t cx0 = max<int16_t>(left, 0);
+  int16_t cx1 = min<int16_t>(left + dw - 1, SCREEN_WIDTH - 1);
+  int16_t yStart = max<int16_t>(max<int16_t>(top, 0), bandTop);
+  int16_t yEnd = min<int16_t>(min<int16_t>(top + dh, SCREEN_HEIGHT), bandBottom);
+  if (cx0 > cx1) return;
+  
+  // Destination -> source step, Q16
+  uint32_t stepX = ((uint32_t)w << 16) / dw;
+  uint32_t stepY = ((uint32_t)h << 16) / dh;
+  uint16_t line[SCREEN_WIDTH];
+  
+  gfx->startWrite();
+  for (int16_t py = yStart; py < yEnd; py++) {
+    int16_t sx0 = cx0, sx1 = cx1;
+    bool visible = roundMaskClip(py, sx0, sx1);
+    if (gfx == &tft) {
+      maskSavedBytes += (cx1 - cx0 + 1 - (visible ? sx1 - sx0 + 1 : 0)) * 2;
+    }
+    if (!visible) continue;
+    
+    const uint16_t* src = data + (((uint32_t)(py - top) * stepY) >> 16) * w;
+    uint32_t u = (uint32_t)(sx0 - left) * stepX;
+    if (isIndexedTarget()) {
+      // Quantized to the palette, straight into the back buffer
+      uint8_t* out = (uint8_t*)canvas.getBuffer() + py * SCREEN_WIDTH;
+      for (int16_t px = sx0; px <= sx1; px++, u += stepX) {
+        out[px] = palette->indexOf(src[u >> 16]);
+      }
+      continue;
+    }
+    for (int16_t i = 0; i <= sx1 - sx0; i++, u += stepX) {
+      line[i] = src[u >> 16];
+    }
+    gfx->pushImage(sx0, ty(py), sx1 - sx0 + 1, 1, line);
+  }
+  gfx->endWrite();
+}
+
+void DisplayDriver::drawRleFrame(const RleFrame* frame, int16_t x, int16_t y, uint8_t zoom) {
+  if (zoom == 0 || frame->width == 0) return;
+  int16_t dw = frame->width * zoom;
+  int16_t dh = frame->height * zoom;
+  int16_t left = x + frame->x * zoom;
+  int16_t top = y + frame->y * zoom;
+  if (!markDirty(left, top, dw, dh)) return;
+  replayCommands();
+  // A frame covering the screen replaces everything; smaller ones (sprites,
+  // deltas) leave the rest as it was, so incremental redraws stay valid
+  if (left <= 0 && top <= 0 && left + dw >= SCREEN_WIDTH && top + dh >= SCREEN_HEIGHT) {
+    surfaceEpoch++;
+  }
+  
+  int16_t cx0 = max<int16_t>(left, 0);
+  int16_t cx1 = min<int16_t>(left + dw - 1, SCREEN_WIDTH - 1);
+  int16_t yStart = max<int16_t>(max<int16_t>(top, 0), bandTop);
+  int16_t yEnd = min<int16_t>(min<int16_t>(top + dh, SCREEN_HEIGHT), bandBottom);
+  if (cx0 > cx1) return;
+  
+  // Straight to the panel, spans alternate between two DMA line buffers
+  bool direct = gfx == &tft;
+  uint16_t lines[2][SCREEN_WIDTH];
+  uint8_t next = 0;
+  RleDecoder decoder;
+  decoder.begin(frame);
+  
+  gfx->startWrite();
+  for (int16_t py = yStart; py < yEnd; py++) {
+    // Rows above the strip are decoded and dropped; a zoomed row is reused
+    int16_t sy = (py - top) / zoom;
+    while (decoder.rowIndex() < sy && decoder.nextRow()) {}
+    
+    int16_t mx0 = cx0, mx1 = cx1;
+    bool visible = roundMaskClip(py, mx0, mx1);
+    if (direct) {
+      maskSavedBytes += (cx1 - cx0 + 1 - (visible ? mx1 - mx0 + 1 : 0)) * 2;
+    }
+    if (!visible) continue;
+    
+    // Only the spans the frame writes; the rest of a delta row keeps the
+    // previous frame's pixels
+    const uint8_t* indices = decoder.row();
+    for (uint8_t s = 0; s < decoder.spans(); s++) {
+      int16_t sx0 = max<int16_t>(mx0, left + decoder.spanStart(s) * zoom);
+      int16_t sx1 = min<int16_t>(mx1, left + decoder.spanEnd(s) * zoom - 1);
+      if (sx0 > sx1) continue;
+      
+      if (isIndexedTarget()) {
+        uint8_t* out = (uint8_t*)canvas.getBuffer() + py * SCREEN_WIDTH;
+        for (int16_t px = sx0; px <= sx1; px++) {
+          out[px] = palette->indexOf(pxSwap(decoder.color(indices[(px - left) / zoom])));
+        }
+        continue;
+      }
+      
+      uint16_t* line = lines[next];
+      for (int16_t px = sx0; px <= sx1; px++) {
+        line[px - sx0] = decoder.color(indices[(px - left) / zoom]);
+      }
+      if (direct) {
+        tft.pushImageDMA(sx0, py, sx1 - sx0 + 1, 1, (const lgfx::swap565_t*)line);
+        next ^= 1;
+      } else {
+        gfx->pushImage(sx0, ty(py), sx1 - sx0 + 1, 1, (const lgfx::swap565_t*)line);
+      }
+    }
+  }
+  if (direct) {
+    tft.waitDMA();  // The line buffers are on this stack frame
+  }
+  gfx->endWrite();
+}
+
+void DisplayDriver::drawRleAnimation(const RleAnimation* anim, int16_t shown, uint8_t frame,
+                                     int16_t x, int16_t y, uint8_t zoom) {
+  // Banded strips start blank, so they always need the whole chain
+  if (shown < 0 || shown >= anim->frameCount || isBanding()) {
+    drawRleFrame(anim->keyframe, x, y, zoom);
+    shown = 0;
+  }
+  while (shown != frame) {
+    shown = (shown + 1) % anim->frameCount;
+    drawRleFrame(&anim->deltas[shown], x, y, zoom);
+  }
+}
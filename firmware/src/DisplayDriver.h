@@ -11,7 +11,16 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <LovyanGFX.hpp>
+#include <functional>
 #include "Theme.h"
+#include "DigitAtlas.h"
+#include "IndexedPalette.h"
+#include "Transition.h"
+#include "DrawList.h"
+#include "TextLayout.h"
+#include "SmoothFont.h"
+#include "RotationTable.h"
+#include "RleFrame.h"
 
 // LovyanGFX setup for GC9A01
 class LGFX : public lgfx::LGFX_Device
@@ -65,6 +74,12 @@ public:
   }
 };
 
+// GC9A01 pixel format (COLMOD, DBI bits). LovyanGFX always runs the panel
+// at 16 bits; DisplayDriver switches to 12 bits around its own flushes.
+#define GC9A01_CMD_COLMOD    0x3A
+#define GC9A01_COLMOD_12BIT  0x33
+#define GC9A01_COLMOD_16BIT  0x55
+
 #include "Theme.h"
 
 // Display dimensions
@@ -72,9 +87,78 @@ public:
 #define SCREEN_HEIGHT 240
 #define SCREEN_RADIUS 120
 
+// Render mode (select with -DDISPLAY_RENDER_MODE=n in platformio.ini)
+// DISPLAY_RENDER_DIRECT:    every primitive goes straight to the panel
+// DISPLAY_RENDER_FULLFRAME: frames are composed in a 240x240 RGB565 sprite and
+//                           only the dirty region is pushed with DMA (115 KB RAM)
+// DISPLAY_RENDER_BANDED:    frames are replayed into two 240xDISPLAY_BAND_HEIGHT
+//                           strips; one strip is on the wire while the CPU
+//                           rasterizes the next (2 x 11.5 KB RAM at 24 rows)
+// DISPLAY_RENDER_INDEXED:   like FULLFRAME, but the sprite holds 8-bit palette
+//                           indices (58 KB RAM) and is expanded to RGB565 on
+//                           flush; a theme change is a palette swap
+#define DISPLAY_RENDER_DIRECT     0
+#define DISPLAY_RENDER_FULLFRAME  1
+#define DISPLAY_RENDER_BANDED     2
+#define DISPLAY_RENDER_INDEXED    3
+#ifndef DISPLAY_RENDER_MODE
+#define DISPLAY_RENDER_MODE DISPLAY_RENDER_FULLFRAME
+#endif
+
+#ifndef DISPLAY_BAND_HEIGHT
+#define DISPLAY_BAND_HEIGHT 24
+#endif
+#define DISPLAY_BAND_COUNT ((SCREEN_HEIGHT + DISPLAY_BAND_HEIGHT - 1) / DISPLAY_BAND_HEIGHT)
+
+// Experimental, off by default: leave each flush's last transfers on the
+// wire and let the CPU go on (loop(), the next frame's logic) until the
+// buffer or the bus is needed again. Only those last transfers overlap,
+// and no frame-rate gain has been measured on the panel yet; compare the
+// [FRAME] and [DRAW] lines with 0 and 1 before turning it on.
+#ifndef DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH 0
+#endif
+
+// Save-under overlay layers (DisplayDriver::showOverlay()), drawn in order
+#define DISPLAY_OVERLAY_LAYERS 3
+
+// Wire format of frame flushes (DisplayDriver::setWireFormat())
+// DISPLAY_WIRE_RGB565: 2 bytes per pixel
+// DISPLAY_WIRE_RGB444: two pixels in 3 bytes, 25% less SPI time at 4 bits
+//                      per channel; meant for full-screen animation
+// Build with -DDISPLAY_WIRE_444_ENABLE=0 to keep the panel at 16 bits.
+#define DISPLAY_WIRE_RGB565  0
+#define DISPLAY_WIRE_RGB444  1
+#ifndef DISPLAY_WIRE_444_ENABLE
+#define DISPLAY_WIRE_444_ENABLE 1
+#endif
+static_assert(DISPLAY_BAND_COUNT <= 32, "DISPLAY_BAND_HEIGHT too small (max 32 bands)");
+
 // Display rotation angle (in degrees, counter-clockwise)
-// Set to -60 for mounting position rotated 60° counter-clockwise
+// Set to -60 for mounting position rotated 60° counter-clockwise.
+// By default the panel uses LovyanGFX's DISPLAY_ROTATION_QUARTER (0-3, in
+// 90° steps). DISPLAY_ROTATION_RESAMPLE=1 opts in to the exact angle: with
+// a back buffer the frame is resampled through RotationTable at flush time,
+// which costs a 2-line buffer, turns off band transitions and sends every
+// draw through the back buffer. Banded and direct rendering always use the
+// quarter turn.
+#ifndef DISPLAY_ROTATION_ANGLE
 #define DISPLAY_ROTATION_ANGLE -60
+#endif
+#define DISPLAY_ROTATION_QUARTER 1
+#ifndef DISPLAY_ROTATION_RESAMPLE
+#define DISPLAY_ROTATION_RESAMPLE 0
+#endif
+
+// Rolling eyes (drawRollingEyes(), EyesWidget): two eyes either side of the
+// center and a breathing ring near the rim
+#define EYES_SPACING     55
+#define EYES_SIZE        35
+#define EYES_GLOW        2     // NEON halo beyond EYES_SIZE
+#define EYES_RING_INNER  110
+#define EYES_RING_OUTER  114
+#define EYES_BLINK_MS         250   // Longer than a 10 FPS frame period
+#define EYES_BLINK_PERIOD_MS  4000
 
 // Legacy color defines for backward compatibility (now use theme colors)
 #define COLOR_BLACK       0x0000
@@ -92,6 +176,25 @@ public:
 
 // Theme-based color access (preferred)
 
+// Bounding box of everything drawn since the last flush (inclusive coordinates)
+struct DirtyRect {
+  int16_t x0, y0, x1, y1;
+
+  DirtyRect() { clear(); }
+  void clear() { x0 = y0 = INT16_MAX; x1 = y1 = INT16_MIN; }
+  bool isEmpty() const { return x1 < x0 || y1 < y0; }
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+// What frames cost in draw calls and SPI transactions
+struct DrawStats {
+  uint32_t frames;        // Frames, banded passes and transition frames drawn
+  uint32_t calls;         // Primitives drawn inside them
+  uint32_t transactions;  // SPI transactions they opened (one per flush or direct frame)
+  uint32_t merged;        // Recorded fills merged into the one before (direct mode)
+  uint32_t flushWaitUs;   // Spent waiting for an earlier flush to leave the wire
+};
+
 class DisplayDriver {
 public:
   DisplayDriver();
@@ -102,12 +205,73 @@ public:
   uint8_t getBrightness() const { return currentBrightness; }
   
   // Theme management
-  void setTheme(ThemeType theme) { themeManager.setTheme(theme); }
+  // In indexed mode a theme change recolors the back buffer in place and
+  // flushes it; nothing needs to be redrawn
+  void setTheme(ThemeType theme) { themeManager.setTheme(theme); applyTheme(); }
   ThemeType getCurrentTheme() const { return themeManager.getCurrentTheme(); }
-  const ThemeColors& getThemeColors() const { return themeManager.getColors(); }
+  const ThemeColors& getThemeColors() const { return palette ? palette->getColors() : themeManager.getColors(); }
   const char* getThemeName() const { return themeManager.getThemeName(); }
-  void nextTheme() { themeManager.nextTheme(); }
-  void previousTheme() { themeManager.previousTheme(); }
+  void nextTheme() { themeManager.nextTheme(); applyTheme(); }
+  void previousTheme() { themeManager.previousTheme(); applyTheme(); }
+  bool isIndexed() const { return palette != nullptr; }
+  
+  // Frame composition
+  // Drawing between beginFrame() and endFrame() goes to the back buffer (if
+  // available); endFrame() pushes the union of dirty rectangles via DMA.
+  // Outside a frame all primitives draw directly to the panel. Without a
+  // back buffer a frame is one SPI transaction: shape primitives are
+  // recorded (see DrawList.h) and replayed in it.
+  void beginFrame();
+  void endFrame();
+  bool isBuffered() const { return backBufferReady; }
+  bool inFrame() const { return frameDepth > 0; }
+  
+  // Render one frame from a draw callback. In banded mode the callback is
+  // replayed once per strip, so it must draw the same frame every time it
+  // runs (sample millis() etc. outside the callback). Nested calls just draw.
+  void renderFrame(const std::function<void()>& draw);
+  
+  // Animate from the screen drawn by `from` to the one drawn by `to` (see
+  // Transition.h), one frame per transitionStep() call so the caller's
+  // loop keeps running in between. beginTransition() returns false if it
+  // cannot run (direct mode, inside a frame, or no memory for the strips).
+  // Each step draws the frame for the time elapsed since the begin and
+  // returns false once it has drawn the final one: the panel then shows
+  // `to`, so drawing the new screen afterwards changes nothing visible.
+  // `skipToEnd` draws that final frame right away. Both callbacks are
+  // replayed per strip like renderFrame(); buffered modes take the
+  // outgoing screen from the back buffer and never call `from`, so nothing
+  // else may draw until the transition is over.
+  bool beginTransition(TransitionType type, uint16_t durationMs = TRANSITION_DURATION_MS);
+  bool transitionStep(const std::function<void()>& from, const std::function<void()>& to,
+                      bool skipToEnd = false);
+  bool inTransition() const { return transitionActive; }
+  
+  // Save-under overlays on top of whatever frames draw underneath. A flush
+  // that touches an overlay saves the back buffer pixels under it, draws it,
+  // pushes, and puts the saved pixels back, so the back buffer only ever
+  // holds the screen itself. Hiding an overlay pushes just its own pixels.
+  // `draw` must stay inside the shape; it runs again on every such flush.
+  // A ring overlay covers only the annulus rInner..rOuter (rows up to maxY),
+  // so a thin ring does not need a full-screen save. Showing the same shape
+  // again replaces `draw`. Returns false without drawing when there is no
+  // back buffer or no memory for the save buffer.
+  bool showOverlay(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h, const std::function<void()>& draw);
+  bool showRingOverlay(uint8_t layer, int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner,
+                       const std::function<void()>& draw, int16_t maxY = SCREEN_HEIGHT - 1);
+  void hideOverlay(uint8_t layer);
+  bool hasOverlay(uint8_t layer) const { return layer < DISPLAY_OVERLAY_LAYERS && overlays[layer].active; }
+  
+  // Identifies the pixels on the current draw target. It changes whenever
+  // earlier drawing may be gone (screen clears, full-screen images, switching
+  // between panel and back buffer) and is 0 while banding, where every strip
+  // starts blank. Incremental redraws compare it with the id they drew on.
+  uint32_t getSurfaceId() const { return isBanding() ? 0 : (surfaceEpoch << 1) | (gfx == &canvas ? 1 : 0); }
+  uint32_t getSurfaceEpoch() const { return surfaceEpoch; }
+  
+  // True while nothing but the theme background has been drawn since the
+  // last full-screen fill (or since the current band strip was started)
+  bool isSurfaceBlank() const { return surfaceBlank && blankColor == getThemeColors().bg; }
   
   // Basic drawing
   void clear();
@@ -125,17 +289,45 @@ public:
   void setTextColor(uint16_t color);
   void setTextColor(uint16_t color, uint16_t bg);
   void setTextSize(uint8_t size);
+  // Font for every surface; drops cached text widths
+  void setFont(const lgfx::IFont* font);
   void setCursor(int16_t x, int16_t y);
   void print(const char* text);
   void print(String text);
   void println(const char* text);
   void println(String text);
+  // Sizes from SMOOTH_FONT_MIN_SIZE up use the anti-aliased glyph cache
+  // (opaque cells on the theme bg) when SMOOTH_FONT is enabled
   void drawCenteredText(const char* text, int16_t y, uint8_t size);
   void drawCenteredText(String text, int16_t y, uint8_t size);
   
+  // Anti-aliased text with its top-left at x, y, on the theme bg
+  void drawSmoothText(const char* text, int16_t x, int16_t y, uint16_t color);
+  
+  // Blit one digit-atlas glyph as an opaque color-on-bg cell of
+  // DIGIT_GLYPH_WIDTH x DIGIT_GLYPH_HEIGHT times size pixels. Characters
+  // outside the atlas paint an empty cell.
+  void drawDigitCell(int16_t x, int16_t y, char c, uint8_t size, uint16_t color, uint16_t bg);
+  
+  // Push what was drawn outside beginFrame()/endFrame(). Only needed when
+  // the panel is rotated at flush time: every draw then goes to the back
+  // buffer, and loop() calls this once per pass.
+  void flush();
+  
+  // Composite a w x h 4-bit alpha mask (two pixels per byte, even x in the
+  // low nibble, rows padded to whole bytes) in one color over `bg`. Only
+  // covered pixels are written, and never blended with what is there, so a
+  // mask redrawn every frame into an uncleared buffer stays the same.
+  void drawAlphaMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* alpha,
+                     uint16_t color, uint16_t bg);
+  
   // Advanced drawing
   void drawArc(int16_t x, int16_t y, int16_t r, int16_t startAngle, int16_t endAngle, uint16_t color);
+  // Solid annulus sector rInner..rOuter (inclusive), filled with horizontal spans.
+  // Angles in degrees, 0 = 3 o'clock, increasing clockwise; a 360° sweep is a full ring.
+  void fillArc(int16_t x, int16_t y, int16_t rOuter, int16_t rInner, int16_t startAngle, int16_t endAngle, uint16_t color);
   void drawProgressRing(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress, uint16_t color);
+  void invalidateProgressRing() { lastRing.surface = 0; }  // Next ring is drawn in full
   void drawProgressRingNeon(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress, uint16_t color);
   void drawTemperatureGauge(int16_t x, int16_t y, int16_t r, float temp, float target, uint16_t color);
   
@@ -146,6 +338,7 @@ public:
   
   // Eye animations
   void drawEye(int16_t x, int16_t y, int16_t size, int16_t pupilX, int16_t pupilY, bool blinking);
+  // frame counts FrameScheduler steps (FRAME_STEP_MS each)
   void drawRollingEyes(int16_t frame);
   
   // Icons and symbols (enhanced with better resolution)
@@ -156,6 +349,40 @@ public:
   void drawCheckIcon(int16_t x, int16_t y, uint16_t color);
   void drawTouchFeedbackRing(uint8_t alpha);
   
+  // Translucent fill / darken of what is already drawn (sprite targets; on
+  // the panel blendRect() blends over the background and dimRect() does
+  // nothing). Two pixels per word, see PixelKernels.h.
+  void blendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha);
+  void dimRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t amount);
+  
+  // Images (RGB565), centered on (x, y) and scaled by zoom (nearest neighbour)
+  void pushImageZoom(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* data, float zoom);
+  // Compressed frame of an animation whose top-left corner is (x, y), at an
+  // integer zoom, decoded row by row from flash. A delta writes only its
+  // changed spans.
+  void drawRleFrame(const RleFrame* frame, int16_t x, int16_t y, uint8_t zoom);
+  // Brings an animation at (x, y) from frame `shown` (-1: not on this
+  // surface, start from the keyframe) to `frame` by drawing the deltas in
+  // between
+  void drawRleAnimation(const RleAnimation* anim, int16_t shown, uint8_t frame,
+                        int16_t x, int16_t y, uint8_t zoom);
+  
+  // Draw calls per frame and the transactions they cost (calls minus
+  // transactions is what batching saved)
+  const DrawStats& getDrawStats();
+  void resetDrawStats();
+  
+  // Panel bytes not sent because they fell outside the round glass
+  uint32_t getMaskSavedBytes() const { return maskSavedBytes; }
+  
+  // Pixel format for flushes of the back buffer, strips and transitions.
+  // Direct drawing is always RGB565. Falls back to RGB565 if the packing
+  // buffers cannot be allocated.
+  void setWireFormat(uint8_t format);
+  uint8_t getWireFormat() const { return wireFormat; }
+  // Panel bytes not sent thanks to RGB444
+  uint32_t getWireSavedBytes() const { return wireSavedBytes; }
+  
   // Enhanced icons with NEON glow
   void drawPrinterIconNeon(int16_t x, int16_t y, uint16_t color);
   void drawTemperatureIconNeon(int16_t x, int16_t y, uint16_t color);
@@ -166,7 +393,7 @@ public:
   // Color conversion
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return tft.color565(r, g, b); }
   
-  // Helper functions
+  // Helper functions (widths are cached per text, font and size)
   int16_t getTextWidth(const char* text, uint8_t size);
   int16_t getTextWidth(String text, uint8_t size);
   uint16_t blendColor(uint16_t color1, uint16_t color2, uint8_t alpha);
@@ -177,8 +404,109 @@ public:
   
 private:
   LGFX tft;
+  LGFX_Sprite canvas;           // Back buffer (DISPLAY_RENDER_FULLFRAME/INDEXED)
+  IndexedPalette* palette;      // Set if the back buffer is indexed
+  uint16_t* indexLines;         // Two rows of expanded (or rotated) pixels for the flush
+  uint8_t* wireLines;           // Two rows packed as RGB444 (allocated on first use)
+  uint8_t wireFormat;
+  bool wirePacked;              // Panel is in 12-bit mode for this flush
+  bool flushInFlight;           // A flush's transaction is still open (DISPLAY_ASYNC_FLUSH)
+  uint8_t wireNext;             // wireLines row to fill next
+  LGFX_Sprite bands[2];         // Ping-pong strips (DISPLAY_RENDER_BANDED, transitions)
+  lgfx::LovyanGFX* targets[4];  // Every surface that mirrors text state
+  lgfx::LovyanGFX* gfx;         // Current draw target
+  bool backBufferReady;
+  bool bandsReady;
+  uint8_t frameDepth;
+  DirtyRect dirty;
+  int16_t bandTop;              // Screen row of the strip being rasterized
+  int16_t bandBottom;           // One past its last row
+  uint32_t bandContentMask;     // Strips that showed content last frame
+  bool transitionActive;        // Between beginTransition() and its last step
+  bool transitionOwnStrips;     // Strips allocated for it (not banded mode)
+  TransitionType transitionType;
+  uint16_t transitionDuration;
+  unsigned long transitionStart;
+  uint32_t maskSavedBytes;      // See getMaskSavedBytes()
+  uint32_t wireSavedBytes;      // See getWireSavedBytes()
+  uint32_t surfaceEpoch;        // Bumped whenever the whole target is repainted
+  bool surfaceBlank;            // See isSurfaceBlank()
+  uint16_t blankColor;
   uint8_t currentBrightness;
   ThemeManager themeManager;
+  DigitAtlas digitAtlas;
+  DrawList drawList;             // Direct-mode frame recording
+  TextLayoutCache textLayout;
+  SmoothGlyphCache smoothFont;
+  RotationTable rotation;        // Built when the back buffer is resampled at flush
+  uint16_t textColor;            // Last setTextColor(), for the smooth path
+  DrawStats drawStats;
+  
+  // One save-under layer (see showOverlay())
+  struct Overlay {
+    std::function<void()> draw;
+    uint8_t* saved;               // Back buffer pixels under the shape, span by span
+    int16_t x0, y0, x1, y1;       // Bounding box (inclusive, on screen)
+    int16_t cx, cy, rOuter, rInner;  // Ring shape if rOuter > 0
+    bool active;
+  } overlays[DISPLAY_OVERLAY_LAYERS];
+  uint8_t overlayPush;          // Layers whose pixels the next flush must push
+  
+  // Last progress ring drawn, so the next call can paint only the changed wedge
+  struct ProgressRingState {
+    uint32_t surface;             // getSurfaceId() it was drawn on (0 = none)
+    int16_t x, y, r, thickness;
+    uint8_t progress;
+    uint16_t color;
+    ThemeType theme;
+  } lastRing;
+  
+  bool isBanding() const { return gfx == &bands[0] || gfx == &bands[1]; }
+  bool isIndexedTarget() const { return palette && gfx == &canvas; }
+  // Color value for a draw target: RGB565, or a palette index on the indexed canvas
+  uint16_t ink(lgfx::LovyanGFX* target, uint16_t color) const {
+    return palette && target == &canvas ? palette->indexOf(color) : color;
+  }
+  uint16_t ink(uint16_t color) const { return ink(gfx, color); }
+  void applyTheme();
+  template <typename RowOp>
+  void forEachTargetRow(int16_t x, int16_t y, int16_t w, int16_t h, RowOp row);
+  int16_t ty(int16_t y) const { return y - bandTop; }  // Screen -> target row
+  bool markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  // Direct panel writes must not start while a flush is on the wire: it
+  // holds the bus and may have left the panel in 12-bit mode
+  void claimPanel() { if (gfx == &tft) finishFlush(); }
+  bool recording() const { return frameDepth > 0 && gfx == &tft && drawList.isReady(); }
+  bool record(DrawOp op, int16_t a, int16_t b, int16_t c, int16_t d, int16_t e, uint16_t color);
+  void replayCommands();
+  void markTextDirty(int16_t x, int16_t y, const char* text);
+  void flushDirty();
+  void endFlush();
+  void finishFlush();
+  void pushCanvas(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  bool placeOverlay(uint8_t layer, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner, const std::function<void()>& draw);
+  template <typename SpanOp>
+  void forEachOverlaySpan(const Overlay& o, SpanOp span);
+  void copyOverlay(const Overlay& o, bool save);
+  uint8_t activeOverlays() const;
+  bool composeOverlays();
+  void restoreOverlays();
+  void fillMasked(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void pushMasked(const lgfx::swap565_t* buf, int16_t bufTop, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void pushIndexed(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void pushRotated(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void beginWire();
+  void endWire();
+  void pushRow(int16_t x, int16_t y, int16_t w, const uint16_t* pixels);
+  void renderBands(const std::function<void()>& draw);
+  void startBand(LGFX_Sprite& strip, int band);
+  void endBands();
+  void transitionFrame(TransitionType type, uint8_t progress,
+                       const std::function<void()>& from, const std::function<void()>& to);
+  void fillArcSpans(int16_t cx, int16_t cy, int16_t rOuter, int16_t rInner, int32_t a0, int32_t a1, uint16_t color);
+  void paintProgressRing(int16_t x, int16_t y, int16_t r, int16_t thickness, uint8_t progress,
+                         uint16_t color, int32_t from, int32_t to);
 };
 
 #endif // DISPLAY_DRIVER_H
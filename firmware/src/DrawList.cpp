@@ -0,0 +1,95 @@
+/*
+ * Draw Command List Implementation
+ */
+
+#include "DrawList.h"
+
+DrawList::DrawList() :
+  cmds(nullptr),
+  count(0),
+  merged(0),
+  replayed(0) {
+}
+
+DrawList::~DrawList() {
+  free(cmds);
+}
+
+bool DrawList::begin() {
+  if (!cmds) {
+    cmds = (DrawCmd*)malloc(DRAW_LIST_CAPACITY * sizeof(DrawCmd));
+  }
+  count = 0;
+  return cmds != nullptr;
+}
+
+void DrawList::add(lgfx::LovyanGFX* target, DrawOp op, int16_t a, int16_t b, int16_t c, int16_t d,
+                   int16_t e, uint16_t color) {
+  if (merge(op, a, b, c, d, color)) {
+    merged++;
+    return;
+  }
+  if (count == DRAW_LIST_CAPACITY) {
+    replay(target);
+  }
+  DrawCmd& cmd = cmds[count++];
+  cmd.op = op;
+  cmd.a = a;
+  cmd.b = b;
+  cmd.c = c;
+  cmd.d = d;
+  cmd.e = e;
+  cmd.color = color;
+}
+
+// Grow the last command if this fill is the next row below it (same
+// columns) or the next run to its right (same rows)
+bool DrawList::merge(DrawOp op, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (op != DRAW_FILL_RECT || count == 0) return false;
+  DrawCmd& last = cmds[count - 1];
+  if (last.op != DRAW_FILL_RECT || last.color != color) return false;
+
+  if (last.a == x && last.c == w && last.b + last.d == y) {
+    last.d += h;
+    return true;
+  }
+  if (last.b == y && last.d == h && last.a + last.c == x) {
+    last.c += w;
+    return true;
+  }
+  return false;
+}
+
+void DrawList::replay(lgfx::LovyanGFX* target) {
+  for (uint16_t i = 0; i < count; i++) {
+    const DrawCmd& cmd = cmds[i];
+    switch (cmd.op) {
+      case DRAW_PIXEL:
+        target->drawPixel(cmd.a, cmd.b, cmd.color);
+        break;
+      case DRAW_LINE:
+        target->drawLine(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color);
+        break;
+      case DRAW_RECT:
+        target->drawRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color);
+        break;
+      case DRAW_FILL_RECT:
+        target->fillRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color);
+        break;
+      case DRAW_ROUND_RECT:
+        target->drawRoundRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.e, cmd.color);
+        break;
+      case DRAW_FILL_ROUND_RECT:
+        target->fillRoundRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.e, cmd.color);
+        break;
+      case DRAW_CIRCLE:
+        target->drawCircle(cmd.a, cmd.b, cmd.c, cmd.color);
+        break;
+      case DRAW_FILL_CIRCLE:
+        target->fillCircle(cmd.a, cmd.b, cmd.c, cmd.color);
+        break;
+    }
+  }
+  replayed += count;
+  count = 0;
+}
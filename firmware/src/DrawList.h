@@ -0,0 +1,74 @@
+/*
+ * Draw Command List
+ *
+ * When a frame is drawn straight to the panel (no back buffer), every
+ * LovyanGFX primitive is its own SPI transaction with its own address
+ * window. DisplayDriver records the frame's shape primitives here instead
+ * and replays them inside the frame's single startWrite()/endWrite() pair.
+ * Solid fills that continue the previous one (the next row of a span fill,
+ * or the next span on the same rows) are merged into one rectangle, so a
+ * masked box fill becomes a handful of windows instead of one per row.
+ *
+ * Commands keep their order: later primitives may overdraw earlier ones,
+ * so only neighbouring fills are merged, never reordered.
+ */
+
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#define LGFX_USE_V1
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+
+#define DRAW_LIST_CAPACITY 192  // Commands buffered before an early replay
+
+enum DrawOp : uint8_t {
+  DRAW_PIXEL,         // x, y
+  DRAW_LINE,          // x0, y0, x1, y1
+  DRAW_RECT,          // x, y, w, h
+  DRAW_FILL_RECT,     // x, y, w, h
+  DRAW_ROUND_RECT,    // x, y, w, h, r
+  DRAW_FILL_ROUND_RECT,
+  DRAW_CIRCLE,        // x, y, r
+  DRAW_FILL_CIRCLE
+};
+
+struct DrawCmd {
+  DrawOp op;
+  int16_t a, b, c, d, e;
+  uint16_t color;
+};
+
+class DrawList {
+public:
+  DrawList();
+  ~DrawList();
+
+  // Allocate the command buffer; false leaves recording off
+  bool begin();
+  bool isReady() const { return cmds != nullptr; }
+
+  // Append a command, merging it into the previous fill when it continues
+  // it. Replays into `target` first if the buffer is full.
+  void add(lgfx::LovyanGFX* target, DrawOp op, int16_t a, int16_t b, int16_t c, int16_t d,
+           int16_t e, uint16_t color);
+
+  // Draw every pending command into `target` and empty the list. Must be
+  // called inside target->startWrite().
+  void replay(lgfx::LovyanGFX* target);
+
+  bool isEmpty() const { return count == 0; }
+  uint32_t getMerged() const { return merged; }
+  uint32_t getReplayed() const { return replayed; }
+  void resetStats() { merged = replayed = 0; }
+
+private:
+  bool merge(DrawOp op, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  DrawCmd* cmds;
+  uint16_t count;
+  uint32_t merged;      // Commands folded into the one before
+  uint32_t replayed;    // Commands drawn
+};
+
+#endif // DRAW_LIST_H
@@ -0,0 +1,107 @@
+/*
+ * Fixed-Point Math Implementation
+ */
+
+#include "FixedMath.h"
+
+// sin(0..90 degrees) in 257 steps, Q15
+static const int16_t SIN_QUARTER[257] PROGMEM = {
+      0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+   2410,  2611,  2811,  3012,  3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,
+   4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6786,  6983,
+   7179,  7375,  7571,  7767,  7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+   9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+  14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+  16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+  20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+  22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+  23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674,
+  26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+  28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+  29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050,
+  31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+  31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+  32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+  32757, 32761, 32765, 32766, 32767
+};
+
+// atan(i / 64) for i = 0..64, in binary angle units (0..512 = 0..45 degrees)
+static const int16_t ATAN_OCTANT[65] PROGMEM = {
+    0,  10,  20,  31,  41,  51,  61,  71,  81,  91, 101, 111, 121,
+  131, 140, 150, 160, 169, 179, 188, 197, 207, 216, 225, 234, 243,
+  252, 260, 269, 277, 286, 294, 302, 310, 318, 326, 334, 342, 349,
+  357, 364, 371, 379, 386, 393, 399, 406, 413, 419, 426, 432, 439,
+  445, 451, 457, 463, 469, 474, 480, 486, 491, 496, 502, 507, 512
+};
+
+int16_t fxSin(int32_t angle) {
+  angle &= FX_ANGLE_MASK;
+  
+  // Fold onto the first quadrant: the table holds one quarter wave
+  bool negative = angle >= FX_ANGLE_HALF;
+  angle &= FX_ANGLE_HALF - 1;
+  if (angle > FX_ANGLE_QUARTER) {
+    angle = FX_ANGLE_HALF - angle;
+  }
+  
+  // 4 angle units per table step: interpolate the 2 fractional bits
+  int32_t index = angle >> 2;
+  int32_t frac = angle & 3;
+  int32_t a = (int16_t)pgm_read_word(&SIN_QUARTER[index]);
+  int32_t value = a;
+  if (frac) {
+    int32_t b = (int16_t)pgm_read_word(&SIN_QUARTER[index + 1]);
+    value = a + (((b - a) * frac) >> 2);
+  }
+  return negative ? -value : value;
+}
+
+int32_t fxAtan2(int32_t y, int32_t x) {
+  if (x == 0 && y == 0) return 0;
+  
+  int32_t ax = abs(x);
+  int32_t ay = abs(y);
+  
+  // Angle within the octant, from the ratio of the smaller to the larger
+  // component in Q12 (64 table steps of 64)
+  int32_t ratio = ay <= ax ? (ay << 12) / ax : (ax << 12) / ay;
+  int32_t index = ratio >> 6;
+  int32_t frac = ratio & 63;
+  int32_t a = (int16_t)pgm_read_word(&ATAN_OCTANT[index]);
+  int32_t angle = a;
+  if (frac) {
+    int32_t b = (int16_t)pgm_read_word(&ATAN_OCTANT[index + 1]);
+    angle = a + (((b - a) * frac) >> 6);
+  }
+  
+  // Unfold octant -> quadrant -> full turn
+  if (ay > ax) angle = FX_ANGLE_QUARTER - angle;
+  if (x < 0) angle = FX_ANGLE_HALF - angle;
+  if (y < 0) angle = FX_ANGLE_FULL - angle;
+  return angle & FX_ANGLE_MASK;
+}
+
+uint32_t fxSqrt(uint32_t value) {
+  // Bit-by-bit square root: 16 iterations of shifts and adds
+  uint32_t result = 0;
+  uint32_t bit = 1UL << 30;
+  
+  while (bit > value) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return result;
+}
@@ -0,0 +1,58 @@
+/*
+ * Fixed-Point Math
+ *
+ * Integer trigonometry and geometry for the ESP32-C3, which has no FPU.
+ * Angles are binary angle units: FX_ANGLE_FULL (4096) per turn, so wrapping
+ * is a mask. Sine/cosine results are Q15 (32767 = 1.0).
+ */
+
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#include <Arduino.h>
+
+#define FX_ANGLE_FULL     4096
+#define FX_ANGLE_HALF     2048
+#define FX_ANGLE_QUARTER  1024
+#define FX_ANGLE_MASK     (FX_ANGLE_FULL - 1)
+#define FX_Q15_ONE        32767
+
+// Degrees -> binary angle (rounded)
+inline int32_t fxDegToAngle(int32_t deg) {
+  return (deg * FX_ANGLE_FULL + (deg >= 0 ? 180 : -180)) / 360;
+}
+
+// Q15 sine/cosine of a binary angle (any value, wraps)
+int16_t fxSin(int32_t angle);
+inline int16_t fxCos(int32_t angle) { return fxSin(angle + FX_ANGLE_QUARTER); }
+
+// Q15 sine/cosine of an angle in degrees
+inline int16_t fxSinDeg(int32_t deg) { return fxSin(fxDegToAngle(deg)); }
+inline int16_t fxCosDeg(int32_t deg) { return fxCos(fxDegToAngle(deg)); }
+
+// value * q15, rounded to nearest
+inline int32_t fxMulQ15(int32_t value, int32_t q15) {
+  return (value * q15 + (1 << 14)) >> 15;
+}
+
+// Phase of an oscillator after `ticks` (e.g. millis()) at rateQ10 / 1024
+// angle units per tick. Unsigned overflow wraps cleanly onto the circle.
+// A rate of w rad/tick is rateQ10 = w * 4096 / (2 * PI) * 1024.
+inline int32_t fxPhase(uint32_t ticks, uint32_t rateQ10) {
+  return ((ticks * rateQ10) >> 10) & FX_ANGLE_MASK;
+}
+
+// Binary angle (0..FX_ANGLE_FULL-1) of the vector (x, y), y pointing down
+// like screen coordinates, 0 = +x axis
+int32_t fxAtan2(int32_t y, int32_t x);
+
+// floor(sqrt(value))
+uint32_t fxSqrt(uint32_t value);
+
+// Point at distance r from (cx, cy) along a binary angle
+inline void fxPolar(int16_t cx, int16_t cy, int32_t r, int32_t angle, int16_t& x, int16_t& y) {
+  x = cx + fxMulQ15(r, fxCos(angle));
+  y = cy + fxMulQ15(r, fxSin(angle));
+}
+
+#endif // FIXED_MATH_H
@@ -0,0 +1,97 @@
+/*
+ * Frame Scheduler Implementation
+ */
+
+#include "FrameScheduler.h"
+
+// Adaptation thresholds
+#define OVERLOAD_FRAMES   4    // Frames over budget before degrading
+#define RECOVER_FRAMES    32   // Frames comfortably under budget before recovering
+
+FrameScheduler::FrameScheduler() :
+  targetPeriod(50),
+  lastTick(0),
+  stepRemainder(0),
+  lastFrame(0),
+  renderStart(0),
+  overloadStreak(0),
+  idleStreak(0)
+{
+  stats.frames = 0;
+  stats.overruns = 0;
+  stats.avgRenderUs = 0;
+  stats.maxRenderUs = 0;
+  stats.periodMs = targetPeriod;
+  stats.quality = FRAME_QUALITY_FULL;
+}
+
+void FrameScheduler::setTargetPeriod(uint16_t periodMs) {
+  if (periodMs == targetPeriod) return;
+  targetPeriod = periodMs;
+  stats.periodMs = periodMs;
+  stats.quality = FRAME_QUALITY_FULL;
+  overloadStreak = 0;
+  idleStreak = 0;
+}
+
+uint32_t FrameScheduler::advance(unsigned long now) {
+  uint32_t elapsed = now - lastTick;
+  lastTick = now;
+  if (elapsed > FRAME_MAX_CATCHUP_MS) {
+    elapsed = FRAME_MAX_CATCHUP_MS;
+  }
+
+  elapsed += stepRemainder;
+  stepRemainder = elapsed % FRAME_STEP_MS;
+  return elapsed / FRAME_STEP_MS;
+}
+
+void FrameScheduler::beginRender(unsigned long now) {
+  // Keep the cadence unless we fell a whole period behind
+  lastFrame = (now - lastFrame < 2UL * stats.periodMs) ? lastFrame + stats.periodMs : now;
+  renderStart = micros();
+}
+
+void FrameScheduler::endRender() {
+  uint32_t renderUs = micros() - renderStart;
+
+  stats.frames++;
+  stats.maxRenderUs = max(stats.maxRenderUs, renderUs);
+  // Moving average over ~8 frames
+  stats.avgRenderUs = stats.frames == 1 ? renderUs : stats.avgRenderUs - stats.avgRenderUs / 8 + renderUs / 8;
+  if (renderUs > stats.periodMs * 1000UL) {
+    stats.overruns++;
+  }
+
+  adapt();
+}
+
+// Degrade effects first, then frame rate; recover in the reverse order
+void FrameScheduler::adapt() {
+  uint32_t budgetUs = stats.periodMs * 1000UL;
+
+  if (stats.avgRenderUs > budgetUs * 3 / 4) {
+    idleStreak = 0;
+    if (++overloadStreak < OVERLOAD_FRAMES) return;
+    overloadStreak = 0;
+
+    if (stats.quality > FRAME_QUALITY_MINIMAL) {
+      stats.quality--;
+    } else if (stats.periodMs < targetPeriod * 2) {
+      stats.periodMs = min<uint16_t>(stats.periodMs + stats.periodMs / 4, targetPeriod * 2);
+    }
+  } else if (stats.avgRenderUs < budgetUs / 3) {
+    overloadStreak = 0;
+    if (++idleStreak < RECOVER_FRAMES) return;
+    idleStreak = 0;
+
+    if (stats.periodMs > targetPeriod) {
+      stats.periodMs = max<uint16_t>(stats.periodMs - stats.periodMs / 5, targetPeriod);
+    } else if (stats.quality < FRAME_QUALITY_FULL) {
+      stats.quality++;
+    }
+  } else {
+    overloadStreak = 0;
+    idleStreak = 0;
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * Frame Scheduler
+ *
+ * Owns the UI clock. Animations advance by elapsed time in fixed steps, so
+ * their speed no longer depends on how long loop() was blocked by the
+ * network. Frames are rendered at a target period; the scheduler measures
+ * what each render costs and, when frames keep overrunning, first drops
+ * effect quality and then stretches the period. It recovers the same way
+ * once renders are cheap again.
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+
+#define FRAME_STEP_MS        10    // One animation step
+#define FRAME_MAX_CATCHUP_MS 1000  // Longest stall animations skip ahead over
+
+// Effect levels, highest first
+#define FRAME_QUALITY_FULL     2   // Everything
+#define FRAME_QUALITY_REDUCED  1   // No glow halos
+#define FRAME_QUALITY_MINIMAL  0   // No halos, particles or ambient rings
+
+struct FrameStats {
+  uint32_t frames;        // Frames rendered
+  uint32_t overruns;      // Renders that took longer than the period
+  uint32_t avgRenderUs;   // Moving average of the render time
+  uint32_t maxRenderUs;   // Worst render time since resetStats()
+  uint16_t periodMs;      // Current frame period (target or degraded)
+  uint8_t quality;        // FRAME_QUALITY_*
+};
+
+class FrameScheduler {
+public:
+  FrameScheduler();
+
+  // Frame period for the current screen; changing it restarts adaptation
+  void setTargetPeriod(uint16_t periodMs);
+
+  // Advance the clock to `now` and return the number of animation steps
+  // that elapsed (FRAME_STEP_MS each)
+  uint32_t advance(unsigned long now);
+
+  // True if a frame is due at `now`
+  bool frameDue(unsigned long now) const { return now - lastFrame >= stats.periodMs; }
+
+  // Bracket the render of a due frame
+  void beginRender(unsigned long now);
+  void endRender();
+
+  uint8_t getQuality() const { return stats.quality; }
+  const FrameStats& getStats() const { return stats; }
+  void resetStats() { stats.maxRenderUs = 0; }
+
+private:
+  void adapt();
+
+  FrameStats stats;
+  uint16_t targetPeriod;
+  unsigned long lastTick;     // Clock position of advance()
+  uint32_t stepRemainder;     // Milliseconds not yet turned into a step
+  unsigned long lastFrame;    // When the last frame started
+  unsigned long renderStart;  // micros() at beginRender()
+  uint8_t overloadStreak;     // Consecutive frames over budget
+  uint8_t idleStreak;         // Consecutive frames well under budget
+};
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,136 @@
+/*
+ * Glow Text Implementation
+ */
+
+#include "GlowText.h"
+
+// Binomial kernels C(2r, k), scaled to sum to 256
+static const uint8_t GLOW_KERNELS[GLOW_MAX_RADIUS + 1][2 * GLOW_MAX_RADIUS + 1] PROGMEM = {
+  { 255 },                           // r = 0 (unused; 256 does not fit)
+  { 64, 128, 64 },                   // 1 2 1
+  { 16, 64, 96, 64, 16 },            // 1 4 6 4 1
+  { 4, 24, 60, 80, 60, 24, 4 }       // 1 6 15 20 15 6 1
+};
+
+// One blur pass over `count` lines of `len` samples, `step` apart within a
+// line and `next` apart between lines
+static void blurPass(const uint8_t* src, uint8_t* dst, int16_t len, int16_t count,
+                     int16_t step, int16_t next, uint8_t radius) {
+  const uint8_t* kernel = GLOW_KERNELS[radius];
+  for (int16_t line = 0; line < count; line++) {
+    const uint8_t* in = src + line * next;
+    uint8_t* out = dst + line * next;
+    for (int16_t i = 0; i < len; i++) {
+      uint16_t sum = 0;
+      for (int16_t k = -radius; k <= radius; k++) {
+        int16_t j = i + k;
+        if (j < 0 || j >= len) continue;
+        sum += in[j * step] * pgm_read_byte(&kernel[k + radius]);
+      }
+      out[i * step] = sum >> 8;
+    }
+  }
+}
+
+GlowText::GlowText() :
+  size(0),
+  radius(0),
+  strength(0),
+  width(0),
+  height(0),
+  alpha(nullptr),
+  failed(false)
+{
+  text[0] = '\0';
+}
+
+GlowText::~GlowText() {
+  free(alpha);
+}
+
+void GlowText::draw(DisplayDriver* display, const char* str, int16_t centerX, int16_t y,
+                    uint8_t textSize, uint16_t color, uint8_t glowRadius, uint8_t glowStrength) {
+  glowRadius = min<uint8_t>(glowRadius, GLOW_MAX_RADIUS);
+  if ((!alpha && !failed) || textSize != size || glowRadius != radius || glowStrength != strength ||
+      strncmp(str, text, GLOW_MAX_TEXT) != 0) {
+    strncpy(text, str, GLOW_MAX_TEXT);
+    text[GLOW_MAX_TEXT] = '\0';
+    size = textSize;
+    radius = glowRadius;
+    strength = glowStrength;
+    // Out of memory is not retried until the text or size changes
+    failed = !rebuild(display);
+  }
+  if (failed) {
+    // Plain text without the halo
+    display->setTextColor(color);
+    display->drawCenteredText(text, y, size);
+    return;
+  }
+
+  display->drawAlphaMask(centerX - width / 2, y - radius, width, height, alpha, color,
+                         display->getThemeColors().bg);
+}
+
+bool GlowText::rebuild(DisplayDriver* display) {
+  free(alpha);
+  alpha = nullptr;
+
+  // Measured on the scratch sprite's own font state, so the display's
+  // text size is left as the caller set it
+  LGFX_Sprite scratch(display->getTFT());
+  scratch.setTextSize(size);
+  width = scratch.textWidth(text) + 2 * radius;
+  height = DIGIT_GLYPH_HEIGHT * size + 2 * radius;
+  int32_t pixels = (int32_t)width * height;
+
+  // Rasterize the text once; any non-zero pixel is ink
+  scratch.setColorDepth(16);
+  scratch.setPsram(false);
+  if (!scratch.createSprite(width, height)) return false;
+  scratch.fillSprite(0);
+  scratch.setTextColor(0xFFFF);
+  scratch.setCursor(radius, radius);
+  scratch.print(text);
+
+  uint8_t* ink = (uint8_t*)malloc(pixels * 2);
+  if (!ink) {
+    scratch.deleteSprite();
+    return false;
+  }
+  const uint16_t* src = (const uint16_t*)scratch.getBuffer();
+  for (int32_t i = 0; i < pixels; i++) {
+    ink[i] = src[i] ? 255 : 0;
+  }
+  scratch.deleteSprite();
+
+  // Separable blur: rows into the second half, then columns back
+  uint8_t* tmp = ink + pixels;
+  uint8_t* halo = tmp;
+  if (radius > 0) {
+    blurPass(ink, tmp, width, height, 1, width, radius);
+    halo = (uint8_t*)malloc(pixels);
+    if (!halo) {
+      free(ink);
+      return false;
+    }
+    blurPass(tmp, halo, height, width, width, 1, radius);
+  }
+
+  // Pack: ink is opaque, the halo is scaled to the requested strength
+  int16_t stride = (width + 1) / 2;
+  alpha = (uint8_t*)calloc(stride * height, 1);
+  if (alpha) {
+    for (int16_t py = 0; py < height; py++) {
+      for (int16_t px = 0; px < width; px++) {
+        int32_t i = (int32_t)py * width + px;
+        uint8_t a = ink[i] ? 15 : (radius > 0 ? (halo[i] * strength * 15 + 32512) / 65025 : 0);
+        alpha[py * stride + px / 2] |= a << ((px & 1) * 4);
+      }
+    }
+  }
+
+  if (radius > 0) free(halo);
+  free(ink);
+  return alpha != nullptr;
+}
@@ -0,0 +1,49 @@
+/*
+ * Glow Text
+ *
+ * Soft NEON halo behind a string. The text is rendered once into a mask,
+ * blurred with a separable binomial kernel and packed to 4-bit alpha. Every
+ * frame then composites that single mask in the requested color instead of
+ * re-printing the string at a dozen offsets. The mask is rebuilt only when
+ * the text, size or glow parameters change; color (and so the theme) is
+ * applied at composite time.
+ */
+
+#ifndef GLOW_TEXT_H
+#define GLOW_TEXT_H
+
+#include <Arduino.h>
+#include "DisplayDriver.h"
+
+#define GLOW_MAX_RADIUS  3
+#define GLOW_MAX_TEXT    24
+
+class GlowText {
+public:
+  GlowText();
+  ~GlowText();
+
+  // Text centered on centerX with its top at y, with a halo `radius` pixels
+  // wide whose peak is `strength` (0-255) of the text color
+  void draw(DisplayDriver* display, const char* text, int16_t centerX, int16_t y,
+            uint8_t size, uint16_t color, uint8_t radius, uint8_t strength);
+
+private:
+  bool rebuild(DisplayDriver* display);
+
+  // Cache key
+  char text[GLOW_MAX_TEXT + 1];
+  uint8_t size;
+  uint8_t radius;
+  uint8_t strength;
+
+  int16_t width;    // Mask size, text plus halo on every side
+  int16_t height;
+  uint8_t* alpha;   // 4-bit alpha, two pixels per byte (even x in the low nibble)
+  bool failed;      // Last rebuild ran out of memory
+
+  GlowText(const GlowText&);
+  GlowText& operator=(const GlowText&);
+};
+
+#endif // GLOW_TEXT_H
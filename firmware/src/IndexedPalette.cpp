@@ -0,0 +1,151 @@
+/*
+ * Indexed Color Palette Implementation
+ */
+
+#include "IndexedPalette.h"
+#include "DisplayDriver.h"
+
+#define TABLE_SIZE (PALETTE_SIZE * 2)
+
+// Theme roles in ramp order
+static uint16_t ThemeColors::* const ROLES[PALETTE_ROLES] = {
+  &ThemeColors::bg,
+  &ThemeColors::text,
+  &ThemeColors::accent,
+  &ThemeColors::warning,
+  &ThemeColors::error,
+  &ThemeColors::success,
+  &ThemeColors::secondary,
+  &ThemeColors::highlight,
+  &ThemeColors::dimmed
+};
+
+static const uint16_t LITERALS[] = {
+  COLOR_BLACK, COLOR_WHITE, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_YELLOW,
+  COLOR_ORANGE, COLOR_CYAN, COLOR_MAGENTA, COLOR_GRAY, COLOR_DARK_GRAY, COLOR_LIGHT_GRAY
+};
+
+static uint16_t hashColor(uint16_t color) {
+  return ((uint32_t)color * 40503u >> 7) & (TABLE_SIZE - 1);
+}
+
+static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// alpha = 255 gives color1, 0 gives color2 (same as DisplayDriver::blendColor)
+static uint16_t blend565(uint16_t color1, uint16_t color2, uint8_t alpha) {
+  int16_t r2 = (color2 >> 11) & 0x1F;
+  int16_t g2 = (color2 >> 5) & 0x3F;
+  int16_t b2 = color2 & 0x1F;
+
+  int16_t r = r2 + ((((color1 >> 11) & 0x1F) - r2) * alpha) / 255;
+  int16_t g = g2 + ((((color1 >> 5) & 0x3F) - g2) * alpha) / 255;
+  int16_t b = b2 + (((color1 & 0x1F) - b2) * alpha) / 255;
+
+  return (r << 11) | (g << 5) | b;
+}
+
+IndexedPalette::IndexedPalette() {
+  memset(colors, 0, sizeof(colors));
+  memset(swapped, 0, sizeof(swapped));
+  for (uint16_t i = 0; i < TABLE_SIZE; i++) {
+    table[i].index = -1;
+  }
+  keyed = THEMES[THEME_DARK];
+}
+
+void IndexedPalette::build(const ThemeColors& theme) {
+  for (uint16_t i = 0; i < TABLE_SIZE; i++) {
+    table[i].index = -1;
+  }
+
+  // Literals first, so theme roles are the ones that get nudged
+  for (uint8_t i = 0; i < PALETTE_SIZE - PALETTE_LITERALS; i++) {
+    bool used = i < sizeof(LITERALS) / sizeof(LITERALS[0]);
+    set(PALETTE_LITERALS + i, used ? LITERALS[i] : COLOR_BLACK, used);
+  }
+
+  // Role ramps, full color first so it stays the closest to the theme
+  for (uint8_t role = 0; role < PALETTE_ROLES; role++) {
+    uint16_t base = theme.*ROLES[role];
+    for (int8_t level = PALETTE_LEVELS - 1; level >= 0; level--) {
+      uint16_t color = blend565(base, theme.bg, level * 255 / (PALETTE_LEVELS - 1));
+      set(role * PALETTE_LEVELS + level, unique(color), true);
+    }
+    keyed.*ROLES[role] = colors[role * PALETTE_LEVELS + PALETTE_LEVELS - 1];
+  }
+
+  // Fixed cube and grays; exact hits only where nothing else has the color
+  for (uint8_t i = 0; i < 64; i++) {
+    uint16_t color = rgb565((i >> 4) * 85, ((i >> 2) & 3) * 85, (i & 3) * 85);
+    set(PALETTE_CUBE + i, color, find(color) < 0);
+  }
+  for (uint8_t i = 0; i < 32; i++) {
+    uint8_t v = i * 255 / 31;
+    uint16_t color = rgb565(v, v, v);
+    set(PALETTE_GRAYS + i, color, find(color) < 0);
+  }
+}
+
+void IndexedPalette::set(uint8_t index, uint16_t color, bool alias) {
+  colors[index] = color;
+  swapped[index] = (color << 8) | (color >> 8);
+  if (!alias) return;
+
+  uint16_t slot = hashColor(color);
+  while (table[slot].index >= 0) {
+    slot = (slot + 1) & (TABLE_SIZE - 1);
+  }
+  table[slot].color = color;
+  table[slot].index = index;
+}
+
+int16_t IndexedPalette::find(uint16_t color) const {
+  for (uint16_t slot = hashColor(color); table[slot].index >= 0; slot = (slot + 1) & (TABLE_SIZE - 1)) {
+    if (table[slot].color == color) return table[slot].index;
+  }
+  return -1;
+}
+
+// Nudge the low bits of each channel until the color is not taken
+uint16_t IndexedPalette::unique(uint16_t color) const {
+  static const uint16_t BITS[6] = { 0x0001, 0x0020, 0x0800, 0x0002, 0x0040, 0x1000 };
+  for (uint8_t k = 0; k < 64; k++) {
+    uint16_t candidate = color;
+    for (uint8_t b = 0; b < 6; b++) {
+      if (k & (1 << b)) candidate ^= BITS[b];
+    }
+    if (find(candidate) < 0) return candidate;
+  }
+  return color;
+}
+
+uint8_t IndexedPalette::indexOf(uint16_t color) const {
+  int16_t index = find(color);
+  return index >= 0 ? index : quantize(color);
+}
+
+uint8_t IndexedPalette::quantize(uint16_t color) const {
+  uint8_t r = ((color >> 11) & 0x1F) * 255 / 31;
+  uint8_t g = ((color >> 5) & 0x3F) * 255 / 63;
+  uint8_t b = (color & 0x1F) * 255 / 31;
+
+  // Near-neutral colors go to the finer gray ramp
+  uint8_t hi = max(r, max(g, b));
+  uint8_t lo = min(r, min(g, b));
+  if (hi - lo <= 24) {
+    uint8_t lum = (r + 2 * g + b) / 4;
+    return PALETTE_GRAYS + (lum * 31 + 127) / 255;
+  }
+
+  return PALETTE_CUBE + ((r + 42) / 85) * 16 + ((g + 42) / 85) * 4 + (b + 42) / 85;
+}
+
+int16_t IndexedPalette::fade(uint16_t color, uint8_t amount) const {
+  int16_t index = find(color);
+  if (index < 0 || index >= PALETTE_RAMP_END) return -1;
+
+  uint8_t level = index % PALETTE_LEVELS;
+  return index - level + (level * amount + 127) / 255;
+}
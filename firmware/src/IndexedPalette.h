@@ -0,0 +1,75 @@
+/*
+ * Indexed Color Palette
+ *
+ * 256 colors for the 8-bit back buffer (DISPLAY_RENDER_INDEXED). Pixels
+ * hold palette indices, so a theme change only rewrites the palette:
+ *
+ *   0..143    9 theme roles x 16 levels, role color (level 15) faded down
+ *             to the theme background (level 0) - rebuilt per theme
+ *   144..207  4x4x4 color cube     } fixed, for colors that are not in
+ *   208..239  32 grays             } the palette (quantized)
+ *   240..255  legacy COLOR_* literals
+ *
+ * Drawing code keeps passing RGB565; the driver maps each color to its
+ * index. Every entry is made unique (by nudging low bits), so a theme role
+ * color never aliases a literal or another role and keeps following the
+ * theme after a swap.
+ */
+
+#ifndef INDEXED_PALETTE_H
+#define INDEXED_PALETTE_H
+
+#include <Arduino.h>
+#include "Theme.h"
+
+#define PALETTE_ROLES       9
+#define PALETTE_LEVELS      16
+#define PALETTE_RAMP_END    (PALETTE_ROLES * PALETTE_LEVELS)
+#define PALETTE_CUBE        PALETTE_RAMP_END
+#define PALETTE_GRAYS       (PALETTE_CUBE + 64)
+#define PALETTE_LITERALS    (PALETTE_GRAYS + 32)
+#define PALETTE_SIZE        256
+
+static_assert(PALETTE_LITERALS + 16 == PALETTE_SIZE, "Palette layout must fill 256 entries");
+
+class IndexedPalette {
+public:
+  IndexedPalette();
+
+  // Rebuild the role ramps for a theme
+  void build(const ThemeColors& theme);
+
+  // Theme colors as stored in the palette (what screens should draw with)
+  const ThemeColors& getColors() const { return keyed; }
+
+  // Exact entry for a color, else the nearest cube or gray entry
+  uint8_t indexOf(uint16_t color) const;
+
+  // Ramp entry `amount`/255 of the way from the background to a role color,
+  // or -1 if the color is not a ramp entry
+  int16_t fade(uint16_t color, uint8_t amount) const;
+
+  uint16_t colorAt(uint8_t index) const { return colors[index]; }
+
+  // Byte-swapped RGB565 per index, ready for the panel
+  const uint16_t* getSwapped() const { return swapped; }
+
+private:
+  int16_t find(uint16_t color) const;
+  uint8_t quantize(uint16_t color) const;
+  uint16_t unique(uint16_t color) const;
+  void set(uint8_t index, uint16_t color, bool alias);
+
+  ThemeColors keyed;
+  uint16_t colors[PALETTE_SIZE];
+  uint16_t swapped[PALETTE_SIZE];
+
+  // Open-addressed color -> index map (twice the palette size)
+  struct Slot {
+    uint16_t color;
+    int16_t index;    // -1 = empty
+  };
+  Slot table[PALETTE_SIZE * 2];
+};
+
+#endif // INDEXED_PALETTE_H
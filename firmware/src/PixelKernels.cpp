@@ -0,0 +1,153 @@
+/*
+ * RGB565 Pixel Kernels Implementation
+ *
+ * A word holds two pixels. Each channel is masked into both 16-bit lanes
+ * at bit 0 (R, B: 5 bits, G: 6 bits), so a product with a 0..32 weight
+ * (at most 11 bits) never reaches the neighbouring lane.
+ */
+
+#include "PixelKernels.h"
+
+#define LANES_5  0x001F001F
+#define LANES_6  0x003F003F
+
+static inline uint32_t swapPair(uint32_t w) {
+  return ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+}
+
+// Channels of both pixels, each in its own lanes
+struct Channels {
+  uint32_t r, g, b;
+
+  explicit Channels(uint32_t w) :
+    r((w >> 11) & LANES_5),
+    g((w >> 5) & LANES_6),
+    b(w & LANES_5) {
+  }
+};
+
+// Half a unit in every lane, to round the sums
+#define LANES_HALF  ((PX_ALPHA_ONE / 2) * 0x00010001)
+
+// Pack channel sums (weights adding up to PX_ALPHA_ONE) back into two pixels
+static inline uint32_t packPair(uint32_t r, uint32_t g, uint32_t b) {
+  return (((r + LANES_HALF) << (11 - PX_ALPHA_SHIFT)) & 0xF800F800) |
+         ((g + LANES_HALF) & 0x07E007E0) |
+         (((b + LANES_HALF) >> PX_ALPHA_SHIFT) & LANES_5);
+}
+
+// Apply op to every pixel pair; unaligned ends go through it alone in the
+// low lane
+template <typename Op>
+static void forEachPair(uint16_t* buf, size_t count, bool swapped, Op op) {
+  if (count > 0 && ((uintptr_t)buf & 2)) {
+    uint16_t px = swapped ? pxSwap(*buf) : *buf;
+    px = op(px);
+    *buf++ = swapped ? pxSwap(px) : px;
+    count--;
+  }
+
+  uint32_t* words = (uint32_t*)buf;
+  size_t pairs = count / 2;
+  if (swapped) {
+    for (size_t i = 0; i < pairs; i++) {
+      words[i] = swapPair(op(swapPair(words[i])));
+    }
+  } else {
+    for (size_t i = 0; i < pairs; i++) {
+      words[i] = op(words[i]);
+    }
+  }
+
+  if (count & 1) {
+    uint16_t* last = buf + count - 1;
+    uint16_t px = swapped ? pxSwap(*last) : *last;
+    px = op(px);
+    *last = swapped ? pxSwap(px) : px;
+  }
+}
+
+void pxDimBuffer(uint16_t* buf, size_t count, uint8_t amount, bool swapped) {
+  uint32_t a = pxAlpha(amount);
+  forEachPair(buf, count, swapped, [a](uint32_t w) {
+    Channels c(w);
+    return packPair(c.r * a, c.g * a, c.b * a);
+  });
+}
+
+void pxBlendBuffer(uint16_t* buf, size_t count, uint16_t color, uint8_t alpha, bool swapped) {
+  uint32_t a = pxAlpha(alpha);
+  uint32_t keep = PX_ALPHA_ONE - a;
+  // The color's share, the same in both lanes
+  Channels c((uint32_t)color | ((uint32_t)color << 16));
+  uint32_t r = c.r * a, g = c.g * a, b = c.b * a;
+  forEachPair(buf, count, swapped, [=](uint32_t w) {
+    Channels d(w);
+    return packPair(d.r * keep + r, d.g * keep + g, d.b * keep + b);
+  });
+}
+
+void pxCrossfade(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count,
+                 uint8_t alpha, bool swapped) {
+  uint32_t a = pxAlpha(alpha);
+  uint32_t keep = PX_ALPHA_ONE - a;
+  auto mix = [=](uint32_t f, uint32_t t) {
+    Channels cf(f), ct(t);
+    return packPair(cf.r * keep + ct.r * a, cf.g * keep + ct.g * a, cf.b * keep + ct.b * a);
+  };
+
+  // Pairs only when all three buffers share word alignment
+  size_t i = 0;
+  uintptr_t phase = (uintptr_t)dst & 2;
+  if (((uintptr_t)from & 2) == phase && ((uintptr_t)to & 2) == phase) {
+    if (count > 0 && phase) {
+      uint16_t px = mix(swapped ? pxSwap(from[0]) : from[0], swapped ? pxSwap(to[0]) : to[0]);
+      dst[0] = swapped ? pxSwap(px) : px;
+      i = 1;
+    }
+    for (; i + 1 < count; i += 2) {
+      uint32_t f = *(const uint32_t*)(from + i);
+      uint32_t t = *(const uint32_t*)(to + i);
+      if (swapped) {
+        *(uint32_t*)(dst + i) = swapPair(mix(swapPair(f), swapPair(t)));
+      } else {
+        *(uint32_t*)(dst + i) = mix(f, t);
+      }
+    }
+  }
+  for (; i < count; i++) {
+    uint16_t px = mix(swapped ? pxSwap(from[i]) : from[i], swapped ? pxSwap(to[i]) : to[i]);
+    dst[i] = swapped ? pxSwap(px) : px;
+  }
+}
+
+void pxMaskShades(uint16_t* shades, uint16_t color, uint16_t bg, bool swapped) {
+  for (uint8_t a = 0; a < 16; a++) {
+    uint16_t px = pxBlend(color, bg, a * 17);
+    shades[a] = swapped ? pxSwap(px) : px;
+  }
+}
+
+void pxMaskRow(uint16_t* dst, const uint8_t* mask, int16_t first, int16_t count, const uint16_t* shades) {
+  for (int16_t i = 0; i < count; i++) {
+    int16_t m = first + i;
+    uint8_t a = (mask[m >> 1] >> ((m & 1) * 4)) & 0x0F;
+    if (a) dst[i] = shades[a];
+  }
+}
+
+// Top 4 bits of each channel as 0x0RGB
+static inline uint32_t to444(uint16_t px) {
+  return ((px >> 4) & 0xF00) | ((px >> 3) & 0x0F0) | ((px >> 1) & 0x00F);
+}
+
+void pxPack444(uint8_t* dst, const uint16_t* src, size_t count, bool swapped) {
+  for (size_t i = 0; i + 1 < count; i += 2) {
+    uint16_t a = swapped ? pxSwap(src[i]) : src[i];
+    uint16_t b = swapped ? pxSwap(src[i + 1]) : src[i + 1];
+    uint32_t pair = (to444(a) << 12) | to444(b);
+    *dst++ = pair >> 16;
+    *dst++ = pair >> 8;
+    *dst++ = pair;
+  }
+}
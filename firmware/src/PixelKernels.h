@@ -0,0 +1,69 @@
+/*
+ * RGB565 Pixel Kernels
+ *
+ * Blend, dim and crossfade without divides. Alpha is reduced to 0..32 with
+ * a shift, which is as fine as RGB565's 5-bit channels can show. Single
+ * pixels use the spread-word trick (one multiply); buffers are processed
+ * two pixels per 32-bit word, each channel in its own 16-bit lane.
+ *
+ * Buffer kernels take `swapped` for byte-swapped RGB565, the layout of
+ * LovyanGFX sprite memory.
+ */
+
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <Arduino.h>
+
+#define PX_ALPHA_SHIFT  5
+#define PX_ALPHA_ONE    (1 << PX_ALPHA_SHIFT)
+
+// 0..255 -> 0..PX_ALPHA_ONE, rounded
+inline uint32_t pxAlpha(uint8_t alpha) {
+  return (alpha + 4) >> 3;
+}
+
+inline uint16_t pxSwap(uint16_t color) {
+  return (color << 8) | (color >> 8);
+}
+
+// alpha = 255 gives fg, 0 gives bg
+inline uint16_t pxBlend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  // G moves to the upper half, leaving room above R and B for the product
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+  uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  // 0x02008010: one half in each field, to round
+  b += ((f - b) * pxAlpha(alpha) + 0x02008010) >> PX_ALPHA_SHIFT;
+  b &= 0x07E0F81F;
+  return (uint16_t)(b | (b >> 16));
+}
+
+// amount = 255 leaves the color, 0 gives black
+inline uint16_t pxDim(uint16_t color, uint8_t amount) {
+  return pxBlend(color, 0, amount);
+}
+
+// Scale `count` pixels towards black
+void pxDimBuffer(uint16_t* buf, size_t count, uint8_t amount, bool swapped);
+
+// Composite `color` over `count` pixels
+void pxBlendBuffer(uint16_t* buf, size_t count, uint16_t color, uint8_t alpha, bool swapped);
+
+// dst = from blended towards to (alpha = 255 gives to); dst may alias either
+void pxCrossfade(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count,
+                 uint8_t alpha, bool swapped);
+
+// 4-bit alpha masks (two pixels per byte, even x in the low nibble):
+// shades[a] is `color` at alpha a * 17 over `bg`, the same for every pixel,
+// so compositing never reads the destination
+void pxMaskShades(uint16_t* shades, uint16_t color, uint16_t bg, bool swapped);
+
+// Write shades[alpha] for `count` mask pixels starting at mask pixel
+// `first`; alpha 0 leaves the pixel as it is
+void pxMaskRow(uint16_t* dst, const uint8_t* mask, int16_t first, int16_t count, const uint16_t* shades);
+
+// Pack `count` (even) pixels as 12-bit RGB444 for the wire: three bytes
+// per pair, R1G1 B1R2 G2B2
+void pxPack444(uint8_t* dst, const uint16_t* src, size_t count, bool swapped);
+
+#endif // PIXEL_KERNELS_H
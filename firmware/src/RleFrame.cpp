@@ -0,0 +1,74 @@
+/*
+ * RLE Animation Frames Implementation
+ */
+
+#include "RleFrame.h"
+
+void RleDecoder::begin(const RleFrame* image) {
+  frame = image;
+  next = image->data;
+  end = image->data + (image->data ? image->size : 0);
+  y = 0;
+  spanCount = 0;
+  memcpy_P(lut, image->palette, min<uint16_t>(image->colors, 256) * sizeof(uint16_t));
+}
+
+bool RleDecoder::nextRow() {
+  if (y >= frame->height) return false;
+
+  uint16_t width = min<uint16_t>(frame->width, RLE_MAX_WIDTH);
+  uint16_t x = 0;
+  spanCount = 0;
+  while (x < width) {
+    // Every token must fit in the stream: a truncated frame stops here
+    // rather than reading whatever follows it in flash
+    uint8_t ctl = next < end ? pgm_read_byte(next) : 0xFF;
+    uint16_t bytes = ctl < 0x80 ? (frame->bits == 4 ? (ctl + 2) / 2 : ctl + 1) + 1 : ctl < 0xC0 ? 2 : 1;
+    if (end - next < bytes) {
+      y = frame->height;
+      spanCount = 0;
+      return false;
+    }
+    next++;
+    uint16_t count;
+    if (ctl < 0x80) {
+      count = min<uint16_t>(ctl + 1, width - x);
+      if (frame->bits == 4) {
+        for (uint16_t i = 0; i < count; i++) {
+          uint8_t pair = pgm_read_byte(next + i / 2);
+          indices[x + i] = (i & 1) ? pair & 0x0F : pair >> 4;
+        }
+        next += (ctl + 2) / 2;
+      } else {
+        memcpy_P(indices + x, next, count);
+        next += ctl + 1;
+      }
+    } else if (ctl < 0xC0) {
+      count = min<uint16_t>(ctl - 0x80 + 2, width - x);
+      memset(indices + x, pgm_read_byte(next++), count);
+    } else {
+      // Copy from the row above, or for deltas a skip: the indices (or the
+      // pixels on screen) are already there
+      x += ctl - 0xC0 + 1;
+      continue;
+    }
+
+    // Written pixels extend the last span if they follow it directly
+    if (spanCount > 0 && spanBounds[spanCount - 1][1] == x) {
+      spanBounds[spanCount - 1][1] = x + count;
+    } else if (spanCount < RLE_MAX_SPANS) {
+      spanBounds[spanCount][0] = x;
+      spanBounds[spanCount][1] = x + count;
+      spanCount++;
+    }
+    x += count;
+  }
+  if (!frame->delta) {
+    // Copies write pixels too
+    spanCount = 1;
+    spanBounds[0][0] = 0;
+    spanBounds[0][1] = width;
+  }
+  y++;
+  return true;
+}
@@ -0,0 +1,84 @@
+/*
+ * RLE Animation Frames
+ *
+ * Animation assets were raw RGB565 arrays: 28.8 KB of flash per 120x120
+ * frame, 115 KB per full-screen one. tools/rle_frames.py packs them as
+ * palette indices (up to 256 colors per asset, dithered at build time when
+ * it has to reduce them) in run-length tokens, coded row by row:
+ *
+ *   0x00-0x7F  literal: ctl + 1 indices follow (4-bit: two per byte)
+ *   0x80-0xBF  run: ctl - 0x80 + 2 copies of the next index
+ *   0xC0-0xFF  copy: ctl - 0xC0 + 1 indices as in the row above
+ *
+ * An animation is one keyframe plus a delta per frame. A delta codes only
+ * the rectangle that changed since the previous frame, and in it a copy
+ * token means skip: those pixels are left as the previous frame drew them.
+ * Each delta row is therefore a few spans of pixels to write, so both the
+ * dirty area and the SPI traffic follow the motion rather than the frame.
+ *
+ * RleDecoder streams a frame from flash one row at a time into a row of
+ * indices; callers expand that through the palette straight into their line
+ * buffer. The decoder copies the palette (already in panel byte order) to
+ * RAM once per frame, so expanding a pixel is one table load rather than a
+ * read through the flash cache. Nothing frame-sized is ever held in RAM.
+ */
+
+#ifndef RLE_FRAME_H
+#define RLE_FRAME_H
+
+#include <Arduino.h>
+
+#define RLE_MAX_WIDTH 240
+#define RLE_MAX_SPANS 16   // Written spans per delta row (the encoder merges down to this)
+
+struct RleFrame {
+  uint16_t x, y;            // Coded rectangle inside the animation
+  uint16_t width, height;   // 0 x 0 for a delta with no change
+  const uint16_t* palette;  // Byte-swapped RGB565
+  uint16_t colors;          // Palette entries (up to 256)
+  uint8_t bits;             // Index width: 8, or 4 for up to 16 colors
+  const uint8_t* data;      // Token stream, height rows
+  uint32_t size;            // Bytes in data: decoding never reads past it
+  bool delta;               // Copy tokens skip pixels of the previous frame
+};
+
+struct RleAnimation {
+  uint16_t width, height;
+  uint8_t frameCount;
+  const RleFrame* keyframe;  // Frame 0, complete
+  const RleFrame* deltas;    // deltas[i] turns frame i - 1 into frame i (deltas[0]: last into first)
+};
+
+class RleDecoder {
+public:
+  RleDecoder() : frame(nullptr), next(nullptr), end(nullptr), y(0), spanCount(0) {}
+
+  void begin(const RleFrame* image);
+
+  // Decode the next row into row(); false past the last one, or where the
+  // token stream ends early (no further rows are decoded then)
+  bool nextRow();
+  const uint8_t* row() const { return indices; }
+  int16_t rowIndex() const { return y - 1; }  // Row in row(), -1 before the first
+
+  // Columns of row() to write, as [start, end) pairs: the whole row for
+  // keyframes, what changed for deltas (none if nothing did)
+  uint8_t spans() const { return spanCount; }
+  uint8_t spanStart(uint8_t i) const { return spanBounds[i][0]; }
+  uint8_t spanEnd(uint8_t i) const { return spanBounds[i][1]; }
+
+  // Panel-order color of a palette index
+  uint16_t color(uint8_t index) const { return lut[index]; }
+
+private:
+  const RleFrame* frame;
+  const uint8_t* next;
+  const uint8_t* end;              // Past the frame's token stream
+  uint16_t y;                      // Rows decoded
+  uint8_t indices[RLE_MAX_WIDTH];  // Doubles as the row above for copies
+  uint8_t spanCount;
+  uint8_t spanBounds[RLE_MAX_SPANS][2];
+  uint16_t lut[256];               // The frame's palette, in RAM
+};
+
+#endif // RLE_FRAME_H
@@ -0,0 +1,59 @@
+/*
+ * Mounting Rotation Table Implementation
+ *
+ * Coordinates are measured from the panel center in half pixels, so pixel
+ * centers (x + 0.5) stay integers: h = 2x + 1 - SIZE.
+ */
+
+#include "RotationTable.h"
+#include "FixedMath.h"
+
+#define CENTER_Q16 ((int32_t)(ROTATION_TABLE_SIZE / 2) << 16)
+
+bool RotationTable::build(int16_t angle) {
+  free(rows);
+  rows = nullptr;
+  if (angle % 360 == 0) return false;
+
+  rows = (Row*)malloc(ROTATION_TABLE_SIZE * sizeof(Row));
+  if (!rows) return false;
+
+  cosQ15 = fxCosDeg(angle);
+  sinQ15 = fxSinDeg(angle);
+  stepU = cosQ15 * 2;
+  stepV = sinQ15 * 2;
+
+  // Source = center + R(angle) * (destination - center), as in
+  // DisplayDriver::rotateCoordinates(); half-pixel units halve the Q16 step
+  int32_t hx = 1 - ROTATION_TABLE_SIZE;
+  for (int16_t y = 0; y < ROTATION_TABLE_SIZE; y++) {
+    int32_t hy = 2 * y + 1 - ROTATION_TABLE_SIZE;
+    rows[y].u = CENTER_Q16 + (hx * stepU - hy * stepV) / 2;
+    rows[y].v = CENTER_Q16 + (hx * stepV + hy * stepU) / 2;
+  }
+  return true;
+}
+
+void RotationTable::destBounds(int16_t& x0, int16_t& y0, int16_t& x1, int16_t& y1) const {
+  // Corners of the source pixels' outer edges, relative to the center in
+  // half pixels, through the inverse rotation (Q15)
+  const int32_t hx[2] = { 2 * x0 - ROTATION_TABLE_SIZE, 2 * (x1 + 1) - ROTATION_TABLE_SIZE };
+  const int32_t hy[2] = { 2 * y0 - ROTATION_TABLE_SIZE, 2 * (y1 + 1) - ROTATION_TABLE_SIZE };
+  int32_t minX = INT32_MAX, maxX = INT32_MIN, minY = INT32_MAX, maxY = INT32_MIN;
+  for (uint8_t i = 0; i < 4; i++) {
+    int32_t sx = hx[i & 1], sy = hy[i >> 1];
+    int32_t dx = sx * cosQ15 + sy * sinQ15;
+    int32_t dy = sy * cosQ15 - sx * sinQ15;
+    minX = min(minX, dx);
+    maxX = max(maxX, dx);
+    minY = min(minY, dy);
+    maxY = max(maxY, dy);
+  }
+
+  // Back to pixels, one extra on each side for nearest-pixel sampling
+  const int32_t half = ROTATION_TABLE_SIZE / 2;
+  x0 = constrain(half + (minX >> 16) - 1, 0, ROTATION_TABLE_SIZE - 1);
+  y0 = constrain(half + (minY >> 16) - 1, 0, ROTATION_TABLE_SIZE - 1);
+  x1 = constrain(half + (maxX >> 16) + 1, 0, ROTATION_TABLE_SIZE - 1);
+  y1 = constrain(half + (maxY >> 16) + 1, 0, ROTATION_TABLE_SIZE - 1);
+}
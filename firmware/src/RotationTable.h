@@ -0,0 +1,58 @@
+/*
+ * Mounting Rotation Table
+ *
+ * The panel is mounted turned by DISPLAY_ROTATION_ANGLE, which is not a
+ * multiple of 90 degrees, so LovyanGFX's setRotation() cannot undo it.
+ * Instead the UI is drawn upright into the back buffer and resampled once
+ * per flush: destination pixel (x, y) on the panel shows source pixel
+ * rotateCoordinates(x, y). Along a row the source coordinate moves by a
+ * constant (cos, sin) step, so the table only holds each row's starting
+ * source coordinate, in Q16. A flushed row is then one add pair and one
+ * load per pixel, and primitives never see the angle.
+ */
+
+#ifndef ROTATION_TABLE_H
+#define ROTATION_TABLE_H
+
+#include <Arduino.h>
+
+#define ROTATION_TABLE_SIZE 240  // Panel width = height
+
+class RotationTable {
+public:
+  RotationTable() : rows(nullptr), stepU(0), stepV(0) {}
+  ~RotationTable() { free(rows); }
+
+  // Build the table for an angle in degrees; false (no table) for a
+  // multiple of 360 or when out of memory
+  bool build(int16_t angle);
+  bool isReady() const { return rows != nullptr; }
+
+  // Source coordinates (Q16) of the center of destination pixel (x, y)
+  void source(int16_t x, int16_t y, int32_t& u, int32_t& v) const {
+    u = rows[y].u + x * stepU;
+    v = rows[y].v + x * stepV;
+  }
+  int32_t getStepU() const { return stepU; }
+  int32_t getStepV() const { return stepV; }
+
+  // Grow an inclusive source rectangle to the destination rectangle that
+  // shows it (clipped to the panel)
+  void destBounds(int16_t& x0, int16_t& y0, int16_t& x1, int16_t& y1) const;
+
+private:
+  struct Row {
+    int32_t u, v;  // Source of destination column 0
+  };
+
+  Row* rows;
+  int32_t stepU;   // Source step per destination column (cos, sin)
+  int32_t stepV;
+  int32_t cosQ15;  // Kept for destBounds()
+  int32_t sinQ15;
+
+  RotationTable(const RotationTable&);
+  RotationTable& operator=(const RotationTable&);
+};
+
+#endif // ROTATION_TABLE_H
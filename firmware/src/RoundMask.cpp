@@ -0,0 +1,31 @@
+/*
+ * Round Panel Visibility Mask Implementation
+ */
+
+#include "RoundMask.h"
+
+#define ROUND_MASK_ROW(y) { roundMaskX0(y), roundMaskX1(y) }
+#define ROUND_MASK_4(y)   ROUND_MASK_ROW(y), ROUND_MASK_ROW(y + 1), ROUND_MASK_ROW(y + 2), ROUND_MASK_ROW(y + 3)
+#define ROUND_MASK_16(y)  ROUND_MASK_4(y), ROUND_MASK_4(y + 4), ROUND_MASK_4(y + 8), ROUND_MASK_4(y + 12)
+
+static_assert(ROUND_MASK_SIZE % 16 == 0, "ROUND_MASK initializer expects a multiple of 16 rows");
+static_assert(roundMaskX0(ROUND_MASK_SIZE / 2) == 0 && roundMaskX1(ROUND_MASK_SIZE / 2) == ROUND_MASK_SIZE - 1,
+              "Center row must span the panel");
+
+const RoundSpan ROUND_MASK[ROUND_MASK_SIZE] PROGMEM = {
+  ROUND_MASK_16(0),
+  ROUND_MASK_16(16),
+  ROUND_MASK_16(32),
+  ROUND_MASK_16(48),
+  ROUND_MASK_16(64),
+  ROUND_MASK_16(80),
+  ROUND_MASK_16(96),
+  ROUND_MASK_16(112),
+  ROUND_MASK_16(128),
+  ROUND_MASK_16(144),
+  ROUND_MASK_16(160),
+  ROUND_MASK_16(176),
+  ROUND_MASK_16(192),
+  ROUND_MASK_16(208),
+  ROUND_MASK_16(224)
+};
@@ -0,0 +1,59 @@
+/*
+ * Round Panel Visibility Mask
+ *
+ * The GC9A01 sits behind a round window: only pixels whose centers lie inside
+ * the inscribed circle are visible. ROUND_MASK holds the visible [x0, x1]
+ * column span of every row, computed at compile time, so fills and pushes can
+ * skip the ~21% of the square that is off the glass.
+ */
+
+#ifndef ROUND_MASK_H
+#define ROUND_MASK_H
+
+#include <Arduino.h>
+
+#define ROUND_MASK_SIZE 240  // Panel width = height = circle diameter
+
+struct RoundSpan {
+  uint8_t x0, x1;  // Inclusive visible columns
+};
+
+// Compile-time integer sqrt (binary search, C++11 single-expression constexpr)
+constexpr int32_t roundMaskSqrt(int32_t n, int32_t lo, int32_t hi) {
+  return lo >= hi ? lo
+       : ((lo + hi + 1) / 2) * ((lo + hi + 1) / 2) <= n ? roundMaskSqrt(n, (lo + hi + 1) / 2, hi)
+       : roundMaskSqrt(n, lo, (lo + hi + 1) / 2 - 1);
+}
+
+// Half chord of row y in half-pixel units: pixel (x, y) is visible when
+// |2x + 1 - D| <= roundMaskChord(y)
+constexpr int32_t roundMaskChord(int32_t y) {
+  return roundMaskSqrt(ROUND_MASK_SIZE * ROUND_MASK_SIZE -
+                       (2 * y + 1 - ROUND_MASK_SIZE) * (2 * y + 1 - ROUND_MASK_SIZE), 0, ROUND_MASK_SIZE);
+}
+
+constexpr uint8_t roundMaskX0(int32_t y) { return (ROUND_MASK_SIZE - roundMaskChord(y)) / 2; }
+constexpr uint8_t roundMaskX1(int32_t y) { return (ROUND_MASK_SIZE - 1 + roundMaskChord(y)) / 2; }
+
+extern const RoundSpan ROUND_MASK[ROUND_MASK_SIZE];
+
+// Clips [x0, x1] on row y to the glass. Returns false if nothing is visible.
+inline bool roundMaskClip(int16_t y, int16_t& x0, int16_t& x1) {
+  if (y < 0 || y >= ROUND_MASK_SIZE) return false;
+  int16_t v0 = pgm_read_byte(&ROUND_MASK[y].x0);
+  int16_t v1 = pgm_read_byte(&ROUND_MASK[y].x1);
+  if (x0 < v0) x0 = v0;
+  if (x1 > v1) x1 = v1;
+  return x0 <= x1;
+}
+
+// True if the rectangle is entirely on the glass. The disc is convex, so
+// checking the corners (i.e. the first and last row spans) is enough.
+inline bool roundMaskContains(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t x0 = x, x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
+  return roundMaskClip(y, x0, x1) && x0 == x && x1 == x + w - 1 &&
+         roundMaskClip(y1, x0, x1) && x0 == x && x1 == x + w - 1;
+}
+
+#endif // ROUND_MASK_H
@@ -0,0 +1,200 @@
+/*
+ * Smooth Font Glyph Cache Implementation
+ *
+ * A glyph is a run of uint16_t words: its width, then for each of the
+ * cellHeight rows a run count followed by the runs, each as
+ * [bg pixels skipped, length, length pre-blended pixels].
+ */
+
+#include "SmoothFont.h"
+#include "PixelKernels.h"
+
+#define SUPERSAMPLE 2
+
+SmoothGlyphCache::SmoothGlyphCache() :
+  parent(nullptr),
+  cellHeight(0),
+  background(0),
+  useClock(0),
+  ready(false) {
+  for (InkSlot& slot : slots) {
+    slot.used = false;
+    memset(slot.glyphs, 0, sizeof(slot.glyphs));
+  }
+}
+
+SmoothGlyphCache::~SmoothGlyphCache() {
+  clear();
+}
+
+bool SmoothGlyphCache::begin(lgfx::LovyanGFX* display) {
+  parent = display;
+
+  // Metrics only, no pixels needed
+  LGFX_Sprite scratch(parent);
+  scratch.setFont(&SMOOTH_FONT_SOURCE);
+  scratch.setTextSize(1);
+  cellHeight = min<int16_t>((scratch.fontHeight() + 1) / SUPERSAMPLE, SMOOTH_CELL_MAX_H);
+
+  char text[2] = { '\0', '\0' };
+  for (uint8_t i = 0; i < SMOOTH_FONT_GLYPHS; i++) {
+    text[0] = SMOOTH_FONT_FIRST + i;
+    advances[i] = min<int16_t>((scratch.textWidth(text) + 1) / SUPERSAMPLE, SMOOTH_CELL_MAX_W);
+  }
+
+  ready = cellHeight > 0;
+  if (!ready) {
+    Serial.println("[DISPLAY] Smooth font has no metrics - using the bitmap font");
+  }
+  return ready;
+}
+
+void SmoothGlyphCache::setBackground(uint16_t bg) {
+  if (bg == background) return;
+  clear();
+  background = bg;
+}
+
+void SmoothGlyphCache::clear() {
+  for (InkSlot& slot : slots) {
+    clearSlot(slot);
+  }
+}
+
+void SmoothGlyphCache::clearSlot(InkSlot& slot) {
+  for (uint16_t*& g : slot.glyphs) {
+    free(g);
+    g = nullptr;
+  }
+  slot.used = false;
+}
+
+// The slot already holding this color, else the least recently used one
+SmoothGlyphCache::InkSlot& SmoothGlyphCache::slotFor(uint16_t ink) {
+  InkSlot* victim = &slots[0];
+  for (InkSlot& slot : slots) {
+    if (slot.used && slot.ink == ink) {
+      slot.lastUse = ++useClock;
+      return slot;
+    }
+    if (!slot.used) {
+      victim = &slot;
+    } else if (victim->used && slot.lastUse < victim->lastUse) {
+      victim = &slot;
+    }
+  }
+  clearSlot(*victim);
+  victim->ink = ink;
+  victim->used = true;
+  victim->lastUse = ++useClock;
+  return *victim;
+}
+
+const uint16_t* SmoothGlyphCache::glyph(char c, uint16_t ink) {
+  uint8_t code = (uint8_t)c;
+  if (!ready || code < SMOOTH_FONT_FIRST || code > SMOOTH_FONT_LAST) return nullptr;
+  uint8_t index = code - SMOOTH_FONT_FIRST;
+
+  InkSlot& slot = slotFor(ink);
+  if (!slot.glyphs[index]) {
+    slot.glyphs[index] = build(index, ink);
+  }
+  return slot.glyphs[index];
+}
+
+uint16_t* SmoothGlyphCache::build(uint8_t index, uint16_t ink) {
+  int16_t w = advances[index];
+  int16_t h = cellHeight;
+
+  // Rasterize at twice the size; any non-zero pixel is ink
+  LGFX_Sprite scratch(parent);
+  scratch.setColorDepth(8);
+  scratch.setPsram(false);
+  if (!scratch.createSprite(w * SUPERSAMPLE, h * SUPERSAMPLE)) return nullptr;
+  scratch.fillSprite(0);
+  scratch.setFont(&SMOOTH_FONT_SOURCE);
+  scratch.setTextSize(1);
+  scratch.setTextColor(0xFFFF);
+  scratch.drawChar(SMOOTH_FONT_FIRST + index, 0, 0);
+
+  // 2x2 box filter to 0..4 coverage, counting the words the runs need
+  uint8_t coverage[SMOOTH_CELL_MAX_W * SMOOTH_CELL_MAX_H];
+  size_t words = 1;
+  for (int16_t y = 0; y < h; y++) {
+    bool inRun = false;
+    words++;
+    for (int16_t x = 0; x < w; x++) {
+      uint8_t c = 0;
+      for (uint8_t sy = 0; sy < SUPERSAMPLE; sy++) {
+        for (uint8_t sx = 0; sx < SUPERSAMPLE; sx++) {
+          if (scratch.readPixel(x * SUPERSAMPLE + sx, y * SUPERSAMPLE + sy)) c++;
+        }
+      }
+      coverage[y * w + x] = c;
+      if (c && !inRun) words += 2;
+      if (c) words++;
+      inRun = c != 0;
+    }
+  }
+  scratch.deleteSprite();
+
+  uint16_t* g = (uint16_t*)malloc(words * sizeof(uint16_t));
+  if (!g) return nullptr;
+
+  // The blend, done once per coverage level
+  uint16_t ramp[SUPERSAMPLE * SUPERSAMPLE + 1];
+  for (uint8_t i = 0; i <= SUPERSAMPLE * SUPERSAMPLE; i++) {
+    ramp[i] = pxBlend(ink, background, i * 255 / (SUPERSAMPLE * SUPERSAMPLE));
+  }
+
+  uint16_t* out = g;
+  *out++ = w;
+  for (int16_t y = 0; y < h; y++) {
+    const uint8_t* row = coverage + y * w;
+    uint16_t* runCount = out++;
+    *runCount = 0;
+    int16_t x = 0;
+    int16_t end = 0;  // End of the previous run
+    while (x < w) {
+      if (!row[x]) {
+        x++;
+        continue;
+      }
+      int16_t start = x;
+      while (x < w && row[x]) x++;
+      *out++ = start - end;
+      *out++ = x - start;
+      for (int16_t i = start; i < x; i++) *out++ = ramp[row[i]];
+      end = x;
+      (*runCount)++;
+    }
+  }
+  return g;
+}
+
+int16_t SmoothGlyphCache::textWidth(const char* text) const {
+  int16_t w = 0;
+  for (const char* c = text; *c; c++) {
+    uint8_t code = (uint8_t)*c;
+    if (code >= SMOOTH_FONT_FIRST && code <= SMOOTH_FONT_LAST) {
+      w += advances[code - SMOOTH_FONT_FIRST];
+    }
+  }
+  return w;
+}
+
+void SmoothGlyphCache::expand(const uint16_t* glyph, uint16_t* cell) const {
+  int16_t w = *glyph++;
+  for (int16_t y = 0; y < cellHeight; y++, cell += w) {
+    for (int16_t x = 0; x < w; x++) cell[x] = background;
+    uint16_t runs = *glyph++;
+    uint16_t* out = cell;
+    while (runs--) {
+      out += *glyph++;
+      uint16_t len = *glyph++;
+      memcpy(out, glyph, len * sizeof(uint16_t));
+      out += len;
+      glyph += len;
+    }
+  }
+}
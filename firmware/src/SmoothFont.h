@@ -0,0 +1,87 @@
+/*
+ * Smooth Font Glyph Cache
+ *
+ * Large text (size 3 and up) looks blocky as a scaled 6x8 bitmap on the
+ * round panel. Here glyphs come from a larger bitmap font rasterized at
+ * twice the target size and box-filtered 2x2, giving five coverage levels
+ * per pixel. Blending those against the background on every frame would
+ * cost a multiply per pixel, so each glyph is stored already blended: ink
+ * over the theme bg, as RGB565 runs (the bg gaps between runs are not
+ * stored). Drawing a glyph is then a fill and a copy into an opaque cell.
+ *
+ * Glyphs are built on first use, for up to SMOOTH_FONT_INKS text colors at
+ * a time. A different background (theme change) drops them all.
+ */
+
+#ifndef SMOOTH_FONT_H
+#define SMOOTH_FONT_H
+
+#define LGFX_USE_V1
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+
+#ifndef SMOOTH_FONT
+#define SMOOTH_FONT 0
+#endif
+
+#define SMOOTH_FONT_SOURCE    lgfx::fonts::DejaVu40   // Rasterized at 2x
+#define SMOOTH_FONT_MIN_SIZE  3     // drawCenteredText() sizes drawn smooth
+#define SMOOTH_FONT_FIRST     0x20  // Printable ASCII only
+#define SMOOTH_FONT_LAST      0x7E
+#define SMOOTH_FONT_GLYPHS    (SMOOTH_FONT_LAST - SMOOTH_FONT_FIRST + 1)
+#define SMOOTH_FONT_INKS      3     // Text colors cached at once
+#define SMOOTH_CELL_MAX_W     32    // Largest glyph cell, after the 2x2 filter
+#define SMOOTH_CELL_MAX_H     28
+
+class SmoothGlyphCache {
+public:
+  SmoothGlyphCache();
+  ~SmoothGlyphCache();
+
+  // Measure the source font (needs a display to create sprites with)
+  bool begin(lgfx::LovyanGFX* parent);
+  bool isReady() const { return ready; }
+
+  // Background every glyph is blended against; a new one drops the cache
+  void setBackground(uint16_t bg);
+
+  // Glyph of c in `ink`, built on first use. nullptr for characters outside
+  // the font or when out of memory.
+  const uint16_t* glyph(char c, uint16_t ink);
+
+  static int16_t width(const uint16_t* glyph) { return glyph[0]; }
+  int16_t height() const { return cellHeight; }
+  int16_t textWidth(const char* text) const;
+
+  // Expand a glyph into a width x height cell of plain RGB565
+  void expand(const uint16_t* glyph, uint16_t* cell) const;
+
+  // Free every built glyph
+  void clear();
+
+private:
+  // Built glyphs of one text color
+  struct InkSlot {
+    uint16_t ink;
+    uint32_t lastUse;
+    bool used;
+    uint16_t* glyphs[SMOOTH_FONT_GLYPHS];
+  };
+
+  uint16_t* build(uint8_t index, uint16_t ink);
+  InkSlot& slotFor(uint16_t ink);
+  void clearSlot(InkSlot& slot);
+
+  lgfx::LovyanGFX* parent;
+  InkSlot slots[SMOOTH_FONT_INKS];
+  uint8_t advances[SMOOTH_FONT_GLYPHS];  // Cell widths
+  int16_t cellHeight;
+  uint16_t background;
+  uint32_t useClock;
+  bool ready;
+
+  SmoothGlyphCache(const SmoothGlyphCache&);
+  SmoothGlyphCache& operator=(const SmoothGlyphCache&);
+};
+
+#endif // SMOOTH_FONT_H
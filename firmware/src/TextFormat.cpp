@@ -0,0 +1,90 @@
+/*
+ * Integer Text Formatting Implementation
+ */
+
+#include "TextFormat.h"
+
+static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+static char* fmtUnsigned(char* out, uint32_t value, uint8_t minDigits) {
+  char digits[10];
+  uint8_t n = 0;
+  do {
+    digits[n++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  while (n < minDigits) {
+    digits[n++] = '0';
+  }
+  while (n > 0) {
+    *out++ = digits[--n];
+  }
+  *out = '\0';
+  return out;
+}
+
+char* fmtInt(char* out, int32_t value) {
+  if (value < 0) {
+    *out++ = '-';
+    return fmtUnsigned(out, -(uint32_t)value, 1);
+  }
+  return fmtUnsigned(out, value, 1);
+}
+
+char* fmtFixed(char* out, int32_t value, uint8_t scale, uint8_t decimals) {
+  decimals = min(decimals, scale);
+  uint32_t magnitude = value < 0 ? -(uint32_t)value : value;
+  uint32_t drop = POW10[scale - decimals];
+  magnitude = (magnitude + drop / 2) / drop;
+
+  // No "-0" for values that round to zero
+  if (value < 0 && magnitude > 0) {
+    *out++ = '-';
+  }
+  uint32_t unit = POW10[decimals];
+  out = fmtUnsigned(out, magnitude / unit, 1);
+  if (decimals > 0) {
+    *out++ = '.';
+    out = fmtUnsigned(out, magnitude % unit, decimals);
+  }
+  return out;
+}
+
+char* fmtText(char* out, const char* text) {
+  while (*text) {
+    *out++ = *text++;
+  }
+  *out = '\0';
+  return out;
+}
+
+char* fmtEllipsis(char* out, const char* text, uint8_t maxChars) {
+  size_t len = strlen(text);
+  if (len <= maxChars) {
+    return fmtText(out, text);
+  }
+  // Below 4 characters there is only room for (some of) the dots
+  uint8_t dots = min<uint8_t>(maxChars, 3);
+  uint8_t keep = maxChars - dots;
+  memcpy(out, text, keep);
+  memset(out + keep, '.', dots);
+  out += keep + dots;
+  *out = '\0';
+  return out;
+}
+
+char* fmtDuration(char* out, uint32_t seconds) {
+  uint32_t hours = seconds / 3600;
+  uint32_t minutes = (seconds % 3600) / 60;
+  uint32_t secs = seconds % 60;
+
+  if (hours > 0) {
+    out = fmtText(fmtUnsigned(out, hours, 1), "h ");
+    return fmtText(fmtUnsigned(out, minutes, 1), "m");
+  }
+  if (minutes > 0) {
+    out = fmtText(fmtUnsigned(out, minutes, 1), "m ");
+    return fmtText(fmtUnsigned(out, secs, 1), "s");
+  }
+  return fmtText(fmtUnsigned(out, secs, 1), "s");
+}
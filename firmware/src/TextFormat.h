@@ -0,0 +1,52 @@
+/*
+ * Integer Text Formatting
+ *
+ * Number-to-text for the UI without float printf, which on the C3 (no FPU)
+ * goes through soft-float division and the full _dtoa path. Values arrive
+ * as fixed point: temperatures in deci-degrees, Z in microns, progress and
+ * percentages as plain integers. Rounding is half away from zero.
+ *
+ * Every function writes a NUL-terminated string at `out` and returns a
+ * pointer to that NUL, so pieces can be appended one after another. The
+ * caller sizes the buffer.
+ */
+
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+#include <Arduino.h>
+
+// Float readings -> fixed point, rounded (one multiply, no division)
+inline int32_t fmtDeci(float value) {
+  return (int32_t)(value * 10.0f + (value < 0 ? -0.5f : 0.5f));
+}
+inline int32_t fmtMicrons(float mm) {
+  return (int32_t)(mm * 1000.0f + (mm < 0 ? -0.5f : 0.5f));
+}
+
+char* fmtInt(char* out, int32_t value);
+
+// value / 10^scale with `decimals` (<= scale) digits after the point,
+// e.g. fmtFixed(out, 2155, 1, 0) = "216", fmtFixed(out, 12345, 3, 2) = "12.35"
+char* fmtFixed(char* out, int32_t value, uint8_t scale, uint8_t decimals);
+
+char* fmtText(char* out, const char* text);
+
+// `text`, cut to maxChars with "..." at the end if it is longer (never
+// wider than maxChars: just "." or ".." below 3)
+char* fmtEllipsis(char* out, const char* text, uint8_t maxChars);
+
+// "1h 5m", "5m 3s" or "7s"
+char* fmtDuration(char* out, uint32_t seconds);
+
+// Whole degrees from deci-degrees
+inline char* fmtTemp(char* out, int32_t deci) {
+  return fmtFixed(out, deci, 1, 0);
+}
+
+// "42%"
+inline char* fmtPercent(char* out, int32_t value) {
+  return fmtText(fmtInt(out, value), "%");
+}
+
+#endif // TEXT_FORMAT_H
@@ -0,0 +1,45 @@
+/*
+ * Text Layout Cache Implementation
+ */
+
+#include "TextLayout.h"
+
+#define FNV_OFFSET  2166136261u
+#define FNV_PRIME   16777619u
+
+void TextLayoutCache::invalidate() {
+  for (Entry& e : entries) {
+    e.font = nullptr;
+    e.text[0] = '\0';
+  }
+}
+
+TextLayout TextLayoutCache::measure(lgfx::LovyanGFX* target, const char* text) {
+  const lgfx::IFont* font = target->getFont();
+  float size = target->getTextSizeX();
+
+  // Hash the text; font and size are mixed in afterwards
+  uint32_t hash = FNV_OFFSET;
+  size_t len = 0;
+  for (const char* c = text; *c; c++, len++) {
+    hash = (hash ^ (uint8_t)*c) * FNV_PRIME;
+  }
+  if (len > TEXT_LAYOUT_MAX_TEXT) {
+    return { (int16_t)target->textWidth(text), (int16_t)target->fontHeight() };
+  }
+  hash = (hash ^ (uint32_t)(uintptr_t)font) * FNV_PRIME;
+  hash = (hash ^ (uint32_t)(size * 16)) * FNV_PRIME;
+
+  Entry& e = entries[hash & (TEXT_LAYOUT_SLOTS - 1)];
+  if (e.font == font && e.hash == hash && e.size == size && strcmp(e.text, text) == 0) {
+    return e.layout;
+  }
+
+  e.hash = hash;
+  e.font = font;
+  e.size = size;
+  e.layout.width = target->textWidth(text);
+  e.layout.height = target->fontHeight();
+  memcpy(e.text, text, len + 1);
+  return e.layout;
+}
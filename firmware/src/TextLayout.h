@@ -0,0 +1,52 @@
+/*
+ * Text Layout Cache
+ *
+ * The animation screens center the same few strings ("PRINTING...",
+ * temperatures, percentages) every frame, and the glow passes measure them
+ * again. LovyanGFX walks the font's glyph metrics for each textWidth()
+ * call; this cache keeps the result per (text, font, size), found by an
+ * FNV-1a hash and confirmed against a copy of the text.
+ *
+ * Font pointers are part of the key, but a font can change metrics in
+ * place (a smooth font loaded over the old one), so setting a font must
+ * call invalidate().
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#define LGFX_USE_V1
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+
+#define TEXT_LAYOUT_SLOTS     32   // Power of two
+#define TEXT_LAYOUT_MAX_TEXT  23   // Longer strings are measured every time
+
+// Bounding box of a string drawn from the cursor
+struct TextLayout {
+  int16_t width;
+  int16_t height;
+};
+
+class TextLayoutCache {
+public:
+  TextLayoutCache() { invalidate(); }
+
+  // Layout of `text` with the target's current font and text size
+  TextLayout measure(lgfx::LovyanGFX* target, const char* text);
+
+  void invalidate();
+
+private:
+  struct Entry {
+    uint32_t hash;
+    const lgfx::IFont* font;
+    float size;
+    TextLayout layout;
+    char text[TEXT_LAYOUT_MAX_TEXT + 1];
+  };
+
+  Entry entries[TEXT_LAYOUT_SLOTS];
+};
+
+#endif // TEXT_LAYOUT_H
@@ -0,0 +1,59 @@
+/*
+ * Screen Transitions Implementation
+ */
+
+#include "Transition.h"
+#include "DisplayDriver.h"
+#include "FixedMath.h"
+#include "PixelKernels.h"
+
+uint8_t transitionEase(uint8_t t) {
+  // (1 - cos(pi * t)) / 2
+  int32_t c = fxCos((int32_t)t * FX_ANGLE_HALF / 255);
+  return ((FX_Q15_ONE - c) * 255 + FX_Q15_ONE) / (2 * FX_Q15_ONE);
+}
+
+void transitionRow(TransitionType type, uint8_t progress, int16_t y,
+                   uint16_t* out, const uint16_t* from, const uint16_t* to) {
+  const size_t rowBytes = SCREEN_WIDTH * sizeof(uint16_t);
+  int16_t shift = (int32_t)SCREEN_WIDTH * progress / 255;
+
+  switch (type) {
+    case TRANSITION_SLIDE_LEFT:
+      // [from shifted left | start of to]; move `to` first, it may be `out`
+      memmove(out + SCREEN_WIDTH - shift, to, shift * sizeof(uint16_t));
+      memcpy(out, from + shift, (SCREEN_WIDTH - shift) * sizeof(uint16_t));
+      break;
+
+    case TRANSITION_SLIDE_RIGHT:
+      // [end of to | from shifted right]
+      memmove(out, to + SCREEN_WIDTH - shift, shift * sizeof(uint16_t));
+      memcpy(out + shift, from, (SCREEN_WIDTH - shift) * sizeof(uint16_t));
+      break;
+
+    case TRANSITION_RADIAL_WIPE: {
+      // `to` inside a circle that reaches the rim at 255, `from` outside
+      int32_t r = (int32_t)(SCREEN_RADIUS + 1) * progress / 255;
+      int32_t dy = y - SCREEN_HEIGHT / 2;
+      int32_t rest = r * r - dy * dy;
+      if (rest < 0) {
+        memcpy(out, from, rowBytes);
+        break;
+      }
+      int16_t half = fxSqrt(rest);
+      int16_t x0 = max<int16_t>(SCREEN_WIDTH / 2 - half, 0);
+      int16_t x1 = min<int16_t>(SCREEN_WIDTH / 2 + half, SCREEN_WIDTH - 1);
+      if (out != to) {
+        memcpy(out + x0, to + x0, (x1 - x0 + 1) * sizeof(uint16_t));
+      }
+      memcpy(out, from, x0 * sizeof(uint16_t));
+      memcpy(out + x1 + 1, from + x1 + 1, (SCREEN_WIDTH - 1 - x1) * sizeof(uint16_t));
+      break;
+    }
+
+    case TRANSITION_CROSSFADE:
+    default:
+      pxCrossfade(out, from, to, SCREEN_WIDTH, progress, true);
+      break;
+  }
+}
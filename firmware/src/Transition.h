@@ -0,0 +1,33 @@
+/*
+ * Screen Transitions
+ *
+ * Row compositors for DisplayDriver::transition(). A transition frame is
+ * built strip by strip: the outgoing and incoming screens are rasterized
+ * into two strips and each row is combined here, so no second full-frame
+ * buffer is needed and banded mode can run them too.
+ */
+
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+
+#define TRANSITION_FRAME_MS     33    // Frame budget (~30 FPS)
+#define TRANSITION_DURATION_MS  300   // Default length
+
+enum TransitionType {
+  TRANSITION_CROSSFADE,     // Blend old into new
+  TRANSITION_SLIDE_LEFT,    // New screen pushes in from the right
+  TRANSITION_SLIDE_RIGHT,   // New screen pushes in from the left
+  TRANSITION_RADIAL_WIPE    // New screen grows from the center
+};
+
+// Linear 0..255 -> eased (slow in, slow out) 0..255
+uint8_t transitionEase(uint8_t t);
+
+// Compose screen row y of a frame at progress 0..255 into `out`. Rows are
+// SCREEN_WIDTH byte-swapped RGB565 pixels; `out` may be the `to` row.
+void transitionRow(TransitionType type, uint8_t progress, int16_t y,
+                   uint16_t* out, const uint16_t* from, const uint16_t* to);
+
+#endif // TRANSITION_H
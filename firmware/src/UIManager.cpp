@@ -3,103 +3,189 @@
  */
 
 #include "UIManager.h"
+#include "FixedMath.h"
+#include "TextFormat.h"
+#include "PixelKernels.h"
 #include "WifiConfig.h"
 
-// External declarations for spaceman animation (defined in spaceman_data.cpp)
-extern const uint16_t* spaceman_frames[];
-#define SPACEMAN_FRAME_COUNT 5
-#define SPACEMAN_WIDTH 120
-#define SPACEMAN_HEIGHT 120
+// Built-in spaceman animation (defined in spaceman_data.cpp), used when the
+// asset pack has none
+extern const Animation spaceman_animation;
 
 UIManager::UIManager() : 
   display(nullptr),
   currentScreen(SCREEN_IDLE),
-  lastAnimationUpdate(0),
   animationFrame(0),
+  idleReady(SCREEN_WIDTH/2, 210, 10, 2),
+  idleChamber(SCREEN_WIDTH/2, 190, 10, 1),
+  idleTemps(SCREEN_WIDTH/2, 230, 7, 1),
+  printingRing(SCREEN_WIDTH/2, SCREEN_HEIGHT/2, 75, 12),
+  printingProgress(SCREEN_WIDTH/2, 110, 4, 3),
+  hotendGauge(45, 45, 25),
+  bedGauge(SCREEN_WIDTH - 45, 45, 25),
+  hotendTemp(SCREEN_WIDTH/2, 45 + 40, 3, 1),
+  hotendTarget(SCREEN_WIDTH/2, 45 + 50, 4, 1),
+  bedTemp(SCREEN_WIDTH/2, SCREEN_WIDTH - 45 + 40, 3, 1),
+  bedTarget(SCREEN_WIDTH/2, SCREEN_WIDTH - 45 + 50, 4, 1),
+  printingEta(SCREEN_WIDTH/2, 30, 7, 1, "ETA: "),
+  printingFile(SCREEN_WIDTH/2, 200, 20, 1),
+  printingZ(SCREEN_WIDTH/2, 225, 6, 1, "Z:"),
+  pausedRing(SCREEN_WIDTH/2, SCREEN_HEIGHT/2, 75, 12),
+  pausedTitle(SCREEN_WIDTH/2, 110, 6, 2),
+  pausedProgress(SCREEN_WIDTH/2, 140, 4, 2),
+  pausedTemps(SCREEN_WIDTH/2, 170, 16, 1),
+  completeIcon(SCREEN_WIDTH/2, SCREEN_HEIGHT/2 - 20, ICON_CHECK),
+  completeTitle(SCREEN_WIDTH/2, 150, 8, 2),
+  completeTime(SCREEN_WIDTH/2, 180, 10, 1),
+  errorIcon(SCREEN_WIDTH/2, SCREEN_HEIGHT/2 - 20, ICON_ERROR),
+  errorTitle(SCREEN_WIDTH/2, 150, 5, 2),
+  errorHint(SCREEN_WIDTH/2, 180, 13, 1),
   lastScreenSwitch(0),
   showingAnimation(false),
+  transitioning(false),
+  transitionFrom(SCREEN_IDLE),
+  transitionFromAnimated(false),
   lastTouchFeedback(0),
+  touchRingLevel(-1),
   manualMode(false),
+  timedOverlay(false),
+  overlayHideTime(0),
+  overlayDrawnDirect(false),
   completeScreenStartTime(0),
+  spaceman(&spaceman_animation),
   spacemanStartTime(0),
   lastSpacemanCheck(0),
   spacemanShownOnBoot(false)
 {
+  buildScreens();
 }
 
-void UIManager::init(DisplayDriver* disp) {
+void UIManager::init(DisplayDriver* disp, AssetPack* assets) {
   display = disp;
   currentScreen = SCREEN_BOOT;
   animationFrame = 0;
+  
+  spacemanPlayer.init(disp, assets);
+  const Animation* packed = assets ? assets->findAnimation("spaceman") : nullptr;
+  if (packed) {
+    spaceman = packed;
+  }
+}
+
+// Widgets are listed bottom to top
+void UIManager::buildScreens() {
+  idleReady.setText("Ready");
+  idleScreen.add(&idleEyes);
+  idleScreen.add(&idleReady);
+  idleScreen.add(&idleChamber);
+  idleScreen.add(&idleTemps);
+  
+  printingScreen.add(&printingRing);
+  printingScreen.add(&printingProgress);
+  printingScreen.add(&hotendGauge);
+  printingScreen.add(&bedGauge);
+  printingScreen.add(&hotendTemp);
+  printingScreen.add(&hotendTarget);
+  printingScreen.add(&bedTemp);
+  printingScreen.add(&bedTarget);
+  printingScreen.add(&printingEta);
+  printingScreen.add(&printingFile);
+  printingScreen.add(&printingZ);
+  
+  pausedTitle.setText("PAUSED");
+  pausedScreen.add(&pausedRing);
+  pausedScreen.add(&pausedTitle);
+  pausedScreen.add(&pausedProgress);
+  pausedScreen.add(&pausedTemps);
+  
+  completeTitle.setText("COMPLETE");
+  completeScreen.add(&completeIcon);
+  completeScreen.add(&completeTitle);
+  completeScreen.add(&completeTime);
+  
+  errorTitle.setText("ERROR");
+  errorHint.setText("Check printer");
+  errorScreen.add(&errorIcon);
+  errorScreen.add(&errorTitle);
+  errorScreen.add(&errorHint);
 }
 
 void UIManager::showBootScreen() {
   currentScreen = SCREEN_BOOT;
-  display->clear();
-  
-  // Draw rainbow arc at top (Electric Callboy style)
-  int16_t centerX = 120;
-  int16_t centerY = 120;
-  int16_t radius = 90;
-  
-  // Rainbow colors
-  uint16_t rainbowColors[] = {
-    display->color565(255, 0, 0),     // Red
-    display->color565(255, 127, 0),   // Orange
-    display->color565(255, 255, 0),   // Yellow
-    display->color565(0, 255, 0),     // Green
-    display->color565(0, 0, 255),     // Blue
-    display->color565(75, 0, 130),    // Indigo
-    display->color565(148, 0, 211)    // Violet
-  };
   
-  // Draw rainbow arcs (smaller for boot screen)
-  for (int i = 0; i < 7; i++) {
-    for (int angle = 200; angle <= 340; angle += 3) {
-      float rad = angle * PI / 180.0;
-      int16_t x1 = centerX + (radius - i * 3) * cos(rad);
-      int16_t y1 = centerY + (radius - i * 3) * sin(rad);
-      int16_t x2 = centerX + (radius - i * 3 - 2) * cos(rad);
-      int16_t y2 = centerY + (radius - i * 3 - 2) * sin(rad);
-      display->drawLine(x1, y1, x2, y2, rainbowColors[i]);
+  display->renderFrame([&]() {
+    display->clear();
+    
+    // Draw rainbow arc at top (Electric Callboy style)
+    int16_t centerX = 120;
+    int16_t centerY = 120;
+    int16_t radius = 90;
+    
+    // Rainbow colors
+    uint16_t rainbowColors[] = {
+      display->color565(255, 0, 0),     // Red
+      display->color565(255, 127, 0),   // Orange
+      display->color565(255, 255, 0),   // Yellow
+      display->color565(0, 255, 0),     // Green
+      display->color565(0, 0, 255),     // Blue
+      display->color565(75, 0, 130),    // Indigo
+      display->color565(148, 0, 211)    // Violet
+    };
+    
+    // Draw rainbow arcs (smaller for boot screen)
+    for (int i = 0; i < 7; i++) {
+      for (int angle = 200; angle <= 340; angle += 3) {
+        int16_t x1, y1, x2, y2;
+        fxPolar(centerX, centerY, radius - i * 3, fxDegToAngle(angle), x1, y1);
+        fxPolar(centerX, centerY, radius - i * 3 - 2, fxDegToAngle(angle), x2, y2);
+        display->drawLine(x1, y1, x2, y2, rainbowColors[i]);
+      }
     }
-  }
-  
-  // Draw title text
-  display->setTextColor(display->getThemeColors().text);
-  display->drawCenteredText("PaWe", 130, 3);
-  display->drawCenteredText("i-print", 155, 2);
-  
-  // Draw version
-  display->setTextColor(display->getThemeColors().secondary);
-  display->drawCenteredText("v1.1", 185, 1);
-  
-  // Draw loading indicator
-  display->drawCircle(SCREEN_WIDTH/2, 210, 8, display->getThemeColors().accent);
+    
+    // Draw title text
+    display->setTextColor(display->getThemeColors().text);
+    display->drawCenteredText("PaWe", 130, 3);
+    display->drawCenteredText("i-print", 155, 2);
+    
+    // Draw version
+    display->setTextColor(display->getThemeColors().secondary);
+    display->drawCenteredText("v1.1", 185, 1);
+    
+    // Draw loading indicator
+    display->drawCircle(SCREEN_WIDTH/2, 210, 8, display->getThemeColors().accent);
+  });
 }
 
 void UIManager::updateStatus(PrinterStatus& status) {
+  if (transitioning) {
+    // The incoming screen picks the new values up; switching decisions
+    // wait for the next status
+    lastStatus = status;
+    return;
+  }
+  
   // Skip automatic screen switching if user is in manual mode
   if (manualMode) {
-    // Just update the data on current screen without switching
-    if (shouldRedraw(status)) {
-      switch (currentScreen) {
-        case SCREEN_IDLE:
-          drawIdleScreen(status);
-          break;
-        case SCREEN_PRINTING:
-          drawPrintingScreen(status);
-          break;
-        case SCREEN_PAUSED:
-          drawPausedScreen(status);
-          break;
-        case SCREEN_COMPLETE:
-          drawCompleteScreen(status);
-          break;
-        case SCREEN_ERROR:
-          drawErrorScreen();
-          break;
-      }
+    // Just update the data on current screen without switching; the
+    // widgets repaint only what changed
+    switch (currentScreen) {
+      case SCREEN_IDLE:
+        drawIdleScreen(status);
+        break;
+      case SCREEN_PRINTING:
+        drawPrintingScreen(status);
+        break;
+      case SCREEN_PAUSED:
+        drawPausedScreen(status);
+        break;
+      case SCREEN_COMPLETE:
+        drawCompleteScreen(status);
+        break;
+      case SCREEN_ERROR:
+        drawErrorScreen();
+        break;
+      default:
+        break;
     }
     lastStatus = status;
     return;
@@ -122,6 +208,7 @@ void UIManager::updateStatus(PrinterStatus& status) {
       return;
     } else {
       // Animation finished, switch to normal screen
+      spacemanPlayer.stop();
       currentScreen = SCREEN_IDLE;
       display->clear();
       Serial.println("[UI] Spaceman animation finished");
@@ -172,61 +259,39 @@ void UIManager::updateStatus(PrinterStatus& status) {
     completeScreenStartTime = 0;  // Reset complete screen timer
   }
   
-  // Animation cycling logic
+  // Animation cycling logic (only idle and printing have an animation)
   unsigned long currentTime = millis();
   unsigned long timeSinceSwitch = currentTime - lastScreenSwitch;
+  bool nextAnimation = showingAnimation;
   bool modeChanged = false;
   
   // Check if it's time to switch between data and animation
   if (showingAnimation && timeSinceSwitch > ANIMATION_DISPLAY_TIME) {
-    showingAnimation = false;
+    nextAnimation = false;
     lastScreenSwitch = currentTime;
-    display->clear();
     modeChanged = true;
   } else if (!showingAnimation && timeSinceSwitch > DATA_DISPLAY_TIME) {
-    showingAnimation = true;
+    nextAnimation = true;
     lastScreenSwitch = currentTime;
-    display->clear();
     modeChanged = true;
   }
   
-  // Redraw if screen changed, mode changed, or significant data changed
-  if (newScreen != currentScreen || modeChanged || shouldRedraw(status)) {
-    // Clear screen only when switching screens
-    if (newScreen != currentScreen) {
-      display->clear();
-      lastScreenSwitch = currentTime;  // Reset timer on screen change
-      showingAnimation = false;  // Start with data view
-    }
-    currentScreen = newScreen;
-    
-    // Choose between data view and animation view
-    switch (currentScreen) {
-      case SCREEN_IDLE:
-        if (showingAnimation) {
-          drawIdleAnimation(status);
-        } else {
-          drawIdleScreen(status);
-        }
-        break;
-      case SCREEN_PRINTING:
-        if (showingAnimation) {
-          drawPrintingAnimation(status);
-        } else {
-          drawPrintingScreen(status);
-        }
-        break;
-      case SCREEN_PAUSED:
-        drawPausedScreen(status);
-        break;
-      case SCREEN_COMPLETE:
-        drawCompleteScreen(status);
-        break;
-      case SCREEN_ERROR:
-        drawErrorScreen();
-        break;
-      default:
-        break;
+  bool screenChanged = newScreen != currentScreen;
+  if (screenChanged) {
+    lastScreenSwitch = currentTime;  // Reset timer on screen change
+    nextAnimation = false;  // Start with data view
+  }
+  
+  if (screenChanged || (modeChanged && hasAnimation(newScreen))) {
+    // Finished prints are revealed from the center, everything else fades
+    TransitionType type = (screenChanged && newScreen == SCREEN_COMPLETE) ? TRANSITION_RADIAL_WIPE : TRANSITION_CROSSFADE;
+    switchScreen(newScreen, nextAnimation, type, status);
+  } else {
+    showingAnimation = nextAnimation;
+    // Data screens are widget trees and repaint only what changed;
+    // animations redraw continuously from update()
+    if (!showingAnimation || !hasAnimation(currentScreen)) {
+      drawScreen(currentScreen, false, status);
     }
   }
   
@@ -234,187 +299,271 @@ void UIManager::updateStatus(PrinterStatus& status) {
   lastStatus = status;
 }
 
+void UIManager::drawScreen(ScreenType screen, bool animated, PrinterStatus& status) {
+  switch (screen) {
+    case SCREEN_IDLE:
+      if (animated) {
+        drawIdleAnimation(status);
+      } else {
+        drawIdleScreen(status);
+      }
+      break;
+    case SCREEN_PRINTING:
+      if (animated) {
+        drawPrintingAnimation(status);
+      } else {
+        drawPrintingScreen(status);
+      }
+      break;
+    case SCREEN_PAUSED:
+      drawPausedScreen(status);
+      break;
+    case SCREEN_COMPLETE:
+      drawCompleteScreen(status);
+      break;
+    case SCREEN_ERROR:
+      drawErrorScreen();
+      break;
+    case SCREEN_SPACEMAN:
+      drawSpacemanAnimation();
+      break;
+    default:
+      break;  // Boot screen is drawn once by showBootScreen()
+  }
+}
+
+// Animate from whatever is showing to `screen`. update() draws the
+// transition a frame at a time, then the screen for real so its widgets
+// know what is on the panel.
+void UIManager::switchScreen(ScreenType screen, bool animated, TransitionType type, PrinterStatus& status) {
+  finishTransition();  // A switch mid-transition starts from where it ends
+  transitionFrom = currentScreen;
+  transitionFromAnimated = showingAnimation;
+  currentScreen = screen;
+  showingAnimation = animated;
+  lastStatus = status;
+  
+  // Transition frames mix two screens: full 16 bits, whatever they are
+  display->setWireFormat(DISPLAY_WIRE_RGB565);
+  transitioning = display->beginTransition(type);
+  if (transitioning) {
+    stepTransition();
+  } else {
+    display->clear();
+    drawScreen(screen, animated, status);
+    applyWireFormat();
+  }
+}
+
+void UIManager::stepTransition(bool skipToEnd) {
+  bool running = display->transitionStep(
+    [this]() { drawScreen(transitionFrom, transitionFromAnimated, lastStatus); },
+    [this]() { drawScreen(currentScreen, showingAnimation, lastStatus); },
+    skipToEnd);
+  if (!running) {
+    transitioning = false;
+    applyWireFormat();
+    drawScreen(currentScreen, showingAnimation, lastStatus);
+  }
+}
+
+// Full-screen animation goes out at 12 bits per pixel, UI screens and
+// transitions at 16
+void UIManager::applyWireFormat() {
+  bool animated = !transitioning && (currentScreen == SCREEN_SPACEMAN || showingAnimation);
+  display->setWireFormat(animated ? DISPLAY_WIRE_RGB444 : DISPLAY_WIRE_RGB565);
+}
+
 void UIManager::drawIdleScreen(PrinterStatus& status) {
-  // Only clear on screen change (handled by updateStatus)
-  // Don't clear here to prevent flicker during animation
+  const ThemeColors& colors = display->getThemeColors();
   
-  // Draw rolling eyes animation
-  display->drawRollingEyes(animationFrame);
+  // Rolling eyes animation
+  idleEyes.setFrame(animationFrame);
   
-  // Draw status text at bottom
-  display->setTextColor(display->getThemeColors().text);
-  display->drawCenteredText("Ready", 210, 2);
+  idleReady.setColor(colors.text);
   
-  // Draw temperatures
+  // Temperatures
   char tempStr[32];
-  sprintf(tempStr, "%.0f/%.0f", status.hotendTemp, status.hotendTarget);
-  display->setTextColor(display->getThemeColors().highlight);
-  display->drawCenteredText(tempStr, 230, 1);
-  
-  // Draw environmental data if available
+  char* p = fmtTemp(tempStr, fmtDeci(status.hotendTemp));
+  p = fmtText(p, "/");
+  fmtTemp(p, fmtDeci(status.hotendTarget));
+  idleTemps.setText(tempStr);
+  idleTemps.setColor(colors.highlight);
+  
+  // Environmental data if available
+  char envStr[32] = "";
   if (status.chamberTemp > 0 || status.chamberHumidity > 0) {
-    display->setTextColor(display->getThemeColors().secondary);
-    char envStr[32];
+    p = fmtFixed(envStr, fmtDeci(status.chamberTemp), 1, 1);
+    p = fmtText(p, "°C");
     if (status.chamberHumidity > 0) {
-      sprintf(envStr, "%.1f°C %.0f%%", status.chamberTemp, status.chamberHumidity);
-    } else {
-      sprintf(envStr, "%.1f°C", status.chamberTemp);
+      p = fmtTemp(fmtText(p, " "), fmtDeci(status.chamberHumidity));
+      fmtText(p, "%");
     }
-    display->drawCenteredText(envStr, 190, 1);
   }
+  idleChamber.setText(envStr);
+  idleChamber.setColor(colors.secondary);
+  
+  idleScreen.render(display);
 }
 
 void UIManager::drawPrintingScreen(PrinterStatus& status) {
-  // Only clear on screen change (handled by updateStatus)
+  const ThemeColors& colors = display->getThemeColors();
   
-  // Draw progress ring with enhanced visuals
+  // Progress ring with the percentage in its center
   drawProgressCircle(status.printProgress);
-  
-  // Draw progress percentage in center
   char progressStr[8];
-  sprintf(progressStr, "%d%%", status.printProgress);
-  display->setTextColor(display->getThemeColors().text);
-  display->drawCenteredText(progressStr, 110, 3);
+  fmtPercent(progressStr, status.printProgress);
+  printingProgress.setText(progressStr);
+  printingProgress.setColor(colors.text);
   
-  // Draw temperature gauges in corners
+  // Temperature gauges in corners
   drawTemperatureGauges(status);
   
-  // Draw time remaining at top
+  // Time remaining at top
+  char etaStr[16] = "";
   if (status.printTimeLeft > 0) {
-    display->setTextColor(display->getThemeColors().secondary);
-    String timeStr = formatTime(status.printTimeLeft);
-    display->drawCenteredText("ETA: " + timeStr, 30, 1);
+    fmtDuration(etaStr, status.printTimeLeft);
   }
+  printingEta.setText(etaStr);
+  printingEta.setColor(colors.secondary);
   
-  // Draw filename (truncated)
-  if (status.fileName.length() > 0) {
-    display->setTextColor(display->getThemeColors().accent);
-    String shortName = status.fileName;
-    if (shortName.length() > 20) {
-      shortName = shortName.substring(0, 17) + "...";
-    }
-    display->drawCenteredText(shortName, 200, 1);
-  }
+  // Filename (truncated)
+  char nameStr[24];
+  fmtEllipsis(nameStr, status.fileName.c_str(), 20);
+  printingFile.setText(nameStr);
+  printingFile.setColor(colors.accent);
   
-  // Draw Z height at bottom
-  display->setTextColor(display->getThemeColors().secondary);
+  // Z height at bottom
   char zStr[16];
-  sprintf(zStr, "Z:%.2f", status.posZ);
-  display->drawCenteredText(zStr, 225, 1);
+  fmtFixed(zStr, fmtMicrons(status.posZ), 3, 2);
+  printingZ.setText(zStr);
+  printingZ.setColor(colors.secondary);
+  
+  printingScreen.render(display);
 }
 
 void UIManager::drawPausedScreen(PrinterStatus& status) {
-  // Only clear on screen change (handled by updateStatus)
-  
-  // Draw progress ring (dimmed)
-  drawProgressCircle(status.printProgress);
+  const ThemeColors& colors = display->getThemeColors();
   
-  // Draw PAUSED text
-  display->setTextColor(display->getThemeColors().warning);
-  display->drawCenteredText("PAUSED", 110, 2);
+  pausedRing.setProgress(status.printProgress);
+  pausedRing.setColor(colors.highlight);
+  pausedTitle.setColor(colors.warning);
   
-  // Draw progress percentage
   char progressStr[8];
-  sprintf(progressStr, "%d%%", status.printProgress);
-  display->setTextColor(display->getThemeColors().text);
-  display->drawCenteredText(progressStr, 140, 2);
+  fmtPercent(progressStr, status.printProgress);
+  pausedProgress.setText(progressStr);
+  pausedProgress.setColor(colors.text);
   
-  // Draw temperatures
   char tempStr[32];
-  sprintf(tempStr, "E:%.0f B:%.0f", status.hotendTemp, status.bedTemp);
-  display->setTextColor(display->getThemeColors().highlight);
-  display->drawCenteredText(tempStr, 170, 1);
+  char* p = fmtTemp(fmtText(tempStr, "E:"), fmtDeci(status.hotendTemp));
+  fmtTemp(fmtText(p, " B:"), fmtDeci(status.bedTemp));
+  pausedTemps.setText(tempStr);
+  pausedTemps.setColor(colors.highlight);
+  
+  pausedScreen.render(display);
 }
 
 void UIManager::drawCompleteScreen(PrinterStatus& status) {
-  display->clear();
-  
-  // Draw checkmark
-  display->drawCheckIcon(SCREEN_WIDTH/2, SCREEN_HEIGHT/2 - 20, display->getThemeColors().success);
+  const ThemeColors& colors = display->getThemeColors();
   
-  // Draw COMPLETE text
-  display->setTextColor(display->getThemeColors().success);
-  display->drawCenteredText("COMPLETE", 150, 2);
+  completeIcon.setColor(colors.success);
+  completeTitle.setColor(colors.success);
+  char timeStr[16];
+  fmtDuration(timeStr, status.printTime);
+  completeTime.setText(timeStr);
+  completeTime.setColor(colors.secondary);
   
-  // Draw print time
-  display->setTextColor(display->getThemeColors().secondary);
-  String timeStr = formatTime(status.printTime);
-  display->drawCenteredText(timeStr, 180, 1);
+  completeScreen.render(display);
 }
 
 void UIManager::drawErrorScreen() {
-  display->clear();
+  const ThemeColors& colors = display->getThemeColors();
   
-  // Draw error icon
-  display->drawErrorIcon(SCREEN_WIDTH/2, SCREEN_HEIGHT/2 - 20, display->getThemeColors().error);
+  errorIcon.setColor(colors.error);
+  errorTitle.setColor(colors.error);
+  errorHint.setColor(colors.secondary);
   
-  // Draw ERROR text
-  display->setTextColor(display->getThemeColors().error);
-  display->drawCenteredText("ERROR", 150, 2);
-  display->setTextColor(display->getThemeColors().secondary);
-  display->drawCenteredText("Check printer", 180, 1);
+  errorScreen.render(display);
 }
 
 void UIManager::drawTemperatureGauges(PrinterStatus& status) {
-  // Draw hotend gauge in top-left
-  display->drawTemperatureGauge(45, 45, 25, status.hotendTemp, status.hotendTarget, display->getThemeColors().highlight);
-  display->setTextColor(display->getThemeColors().highlight);
-  display->setTextSize(1);
+  const ThemeColors& colors = display->getThemeColors();
+  
+  // Hotend gauge in top-left
+  hotendGauge.setValue(status.hotendTemp, status.hotendTarget);
+  hotendGauge.setColor(colors.highlight);
   char hotendStr[8];
-  sprintf(hotendStr, "%.0f", status.hotendTemp);
-  display->drawCenteredText(hotendStr, 45 + 40, 1);
+  fmtTemp(hotendStr, fmtDeci(status.hotendTemp));
+  hotendTemp.setText(hotendStr);
+  hotendTemp.setColor(colors.highlight);
   
-  // Draw bed gauge in top-right
-  display->drawTemperatureGauge(SCREEN_WIDTH - 45, 45, 25, status.bedTemp, status.bedTarget, display->getThemeColors().text);
-  display->setTextColor(display->getThemeColors().text);
+  // Bed gauge in top-right
+  bedGauge.setValue(status.bedTemp, status.bedTarget);
+  bedGauge.setColor(colors.text);
   char bedStr[8];
-  sprintf(bedStr, "%.0f", status.bedTemp);
-  display->drawCenteredText(bedStr, SCREEN_WIDTH - 45 + 40, 1);
+  fmtTemp(bedStr, fmtDeci(status.bedTemp));
+  bedTemp.setText(bedStr);
+  bedTemp.setColor(colors.text);
   
-  // Draw target indicators if available
+  // Target indicators if available (blank when the heater is off)
+  char targetStr[8] = "";
   if (status.hotendTarget > 0) {
-    display->setTextColor(display->getThemeColors().secondary);
-    char targetStr[8];
-    sprintf(targetStr, "/%.0f", status.hotendTarget);
-    display->drawCenteredText(targetStr, 45 + 50, 1);
+    fmtTemp(fmtText(targetStr, "/"), fmtDeci(status.hotendTarget));
   }
+  hotendTarget.setText(targetStr);
+  hotendTarget.setColor(colors.secondary);
   
+  targetStr[0] = '\0';
   if (status.bedTarget > 0) {
-    display->setTextColor(display->getThemeColors().secondary);
-    char targetStr[8];
-    sprintf(targetStr, "/%.0f", status.bedTarget);
-    display->drawCenteredText(targetStr, SCREEN_WIDTH - 45 + 50, 1);
+    fmtTemp(fmtText(targetStr, "/"), fmtDeci(status.bedTarget));
   }
+  bedTarget.setText(targetStr);
+  bedTarget.setColor(colors.secondary);
 }
 
 void UIManager::drawProgressCircle(uint8_t progress) {
-  // Draw progress ring in center of screen
-  int16_t centerX = SCREEN_WIDTH / 2;
-  int16_t centerY = SCREEN_HEIGHT / 2;
-  int16_t radius = 75;
-  int16_t thickness = 12;
-  uint16_t color = display->getThemeColors().highlight;
-  
-  display->drawProgressRing(centerX, centerY, radius, thickness, progress, color);
+  // Progress ring in center of screen
+  printingRing.setProgress(progress);
+  printingRing.setColor(display->getThemeColors().highlight);
 }
 
 void UIManager::update() {
   unsigned long currentTime = millis();
   
-  // Handle Spaceman animation separately (always animates)
-  if (currentScreen == SCREEN_SPACEMAN) {
-    if (currentTime - lastAnimationUpdate > 200) { // 5 FPS for spaceman
-      lastAnimationUpdate = currentTime;
-      drawSpacemanAnimation();
+  // Animations advance with elapsed time, not with loop() iterations.
+  // Wrapped so int16_t frame math (eyes, blinks) never goes negative.
+  animationFrame = (animationFrame + frameScheduler.advance(currentTime)) % ANIMATION_FRAME_WRAP;
+  
+  // Frame rate for what is on screen
+  if (transitioning) {
+    frameScheduler.setTargetPeriod(TRANSITION_FRAME_MS);
+  } else if (showingAnimation) {
+    frameScheduler.setTargetPeriod(50);   // 20 FPS for smooth animation
+  } else {
+    frameScheduler.setTargetPeriod(100);  // 10 FPS rolling eyes
+  }
+  
+  if (transitioning) {
+    // One transition frame per scheduled frame; nothing else draws over it
+    if (frameScheduler.frameDue(currentTime)) {
+      frameScheduler.beginRender(currentTime);
+      stepTransition();
+      frameScheduler.endRender();
     }
     return;
   }
   
-  // If showing animation mode, continuously redraw the animation
-  if (showingAnimation) {
-    if (currentTime - lastAnimationUpdate > 50) { // 20 FPS for smooth animation
-      lastAnimationUpdate = currentTime;
-      
+  // The screen state is settled by now (status updates and switches ran
+  // before this)
+  applyWireFormat();
+  
+  if (currentScreen == SCREEN_SPACEMAN) {
+    // Timed by the player itself, at the GIF's own frame delays
+    drawSpacemanAnimation();
+  } else if (frameScheduler.frameDue(currentTime)) {
+    frameScheduler.beginRender(currentTime);
+    
+    if (showingAnimation) {
       switch (currentScreen) {
         case SCREEN_IDLE:
           drawIdleAnimation(lastStatus);
@@ -425,78 +574,142 @@ void UIManager::update() {
         default:
           break;
       }
+    } else if (currentScreen == SCREEN_IDLE) {
+      // Data mode - only the rolling eyes move
+      updateRollingEyes();
     }
-  } else {
-    // Data mode - only update rolling eyes if on idle screen
-    if (currentTime - lastAnimationUpdate > 100) { // 10 FPS animation
-      lastAnimationUpdate = currentTime;
-      
-      if (currentScreen == SCREEN_IDLE) {
-        updateRollingEyes();
-      }
-    }
+    
+    frameScheduler.endRender();
   }
   
-  animationFrame++;
+  if (timedOverlay && (long)(currentTime - overlayHideTime) >= 0) {
+    hideTimedOverlays();
+  }
   
-  // Handle touch feedback animation
+  if (currentScreen == SCREEN_SPACEMAN) return;
+  
+  // Handle touch feedback animation. The overlay is recomposed only when
+  // the fade reaches a level the ring can show (see pxAlpha()).
+  int16_t ringLevel = -1;
+  uint8_t alpha = 0;
   if (currentTime - lastTouchFeedback < TOUCH_FEEDBACK_DURATION) {
-    // Show touch feedback ring
-    int alpha = 255 - ((currentTime - lastTouchFeedback) * 255 / TOUCH_FEEDBACK_DURATION);
-    display->drawTouchFeedbackRing(alpha);
+    alpha = 255 - ((currentTime - lastTouchFeedback) * 255 / TOUCH_FEEDBACK_DURATION);
+    ringLevel = pxAlpha(alpha);
+  }
+  if (ringLevel == touchRingLevel) return;
+  touchRingLevel = ringLevel;
+  
+  if (ringLevel >= 0) {
+    // Show touch feedback ring, over the screen so it can be taken away again
+    auto ring = [this, alpha]() { display->drawTouchFeedbackRing(alpha); };
+    if (!display->showRingOverlay(OVERLAY_TOUCH_RING, SCREEN_WIDTH/2, SCREEN_HEIGHT/2, 119, 114, ring)) {
+      ring();
+    }
+  } else {
+    display->hideOverlay(OVERLAY_TOUCH_RING);
   }
 }
 
-void UIManager::updateRollingEyes() {
-  // Redraw eyes with new frame
-  if (animationFrame % 5 == 0) {  // Update every 5 frames to reduce flicker
-    drawIdleScreen(lastStatus);
+void UIManager::showBrightnessHud(int brightness) {
+  uint8_t percent = (brightness * 100) / 255;
+  auto hud = [this, percent]() {
+    const ThemeColors& colors = display->getThemeColors();
+    display->fillRoundRect(52, 90, 136, 74, 12, colors.bg);
+    display->drawRoundRect(52, 90, 136, 74, 12, colors.accent);
+    display->setTextColor(colors.text);
+    display->drawCenteredText("Brightness", 100, 2);
+    char brightStr[16];
+    fmtPercent(brightStr, percent);
+    display->drawCenteredText(brightStr, 130, 3);
+  };
+  
+  display->hideOverlay(OVERLAY_RAINBOW);
+  if (!display->showOverlay(OVERLAY_CARD, 52, 90, 136, 74, hud)) {
+    display->clear();
+    hud();
+    overlayDrawnDirect = true;
   }
+  timedOverlay = true;
+  overlayHideTime = millis() + BRIGHTNESS_HUD_DURATION;
 }
 
-void UIManager::updatePrintingAnimation() {
-  // Could add subtle animations during printing if desired
-  // For now, keep it static to avoid distractions
+void UIManager::showEasterEgg() {
+  // Rainbow arc over the top half, title below it
+  auto rainbow = [this]() {
+    int16_t centerX = 120;
+    int16_t centerY = 120;
+    int16_t radius = 100;
+    
+    // Rainbow colors (7 colors)
+    uint16_t rainbowColors[] = {
+      display->color565(255, 0, 0),     // Red
+      display->color565(255, 127, 0),   // Orange
+      display->color565(255, 255, 0),   // Yellow
+      display->color565(0, 255, 0),     // Green
+      display->color565(0, 0, 255),     // Blue
+      display->color565(75, 0, 130),    // Indigo
+      display->color565(148, 0, 211)    // Violet
+    };
+    
+    display->fillArc(centerX, centerY, radius, radius - 27, 180, 360, display->getThemeColors().bg);
+    for (int i = 0; i < 7; i++) {
+      for (int angle = 180; angle <= 360; angle += 2) {
+        int16_t x1, y1, x2, y2;
+        fxPolar(centerX, centerY, radius - i * 4, fxDegToAngle(angle), x1, y1);
+        fxPolar(centerX, centerY, radius - i * 4 - 3, fxDegToAngle(angle), x2, y2);
+        display->drawLine(x1, y1, x2, y2, rainbowColors[i]);
+      }
+    }
+  };
+  auto title = [this]() {
+    const ThemeColors& colors = display->getThemeColors();
+    display->fillRoundRect(24, 134, 192, 66, 12, colors.bg);
+    display->setTextColor(colors.text);
+    display->drawCenteredText("VIVA LA", 140, 3);
+    display->drawCenteredText("ELTON JOHN", 170, 3);
+  };
+  
+  bool saved = display->showRingOverlay(OVERLAY_RAINBOW, 120, 120, 101, 72, rainbow, 120) &&
+               display->showOverlay(OVERLAY_CARD, 24, 134, 192, 66, title);
+  if (!saved) {
+    display->hideOverlay(OVERLAY_RAINBOW);
+    display->clear();
+    rainbow();
+    title();
+    overlayDrawnDirect = true;
+  }
+  timedOverlay = true;
+  overlayHideTime = millis() + EASTER_EGG_DURATION;
 }
 
-bool UIManager::shouldRedraw(PrinterStatus& status) {
-  // Check if significant values changed
-  if (abs(status.hotendTemp - lastStatus.hotendTemp) > 1.0) return true;
-  if (abs(status.bedTemp - lastStatus.bedTemp) > 1.0) return true;
-  if (status.printProgress != lastStatus.printProgress) return true;
-  if (status.state != lastStatus.state) return true;
-  
-  return false;
+// Take the HUD / easter egg down, leaving the screen as it is underneath
+void UIManager::hideTimedOverlays() {
+  timedOverlay = false;
+  display->hideOverlay(OVERLAY_RAINBOW);
+  display->hideOverlay(OVERLAY_CARD);
+  if (overlayDrawnDirect) {
+    overlayDrawnDirect = false;
+    display->clear();
+    drawScreen(currentScreen, showingAnimation, lastStatus);
+  }
 }
 
-String UIManager::formatTime(uint32_t seconds) {
-  uint32_t hours = seconds / 3600;
-  uint32_t minutes = (seconds % 3600) / 60;
-  uint32_t secs = seconds % 60;
-  
-  char timeStr[16];
-  if (hours > 0) {
-    sprintf(timeStr, "%dh %dm", hours, minutes);
-  } else if (minutes > 0) {
-    sprintf(timeStr, "%dm %ds", minutes, secs);
-  } else {
-    sprintf(timeStr, "%ds", secs);
-  }
-  
-  return String(timeStr);
+void UIManager::updateRollingEyes() {
+  // Redraw eyes with the current frame
+  drawIdleScreen(lastStatus);
 }
 
-String UIManager::formatTemperature(float temp, float target) {
-  char tempStr[16];
-  if (target > 0) {
-    sprintf(tempStr, "%.0f/%.0f", temp, target);
-  } else {
-    sprintf(tempStr, "%.0f", temp);
-  }
-  return String(tempStr);
+void UIManager::updatePrintingAnimation() {
+  // Could add subtle animations during printing if desired
+  // For now, keep it static to avoid distractions
 }
 
 void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
+  // Anything a gesture draws would land in the middle of a transition
+  if (event != TOUCH_MOVE && event != TOUCH_UP) {
+    finishTransition();
+  }
+  
   // Handle different touch events
   switch (event) {
     case TOUCH_GESTURE_TAP:
@@ -504,8 +717,12 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
       manualMode = false;  // Exit manual mode on tap
       if (currentScreen == SCREEN_IDLE || currentScreen == SCREEN_PRINTING) {
         display->nextTheme();
-        // Clear screen and redraw to show new theme
-        display->clear();
+        // Clear screen and redraw to show new theme (an indexed back
+        // buffer was recolored by the palette swap; the redraw below only
+        // updates what looks different per theme)
+        if (!display->isIndexed()) {
+          display->clear();
+        }
         if (currentScreen == SCREEN_IDLE) {
           drawIdleScreen(lastStatus);
         } else if (currentScreen == SCREEN_PRINTING) {
@@ -519,62 +736,7 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
       // Handle circle gesture - show VIVA LA ELTON JOHN logo
       {
         Serial.println("Touch: Circle gesture - showing VIVA LA ELTON JOHN!");
-        display->clear();
-        
-        // Draw rainbow arc at top
-        int16_t centerX = 120;
-        int16_t centerY = 120;
-        int16_t radius = 100;
-        
-        // Rainbow colors (7 colors)
-        uint16_t rainbowColors[] = {
-          display->color565(255, 0, 0),     // Red
-          display->color565(255, 127, 0),   // Orange
-          display->color565(255, 255, 0),   // Yellow
-          display->color565(0, 255, 0),     // Green
-          display->color565(0, 0, 255),     // Blue
-          display->color565(75, 0, 130),    // Indigo
-          display->color565(148, 0, 211)    // Violet
-        };
-        
-        // Draw rainbow arcs
-        for (int i = 0; i < 7; i++) {
-          for (int angle = 180; angle <= 360; angle += 2) {
-            float rad = angle * PI / 180.0;
-            int16_t x1 = centerX + (radius - i * 4) * cos(rad);
-            int16_t y1 = centerY + (radius - i * 4) * sin(rad);
-            int16_t x2 = centerX + (radius - i * 4 - 3) * cos(rad);
-            int16_t y2 = centerY + (radius - i * 4 - 3) * sin(rad);
-            display->drawLine(x1, y1, x2, y2, rainbowColors[i]);
-          }
-        }
-        
-        // Draw text
-        display->setTextColor(display->getThemeColors().text);
-        display->drawCenteredText("VIVA LA", 140, 3);
-        display->drawCenteredText("ELTON JOHN", 170, 3);
-        
-        // Show for 3 seconds
-        delay(3000);
-        
-        // Clear and redraw current screen
-        display->clear();
-        switch (currentScreen) {
-          case SCREEN_IDLE:
-            drawIdleScreen(lastStatus);
-            break;
-          case SCREEN_PRINTING:
-            drawPrintingScreen(lastStatus);
-            break;
-          case SCREEN_PAUSED:
-            drawPausedScreen(lastStatus);
-            break;
-          case SCREEN_COMPLETE:
-            drawCompleteScreen(lastStatus);
-            break;
-          default:
-            break;
-        }
+        showEasterEgg();
       }
       break;
       
@@ -600,26 +762,8 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
             break;
         }
         
-        currentScreen = nextScreen;
-        display->clear();
-        
-        // Draw the new screen
-        switch (currentScreen) {
-          case SCREEN_IDLE:
-            drawIdleScreen(lastStatus);
-            break;
-          case SCREEN_PRINTING:
-            drawPrintingScreen(lastStatus);
-            break;
-          case SCREEN_PAUSED:
-            drawPausedScreen(lastStatus);
-            break;
-          case SCREEN_COMPLETE:
-            drawCompleteScreen(lastStatus);
-            break;
-          default:
-            break;
-        }
+        // Slide the new screen in the direction of the swipe
+        switchScreen(nextScreen, false, TRANSITION_SLIDE_LEFT, lastStatus);
         
         manualMode = true;  // Enter manual mode
         Serial.printf("Touch: Swipe left - Screen mode: %d (manual)\n", currentScreen);
@@ -647,26 +791,8 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
             break;
         }
         
-        currentScreen = prevScreen;
-        display->clear();
-        
-        // Draw the new screen
-        switch (currentScreen) {
-          case SCREEN_IDLE:
-            drawIdleScreen(lastStatus);
-            break;
-          case SCREEN_PRINTING:
-            drawPrintingScreen(lastStatus);
-            break;
-          case SCREEN_PAUSED:
-            drawPausedScreen(lastStatus);
-            break;
-          case SCREEN_COMPLETE:
-            drawCompleteScreen(lastStatus);
-            break;
-          default:
-            break;
-        }
+        // Slide the new screen in the direction of the swipe
+        switchScreen(prevScreen, false, TRANSITION_SLIDE_RIGHT, lastStatus);
         
         manualMode = true;  // Enter manual mode
         Serial.printf("Touch: Swipe right - Screen mode: %d (manual)\n", currentScreen);
@@ -682,20 +808,7 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
         Serial.printf("Touch: Swipe up - Brightness: %d -> %d\n", currentBrightness, newBrightness);
         
         // Show brightness indicator briefly
-        display->clear();
-        display->setTextColor(display->getThemeColors().text);
-        display->drawCenteredText("Brightness", 100, 2);
-        char brightStr[16];
-        sprintf(brightStr, "%d%%", (newBrightness * 100) / 255);
-        display->drawCenteredText(brightStr, 130, 3);
-        delay(500);
-        
-        // Redraw current screen
-        if (currentScreen == SCREEN_IDLE) {
-          drawIdleScreen(lastStatus);
-        } else if (currentScreen == SCREEN_PRINTING) {
-          drawPrintingScreen(lastStatus);
-        }
+        showBrightnessHud(newBrightness);
       }
       break;
       
@@ -708,20 +821,7 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
         Serial.printf("Touch: Swipe down - Brightness: %d -> %d\n", currentBrightness, newBrightness);
         
         // Show brightness indicator briefly
-        display->clear();
-        display->setTextColor(display->getThemeColors().text);
-        display->drawCenteredText("Brightness", 100, 2);
-        char brightStr[16];
-        sprintf(brightStr, "%d%%", (newBrightness * 100) / 255);
-        display->drawCenteredText(brightStr, 130, 3);
-        delay(500);
-        
-        // Redraw current screen
-        if (currentScreen == SCREEN_IDLE) {
-          drawIdleScreen(lastStatus);
-        } else if (currentScreen == SCREEN_PRINTING) {
-          drawPrintingScreen(lastStatus);
-        }
+        showBrightnessHud(newBrightness);
       }
       break;
       
@@ -763,19 +863,13 @@ void UIManager::handleTouchEvent(TouchEvent event, TouchPoint point) {
   }
 }
 
-// Spaceman animation - real GIF from spaceman_gif.h
+// Spaceman animation - real GIF from spaceman_gif.h (or the asset pack)
 void UIManager::drawSpacemanAnimation() {
-  // Calculate animation frame based on time
-  unsigned long elapsed = millis() - spacemanStartTime;
-  int frameIndex = (elapsed / 200) % SPACEMAN_FRAME_COUNT;  // 200ms per frame = 5fps
-  
-  // Get the current frame data from array
-  const uint16_t* frameData = spaceman_frames[frameIndex];
-  
-  if (frameData) {
-    // Scale 120x120 to 240x240 (2x zoom) using LovyanGFX
-    // pushImageRotateZoom(x, y, center_x, center_y, angle, zoom_x, zoom_y, width, height, data)
-    // Position at screen center (120,120), source center at (60,60)
-    display->getTFT()->pushImageRotateZoom(120, 120, 60, 60, 0, 2.0, 2.0, SPACEMAN_WIDTH, SPACEMAN_HEIGHT, frameData);
+  // Scaled 120x120 to 240x240 (2x zoom), centered on the screen. The player
+  // keeps the GIF's own frame times and redraws only what changed.
+  if (!spacemanPlayer.isPlaying()) {
+    const RleFrame* size = spaceman->keyframe;
+    spacemanPlayer.play(spaceman, SCREEN_WIDTH/2 - size->width, SCREEN_HEIGHT/2 - size->height, 2);
   }
+  spacemanPlayer.update();
 }
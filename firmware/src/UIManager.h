@@ -9,8 +9,13 @@
 
 #include <Arduino.h>
 #include "DisplayDriver.h"
+#include "Widget.h"
+#include "GlowText.h"
+#include "FrameScheduler.h"
 #include "KlipperAPI.h"
 #include "TouchDriver.h"
+#include "AnimationPlayer.h"
+#include "AssetPack.h"
 
 // Screen types
 enum ScreenType {
@@ -27,8 +32,9 @@ class UIManager {
 public:
   UIManager();
   
-  // Initialization
-  void init(DisplayDriver* display);
+  // Initialization. Animations found in the asset pack (if any) replace
+  // the built-in ones.
+  void init(DisplayDriver* display, AssetPack* assets = nullptr);
   
   // Screen management
   void showBootScreen();
@@ -42,29 +48,93 @@ public:
   // Touch event handling
   void handleTouchEvent(TouchEvent event, TouchPoint point);
   
+  // Render timing of the animation frames
+  const FrameStats& getFrameStats() const { return frameScheduler.getStats(); }
+  void resetFrameStats() { frameScheduler.resetStats(); }
+  
 private:
   DisplayDriver* display;
   ScreenType currentScreen;
-  unsigned long lastAnimationUpdate;
-  int animationFrame;
+  FrameScheduler frameScheduler;
+  int animationFrame;             // Animation steps (FRAME_STEP_MS each)
+  static constexpr int ANIMATION_FRAME_WRAP = 36000;  // 6 minutes
   PrinterStatus lastStatus;
   
+  // Data screens as widget trees (rebuilt from the status, painted as diffs)
+  WidgetScreen idleScreen;
+  EyesWidget idleEyes;
+  LabelWidget idleReady;
+  NumberWidget idleChamber;
+  NumberWidget idleTemps;
+  
+  WidgetScreen printingScreen;
+  RingWidget printingRing;
+  NumberWidget printingProgress;
+  GaugeWidget hotendGauge;
+  GaugeWidget bedGauge;
+  NumberWidget hotendTemp;
+  NumberWidget hotendTarget;
+  NumberWidget bedTemp;
+  NumberWidget bedTarget;
+  NumberWidget printingEta;
+  LabelWidget printingFile;
+  NumberWidget printingZ;
+  
+  WidgetScreen pausedScreen;
+  RingWidget pausedRing;
+  LabelWidget pausedTitle;
+  NumberWidget pausedProgress;
+  LabelWidget pausedTemps;
+  
+  WidgetScreen completeScreen;
+  IconWidget completeIcon;
+  LabelWidget completeTitle;
+  LabelWidget completeTime;
+  
+  WidgetScreen errorScreen;
+  IconWidget errorIcon;
+  LabelWidget errorTitle;
+  LabelWidget errorHint;
+  
+  AnimationPlayer spacemanPlayer;
+  
+  // Cached NEON halos for the animation screens
+  GlowText idleTempGlow;
+  GlowText progressGlow;
+  GlowText printingGlow[4];     // One per "PRINTING..." dot state
+  
   // Animation cycling
   unsigned long lastScreenSwitch;
   bool showingAnimation;
+  
+  // Screen transition in progress, one frame per scheduled frame (nothing
+  // else draws until it ends)
+  bool transitioning;
+  ScreenType transitionFrom;
+  bool transitionFromAnimated;
   static constexpr unsigned long DATA_DISPLAY_TIME = 10000;  // 10 seconds showing data
   static constexpr unsigned long ANIMATION_DISPLAY_TIME = 5000;  // 5 seconds showing animation
   
   // Touch feedback
   unsigned long lastTouchFeedback;
+  int16_t touchRingLevel;         // Fade level on screen, -1 = hidden
   static constexpr unsigned long TOUCH_FEEDBACK_DURATION = 200;
   bool manualMode;  // True when user manually swipes to a screen
   
+  // Overlays, drawn over the current screen (see DisplayDriver::showOverlay())
+  enum OverlayLayer { OVERLAY_TOUCH_RING, OVERLAY_RAINBOW, OVERLAY_CARD };
+  bool timedOverlay;                // Brightness HUD or easter egg is up
+  unsigned long overlayHideTime;
+  bool overlayDrawnDirect;          // No back buffer: repaint the screen to hide it
+  static constexpr unsigned long BRIGHTNESS_HUD_DURATION = 500;
+  static constexpr unsigned long EASTER_EGG_DURATION = 3000;
+  
   // Complete screen timeout
   unsigned long completeScreenStartTime;
   static constexpr unsigned long COMPLETE_SCREEN_TIMEOUT = 30000;  // 30 seconds
   
   // Spaceman animation
+  const Animation* spaceman;
   unsigned long spacemanStartTime;
   unsigned long lastSpacemanCheck;
   bool spacemanShownOnBoot;
@@ -72,6 +142,14 @@ private:
   static constexpr unsigned long SPACEMAN_RANDOM_CHECK = 60000;  // Check every 60 seconds
   static constexpr int SPACEMAN_SPAWN_CHANCE = 5;  // 5% chance to spawn
 
+  // Screen switching
+  static bool hasAnimation(ScreenType screen) { return screen == SCREEN_IDLE || screen == SCREEN_PRINTING; }
+  void drawScreen(ScreenType screen, bool animated, PrinterStatus& status);
+  void switchScreen(ScreenType screen, bool animated, TransitionType type, PrinterStatus& status);
+  void stepTransition(bool skipToEnd = false);
+  void finishTransition() { if (transitioning) stepTransition(true); }
+  void applyWireFormat();
+  
   // Screen drawing functions
   void drawIdleScreen(PrinterStatus& status);
   void drawPrintingScreen(PrinterStatus& status);
@@ -90,15 +168,16 @@ private:
   void drawProgressCircle(uint8_t progress);
   void drawPrintInfo(PrinterStatus& status);
   void drawTemperatureGauges(PrinterStatus& status);
+  void buildScreens();
+  
+  // Overlays
+  void showBrightnessHud(int brightness);
+  void showEasterEgg();
+  void hideTimedOverlays();
   
   // Animations
   void updateRollingEyes();
   void updatePrintingAnimation();
-  
-  // Helper functions
-  String formatTime(uint32_t seconds);
-  String formatTemperature(float temp, float target);
-  bool shouldRedraw(PrinterStatus& status);
 };
 
 #endif // UI_MANAGER_H
@@ -0,0 +1,350 @@
+/*
+ * Retained-Mode Widgets Implementation
+ */
+
+#include "Widget.h"
+
+WidgetScreen* WidgetScreen::lastRendered = nullptr;
+
+static bool rectsOverlap(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                         int16_t bx, int16_t by, int16_t bw, int16_t bh) {
+  return ax < bx + bw && bx < ax + aw && ay < by + bh && by < ay + ah;
+}
+
+// True if the rectangle reaches the ring between radii inner and outer
+// (inclusive) around (cx, cy)
+static bool annulusOverlaps(int32_t cx, int32_t cy, int32_t inner, int32_t outer,
+                            int16_t rx, int16_t ry, int16_t rw, int16_t rh) {
+  // Nearest and farthest point of the rectangle from the center
+  int32_t nx = constrain(cx, (int32_t)rx, (int32_t)rx + rw - 1) - cx;
+  int32_t ny = constrain(cy, (int32_t)ry, (int32_t)ry + rh - 1) - cy;
+  int32_t fx = max(abs(rx - cx), abs(rx + rw - 1 - cx));
+  int32_t fy = max(abs(ry - cy), abs(ry + rh - 1 - cy));
+  return nx * nx + ny * ny <= outer * outer && fx * fx + fy * fy >= inner * inner;
+}
+
+// --- Widget ---
+
+Widget::Widget(int16_t x, int16_t y, int16_t w, int16_t h, bool opaque) :
+  x(x),
+  y(y),
+  w(w),
+  h(h),
+  opaque(opaque),
+  dirty(true),
+  damaged(false),
+  next(nullptr)
+{
+}
+
+bool Widget::overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const {
+  return rectsOverlap(x, y, w, h, rx, ry, rw, rh);
+}
+
+// --- WidgetScreen ---
+
+WidgetScreen::WidgetScreen() :
+  first(nullptr),
+  last(nullptr),
+  surfaceEpoch(0)
+{
+}
+
+void WidgetScreen::add(Widget* widget) {
+  widget->next = nullptr;
+  if (last) {
+    last->next = widget;
+  } else {
+    first = widget;
+  }
+  last = widget;
+}
+
+void WidgetScreen::render(DisplayDriver* display) {
+  if (display->inFrame()) {
+    // Composited into someone else's frame: nothing on screen can be trusted
+    for (Widget* wg = first; wg; wg = wg->next) {
+      wg->paint(display, true);
+    }
+    surfaceEpoch = 0;
+    lastRendered = nullptr;
+    return;
+  }
+
+  bool full = lastRendered != this || surfaceEpoch != display->getSurfaceEpoch();
+  bool anyDirty = false;
+  for (Widget* wg = first; wg; wg = wg->next) {
+    anyDirty = anyDirty || wg->dirty;
+  }
+  if (!full && !anyDirty) return;
+
+  // A banded frame replays this once per strip: it must not change any
+  // state the decisions below depend on until the frame is done
+  display->renderFrame([&]() {
+    // Strips start blank, so a banded frame is always painted in full
+    bool repaintAll = full || display->getSurfaceId() == 0;
+    if (repaintAll && !display->isSurfaceBlank()) {
+      display->clear();
+    }
+
+    for (Widget* wg = first; wg; wg = wg->next) {
+      wg->damaged = false;
+    }
+
+    // Erase changed widgets that cannot paint over themselves; everything
+    // they overlap loses pixels too
+    if (!repaintAll) {
+      uint16_t bg = display->getThemeColors().bg;
+      for (Widget* wg = first; wg; wg = wg->next) {
+        if (!wg->dirty || wg->opaque) continue;
+        display->fillRect(wg->x, wg->y, wg->w, wg->h, bg);
+        for (Widget* other = first; other; other = other->next) {
+          if (other != wg && other->overlaps(wg->x, wg->y, wg->w, wg->h)) {
+            other->damaged = true;
+          }
+        }
+      }
+    }
+
+    // Paint bottom to top; a paint may cover widgets above it
+    for (Widget* wg = first; wg; wg = wg->next) {
+      if (!repaintAll && !wg->dirty && !wg->damaged) continue;
+      wg->paint(display, repaintAll || wg->damaged || !wg->opaque);
+      for (Widget* above = wg->next; above; above = above->next) {
+        if (wg->overlaps(above->x, above->y, above->w, above->h)) {
+          above->damaged = true;
+        }
+      }
+    }
+  });
+
+  for (Widget* wg = first; wg; wg = wg->next) {
+    wg->dirty = false;
+  }
+  surfaceEpoch = display->getSurfaceEpoch();
+  lastRendered = this;
+}
+
+// --- LabelWidget ---
+
+LabelWidget::LabelWidget(int16_t centerX, int16_t y, uint8_t maxChars, uint8_t size) :
+  Widget(centerX - maxChars * DIGIT_GLYPH_WIDTH * size / 2, y,
+         maxChars * DIGIT_GLYPH_WIDTH * size, DIGIT_GLYPH_HEIGHT * size, false),
+  size(size),
+  color(COLOR_WHITE)
+{
+  text[0] = '\0';
+}
+
+void LabelWidget::setText(const char* str) {
+  if (strncmp(str, text, LABEL_MAX_TEXT) == 0) return;
+  strncpy(text, str, LABEL_MAX_TEXT);
+  text[LABEL_MAX_TEXT] = '\0';
+  invalidate();
+}
+
+void LabelWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void LabelWidget::paint(DisplayDriver* display, bool full) {
+  if (!text[0]) return;
+  display->setTextColor(color);
+  int16_t textWidth = display->getTextWidth(text, size);
+  display->setCursor(x + (w - textWidth) / 2, y);
+  display->print(text);
+}
+
+// --- NumberWidget ---
+
+static int16_t fieldWidth(uint8_t cells, uint8_t size, const char* label) {
+  return ((label ? strlen(label) : 0) + min<uint8_t>(cells, DIGIT_FIELD_MAX_CELLS)) * DIGIT_GLYPH_WIDTH * size;
+}
+
+NumberWidget::NumberWidget(int16_t centerX, int16_t y, uint8_t cells, uint8_t size, const char* label) :
+  Widget(centerX - fieldWidth(cells, size, label) / 2, y,
+         fieldWidth(cells, size, label), DIGIT_GLYPH_HEIGHT * size, true),
+  field(centerX, y, cells, size, label),
+  color(COLOR_WHITE)
+{
+  text[0] = '\0';
+}
+
+void NumberWidget::setText(const char* str) {
+  if (strncmp(str, text, DIGIT_FIELD_MAX_CELLS) == 0) return;
+  strncpy(text, str, DIGIT_FIELD_MAX_CELLS);
+  text[DIGIT_FIELD_MAX_CELLS] = '\0';
+  invalidate();
+}
+
+void NumberWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void NumberWidget::paint(DisplayDriver* display, bool full) {
+  if (full) field.invalidate();
+  field.draw(display, text, color);
+}
+
+// --- RingWidget ---
+
+RingWidget::RingWidget(int16_t centerX, int16_t centerY, int16_t r, int16_t thickness) :
+  // NEON glow reaches r + 3
+  Widget(centerX - r - 3, centerY - r - 3, 2 * r + 7, 2 * r + 7, true),
+  r(r),
+  thickness(thickness),
+  progress(0),
+  color(COLOR_WHITE)
+{
+}
+
+void RingWidget::setProgress(uint8_t value) {
+  if (value == progress) return;
+  progress = value;
+  invalidate();
+}
+
+void RingWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+// The hole is untouched apart from the center dot
+bool RingWidget::overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const {
+  if (!Widget::overlaps(rx, ry, rw, rh)) return false;
+
+  int32_t cx = x + w / 2;
+  int32_t cy = y + h / 2;
+  if (annulusOverlaps(cx, cy, r - thickness, w, rx, ry, rw, rh)) return true;
+  return progress > 0 && annulusOverlaps(cx, cy, 0, 3, rx, ry, rw, rh);
+}
+
+void RingWidget::paint(DisplayDriver* display, bool full) {
+  if (full) display->invalidateProgressRing();
+  display->drawProgressRing(x + w / 2, y + h / 2, r, thickness, progress, color);
+}
+
+// --- GaugeWidget ---
+
+GaugeWidget::GaugeWidget(int16_t centerX, int16_t centerY, int16_t r) :
+  Widget(centerX - r, centerY - r, 2 * r + 1, 2 * r + 1, false),
+  r(r),
+  temp(0),
+  target(0),
+  color(COLOR_WHITE)
+{
+}
+
+void GaugeWidget::setValue(float newTemp, float newTarget) {
+  int16_t t = (int16_t)newTemp;
+  int16_t tt = (int16_t)newTarget;
+  if (t == temp && tt == target) return;
+  temp = t;
+  target = tt;
+  invalidate();
+}
+
+void GaugeWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void GaugeWidget::paint(DisplayDriver* display, bool full) {
+  display->drawTemperatureGauge(x + r, y + r, r, temp, target, color);
+}
+
+// --- IconWidget ---
+
+IconWidget::IconWidget(int16_t centerX, int16_t centerY, IconType type) :
+  Widget(centerX - 15, centerY - 15, 31, 31, false),
+  type(type),
+  color(COLOR_WHITE)
+{
+}
+
+void IconWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void IconWidget::paint(DisplayDriver* display, bool full) {
+  if (type == ICON_CHECK) {
+    display->drawCheckIcon(x + 15, y + 15, color);
+  } else {
+    display->drawErrorIcon(x + 15, y + 15, color);
+  }
+}
+
+// --- EyesWidget ---
+
+EyesWidget::EyesWidget() :
+  // Bounded by the breathing ring; the eyes are inside it
+  Widget(SCREEN_WIDTH/2 - EYES_RING_OUTER, SCREEN_HEIGHT/2 - EYES_RING_OUTER,
+         2 * EYES_RING_OUTER + 1, 2 * EYES_RING_OUTER + 1, true),
+  frame(-1)
+{
+}
+
+bool EyesWidget::overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const {
+  if (!Widget::overlaps(rx, ry, rw, rh)) return false;
+
+  int16_t eye = EYES_SIZE + EYES_GLOW;
+  return annulusOverlaps(SCREEN_WIDTH/2, SCREEN_HEIGHT/2, EYES_RING_INNER, EYES_RING_OUTER, rx, ry, rw, rh) ||
+         annulusOverlaps(SCREEN_WIDTH/2 - EYES_SPACING, SCREEN_HEIGHT/2, 0, eye, rx, ry, rw, rh) ||
+         annulusOverlaps(SCREEN_WIDTH/2 + EYES_SPACING, SCREEN_HEIGHT/2, 0, eye, rx, ry, rw, rh);
+}
+
+void EyesWidget::setFrame(int16_t value) {
+  if (value == frame) return;
+  frame = value;
+  invalidate();
+}
+
+void EyesWidget::paint(DisplayDriver* display, bool full) {
+  display->drawRollingEyes(frame);
+}
+
+// --- ImageWidget ---
+
+ImageWidget::ImageWidget(int16_t centerX, int16_t centerY, const RleAnimation* animation, uint8_t zoom) :
+  Widget(centerX - animation->width * zoom / 2, centerY - animation->height * zoom / 2,
+         animation->width * zoom, animation->height * zoom, true),
+  animation(animation),
+  zoom(zoom),
+  frame(0),
+  shown(-1)
+{
+}
+
+void ImageWidget::setAnimation(const RleAnimation* image) {
+  if (image == animation) return;
+  int16_t centerX = x + w / 2;
+  int16_t centerY = y + h / 2;
+  animation = image;
+  w = image->width * zoom;
+  h = image->height * zoom;
+  x = centerX - w / 2;
+  y = centerY - h / 2;
+  frame = 0;
+  shown = -1;
+  invalidate();
+}
+
+void ImageWidget::setFrame(uint8_t index) {
+  if (index == frame) return;
+  frame = index;
+  invalidate();
+}
+
+void ImageWidget::paint(DisplayDriver* display, bool full) {
+  // On top of its last paint only the deltas since then are drawn
+  display->drawRleAnimation(animation, full ? -1 : shown, frame, x, y, zoom);
+  shown = frame;
+}
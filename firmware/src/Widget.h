@@ -0,0 +1,191 @@
+/*
+ * Retained-Mode Widgets
+ *
+ * A screen is a list of widgets in z-order. Each widget owns its bounds and
+ * the value it last drew; setters invalidate it only when the value really
+ * changes. WidgetScreen::render() then repaints just the invalidated widgets
+ * plus whatever they overlap, instead of redrawing the whole screen.
+ */
+
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include <Arduino.h>
+#include "DisplayDriver.h"
+#include "DigitField.h"
+
+#define LABEL_MAX_TEXT 24
+
+class Widget {
+public:
+  // opaque: paint() covers every pixel of its previous paint, so a change
+  // needs no erase first (the widget is not erased to the background)
+  Widget(int16_t x, int16_t y, int16_t w, int16_t h, bool opaque);
+  virtual ~Widget() {}
+
+  void invalidate() { dirty = true; }
+  bool isDirty() const { return dirty; }
+
+  // True if painting this widget can touch pixels inside the rectangle
+  virtual bool overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const;
+
+protected:
+  // full: the pixels under the widget are not its last paint (first paint,
+  // screen cleared, or erased/overdrawn by a neighbour). Otherwise the last
+  // paint is still on screen and the widget may update incrementally.
+  virtual void paint(DisplayDriver* display, bool full) = 0;
+
+  int16_t x, y, w, h;
+  bool opaque;
+
+private:
+  bool dirty;
+  bool damaged;    // Touched by another widget's erase or paint this frame
+  Widget* next;    // Next widget up in z-order
+
+  friend class WidgetScreen;
+};
+
+class WidgetScreen {
+public:
+  WidgetScreen();
+
+  // Append on top of the existing widgets
+  void add(Widget* widget);
+
+  // Repaint everything on the next render()
+  void invalidate() { surfaceEpoch = 0; }
+
+  // Paint invalidated widgets in one frame. A full repaint (first render,
+  // screen cleared, or another screen drew since) clears to the theme
+  // background first unless the panel is already blank. Inside another
+  // frame (an animation compositing the screen) everything is painted.
+  void render(DisplayDriver* display);
+
+private:
+  Widget* first;
+  Widget* last;
+  uint32_t surfaceEpoch;               // Display epoch of the last render
+
+  static WidgetScreen* lastRendered;   // Screen whose pixels are showing
+};
+
+// Single-line text centered on centerX, erased and redrawn when it changes
+class LabelWidget : public Widget {
+public:
+  LabelWidget(int16_t centerX, int16_t y, uint8_t maxChars, uint8_t size);
+  void setText(const char* text);
+  void setColor(uint16_t color);
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  char text[LABEL_MAX_TEXT + 1];
+  uint8_t size;
+  uint16_t color;
+};
+
+// Fixed-width numeric readout; repaints only the digits that changed
+class NumberWidget : public Widget {
+public:
+  NumberWidget(int16_t centerX, int16_t y, uint8_t cells, uint8_t size, const char* label = nullptr);
+  void setText(const char* text);
+  void setColor(uint16_t color);
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  DigitField field;
+  char text[DIGIT_FIELD_MAX_CELLS + 1];
+  uint16_t color;
+};
+
+// Progress ring; redraws only the changed wedge unless damaged
+class RingWidget : public Widget {
+public:
+  RingWidget(int16_t centerX, int16_t centerY, int16_t r, int16_t thickness);
+  void setProgress(uint8_t progress);
+  void setColor(uint16_t color);
+  bool overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const;
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  int16_t r, thickness;
+  uint8_t progress;
+  uint16_t color;
+};
+
+// Temperature dial with needle and target marker
+class GaugeWidget : public Widget {
+public:
+  GaugeWidget(int16_t centerX, int16_t centerY, int16_t r);
+  void setValue(float temp, float target);
+  void setColor(uint16_t color);
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  int16_t r;
+  int16_t temp;    // Whole degrees, as drawn
+  int16_t target;
+  uint16_t color;
+};
+
+enum IconType {
+  ICON_CHECK,
+  ICON_ERROR
+};
+
+class IconWidget : public Widget {
+public:
+  IconWidget(int16_t centerX, int16_t centerY, IconType type);
+  void setColor(uint16_t color);
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  IconType type;
+  uint16_t color;
+};
+
+// The idle screen's rolling eyes and breathing ring. Only the two eye discs
+// and the ring are painted, so only widgets touching those are damaged.
+class EyesWidget : public Widget {
+public:
+  EyesWidget();
+  void setFrame(int16_t frame);
+  bool overlaps(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const;
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  int16_t frame;
+};
+
+// Compressed animation centered on (x, y) at an integer zoom; a new frame
+// paints only what changed since the last one
+class ImageWidget : public Widget {
+public:
+  ImageWidget(int16_t centerX, int16_t centerY, const RleAnimation* animation, uint8_t zoom);
+  // Another animation, centered where the last one was
+  void setAnimation(const RleAnimation* animation);
+  void setFrame(uint8_t index);
+
+protected:
+  void paint(DisplayDriver* display, bool full);
+
+private:
+  const RleAnimation* animation;
+  uint8_t zoom;
+  uint8_t frame;
+  int16_t shown;   // Frame last painted, for deltas from it
+};
+
+#endif // WIDGET_H
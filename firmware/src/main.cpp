@@ -7,12 +7,11 @@
 #include "Environmental.h"
 #include "TouchDriver.h"
 #include "WifiConfig.h"
+#include "AssetPack.h"
 
-// External declarations for spaceman animation (defined in spaceman_data.cpp)
-extern const uint16_t* spaceman_frames[];
-#define SPACEMAN_FRAME_COUNT 5
-#define SPACEMAN_WIDTH 120
-#define SPACEMAN_HEIGHT 120
+// Built-in spaceman animation (defined in spaceman_data.cpp), used when the
+// asset pack has none
+extern const Animation spaceman_animation;
 
 // Global instances
 DisplayDriver display;
@@ -20,6 +19,7 @@ UIManager ui;
 KlipperAPI api;
 EnvironmentalSensor envSensor;
 TouchDriver touchDriver;
+AssetPack assets;
 
 // Theme cycling button (GPIO 9 - can connect a button here)
 const int THEME_BUTTON_PIN = 9;
@@ -79,7 +79,8 @@ void setup() {
   Serial.println("[3/5] Initializing display...");
   display.init();
   Serial.println("      Display hardware OK");
-  ui.init(&display);
+  assets.begin();
+  ui.init(&display, &assets);
   Serial.println("      UI Manager OK");
 
   // Initialize environmental sensor (BME280 on I2C) - TEMPORARILY DISABLED
@@ -116,23 +117,20 @@ void setup() {
     Serial.println("[BOOT] Showing Spaceman GIF animation...");
     
     // Play GIF animation - 5 frames at 120x120, scaled 2x to 240x240, loop for 3 seconds
+    const Animation* spaceman = assets.findAnimation("spaceman");
+    if (!spaceman) spaceman = &spaceman_animation;
+    AnimationPlayer bootPlayer;
+    bootPlayer.init(&display);
+    bootPlayer.play(spaceman, 120 - spaceman->keyframe->width, 120 - spaceman->keyframe->height, 2);
     unsigned long spacemanStart = millis();
     while (millis() - spacemanStart < 3000) {
-      unsigned long elapsed = millis() - spacemanStart;
-      int frameIndex = (elapsed / 200) % SPACEMAN_FRAME_COUNT;  // 200ms per frame = 5fps
-      
-      // Get the current frame data from array
-      const uint16_t* frameData = spaceman_frames[frameIndex];
-      
-      if (frameData) {
-        // Scale 120x120 to 240x240 (2x zoom) using LovyanGFX
-        // pushImageRotateZoom(x, y, center_x, center_y, angle, zoom_x, zoom_y, width, height, data)
-        // Position at screen center (120,120), source center at (60,60)
-        display.getTFT()->pushImageRotateZoom(120, 120, 60, 60, 0, 2.0, 2.0, SPACEMAN_WIDTH, SPACEMAN_HEIGHT, frameData);
-      }
-      
-      delay(200);  // 200ms per frame
+      bootPlayer.update();
+      delay(5);
     }
+    const AnimationStats& played = bootPlayer.getStats();
+    Serial.printf("[BOOT] Spaceman: %u frames, %u dropped, %u.%u FPS\n", (unsigned)played.frames,
+                  (unsigned)played.dropped, played.fpsX10 / 10, played.fpsX10 % 10);
+    bootPlayer.stop();
     
     // Check WiFi status (already connected in setup)
     display.clear();
@@ -143,6 +141,7 @@ void setup() {
       display.drawCenteredText("WiFi OK!", 80, 2);
       String ipStr = WiFi.localIP().toString();
       display.drawCenteredText(ipStr, 110, 1);
+      display.flush();
       delay(2000);
       
       // Initialize Klipper API
@@ -155,6 +154,7 @@ void setup() {
       display.drawCenteredText(KLIPPER_IP, 100, 1);
       String portStr = ":" + String(KLIPPER_PORT);
       display.drawCenteredText(portStr, 120, 1);
+      display.flush();
       
       // Retry connection with better error handling
       Serial.println("      Testing HTTP connectivity...");
@@ -204,6 +204,7 @@ void setup() {
         display.setTextColor(display.getThemeColors().accent);
         display.drawCenteredText("Connected!", 100, 2);
         Serial.println("      Connected to Klipper!");
+        display.flush();
         delay(1500);
       } else {
         // Klipper not reachable - will retry in loop
@@ -213,6 +214,7 @@ void setup() {
         display.setTextColor(display.getThemeColors().secondary);
         display.drawCenteredText("Will retry...", 130, 1);
         Serial.println("      Failed to connect to Klipper - will retry in loop");
+        display.flush();
         delay(2000);
       }
     } else {
@@ -222,6 +224,7 @@ void setup() {
       display.setTextColor(display.getThemeColors().secondary);
       display.drawCenteredText("Check credentials", 110, 1);
       Serial.println("      WiFi failed - check WifiConfig.h");
+      display.flush();
       delay(3000);
     }
   } else {
@@ -239,6 +242,7 @@ void setup() {
     display.drawCenteredText("Open: 192.168.4.1", 220, 1);
   }
 
+  display.flush();
   delay(2000);
 }
 
@@ -279,6 +283,7 @@ void loop() {
           char retryStr[32];
           sprintf(retryStr, "Attempt %d", connectionRetries);
           display.drawCenteredText(retryStr, 130, 1);
+          display.flush();
         }
         
         // Wait a bit before next attempt
@@ -320,6 +325,7 @@ void loop() {
       display.drawCenteredText("WiFi Error", 100, 2);
       display.setTextColor(display.getThemeColors().secondary);
       display.drawCenteredText("Reconnecting...", 130, 1);
+      display.flush();
       return;  // Skip this update cycle
     }
     
@@ -331,6 +337,23 @@ void loop() {
                   stateNames[status.state], status.state, status.printProgress,
                   status.hotendTemp, status.hotendTarget,
                   status.bedTemp, status.bedTarget);
+    Serial.printf("[DISPLAY] Round mask saved %lu KB, RGB444 %lu KB of SPI traffic\n",
+                  (unsigned long)(display.getMaskSavedBytes() / 1024),
+                  (unsigned long)(display.getWireSavedBytes() / 1024));
+    const FrameStats& frames = ui.getFrameStats();
+    Serial.printf("[FRAME] Period %u ms, render avg %lu us / max %lu us, %lu overruns, quality %u\n",
+                  frames.periodMs, (unsigned long)frames.avgRenderUs, (unsigned long)frames.maxRenderUs,
+                  (unsigned long)frames.overruns, frames.quality);
+    ui.resetFrameStats();
+    const DrawStats& draws = display.getDrawStats();
+    if (draws.frames > 0) {
+      Serial.printf("[DRAW] %lu calls/frame, %lu transactions saved, %lu fills merged, %lu us/frame waiting for DMA\n",
+                    (unsigned long)(draws.calls / draws.frames),
+                    (unsigned long)(draws.calls > draws.transactions ? draws.calls - draws.transactions : 0),
+                    (unsigned long)draws.merged,
+                    (unsigned long)(draws.flushWaitUs / draws.frames));
+    }
+    display.resetDrawStats();
   }
 
   // Update UI animations
@@ -349,5 +372,6 @@ void loop() {
                   touchEvent, touchDriver.getPoint().x, touchDriver.getPoint().y);
   }
 
+  display.flush();
   delay(10);
 }
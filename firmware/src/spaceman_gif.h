@@ -1,6033 +1,1475 @@
-#ifndef SPACEMAN_GIF_H
-#define SPACEMAN_GIF_H
+// Generated by tools/gif_to_header_small.py from Spaceman_optimized.gif - do not edit
+#ifndef SPACEMAN_RLE_H
+#define SPACEMAN_RLE_H
 
-#include <Arduino.h>
+#include "RleFrame.h"
+#include "AnimationPlayer.h"
 
 #define SPACEMAN_FRAME_COUNT 5
 #define SPACEMAN_WIDTH 120
 #define SPACEMAN_HEIGHT 120
 
-const uint16_t spaceman_frame_0[14400] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0100,0x2100,0x2100,0x0200,0x2200,
-  0x2200,0x0200,0x2100,0x2100,0x0100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0100,0x0200,0x2400,0x6600,0x6800,0x8900,0xCA00,0xCB00,0xAC00,0xAC00,
-  0xAC00,0xAC00,0xCB00,0xCA00,0x8900,0x6800,0x4500,0x2400,0x0100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2300,
-  0x6600,0x8900,0xAC00,0xAE00,0xCF00,0xD000,0xD000,0xD000,0xF000,0xF000,0xD000,0xF000,
-  0xF000,0xD000,0xF000,0xF000,0xD000,0xD000,0xD000,0xCF00,0xAD00,0x8B00,0x8900,0x8500,
-  0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0x8800,0x8C00,0xAD00,
-  0xCF00,0xCF00,0xF000,0xF000,0xF000,0xD000,0xD000,0xB000,0xB000,0xB000,0xB000,0xB000,
-  0xB000,0xB000,0xB000,0xB000,0xB000,0xD000,0xD000,0xF000,0xEF00,0xD000,0xF000,0xCE00,
-  0xAD00,0x6900,0x8600,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x4500,0x8A00,0xCD00,0xCF00,0xF000,0xF000,
-  0xD000,0xD100,0xB000,0x8F00,0xAF00,0xCE00,0x0D01,0xEC00,0xEB18,0xEC28,0xEB20,0xEB20,
-  0xEC20,0xEC28,0xEB10,0x0C01,0x0D01,0xAE00,0x8E00,0x8F00,0xB000,0xB000,0xD000,0xD000,
-  0xF000,0xCF00,0xCE00,0xAB00,0x6700,0x2300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x4500,0x8A00,0xCE00,0xF000,0xF100,0xD000,0xAF00,0xAF00,
-  0xAE00,0xAD00,0xCC18,0x0D31,0x0C41,0x2961,0x8879,0x8681,0x86A1,0x86B9,0x86B1,0x86B1,
-  0x86B1,0x86B1,0x8699,0x8781,0x8879,0x2A61,0x2C39,0xED28,0xEC18,0xCD00,0x8E00,0xAF00,
-  0xAF00,0xD000,0xF000,0xF100,0xCF00,0xAB00,0x6600,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2300,0x6800,0xCF00,0xF100,0xD000,0xCF00,0xAF00,0xAE00,0xAD00,0xED10,
-  0x0B39,0x2759,0x6691,0xC8C1,0xE8D1,0xE6F9,0xE7F9,0xE7F9,0xE7F9,0xE8F1,0xE7F9,0xE7F9,
-  0xE7F9,0xE8F1,0xE7F9,0xE7F9,0xE6F9,0xE6F1,0xE8D1,0xA7B9,0x8599,0x4861,0x0C31,0xED18,
-  0xCD08,0xAE00,0xAF00,0xCF00,0xD000,0xF100,0xD000,0xCB00,0x4400,0x0100,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0100,0x8700,0xCE00,0xD000,0xCF00,0xCF00,0xAF00,0xAF00,0xAE08,0xCA18,0x2751,0x8899,
-  0xC6E1,0xE6F9,0xE6F9,0xE8E9,0xEAD9,0x0BC2,0x2FB2,0x30B2,0x30A2,0x3192,0x319A,0x319A,
-  0x319A,0x3192,0x30A2,0x30B2,0x2EB2,0x0BCA,0xEAD9,0xE8F1,0xE6F9,0xC6F9,0xC7E1,0xC9B1,
-  0x6769,0xCB18,0x8E00,0xAF00,0xAF00,0xAF00,0xCF00,0xD000,0xCF00,0x6800,0x0200,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,
-  0xAB00,0xF000,0xD000,0xCF00,0xAF00,0xAF00,0xAD00,0x0A31,0x8999,0xC7D9,0xC5F9,0xE6F9,
-  0x09DA,0x4CCA,0x4FAA,0x328A,0x1482,0x1482,0x3482,0x3582,0x7482,0xB38A,0xB38A,0xB38A,
-  0xB38A,0xB38A,0x5482,0x3582,0x3482,0x1482,0x3482,0x3292,0x4FB2,0x2CD2,0x08E2,0xE6F9,
-  0xC5F1,0xC8D1,0x8981,0xEB20,0xAD00,0xAF00,0xCF00,0xCF00,0xD000,0xD000,0xCC00,0x8500,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6400,0xAD00,
-  0xCF00,0xCF00,0xCF08,0xAF00,0xAD00,0x2931,0x8991,0xA6D9,0xC4F9,0x07FA,0x4DD2,0x2FAA,
-  0xF389,0xF579,0x7582,0x5393,0xD0A3,0x8EBC,0x89D5,0x05E6,0x24EE,0x43EE,0x43EE,0x43EE,
-  0x43EE,0x43EE,0x24EE,0xE6DD,0x4ACD,0x4FBC,0xD0A3,0x3393,0x5582,0xD479,0xF289,0x2FAA,
-  0x4CDA,0x29F2,0xC5F1,0xA7D1,0x8981,0x0921,0xAE00,0xAF00,0xCF00,0xCF00,0xF000,0xCE00,
-  0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2000,0x8600,0xAD00,0xD000,
-  0xCF00,0xAF00,0xCE00,0xED08,0x4A61,0xA5C9,0xC5F9,0x29FA,0x0BCA,0xB099,0xF579,0xB582,
-  0xB2A3,0xACBC,0x67D5,0x24F6,0x83FE,0xA2FE,0xE4F6,0x22FF,0x05EF,0xC9DE,0xE8DE,0xE8DE,
-  0xE8DE,0xC8DE,0x04F7,0x22FF,0xE4F6,0xA2FE,0x63FE,0x05EE,0x48CD,0x6EB4,0x929B,0x9582,
-  0xD581,0xD099,0x2CD2,0x08FA,0xC5F1,0xA6B9,0x6B61,0x0E01,0xAF00,0xAF00,0xEF00,0xD000,
-  0xCE00,0x8700,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x8700,0xEE00,0xF000,0xCE08,
-  0xAE00,0xAD00,0x0B31,0x8889,0xA5E1,0xE6F9,0xEAD1,0xF199,0x357A,0xD382,0xEEAB,0x28DD,
-  0x64FE,0x03FF,0x04F7,0x07E7,0x0AC7,0xCEA6,0x7486,0x957E,0x796E,0x5B5E,0x5A5E,0x5A5E,
-  0x5A5E,0x5B56,0x786E,0x957E,0x948E,0xCDAE,0x0ACF,0x06E7,0x03F7,0xE3FE,0x44FE,0x09D5,
-  0xCFA3,0xB382,0x1582,0xF099,0xE9D1,0xE6F9,0xE6E9,0x8981,0x0B29,0xAE00,0xCF00,0xCE00,
-  0xCF00,0xEF00,0x8800,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8800,0xEE08,0x0E09,0xED08,0xCE00,
-  0xCD08,0x0839,0x85C1,0xE6F9,0xE8E1,0x0EAA,0x3482,0x7582,0xCFAB,0xC6DD,0x02FF,0x23F7,
-  0x06DF,0x8EAE,0x5586,0x3A66,0x1D56,0xDF3D,0xFF3D,0xDE45,0xBE4D,0xBD55,0x9D5D,0x7D5D,
-  0x7D5D,0x9D55,0x9E4D,0xDE3D,0xFF3D,0xDF3D,0x3C56,0x596E,0x548E,0xACB6,0x05E7,0x22FF,
-  0xE2FE,0x48D5,0x8FA3,0x9482,0x338A,0xECB9,0xE8E9,0xC5F9,0xA5B9,0x2941,0xCD00,0xAE00,
-  0xCE00,0xCF00,0xCF00,0x8900,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8600,0xED08,0xEE08,0xED08,0xCE00,0xAC08,
-  0x4961,0xC6E1,0xC5F9,0xEAC1,0x338A,0x5582,0xF192,0xECD4,0xE3FE,0x61FF,0xA9D6,0x358E,
-  0xDC55,0x1F3E,0x1F3E,0xFC55,0x7A6D,0xB78C,0x5394,0x70AB,0x4FA3,0x10B3,0xB2CA,0xD2CA,
-  0xD2CA,0xB2CA,0xF1BA,0xB1A3,0x7494,0xD884,0x9A6D,0xFD4D,0x3F3E,0xFF3D,0xDB5D,0x5396,
-  0xC6E6,0x41FF,0x21FF,0x0ACD,0xB38A,0x5482,0x3192,0xC9C1,0xC6F9,0xC6D9,0x4859,0xAD00,
-  0xAE00,0xEE00,0xCF00,0xEF00,0xA800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x8508,0xED08,0x0E09,0x0D11,0xCD00,0xCC08,0x8881,
-  0xC6F1,0xE7F9,0x4DBA,0x3482,0x3482,0xEDBB,0x83F6,0x60FF,0xCAD6,0x158E,0xFC55,0x5F3E,
-  0xFC55,0x7A65,0xF69B,0xB3CA,0x72CA,0x4FBA,0x4CAA,0x4DB2,0x498A,0x4672,0x6782,0xE99A,
-  0x2CA3,0x6CAA,0x2FC2,0x72D2,0x72D2,0x93E2,0xF3D2,0xF3C2,0x378C,0x9A65,0x1D4E,0x5F3E,
-  0xFA65,0x3396,0xE7E6,0x60FF,0x45EE,0xEFAB,0x3482,0x338A,0x2CBA,0xE7F9,0xA6E1,0x6969,
-  0xAD00,0xAE00,0xEE08,0x0E09,0xED08,0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x4400,0x0C09,0x0D09,0x0C11,0xCD00,0xEC10,0x6881,0xC6F1,
-  0xE7F1,0x2EB2,0xF579,0xB48A,0x2BD5,0xE1FE,0x04EF,0x8FAE,0x5B5E,0x3F3E,0xFC55,0xF66C,
-  0x94A3,0xF4D2,0x31DA,0x6DBA,0x6CA3,0x4C9B,0xCA82,0xCA7A,0x0A7B,0xA762,0x2652,0x087B,
-  0xAB8B,0x4B8B,0x2C93,0x2C9B,0xADA2,0xF1B9,0x30D2,0x72F2,0xB4EA,0x14CB,0xD493,0x3765,
-  0x1D4E,0x5F3E,0x1B5E,0x4FAE,0x22F7,0xC2FE,0xADC4,0x5582,0x357A,0x6DB2,0xE6F9,0xC6E9,
-  0x6969,0xCD00,0xCE00,0xED08,0xEE08,0xEC08,0x6500,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4300,0xEB10,0x2D11,0x2C11,0xCD00,0xEB08,0x6879,0xC5F1,0xE7E9,
-  0x4FA2,0x157A,0x3293,0xC6E5,0x21FF,0xEACE,0x367E,0x5F46,0xFC45,0xF76C,0xD5A3,0x13D3,
-  0xD3F2,0x30E2,0x8DB2,0xAC93,0xEB83,0x8A7B,0x6A7B,0x8B83,0x4DA4,0x0C9C,0xA862,0x6762,
-  0xCC8B,0xAB83,0x0873,0x286B,0x4B7B,0xEC8A,0x2972,0xAB81,0x2FA2,0xB2D2,0xD4F2,0x33D3,
-  0xF5AB,0x386D,0x1E3E,0x3F46,0x548E,0xE7DE,0x01FF,0x29D5,0xF38A,0x357A,0x4DB2,0xE6F9,
-  0xC6E1,0x4969,0xCD08,0xCD00,0x0D11,0x0E09,0xEB08,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0xC808,0x4D19,0x0C11,0xED08,0xCC08,0x6869,0xC5E9,0xE8E9,0x2FA2,
-  0x357A,0x919B,0x25EE,0x61FF,0x8CB6,0x1B5E,0x5F36,0x5B5D,0xF4A3,0xF2D2,0x93F2,0x71E2,
-  0x2E92,0xE979,0x4A83,0x0C8C,0x2A7B,0x2A7B,0x0D9C,0x4DB4,0xCEBC,0xCEBC,0x8B8B,0x885A,
-  0x2A7B,0xAB93,0x4A83,0xC872,0x0973,0x6A7B,0x086B,0xC649,0x2529,0xA951,0x2EA2,0x10DA,
-  0x73FA,0x32D3,0x359C,0xBD55,0x5F36,0x196E,0xC9CE,0x40FF,0xA6DD,0x3293,0x357A,0x2EB2,
-  0xE7F9,0xC6E1,0x2959,0xCD00,0xED08,0x0D09,0x0E09,0xA708,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0xA608,0x2C11,0x2B11,0x0C09,0xCC00,0x4959,0xA6E1,0xE7F9,0x2FA2,0x557A,
-  0x509B,0x64EE,0x61FF,0x50AE,0xFF45,0x5E3E,0x5975,0x13CB,0x12F2,0x53DA,0x4FB2,0xA871,
-  0x8508,0x0642,0x6A8B,0x6B83,0x4A7B,0x2DA4,0xEFBC,0x0FBD,0xEFBC,0x8EB4,0xEC9B,0x6A7B,
-  0xA86A,0xCCA3,0x4EAC,0x6A83,0xC86A,0x2A7B,0xAC93,0x297B,0x4429,0x4400,0xC510,0x2661,
-  0x30B2,0x73E2,0x32EA,0x74BB,0x9A65,0x5F3E,0xFD55,0x8CC6,0x60FF,0xC7DD,0xF38A,0x357A,
-  0x0DB2,0xE6F9,0xA6C9,0x0A41,0xAC00,0x0D09,0x0D09,0x2C09,0x8500,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x6308,0x0A11,0x4C19,0x2B11,0x0B01,0x4829,0xA7C1,0xC5F9,0xEBB1,0x3482,0x509B,
-  0x85EE,0x61FF,0x50AE,0xFE45,0x5E46,0xF784,0x71D2,0x53E2,0x70D2,0xAB79,0x8610,0x2400,
-  0xE618,0x4B83,0xAB8B,0xE972,0xCB93,0xEEBC,0xCEB4,0xAEB4,0xCEBC,0x4DA4,0xAB8B,0xAB8B,
-  0xA86A,0xAB93,0x4DB4,0xCC9B,0x4A7B,0x2A73,0x0A73,0x6A83,0x4B73,0xEC31,0x6900,0x4500,
-  0xC508,0xCC71,0x92CA,0x32EA,0xD2CA,0x5975,0x5E3E,0xFD55,0x6DBE,0x41FF,0xE7DD,0xD292,
-  0x137A,0xECC1,0xE6F9,0x86B1,0xE918,0xCC00,0x0C09,0x2D11,0xE910,0x4200,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xE810,0x6B19,0x2B19,0x2B09,0x2A11,0xC8B1,0xC5F9,0x0ACA,0xF381,0x1293,0x26E6,
-  0x41FF,0x50A6,0x1E46,0x1E46,0x768C,0x71D2,0x73EA,0xB0A2,0x2631,0x4300,0x8900,0xEC08,
-  0xEA6A,0x6A7B,0x0973,0xA76A,0x097B,0xEC93,0xEC93,0x6B7B,0x4A7B,0x2973,0xE872,0xC872,
-  0xE659,0xC96A,0xEC9B,0x2DAC,0x8B83,0x2A73,0x2A73,0x2A73,0x297B,0x0942,0xCD00,0xCF00,
-  0xCA00,0x6300,0x0551,0x2EC2,0x73EA,0xB1C2,0xF87C,0x3F3E,0xFD55,0x8CBE,0x40FF,0x88D5,
-  0x7382,0x3482,0x09D2,0xC5F9,0xA991,0x0A01,0x0C09,0x0C11,0x2C11,0xA608,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8408,0x2A11,0x6B19,0x2C11,0x0C09,0x6861,0xC6F1,0x2AEA,0x1292,0x7582,0xABC4,0x60FF,
-  0x8CC6,0x1D56,0x1F3E,0x568C,0x72D2,0x73EA,0xECA1,0xC428,0x8700,0xAD00,0xCD00,0xCA31,
-  0x0973,0x476A,0xA549,0x0662,0xA782,0xA882,0xA882,0x887A,0x887A,0x887A,0x877A,0x877A,
-  0xE982,0x8B93,0xAB8B,0x2A83,0xE982,0x2A73,0x2A73,0x0A73,0x6A83,0xA962,0x2A19,0xCF00,
-  0xCF00,0xAD00,0x4500,0xC538,0xEEA9,0x73EA,0xB2CA,0xD87C,0x1F3E,0x3A66,0xC8DE,0x40FF,
-  0xCCCC,0x7582,0xF199,0x08FA,0xC6E9,0x4951,0xCD00,0x0C09,0x4C19,0xE910,0x4208,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x0919,0x4B19,0x2C19,0x0B01,0x2931,0xA6C9,0xC6F9,0x6FB2,0x557A,0x4DB4,0x02FF,0xE6E6,
-  0x1A66,0x3F46,0x7684,0x92DA,0x53E2,0xED91,0xA428,0x4600,0xED08,0xAF00,0xEB10,0x8762,
-  0x8762,0x8449,0x6772,0x4DBC,0xB0D4,0x8FD4,0x8FCC,0x6ECC,0x4ECC,0x4ECC,0x4ECC,0x6FD4,
-  0xF1DC,0x52E5,0xB0C4,0xCBBB,0x6AB3,0x4B83,0x2A73,0x0973,0x4B7B,0x497B,0x084A,0x6C00,
-  0xCF00,0xF000,0xAD00,0x4800,0xE730,0x0EAA,0x53EA,0xD2CA,0xF874,0x5F46,0x3876,0xE8D6,
-  0x03FF,0xCFAB,0x357A,0x2EBA,0xE6F9,0xA7C1,0xE918,0x0B01,0x2C11,0x2B11,0xC608,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,
-  0x4B19,0x6B21,0x0B09,0x0A09,0x6779,0xC6F9,0x2BD2,0x1482,0x9193,0x43EE,0x42F7,0x3586,
-  0x5F3E,0xF87C,0xB2D2,0x32EA,0x0DA2,0xA420,0x6700,0xEE08,0x2F11,0x8C00,0x6A21,0x2983,
-  0x475A,0xC559,0x2DC4,0x35FE,0x15FE,0x15FE,0x15FE,0xF4FD,0xD4FD,0xB4FD,0xD3FD,0xD4FD,
-  0xD4FD,0xF4FD,0xD4FD,0xF0EC,0xECD3,0xABAB,0x4A7B,0x4A7B,0x2A7B,0x087B,0x485A,0xCB08,
-  0xAE00,0xCE00,0xF008,0xCF00,0x6900,0xE630,0x4FB2,0x32EA,0x33C3,0x7A65,0x5F36,0x177E,
-  0xE1FE,0xC6E5,0x138B,0xF381,0x2ADA,0xC6F9,0x8869,0xEB08,0x0B09,0x6C19,0xE908,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0819,
-  0x4B19,0x4B21,0x0901,0x2939,0xA7C9,0xE7E9,0x309A,0x357A,0x69CD,0x21FF,0x0FAE,0x1F36,
-  0x9965,0x13BB,0x94F2,0x2EB2,0xC440,0x6700,0x0E09,0x0E09,0xEE08,0xCC00,0xCA31,0x6A83,
-  0x065A,0xC89A,0x11ED,0xF5FD,0x72ED,0x93F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x93F5,
-  0x93F5,0x72ED,0xD4F5,0x52ED,0x2DDC,0xCBCB,0x6A93,0x4A7B,0xE972,0x6762,0xE749,0x2A19,
-  0xCE00,0xEE00,0xED00,0xEF08,0xD000,0x6800,0xE440,0x70CA,0x73F2,0x93AB,0xDB55,0x1E46,
-  0xCCC5,0x21FF,0x8CBC,0xF579,0x2EAA,0xE6F1,0xC9D1,0xE928,0xCA00,0x4C19,0x2B11,0x8508,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4B19,
-  0x4B19,0x2A11,0xE908,0x4789,0xE6F9,0x0BC2,0x3482,0xF0A3,0xA1FE,0xE9D6,0xFD4D,0x1D46,
-  0x919B,0x72E2,0x90D2,0x6751,0x4600,0x0F09,0xEE08,0xED08,0xEE08,0xCC00,0x8929,0x0973,
-  0x0652,0x8BAB,0x72F5,0xD4F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,
-  0xB3F5,0x93F5,0xB3F5,0x93F5,0xCFE4,0xEBD3,0x8BBB,0x676A,0x274A,0x065A,0x8549,0x0811,
-  0xED00,0xEE00,0xEE00,0xED00,0xEF00,0xCF00,0x4500,0xC871,0x91DA,0x92DA,0x138C,0x3E46,
-  0xFA65,0x25E7,0x24F6,0x729B,0xF381,0x0AD2,0xC6F9,0x2769,0xC900,0xEB08,0x4B19,0x0911,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B21,
-  0x4B21,0x0A01,0x2939,0xA6C9,0xE7F1,0x309A,0x938A,0x08D6,0x23F7,0x538E,0x3F36,0x597D,
-  0xB3D2,0x73F2,0x8A61,0x8600,0xCD00,0x0E09,0xEE00,0xED08,0xEE08,0xCC00,0x8929,0xC872,
-  0xE651,0x8CBB,0x73FD,0xD4F5,0x93F5,0xB3F5,0xB3F5,0x93F5,0x93F5,0x93F5,0xB3F5,0xB3F5,
-  0x93F5,0xB3F5,0xB3F5,0xD4F5,0x11ED,0xEBD3,0x0CD4,0xA782,0xA551,0xC559,0x8549,0xE718,
-  0xED00,0xEE00,0xEE08,0xEE00,0xEE00,0xEE08,0xCE00,0xA500,0xCC89,0x73FA,0xF3C2,0x3A6D,
-  0x3F3E,0x8FA6,0x40FF,0x48D5,0x557A,0x509A,0xE7F9,0xA8C1,0xCB51,0x8B19,0x4C19,0x2B19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2A19,0x2A19,
-  0x2A11,0x2A01,0x6881,0xE6F1,0xEBC1,0x5482,0xB0AB,0xE1FE,0xCACE,0x1C56,0xBC55,0x53BB,
-  0x74EA,0xCDA1,0xE820,0xAA00,0x0E09,0xED08,0xED08,0xED08,0xEE00,0xCC00,0x6821,0x675A,
-  0x266A,0xEDBB,0xB3F5,0xD4FD,0x52ED,0x51F5,0x72F5,0x93F5,0xB4F5,0xB3F5,0x93F5,0xB4F5,
-  0x92F5,0x31F5,0x31E5,0x73E5,0x11DD,0xCBC3,0xCAD3,0x6AAB,0xE972,0xA76A,0xE559,0xC618,
-  0xCC00,0xEE00,0xEE08,0xEE00,0xEE00,0xEE00,0x0F09,0x8A00,0x0831,0x0EB2,0x94F2,0x94AB,
-  0x1E46,0x3A66,0x27DF,0x43F6,0x5293,0x3482,0x0AD2,0xA6F9,0x0BA3,0xAD32,0xEA10,0x6B21,
-  0xC610,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8508,0x6B21,0x6A21,
-  0x2A11,0x2A21,0x86B9,0x07FA,0x10A2,0x7482,0x69D5,0xE3F6,0x738E,0x1F3E,0xD884,0x32E2,
-  0x71E2,0x2849,0xA908,0x0E09,0x0D09,0xEE08,0xEE08,0xED08,0x0E09,0xCC00,0x2819,0x065A,
-  0x465A,0xECBB,0x51ED,0x93F5,0xD4F5,0x17DE,0xF6D5,0x93E5,0x51F5,0x93F5,0xB4F5,0x92F5,
-  0x72ED,0xF6D5,0x58CE,0x58CE,0x18C6,0xD6C5,0x33C5,0x4F9C,0xCD9B,0x2993,0x0662,0x2819,
-  0xAC00,0xEE00,0xEE08,0xEE00,0xEE00,0xEE08,0xED08,0xEF08,0x8700,0x8A59,0x73E2,0x92D2,
-  0x5A6D,0x1F3E,0xB0A6,0xE3FE,0xCCC4,0x157A,0x0FAA,0xC6F9,0x27BA,0xCA31,0xEA08,0x6B21,
-  0x2919,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0xA608,0x8B21,0x2B3A,
-  0x4D3A,0x6A51,0x85D1,0x09F2,0x138A,0x3193,0xC3F6,0xC8DE,0x7A5E,0x7D4D,0x74BB,0x73EA,
-  0xECA9,0xA810,0xAB00,0x2E11,0x0C09,0xED08,0xED08,0xED08,0x0E09,0xCD00,0xC908,0xE649,
-  0x265A,0x8BA3,0x53CD,0xF6CD,0x95BD,0x96A5,0xF7AD,0xD6C5,0x95CD,0x93E5,0x92FD,0x72ED,
-  0x75C5,0x54A5,0xD39C,0x318C,0x5084,0x13A5,0x39B6,0x9294,0x6BA3,0xE89A,0x2662,0x8741,
-  0xEC08,0xEE00,0x0E09,0xEE08,0xEE08,0xED08,0xED08,0x0F11,0xAB00,0xE920,0xCEA9,0x73EA,
-  0xD5AB,0xDE45,0x5966,0xE7DE,0x44E6,0xB382,0x328A,0xC8F1,0x86C9,0x2939,0x0A01,0x6B21,
-  0x4B19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0xE810,0x6B21,0x0B32,
-  0x8B42,0xC979,0xA5E1,0xECC9,0x547A,0x6CBC,0x21FF,0x6EB6,0x5D4E,0xD974,0x72EA,0x72D2,
-  0x4851,0xAA08,0xED00,0x0D11,0x0C09,0x0C09,0x0C09,0x0C09,0x0D09,0xCD00,0xAA00,0x6729,
-  0x2672,0xEE9B,0xB6AD,0x76AD,0x0F94,0x8C8B,0xAE8B,0x518C,0x3595,0x74BD,0x52E5,0x54C5,
-  0xB29C,0xCBA3,0x479A,0x6569,0x2251,0xC569,0xB29C,0x51B4,0x0AA3,0x878A,0x466A,0xA651,
-  0x0B09,0xEE00,0xEE08,0xEE00,0xEE08,0xED08,0xED08,0xED08,0x2D09,0x6A29,0xCA79,0x52E2,
-  0x92DA,0x9B65,0x1F3E,0x8DB6,0xE1FE,0xEFAB,0x3382,0xC9D1,0xE7E9,0x8A69,0x2A01,0x4B21,
-  0x4B19,0xC610,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,0x4B19,0xC808,
-  0xC610,0x86B9,0x07F2,0xD099,0xD48A,0xA9E5,0xE3F6,0x167E,0xFF3D,0x9794,0x71EA,0x0EAA,
-  0x0819,0xEC00,0x0E11,0x0C09,0x0C09,0x0C09,0x0C09,0x0C09,0x0C09,0x0D09,0xCB08,0xE620,
-  0x2782,0xB2A4,0xD39C,0xACB3,0x48BB,0xC89A,0x8879,0x4451,0xA762,0x7094,0x3595,0x528C,
-  0x49B3,0xEAD3,0x2BD4,0x69B3,0x288A,0x8871,0xCA82,0x2DB4,0x8CBB,0x6792,0x2662,0x4821,
-  0x8B00,0xCD00,0xCD00,0xED00,0x0E09,0x0D09,0xED08,0xAD00,0x6C21,0x6B3A,0x8C5A,0x2EC2,
-  0x52E2,0x1985,0xFF3D,0x529E,0xE2FE,0x2CD5,0x5482,0xEDB1,0xE6F9,0x8799,0x4911,0x4B19,
-  0x4B19,0x2919,0xE710,0x8408,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA408,0x4A21,0x4B19,0x0A11,
-  0x2841,0xA5D9,0x2AEA,0xF391,0x3193,0xA4F6,0xA8D6,0x5B56,0xBE45,0xF5B3,0x52EA,0xEF91,
-  0xCA08,0xEC00,0x0D11,0x0C09,0x0C09,0x0C09,0x0C09,0x0C09,0x0C09,0x0D09,0xCB08,0x0619,
-  0x266A,0x8B9B,0x6CA3,0x4AC4,0x2ADD,0xEBD3,0xABC3,0x8892,0xE569,0x2B83,0x50A4,0x6B9B,
-  0xC89A,0x6AC3,0xEBDC,0x0BDD,0x8AC3,0xA892,0xA88A,0xECB3,0x6BAB,0x878A,0xE659,0xA608,
-  0x8A00,0xEA08,0xAB29,0xAC21,0xEC08,0xCD00,0x0D09,0x0D09,0x2D11,0xCA00,0xE810,0x6D8A,
-  0x52E2,0xF3AB,0xBD45,0x786E,0xE5E6,0x26E6,0x938A,0x11A2,0x08FA,0x85C1,0x4929,0x2A11,
-  0x4A19,0x6B21,0x6B21,0x6B19,0x0811,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x6B21,0x4A19,0x2A11,
-  0x6861,0xA5E9,0x2BDA,0x1482,0xAEAB,0x01FF,0x6EB6,0x7E46,0xF864,0xD1CA,0xF4E2,0x1284,
-  0x2C09,0xEC08,0x2C11,0x0C11,0x0C11,0x0C11,0x0C11,0x0C11,0x0C11,0x0D11,0xCB00,0x8600,
-  0xC551,0x4AA3,0x099B,0x49A3,0x6BD4,0x4CDC,0x2BD4,0x2BD4,0xC89A,0x0A9B,0xD0DC,0x6ED4,
-  0xA892,0x688A,0x69B3,0x6BDC,0x4CDC,0x8AB3,0x49B3,0xCBC3,0x4BB3,0x8892,0x0662,0x6829,
-  0x6C42,0xD073,0x728C,0xAD4A,0x8800,0xAA00,0x8B00,0xAD00,0x0D09,0xCD00,0xAA00,0x4949,
-  0x52DA,0xD2DA,0x1C5D,0x7D4E,0xAACE,0xC2FE,0x90A3,0x5482,0x0AE2,0xC5D1,0x2841,0xA800,
-  0xE818,0xE910,0x2A11,0x6B21,0x6B19,0xE710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0xE810,0x6B21,0x2A11,0xEA08,
-  0x6869,0xC5F1,0x0CCA,0x547A,0x4CBC,0x01FF,0x3396,0x5F46,0x577C,0x71E2,0x91C2,0x6C4A,
-  0x2C09,0x0C09,0x2C11,0x0C11,0x0C11,0x0C11,0x2C11,0x0C09,0x0D09,0x2D11,0x6C19,0xA929,
-  0x4341,0x08AB,0x2DC4,0x2A9B,0x679A,0x8ABB,0x2BD4,0x8DEC,0xA79A,0xEA9A,0x93F5,0x31ED,
-  0xA89A,0x2782,0x478A,0xA89A,0x08AB,0x49BB,0xEBCB,0xCACB,0x4ABB,0x678A,0xE651,0xEC62,
-  0x1495,0x79CE,0x76A5,0x5284,0x738C,0xD173,0x0C32,0x0A11,0xCA08,0xAC08,0xAB00,0x2929,
-  0x51D2,0x52EA,0xF78C,0x7B56,0x50AE,0x02FF,0x0EB4,0x547A,0xEBD1,0x85E1,0xA979,0xEB7A,
-  0xCA82,0xA931,0x0911,0x4A19,0x6B21,0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x4B19,0x4A21,0x4A11,0x2911,
-  0x4891,0xC5F9,0xCEB1,0x957A,0x09D5,0x22F7,0xF875,0x3E3E,0x379C,0x72EA,0xEDA1,0x6710,
-  0x0B09,0x2C11,0x0C11,0x0C11,0x2C11,0x2C11,0x2C09,0x4C19,0x0B09,0x6900,0x6B21,0xAF6B,
-  0x0B6B,0x868A,0x6EDC,0xB0D4,0xC892,0x09A3,0xCAC3,0x49B3,0x0AA3,0x6FCC,0xF4FD,0x93F5,
-  0x6ECC,0xC89A,0xA892,0x6BAB,0xACB3,0xECCB,0x2CD4,0xCBC3,0xE992,0xC561,0xC651,0x107C,
-  0x59BE,0x59C6,0xB48C,0xF494,0x79CE,0x38BE,0x549D,0x327C,0x2F5B,0xCC29,0xC900,0x4A21,
-  0x50B2,0x52EA,0xD69C,0x5C4E,0x548E,0x22FF,0x4CB4,0x747A,0xCBC1,0xE6E1,0x2DC3,0x31ED,
-  0x10E5,0xE982,0x2721,0x0A11,0x6B21,0x0911,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4B19,0x8B21,0x2A19,0x2911,0x0942,
-  0x49CA,0xC6F1,0xCFA1,0x148B,0x48DD,0x04EF,0x196E,0xFD4D,0xF6AB,0x30EA,0x0D8A,0xE900,
-  0x2C11,0x2C11,0x0C11,0x2C11,0x2C11,0x0B09,0xCB00,0xAB29,0x0B32,0x4A19,0xEB31,0xB394,
-  0xB7A5,0xC962,0xACB3,0xB3FD,0xF0DC,0xECBB,0x49BB,0xE8A2,0x8FCC,0xF4FD,0xD4FD,0xD4FD,
-  0x52ED,0xABBB,0xCBC3,0x31ED,0xB4F5,0x32ED,0x2BD4,0xCBBB,0x6872,0x4349,0x896A,0xB48C,
-  0x54A5,0x349D,0xF494,0xF494,0xF494,0x75A5,0x9AC6,0xFBD6,0x38BE,0x317C,0xCA29,0xA808,
-  0x0F8A,0x32EA,0x779C,0xDF3D,0x1586,0x22FF,0xEBD4,0xB582,0x8EA1,0x68DA,0x6ED4,0x52E5,
-  0xF0E4,0xA782,0x0621,0x0A11,0x8B21,0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0819,0x6B19,0x6B21,0xE908,0x2921,0x2C8B,
-  0x4CD4,0xA9DA,0x2FA2,0x7293,0xE9D4,0x27DE,0x577E,0xDA65,0x75C3,0x12E2,0x0E72,0xE900,
-  0x2C11,0x2C11,0x2C11,0x2C11,0x0B09,0x2A11,0xAC29,0x6C42,0xF073,0x928C,0x517C,0xF394,
-  0xD7AD,0xF073,0xCDA3,0x51F5,0xF4FD,0x31ED,0x8ABB,0x6ED4,0xB0D4,0x8FD4,0xF1E4,0xAFDC,
-  0x69BB,0x0CCC,0x4DCC,0x4ECC,0x31E5,0x52F5,0x0CD4,0xABBB,0x4772,0xA451,0x6B7B,0xB28C,
-  0xAD7B,0x54A5,0xD7AD,0x559D,0x1495,0xD394,0x359D,0x79BE,0x9ACE,0xF8BD,0xD063,0x0919,
-  0x2F92,0x52E2,0xF5AB,0x3B65,0xB495,0x03F7,0xA9E5,0xD48A,0xCFA9,0x88D2,0x0CBC,0xCEDC,
-  0x69BB,0xC420,0xA700,0x8B21,0x6B21,0x0919,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2919,0x6B21,0x4B19,0x0811,0x0952,0x4EDC,
-  0x0CD4,0xEAD3,0x909A,0x91A2,0xE9E4,0xACBE,0xFA65,0x5A65,0x54C3,0x32E2,0xEE71,0xE900,
-  0x2B11,0x2C11,0x4C11,0x0B09,0x4A11,0x0E5B,0x349D,0xB38C,0xB38C,0x359D,0x149D,0xD394,
-  0xD394,0x148D,0x4FA4,0x10E5,0xB3F5,0x0CBC,0xECAB,0x6EBC,0x2DC4,0xABB3,0x6BAB,0x8BAB,
-  0xCBBB,0x4EC4,0xCCAB,0xACA3,0x4EC4,0x6ED4,0x4DCC,0xCCBB,0x4772,0xA549,0x685A,0xEB5A,
-  0xD394,0x76A5,0x1495,0x1495,0x359D,0x359D,0x96A5,0xBACE,0x5DE7,0x5DE7,0xD7B5,0xAF6B,
-  0x91A3,0x51D2,0x13C4,0xB89D,0xD2B5,0x03F7,0x45EE,0x7193,0xD0B2,0x0CD4,0x2DBC,0x8ABB,
-  0x056A,0xA508,0xE908,0x8C21,0x4A19,0xA508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE810,0x6B21,0x6B21,0xE808,0xE849,0x8EE4,
-  0xEDDB,0xEBDB,0xF0A2,0xF292,0xE9D4,0x67D6,0xF77D,0x5A65,0x35CB,0x30D2,0x0C5A,0xE900,
-  0x2B11,0x6C19,0xEC08,0x2A11,0x2E5B,0x55A5,0x75A5,0xB38C,0x3595,0xB6A5,0x75A5,0x559D,
-  0x1495,0x3495,0x5084,0xB0C4,0x92FD,0x4EC4,0x4EBC,0x2983,0x919C,0xB5D5,0x8FD4,0x4ED4,
-  0x95C5,0x13AD,0xCC93,0x6EBC,0xF1DC,0x8BAB,0x2DCC,0x8BBB,0xA892,0x686A,0x2C63,0xF39C,
-  0x59BE,0x359D,0xF49C,0xF7BD,0xD7B5,0x359D,0x349D,0xF7B5,0x59BE,0xD7B5,0x9384,0xED52,
-  0x2C72,0xAFCB,0x94DD,0x999D,0x958D,0x07D7,0xA5EE,0xADBB,0xF1CB,0x51ED,0xEDC3,0xE561,
-  0x8410,0xE810,0x6B21,0x6B21,0xE710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4A19,0x8C21,0xC808,0x2629,0xABB3,
-  0xADD3,0xCCE3,0x50AB,0xF0A3,0x49DD,0x89DD,0x167E,0x796D,0x75C3,0x6FC2,0x0A4A,0xEA00,
-  0x4B19,0xEA08,0x8800,0x2B3A,0xF394,0xD7AD,0x359D,0x1495,0x18BE,0xFBD6,0xBACE,0x18BE,
-  0x18BE,0x96A5,0xB28C,0x6FAC,0x11E5,0x32E5,0x8FCC,0xCCAB,0xB19C,0x96AD,0x54B5,0xF3A4,
-  0x55A5,0x70A4,0xD0CC,0x52E5,0x6ECC,0x8ABB,0x4DCC,0x29A3,0x09AB,0x2FAC,0xB7A5,0x5DE7,
-  0x3CDF,0x39C6,0xBACE,0xDBD6,0xD7B5,0x359D,0xF494,0x96A5,0x76A5,0x1495,0x359D,0x159D,
-  0x118C,0x11DD,0xD3E5,0xB985,0xB96D,0x6DD5,0xC9D4,0xECC3,0x13DD,0x31ED,0xE9A2,0x0521,
-  0xA700,0x4A19,0x8C21,0x0919,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8C21,0xE908,0xE710,0x8782,
-  0x0DDC,0xECE3,0x4FBB,0x4EBC,0x69E5,0x2CD5,0xB68D,0x596D,0x76BB,0x70D2,0x0C62,0xE900,
-  0x0A11,0x2C3A,0x8F6B,0xD494,0x96A5,0xD7AD,0x59BE,0xF7B5,0x59BE,0x5DE7,0x9EEF,0xBBD6,
-  0x9ACE,0xF8B5,0x75A5,0x4F9C,0xECB3,0x11E5,0xF0DC,0x11ED,0xF1D4,0xB1AC,0xB2A4,0xB2A4,
-  0x90B4,0x8FCC,0xB3FD,0x32E5,0xCCBB,0x0CD4,0xABAB,0xE99A,0x6AB3,0x12C5,0x9ABE,0x1CDF,
-  0x9ACE,0x5DE7,0xBEF7,0xDBCE,0x96A5,0x75A5,0x55A5,0x759D,0x1495,0x559D,0x18B6,0x59C6,
-  0xF6C5,0x52ED,0xF3C4,0x7975,0x7785,0x0DDC,0xACCB,0xF0DC,0x52ED,0xECCB,0xE661,0xC610,
-  0x4A19,0x6B21,0x4A19,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,0x8B21,0x2A11,0x0811,0x075A,
-  0xAEDC,0x6EEC,0xEFBA,0xCEBB,0x89E5,0x4BDD,0x95B5,0x787D,0x55BB,0x12EA,0x0F7A,0xC900,
-  0x2911,0x517C,0x79C6,0x59C6,0xB6AD,0x38BE,0x79C6,0xF7AD,0x96A5,0x79C6,0x7DE7,0xFBD6,
-  0xDBCE,0xF7B5,0xD7A5,0xF39C,0xCC93,0x0CB4,0xD0DC,0x73F5,0xB3FD,0x51F5,0xAFDC,0xAFDC,
-  0x11ED,0xF4FD,0xB3F5,0x6FD4,0x0DC4,0x2DC4,0xC88A,0x29B3,0xCBC3,0xD1B4,0xD7AD,0xF7AD,
-  0xF7B5,0x1CD7,0x5DE7,0x39BE,0x559D,0x75A5,0xB7AD,0x55A5,0x149D,0x559D,0x3495,0x9194,
-  0x32DD,0x10F5,0xD59C,0x1885,0xF1BC,0x0AD4,0x2DCC,0x93F5,0xAFE4,0x4682,0xE428,0xE810,
-  0x6B19,0x6B21,0xA610,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B21,0x4B19,0x0909,0x8731,
-  0xEDBB,0x70F5,0x11B3,0x0EAB,0xAAE5,0x4BD5,0xB6AD,0xB69D,0xF3C3,0x92DA,0xCE79,0xC808,
-  0x0A3A,0x5184,0x14A5,0x149D,0xD7AD,0x18B6,0x75A5,0x559D,0x76A5,0x59C6,0xFBD6,0x9AC6,
-  0x1CDF,0x38BE,0xD7AD,0xD8AD,0xF39C,0xAB8B,0x0DB4,0x72ED,0xB3F5,0xD4FD,0xB3F5,0x8FD4,
-  0x31E5,0xD4FD,0x31E5,0x2ECC,0xECB3,0x6B9B,0xC89A,0xCBCB,0xEBCB,0xB0B4,0xF8AD,0x18BE,
-  0x7AC6,0x7AC6,0xBAC6,0xF8B5,0x149D,0x75A5,0x96A5,0x96A5,0xD7B5,0x96A5,0x918C,0x2DB4,
-  0x52E5,0x31F5,0xF2B4,0x75BD,0x11E5,0xABC3,0x2DCC,0xCEEC,0x69AB,0xE328,0x4500,0x6B21,
-  0x6B21,0xE810,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2919,0x8C21,0x0911,0xC518,
-  0xC89A,0x92F5,0x11CC,0xB0C3,0x90ED,0x2BD5,0x13A5,0x5695,0xD5C5,0x51EC,0x8D89,0xC808,
-  0xE641,0x8FCC,0x8FCC,0x6F94,0xB7A5,0x18BE,0xD7AD,0x559D,0x39BE,0x3CE7,0x9ACE,0x96A5,
-  0xD7AD,0x9AC6,0xF7B5,0x55A5,0xB7AD,0x349D,0x8B9B,0x0DBC,0x52E5,0x15FE,0x72ED,0x4EBC,
-  0xCFD4,0x72F5,0x8FDC,0xCCB3,0x6B9B,0xC89A,0xAAC3,0x0BD4,0xECCB,0xF1B4,0x39B6,0x7ACE,
-  0x7ACE,0xF7B5,0xD7AD,0xD7AD,0xD7AD,0xD7AD,0x559D,0x76A5,0x39B6,0xF29C,0xAB9B,0x11E5,
-  0x57E6,0x93ED,0x52DD,0x73DD,0xAFDC,0x8ABB,0x2DCC,0xCCCB,0x4349,0x4400,0x6B19,0x6B19,
-  0x2919,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0811,0x8C21,0x2A11,0xA710,
-  0x478A,0x72F5,0x32E5,0x70CC,0x2FE5,0x2AD5,0x34AD,0xF8AD,0xD2B4,0x10DB,0xCFA1,0x0809,
-  0x6C7B,0x31ED,0x4EBC,0x9194,0xD7AD,0x359D,0xF7B5,0xFBD6,0x5DE7,0x5DE7,0x1CDF,0x18BE,
-  0xD38C,0xBACE,0x38BE,0x1495,0xD7AD,0xD7AD,0x2FA4,0xA88A,0x8BA3,0x31D5,0xD0D4,0x0CAC,
-  0x4EC4,0x8FCC,0x2DBC,0x2A9B,0xE99A,0x8AC3,0x0BD4,0x0CDC,0xEDBB,0xD3A4,0x59BE,0x7ACE,
-  0xF7B5,0x38B6,0x1CD7,0xBAD6,0xF8BD,0x18B6,0xD7AD,0xD7AD,0x1495,0x2E9C,0x8ED4,0xD4FD,
-  0xD5ED,0x72ED,0x31ED,0xF0E4,0x0DCC,0x49B3,0x2CDC,0xA551,0x4400,0x0911,0x8C21,0x4A19,
-  0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4A19,0xE908,
-  0xA749,0x31DD,0xB3FD,0x4ECC,0x8DD4,0x90ED,0xB4D5,0x58D6,0x95D5,0xD1DB,0x0E9A,0xAA49,
-  0x12CD,0x8EDC,0x2F9C,0x3595,0xD7AD,0xD7AD,0x18B6,0xFBD6,0xBEEF,0x3CDF,0x39BE,0x18BE,
-  0xB7AD,0x9ACE,0x59BE,0x759D,0x769D,0xB7AD,0x71A4,0x2AA3,0xC892,0x2A9B,0xACAB,0x4DAC,
-  0x4EB4,0x0DAC,0x4A9B,0xC89A,0x69BB,0x0CD4,0xEBCB,0xAACB,0x0EAC,0x96A5,0x99C6,0xF7B5,
-  0x18BE,0x59BE,0xBACE,0xDBCE,0x9AC6,0x38BE,0x96A5,0x3595,0x2F94,0x6EC4,0xD4FD,0xF4FD,
-  0x72F5,0x31ED,0x31E5,0x6DCC,0xAAC3,0xEBD3,0xE89A,0x8408,0xA800,0xAC29,0x4A19,0xA508,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B19,0x2A11,
-  0xE610,0x8CA3,0x72FD,0xF1E4,0xB0DC,0xD5F5,0xD4F5,0xF5F5,0x56F6,0x93E5,0xCFC3,0xAFB3,
-  0xB3F5,0xCBBB,0x2F94,0x3595,0x149D,0x18B6,0x38B6,0xF7AD,0xBACE,0xDBD6,0xB6AD,0xB6AD,
-  0x7AC6,0x39BE,0xF7B5,0x75A5,0x3595,0x559D,0x0E9C,0xCBC3,0x8AC3,0xC89A,0xC88A,0x6B9B,
-  0x8B9B,0x2A93,0xE89A,0x49B3,0xCBCB,0xCBCB,0xEBCB,0x49BB,0x70A4,0x5AB6,0x79C6,0xB6AD,
-  0xD7B5,0x96AD,0x76A5,0xF7AD,0x38BE,0xD7AD,0x559D,0x727C,0x2EAC,0x31ED,0x15FE,0x93F5,
-  0x52ED,0x11E5,0xAED4,0x2CD4,0xCBD3,0x29A3,0xE328,0xC708,0x4B19,0x8B21,0xE710,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x0811,0x8C21,0x4A19,
-  0xA608,0xA561,0xAFDC,0xF5FD,0x73ED,0xD4ED,0xB3F5,0x93F5,0x94ED,0xD4ED,0xD4FD,0xB3FD,
-  0x93F5,0xCCAB,0x508C,0xD48C,0x5284,0x1495,0x18B6,0x76A5,0x559D,0xF8B5,0x18BE,0xB6AD,
-  0xD7AD,0x96A5,0x359D,0xF494,0xF48C,0xB28C,0x6B9B,0x8ABB,0xEBCB,0xABC3,0x09A3,0x6792,
-  0xC89A,0xE8A2,0x49B3,0xCBC3,0xAAC3,0x8ABB,0xAAC3,0x6B9B,0x34AD,0x9AC6,0x18BE,0x76A5,
-  0x3495,0x559D,0x55A5,0x359D,0x349D,0x559D,0x96A5,0x718C,0x90C4,0x92FD,0x73ED,0x32E5,
-  0xD0DC,0x8FD4,0x2DD4,0x0CDC,0x29A3,0xE328,0x4400,0x2A19,0x8C21,0x0811,0x4200,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x8C21,0x4A19,
-  0x0A11,0x2531,0x8BAB,0x93FD,0xB4F5,0xB3F5,0xB3F5,0x93F5,0x93F5,0xB3ED,0xD5ED,0xD4FD,
-  0xF1E4,0xCB9B,0x908C,0xF494,0x317C,0x9384,0x96A5,0x559D,0x938C,0x1595,0xF7B5,0x96A5,
-  0x359D,0x359D,0xF394,0xD394,0xB384,0x107C,0x09A3,0x29B3,0x49B3,0x69BB,0x8ABB,0x49BB,
-  0x49BB,0x8ABB,0x8BB3,0x4AAB,0x49BB,0x69BB,0x09A3,0x718C,0x18B6,0x59C6,0x75A5,0xD394,
-  0x55A5,0x96A5,0x359D,0xF494,0x149D,0x1495,0x359D,0x509C,0xD0D4,0x51F5,0xF0E4,0xF0E4,
-  0x4DCC,0xAAC3,0x4EE4,0x4BAB,0xC228,0x2300,0x4A19,0x6B21,0x2919,0x6408,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6A21,0x4B19,
-  0x4B19,0xC710,0x6882,0x0FF5,0xF5F5,0xD4ED,0x93F5,0x93F5,0x93F5,0x93F5,0xD4F5,0x52ED,
-  0xABC3,0xAC93,0x349D,0x96A5,0xD38C,0x3184,0x317C,0x9384,0x938C,0xD394,0x75A5,0x75A5,
-  0xB38C,0xD38C,0xF394,0xB38C,0x7284,0xAD83,0x09A3,0x08AB,0x09A3,0x09AB,0x09AB,0x09AB,
-  0x09AB,0x09AB,0x09A3,0x09AB,0x08A3,0xE992,0xAF73,0x769D,0xF7B5,0xB6AD,0x96A5,0x349D,
-  0x1495,0xF494,0xB38C,0x9384,0x7284,0x1174,0xD48C,0xCD93,0xECC3,0xB0DC,0xAFD4,0x4DCC,
-  0xCBC3,0x2BD4,0xABC3,0x6551,0x2300,0x4A19,0x6B19,0x6B19,0x8508,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0919,0x6B21,
-  0x6B21,0xC900,0x8759,0xECCB,0x93F5,0xD4F5,0xB3F5,0xB3F5,0xD4F5,0xF4FD,0x31ED,0xCBCB,
-  0x8AAB,0x508C,0x1595,0x75A5,0x359D,0xD38C,0xF073,0xAF6B,0xF073,0x7284,0xB38C,0x9284,
-  0xD38C,0x1495,0x349D,0xB384,0xAF73,0x4A7B,0xE992,0xE99A,0xE99A,0xE99A,0xE992,0xE99A,
-  0xE89A,0xE8A2,0xE99A,0xE99A,0xC98A,0x0D63,0xB384,0x76A5,0x55A5,0x559D,0x359D,0x938C,
-  0x317C,0x6F63,0x2E63,0x8F6B,0xF073,0xF073,0x317C,0xCC93,0xEBCB,0x2DDC,0x0CCC,0x0CD4,
-  0xEBD3,0xEBCB,0xE761,0x6508,0xE810,0x8B21,0x4B19,0xC610,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x6B21,
-  0x6A21,0xE908,0x6639,0x08A3,0xAFE4,0x72ED,0x72ED,0x73ED,0x32ED,0x8FE4,0x2DCC,0x90B4,
-  0xB5BD,0xD394,0x527C,0x7284,0xB38C,0xB38C,0x317C,0xB073,0x8F6B,0x8F6B,0x6F6B,0x4E63,
-  0xF073,0x5184,0x928C,0x317C,0x4E63,0xEA6A,0x877A,0x877A,0x8782,0x8782,0x877A,0x877A,
-  0x8782,0x8782,0x8782,0x667A,0xA96A,0xB06B,0xB38C,0x7284,0x107C,0xD073,0x8F63,0x6E63,
-  0x2E63,0xCC52,0xED5A,0x6F6B,0xD06B,0xD06B,0x527C,0x14A5,0x0DB4,0x49C3,0xEBD3,0xEBDB,
-  0x6AC3,0x70AC,0x8E6B,0x8A21,0x0A11,0x6B21,0x2A19,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4B19,
-  0x6A21,0x2A11,0x2721,0x4772,0xCBCB,0x8EDC,0x8FDC,0x8EDC,0x0CCC,0x0DBC,0x12B5,0x38B6,
-  0x7AC6,0x117C,0x2E5B,0xAF6B,0xAF73,0xF07B,0x117C,0xD073,0x8F6B,0x6E63,0x4E63,0x2E5B,
-  0x2E63,0x0D5B,0x4E63,0x6E63,0x0D5B,0x8B52,0x266A,0x256A,0x466A,0x266A,0x266A,0x466A,
-  0x466A,0x466A,0x2662,0xE749,0x694A,0x6E6B,0x8F6B,0x0D5B,0xAC52,0x8B4A,0x8C4A,0xCC52,
-  0xED52,0x0D5B,0x2E5B,0x4E63,0x2D5B,0x0D5B,0xF173,0x9AC6,0xB6C5,0x0DB4,0x0CC4,0xECBB,
-  0xEEA3,0xB6AD,0xD48C,0xEA39,0xC908,0x6B21,0x2A19,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0919,
-  0x6B19,0x6B21,0xC808,0x4639,0xE8A2,0xCBD3,0xCAD3,0xABC3,0xECAB,0x33A5,0x39B6,0xF7B5,
-  0x75A5,0x2E5B,0x6B42,0xED5A,0xED5A,0xAC52,0xAC4A,0xED52,0x2E5B,0xED52,0xCD52,0xED52,
-  0xAC4A,0x0A3A,0x0A3A,0x0A3A,0x0A3A,0x4B42,0xC749,0x8641,0x8641,0xC649,0xE749,0x6541,
-  0x6639,0xA649,0xC839,0xCA31,0x2B3A,0x4A42,0xA929,0x8929,0xEA31,0x6B42,0x8B4A,0xAC4A,
-  0x6C42,0x2B3A,0x2A3A,0x4A42,0x4B42,0x0A3A,0xCD52,0x9ACE,0xBFE7,0x17C6,0xCFB4,0x92A4,
-  0x559D,0x18B6,0xD073,0x0819,0xE910,0x6B21,0x4A19,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,
-  0x6B19,0x8B21,0xEA10,0xE618,0x4672,0xEBCB,0x8ABB,0xEEA3,0x149D,0x96A5,0x149D,0x1495,
-  0xB6A5,0x317C,0x2A3A,0xCA31,0x6B42,0x0A3A,0xEA39,0x2B3A,0x0B3A,0xEA31,0x0A3A,0x2B3A,
-  0x2B3A,0x0A3A,0xEA31,0xA929,0x8929,0xC931,0x4921,0x8929,0xA931,0xA931,0x6821,0x0721,
-  0x4919,0x4921,0x8929,0xC931,0xC931,0x8929,0x4921,0x6929,0xCA31,0x0A3A,0xEA39,0xEA31,
-  0xA929,0x8929,0x8929,0xC931,0xC931,0x8929,0x0A3A,0xB6A5,0x5CDF,0x59C6,0x76A5,0x96A5,
-  0x559D,0x96A5,0x6F63,0x2819,0x0911,0x6B21,0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,
-  0x2A19,0x6B21,0x2A19,0x2911,0x6A4A,0x2F94,0x728C,0xB38C,0xD38C,0xB38C,0x938C,0xF394,
-  0x18B6,0x55A5,0x4C42,0xA708,0xEA39,0x5284,0xF8BD,0x0E5B,0x2819,0xD173,0xD7B5,0x7284,
-  0x1495,0x149D,0x327C,0x359D,0xF49C,0x2821,0xEA31,0x359D,0xB7AD,0x2B3A,0x2819,0x1495,
-  0xD7B5,0xEE5A,0x2819,0x4921,0x4821,0xEA31,0x55A5,0x359D,0x2B3A,0x2819,0x8929,0x0719,
-  0x2E5B,0x96AD,0xB394,0x2B3A,0x0819,0x6829,0xA929,0x559D,0x79C6,0x1595,0x9384,0xD48C,
-  0xB38C,0x1495,0x8F6B,0x6921,0x0911,0x6B21,0x2919,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0811,0x6B19,0x6B21,0xE810,0x6821,0xF073,0x3595,0x9384,0x317C,0x7284,0xB38C,0x359D,
-  0xF7B5,0x559D,0xCD52,0x8608,0x4921,0x55A5,0xFFFF,0x4F63,0x2B3A,0xDBD6,0x3DE7,0xAF6B,
-  0x7DEF,0x9ACE,0x5284,0xBAD6,0xBBD6,0x6821,0x7284,0xDFFF,0x35AD,0x0619,0x6F63,0xFFFF,
-  0xFFFF,0xB394,0x6921,0xC808,0x0819,0x6C42,0x9EF7,0xDAD6,0x2C3A,0xA708,0x2819,0xAA29,
-  0xDBDE,0xFFFF,0xDAD6,0x0E53,0x6700,0x2919,0xCA31,0x359D,0xD6AD,0x5184,0x1074,0x517C,
-  0x317C,0x938C,0x2E63,0x6921,0x0A11,0x6B21,0x2A19,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xC610,0x4A19,0x6B21,0x2919,0xC710,0xA829,0x5184,0xD394,0x7284,0x938C,0x1495,0xF494,
-  0x9284,0x517C,0x8F6B,0x6921,0xA708,0x7284,0xFFFF,0xF17B,0xD494,0xFFFF,0x149D,0xE939,
-  0xFFFF,0xF8B5,0x0D5B,0x39C6,0x3CE7,0xEC52,0x1CDF,0x7DEF,0xC931,0xA829,0xBBCE,0xBAD6,
-  0xBEEF,0xF7B5,0x2B3A,0x4700,0x2919,0x6E63,0xFFFF,0x96AD,0xEB31,0x4700,0x6A21,0xD494,
-  0x3DE7,0xFCE6,0x7DE7,0x327C,0x4600,0x6A21,0x8C4A,0x7284,0xF394,0x117C,0x8F6B,0xCF6B,
-  0xAF6B,0x317C,0xAC4A,0x2819,0x2A19,0x6B21,0x4A19,0x4300,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x4208,0x4A19,0x6B21,0x6B21,0x0911,0x6500,0x6B4A,0x317C,0x7284,0x117C,0x117C,0x8F6B,
-  0xED52,0x8F6B,0xF073,0xEB31,0x8700,0x6E63,0xBEF7,0x18BE,0x5DEF,0xBAD6,0x8729,0x4A42,
-  0xBEF7,0xB394,0xC931,0x35A5,0x9EEF,0xB7AD,0xFFFF,0xD073,0x2400,0xB48C,0xFFFF,0x96AD,
-  0x3CDF,0x79CE,0x8D4A,0x2600,0x4919,0x3284,0xBFF7,0x8F6B,0x4500,0x0500,0xAD4A,0x7DEF,
-  0x9ACE,0x18BE,0x9EF7,0xB494,0x6600,0x0C32,0x6E6B,0x4E63,0x6E63,0x6E63,0x0D5B,0x0D5B,
-  0xED52,0x4E63,0x6B42,0x6921,0x2A19,0x6B21,0x4A19,0x2100,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xA610,0x4A19,0x6B21,0x4B19,0x2919,0x0721,0x8B4A,0x0D5B,0xCC52,0x6B4A,0x6B42,
-  0x8B4A,0x2E63,0x6E63,0xEA31,0xA808,0xEE52,0xDFFF,0xFFFF,0xFFFF,0xD073,0x2300,0xF494,
-  0xFFFF,0xF17B,0xE610,0xB494,0xFFFF,0xFFFF,0xDBD6,0xE618,0xCE52,0xBFF7,0xDEF7,0xDBD6,
-  0xFFFF,0x7DEF,0x5063,0x0500,0x8B29,0x98B5,0xFFFF,0x159D,0x0B32,0x6C42,0xB7B5,0xFFFF,
-  0x5CE7,0x3CDF,0xFFFF,0x77A5,0xC810,0x2B3A,0x6E63,0xCC52,0x2A42,0x4B42,0x6B42,0x4B42,
-  0x2B3A,0x4B42,0x4B42,0x8A29,0x2A19,0x6B21,0x4A19,0x6308,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0x0811,0x6B21,0x4A19,0x4A19,0xE810,0x8929,0xE931,0xCA31,0x2A3A,0x6B42,
-  0x8B4A,0x8B4A,0x8B4A,0xEB31,0xC808,0x0C3A,0x5DEF,0xBEF7,0xD7B5,0x6821,0x0719,0x58BE,
-  0xDFFF,0x3063,0x4600,0x337C,0xDFFF,0x5DEF,0x0D5B,0x8929,0xF8BD,0xBEF7,0xF7B5,0x96B5,
-  0x7DEF,0xDFFF,0x337C,0x0600,0x0C32,0xBACE,0xDEFF,0xFFFF,0xFCDE,0xBBD6,0xDFF7,0x3CE7,
-  0x55A5,0x59C6,0xBEF7,0xD8BD,0x8829,0x6929,0x6B42,0x8C4A,0x0A3A,0xC931,0xCA31,0xCA31,
-  0xCA31,0x0A3A,0xC931,0x6921,0x2A19,0x4A19,0x4B19,0x2919,0x6308,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xA408,0x4A19,0x6B19,0x4A19,0x6B21,0x4A19,0x2919,0x8929,0xE931,0xEA31,0x0A3A,
-  0xEA39,0xEA31,0x0A3A,0xCB31,0x4A19,0x6A21,0x2C63,0x8D73,0xE941,0xA610,0x8A21,0x2D63,
-  0xCF73,0xEB31,0xC808,0x4C3A,0xEF7B,0x0C63,0xE610,0x0B3A,0x107C,0x0D63,0xA510,0x6208,
-  0xCC52,0x0F84,0x6C4A,0xE908,0xCB29,0x4C6B,0xCF7B,0xEF83,0xAF73,0xF07B,0xCF7B,0x0942,
-  0x4308,0x2621,0x6D73,0x6E6B,0x6A21,0x4919,0xEA31,0xEA31,0xA929,0xA929,0xA929,0xC931,
-  0xA929,0xA931,0x8921,0x4A19,0x4A19,0x4A19,0x4A19,0x8C21,0xC610,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0811,0x6B19,0x6A19,0x4A19,0xC808,0x8800,0x0500,0x2500,0x0819,0x2919,0xA608,
-  0xC710,0x4919,0xC710,0x6600,0x8800,0x6600,0x0000,0x0100,0x8608,0xA808,0x4600,0x0200,
-  0x0100,0x8708,0x6B19,0xE710,0x0000,0x0100,0xC808,0x2911,0x2300,0x0200,0x6700,0xE810,
-  0xA608,0x6408,0xE710,0x2A11,0x4600,0x0300,0x8410,0x4308,0x0100,0x0100,0x0000,0x0200,
-  0xA708,0xE810,0x4308,0x0200,0x8700,0x6A21,0x4919,0xA708,0xA708,0x2819,0xE710,0x8608,
-  0x0811,0x4921,0xC708,0x6700,0xE910,0x6A21,0x4A19,0x6B21,0xA610,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2919,0x8C21,0x0911,0x8A21,0x6F63,0x127C,0x7384,0x7384,0x8D42,0xEC31,0x327C,
-  0x2E5B,0x4919,0x2F5B,0x948C,0xD173,0x127C,0x317C,0x6B4A,0x0711,0x6D42,0x738C,0x938C,
-  0x8F73,0xEA31,0xC808,0x4921,0xED5A,0x8F6B,0x0B32,0xE808,0x8C4A,0x8F6B,0x2D3A,0x4B19,
-  0x0A11,0xC808,0xC808,0x6D42,0x5284,0x2E5B,0x6600,0xE610,0x0D5B,0x5284,0x5284,0x4F63,
-  0xAB29,0xC808,0xEA31,0xF073,0x706B,0x6A21,0xCA29,0xD173,0x4F63,0xAA29,0x8D4A,0x127C,
-  0x4B42,0xC808,0xCE52,0x327C,0x6D42,0x0911,0x4A19,0x6B19,0x8508,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x4200,0x2919,0xAC21,0xA808,0x2C3A,0xFBD6,0xBEF7,0x9DEF,0xFAD6,0xB06B,0x7063,0xDEF7,
-  0x35A5,0xCA31,0x77AD,0xFFFF,0x7DEF,0xFFFF,0xFFFF,0x159D,0xF17B,0x39C6,0xFFFF,0xFFFF,
-  0xFFFF,0xD7BD,0x4821,0xCB31,0x1DDF,0xBEF7,0x3184,0xEA31,0x19BE,0x9DEF,0xED52,0xA808,
-  0x8B21,0xCC29,0xE908,0xF27B,0xFFFF,0x59BE,0xEB31,0xB494,0xFFFF,0xFFFF,0xFFFF,0x9DF7,
-  0x938C,0x8700,0xF273,0xFFFF,0xB7B5,0x0400,0xCD4A,0x9DEF,0x56A5,0x6B42,0x35A5,0xDEF7,
-  0x35A5,0x6921,0x36A5,0xDEF7,0xB06B,0xA808,0x4A19,0x6B21,0x6308,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8408,0x4A19,0x8B21,0xA700,0xCE52,0xFFFF,0x9EEF,0xF8BD,0x307C,0xAC4A,0xB38C,0xFFFF,
-  0x938C,0xA929,0x4E63,0x9AD6,0xFFFF,0x7DEF,0xB294,0x117C,0x3DE7,0xFFFF,0x34A5,0xEF83,
-  0x1CE7,0xFFFF,0xB16B,0x8C42,0x7DEF,0xFFFF,0x59C6,0xAF6B,0xBAD6,0xFCDE,0x2B3A,0xC808,
-  0x6A21,0x4A19,0xE810,0xF59C,0xDFFF,0x1495,0xF073,0x7EF7,0x3DEF,0x5084,0x9194,0xDFF7,
-  0xFFFF,0x0B32,0x327C,0xDFFF,0xF8BD,0x8829,0xD494,0xFFFF,0x5284,0x6B42,0x79CE,0xFFFF,
-  0x5DE7,0x6F63,0x39C6,0x7DEF,0xEE52,0xA808,0x6B19,0x4A19,0x4308,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8508,0x6B21,0x4B19,0xE710,0xB073,0xFFFF,0x3CE7,0x38BE,0xEC5A,0x0A3A,0xF8B5,0xDFFF,
-  0x4F63,0x8508,0x0000,0xB073,0xFFFF,0x35A5,0x0000,0xF07B,0xFFFF,0xB7B5,0x0200,0x0000,
-  0x149D,0xFFFF,0xD494,0xF173,0xBEF7,0xFFFF,0xBEEF,0x18BE,0x9EF7,0xF8BD,0x2819,0x0911,
-  0x6B19,0xE908,0x8921,0xD7B5,0x7DEF,0x117C,0x39BE,0xFFFF,0xB073,0x0000,0x2521,0xDBD6,
-  0xFFFF,0x8F6B,0x159D,0xFFFF,0xBEF7,0x7DE7,0x9EEF,0xFFFF,0x6F6B,0xAD4A,0x7DEF,0xFFFF,
-  0xDFFF,0xF7B5,0x7DEF,0x7ACE,0xEA31,0xC808,0x6B19,0x2A19,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xC610,0x8B21,0x0A11,0x2819,0x5284,0xFFFF,0x1CDF,0xFBDE,0x9073,0xCC4A,0xDBD6,0x9EF7,
-  0x0A3A,0x0600,0xC708,0x159D,0xFFFF,0x9284,0x6500,0x56A5,0xFFFF,0x15A5,0x0300,0x8600,
-  0xB7B5,0xFFFF,0x5284,0x327C,0xFFFF,0x9ACE,0x7DE7,0xBEF7,0xFFFF,0xF594,0xE810,0x4A19,
-  0x0911,0x0600,0xCA29,0x99CE,0x1CE7,0xAF6B,0xBBD6,0xFFFF,0x6F63,0x0100,0x0B3A,0x5DE7,
-  0xFFFF,0x8F6B,0x97AD,0xFFFF,0xBACE,0x79CE,0xBFF7,0xFFFF,0xCD52,0x2F63,0xFFFF,0xFBDE,
-  0x3CDF,0x9EF7,0xFFFF,0x97AD,0x2919,0x0911,0x6B21,0x0811,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xE810,0x8C21,0xC908,0xAB29,0x77AD,0xFFFF,0xFBD6,0x99CE,0x8F6B,0xF173,0xBEF7,0xDFFF,
-  0x76AD,0xF27B,0x0E53,0xD7B5,0xFFFF,0x8F6B,0x4500,0x9384,0xFFFF,0x1CE7,0x938C,0x369D,
-  0xDFFF,0xFBD6,0xED52,0xD494,0xBEF7,0xD073,0xD7B5,0xBFF7,0xFFFF,0xB48C,0x6600,0x4A19,
-  0x916B,0xB594,0x96AD,0xDFFF,0xDCDE,0xCA31,0x18B6,0xFFFF,0x39C6,0x3184,0x39C6,0xFFFF,
-  0x76AD,0xCC4A,0x5ACE,0x5DEF,0x6A4A,0x6629,0x9EF7,0xFFFF,0x6C42,0xF17B,0xFFFF,0xD48C,
-  0xD494,0x5DEF,0xFFFF,0x1595,0xA708,0x4A19,0x6B21,0xC710,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0911,0xAC21,0xA808,0x2C3A,0xF8BD,0x9EF7,0x3DE7,0x7EEF,0x5284,0x3184,0x7DEF,0x9EEF,
-  0xDFFF,0xF7B5,0xCF73,0xF7B5,0x1CE7,0x6C42,0xA708,0x8829,0x35A5,0xFFFF,0xFFFF,0xFFFF,
-  0x99DE,0x8A52,0xC829,0xF8BD,0xDBD6,0x0A3A,0x0E5B,0xDBD6,0x5DE7,0x906B,0x4700,0x4A19,
-  0x327C,0x9DEF,0xFFFF,0x7DEF,0x3184,0x6600,0xCC52,0x39C6,0xFFFF,0xFFFF,0xFEFF,0x94B5,
-  0x6721,0xCC4A,0x3CE7,0x19BE,0xE610,0x4821,0x5DE7,0x59C6,0x4A42,0xB394,0x7DEF,0x0D53,
-  0x2B42,0x7ACE,0xBEF7,0xF173,0x8700,0x6B21,0x6B21,0xA510,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,
-  0x2A19,0x6B21,0x0A11,0xAA29,0xEC5A,0x4D6B,0x6D6B,0xEF7B,0xAC4A,0x2A3A,0x2C63,0x2D63,
-  0xAE73,0xAC4A,0x093A,0xEC5A,0x0C5B,0x6921,0x4A19,0x6608,0x6729,0x8E6B,0x928C,0xF07B,
-  0x284A,0x4300,0x4819,0x2D63,0xEC5A,0x4821,0x2819,0xEC5A,0x2C63,0xAA29,0xE910,0x2A19,
-  0xA829,0x8E6B,0x928C,0x2C63,0x2621,0xC808,0xA610,0x093A,0xEF7B,0xB294,0x8D6B,0x6531,
-  0x4500,0xEA31,0x8D6B,0x8B4A,0x4A19,0x2C3A,0x4D6B,0x6A4A,0x8929,0x8B4A,0x2C63,0x8929,
-  0x0719,0xCC5A,0x6D6B,0xCA31,0xE910,0x6A21,0x6B19,0x8408,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
-  0x6B19,0x4B19,0x6B21,0x0911,0x2300,0x0100,0x0100,0x0000,0x6500,0x8608,0x0100,0x0100,
-  0x0100,0x0400,0xA608,0x2300,0x0200,0x0911,0x6B21,0x6B19,0x8600,0x0100,0x0100,0x0100,
-  0x2400,0x4B19,0x4A19,0x0300,0x0200,0x0911,0xE810,0x0200,0x0200,0xE810,0x8B21,0x4B19,
-  0x6600,0x0200,0x0000,0x0200,0xC708,0x8B21,0x4A19,0x4400,0x0100,0x0100,0x0100,0x6500,
-  0x8C21,0xE810,0x0100,0x4400,0x2A19,0xE810,0x0100,0x2300,0xE810,0x6500,0x0100,0xE810,
-  0x2A19,0x2300,0x0100,0xA708,0x6B21,0x4B19,0x6B19,0x6408,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,
-  0x4A19,0x6B21,0x4A19,0x6B21,0x8C21,0xAC21,0x8C21,0xAC21,0x8C21,0x8B21,0x8C21,0xAC21,
-  0x8C21,0x8C21,0x8B21,0x8C21,0x8C21,0x6B21,0x4B19,0x6B21,0x8C21,0x8C21,0x6B21,0x8C21,
-  0x8C21,0x6B21,0x6B21,0x8B21,0x8C21,0x6B21,0x6B21,0x8C21,0x8C21,0x8B21,0x4B19,0x6B19,
-  0x8C21,0x8C21,0x6B21,0x8C21,0x8B21,0x6B19,0x8B21,0xAC21,0x6B21,0x6B21,0x8C21,0x8C21,
-  0x6B21,0x6B21,0x8C21,0x8C21,0x6B21,0x6B21,0xAC21,0x8C21,0x6B21,0x8C21,0xAC21,0x6B21,
-  0x6B21,0x8C21,0xAC21,0x6B21,0x6B19,0x6B21,0x2A19,0x4200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8508,0x0819,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,
-  0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,
-  0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,
-  0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,
-  0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,
-  0x2919,0x2919,0x2919,0x2919,0x2919,0x2919,0xC610,0x2100,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,
-  0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,
-  0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,
-  0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,
-  0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,
-  0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// 16 colors (4-bit indices), byte-swapped RGB565
+static const uint16_t spaceman_palette[16] PROGMEM = {
+  0x0000,0x8508,0xEC00,0x6821,0xAB29,0xE769,0x107A,0x0BD2,0x0B73,0xEF83,0xCCBB,0xA9DD,0x576D,0x55A5,0x94DD,0x3CE7,
 };
 
-const uint16_t spaceman_frame_1[14400] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0x2200,0x2200,0x2200,0x2300,0x2300,0x2300,0x2300,
-  0x2200,0x2200,0x2200,0x2100,0x0100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x2100,0x2300,0x4500,0x6700,0xAA00,0xCC00,0xAD00,0xAE00,0xCE00,0xCE00,0xCE00,0xCE00,
-  0xAE00,0xAD00,0xAC00,0xAB00,0x8900,0x6800,0x4400,0x2200,0x0100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x6500,0xAA00,
-  0xAC00,0xCE00,0xCF00,0xD000,0xD000,0xF000,0xD000,0xD000,0xD000,0xCF00,0xCF00,0xCF00,
-  0xD000,0xD000,0xF000,0xF000,0xD000,0xD000,0xCF00,0xCE00,0xAC00,0x8A00,0x8600,0x2200,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x6500,0x8900,0x8C00,0xCE00,0xCF00,
-  0xD000,0xCF00,0xD000,0xD000,0xB000,0xB000,0xAF00,0xAF00,0x8F00,0x8F00,0x8F00,0x8F00,
-  0x9000,0xAF00,0xB000,0xB000,0xB000,0xB000,0xD000,0xF008,0xD000,0xD000,0xCF00,0xAD00,
-  0x8A00,0x8700,0x4300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0x6600,0xAA00,0xCD00,0xEF00,0xEF00,0xF000,0xB000,
-  0xB000,0xAF00,0x8E00,0xAE00,0xED00,0xEB00,0x0B11,0x0B21,0x2B39,0x4A41,0x2A41,0x2A41,
-  0x2A41,0x2B31,0x0B19,0xEB08,0xEB00,0xED00,0xAE00,0x8F00,0xB000,0xB000,0xD000,0xF100,
-  0xF000,0xCF00,0xAC00,0x8900,0x4400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0100,0x4400,0xA900,0xEE00,0x0F09,0xF008,0xCF00,0xCE00,0xCE00,0xCE00,
-  0xED08,0x0C21,0x0C39,0x4B51,0x6871,0x6689,0x86A1,0xA5B1,0xC5C9,0xE5D1,0xE5C9,0xE5C9,
-  0xC5C9,0xA5C1,0x86A9,0x8699,0x6681,0x8871,0x4A61,0x0C41,0xEC18,0xCD00,0xCE00,0xAE00,
-  0xB000,0xD000,0xF100,0xF000,0xCD00,0x6800,0x4400,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x4200,0x8800,0xED00,0x0F09,0xEE00,0xCE00,0xCE00,0xAE00,0xAD00,0xEC18,0x4A41,
-  0x6779,0xA5A9,0xE7D1,0xE7E9,0xE6F9,0xE7F9,0xE7F9,0xC8F1,0xE9E9,0xE9E1,0xC9E1,0xC9E1,
-  0xE9E1,0xE8F1,0xC8F1,0xE7F9,0xE7F9,0xE7F9,0xE6F9,0xE7D9,0xA7A1,0x6861,0x2B31,0xEC18,
-  0xCD00,0xAE00,0xAF00,0xD000,0xD100,0xF100,0xCE00,0x8700,0x2200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x6500,0x0B09,0x0E09,0xEE08,0xED00,0xEE00,0xAE00,0xAE00,0x0A21,0x6759,0xC6A9,0xC6F1,
-  0xC6F9,0xC7F1,0xE9E9,0xEAD9,0xEBC1,0x2EAA,0x1092,0x5192,0x538A,0x5382,0x5382,0x5382,
-  0x5382,0x5292,0x3192,0x0FA2,0x2EB2,0x2EB2,0xEAC1,0xC8E9,0xC6F9,0xC6F9,0xC7E1,0xC8A9,
-  0x4759,0xCC18,0xAE00,0xAE00,0xCF00,0xCF00,0xD000,0xD000,0xAC00,0x4500,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xA808,
-  0xED08,0x0D09,0x0D09,0xED08,0xAD00,0xAD00,0x0931,0xA991,0xC7E1,0xC5F9,0xE6F1,0x08DA,
-  0x4CB2,0x509A,0x338A,0x1482,0x1582,0x357A,0x9382,0x529B,0x729B,0x919B,0x2FA4,0xF09B,
-  0x729B,0x729B,0xF28A,0x5482,0x157A,0x157A,0x1482,0x3292,0x4FA2,0x2AC2,0xE7E1,0xE6F9,
-  0xC5F1,0xC9C1,0x8969,0xEA10,0x8E00,0xAF00,0xCF00,0xCF00,0xD000,0xCF00,0x6900,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0A11,0xEC08,
-  0x0D09,0x0D11,0xEE08,0xCC00,0x2A21,0x8A81,0xA6D9,0xC5F9,0x28F2,0x4CCA,0x2FAA,0xF389,
-  0xF571,0xB482,0x7393,0xAEB4,0xA9D5,0xA8D5,0x44EE,0x82F6,0x82FE,0x82FE,0xA2FE,0xA2FE,
-  0x83FE,0x82FE,0x62F6,0x05E6,0xA8D5,0x69CD,0x11A4,0x3493,0x557A,0xD579,0xF291,0x4DBA,
-  0x4BDA,0xE6F1,0xA4F1,0xA8C1,0x8A69,0xEA08,0x8F00,0xAF00,0xCF00,0xD000,0xD000,0xAC00,
-  0x2300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x0A11,0x4C11,0x2C11,
-  0x0D11,0xCC00,0xEB08,0x6961,0xA6C1,0xC6F1,0x29F2,0x2CCA,0x119A,0xF479,0x557A,0x9393,
-  0xCCBC,0xC6E5,0x23F6,0xE1FE,0x42FF,0xE5EE,0xA9DE,0xABCE,0xCBC6,0xABC6,0xABC6,0xABC6,
-  0xCBC6,0xCBC6,0xAAD6,0xA8E6,0x04F7,0x41FF,0x82FE,0x04F6,0x48D5,0x6EB4,0x539B,0x1572,
-  0xF481,0xEEA1,0x2ADA,0x28FA,0xC6E9,0x86A1,0x4A49,0xCD00,0xAF00,0xCF08,0xF000,0xD100,
-  0xAD00,0x4500,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2A11,0x4C11,0x2B11,0x0B09,
-  0x0C01,0x2B29,0x6881,0xC5E1,0xE6F9,0x0AD2,0x1192,0x1572,0xB582,0xD0AB,0xE8CC,0x24F6,
-  0x04F7,0x05F7,0xC8DE,0xCDB6,0xB396,0x567E,0x1C66,0x3D4E,0x3D4E,0x3C56,0x1C56,0x1C56,
-  0x3C56,0x3C4E,0x1D56,0x1A6E,0x9486,0xB1A6,0xCAC6,0xE7DE,0x05EF,0xE3FE,0x05F6,0x6BBC,
-  0x529B,0xB582,0x3482,0xEFA9,0x09EA,0xE6F9,0xC5D1,0x6A61,0x0D11,0xCE00,0xAF00,0xCF00,
-  0xD100,0xCE00,0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2B11,0x4C19,0x2B11,0xEB08,0xCA08,
-  0x4939,0xC8C1,0xE7F9,0xE8E1,0x0EA2,0x3482,0x7582,0x4F9B,0x0AD5,0xC3FE,0x61FF,0xE6DE,
-  0x709E,0xF87D,0xFD5D,0x1F3E,0xFF35,0xFE3D,0xDC4D,0x7C5D,0x5C6D,0x3B6D,0x1A6D,0x1A6D,
-  0x5B6D,0x3B6D,0x9C65,0xFE4D,0xFF3D,0xFF3D,0x1E46,0x3C56,0x367E,0x8CB6,0x23EF,0x40FF,
-  0xE7F5,0xEBCC,0x519B,0x5582,0x318A,0xEBC1,0xE7F1,0xE7F9,0xC889,0x2B19,0xAE00,0xAF00,
-  0xCE00,0xD000,0xCE00,0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x4B19,0x2C11,0x2B19,0x0B09,0xCA08,0x4861,
-  0xC6E1,0xC5F9,0x0AD2,0x5292,0x557A,0xB38A,0xACC4,0xE2FE,0x60FF,0xC6DE,0x529E,0x1C56,
-  0x1F3E,0x1E3E,0xDC55,0x3A75,0x9694,0x539C,0x90AB,0xB2D2,0x73DA,0xB1CA,0xEFBA,0xCFBA,
-  0xCFBA,0x92D2,0xF1BA,0xD09B,0x7494,0xB784,0x7B65,0xFD4D,0x3F3E,0x1F3E,0x196E,0x6DB6,
-  0x86E6,0x20FF,0x85FE,0x4EC4,0xB282,0x5482,0x2FAA,0xC8E1,0xC6F9,0xA6B1,0x0931,0xAE00,
-  0xCF00,0xCE00,0xD000,0xCE00,0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x8408,0x4B19,0x4B19,0x4B19,0xEB08,0xEA08,0x6869,0xC6E9,
-  0xC6F9,0x2AC2,0x328A,0x5582,0x10AC,0x65EE,0x40FF,0xC6DE,0x5396,0x3C56,0x5F3E,0xFD4D,
-  0x1975,0x138C,0x32B3,0xB4D2,0x93E2,0x93E2,0x93EA,0x52DA,0x8EB2,0x4BA3,0x8CA3,0x6B8B,
-  0x4A8B,0x4A93,0x6972,0x0772,0x899A,0x4EBA,0x92C2,0xB3CA,0x3794,0x9A5D,0x1D4E,0x3F46,
-  0x3A66,0x6EB6,0xE3F6,0x01FF,0xA8CD,0xF08A,0x147A,0x1192,0xE8D1,0xC5F9,0xA7C1,0x2931,
-  0xAE00,0xAF00,0xCE00,0xD000,0xAD00,0x4300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x6308,0x2A11,0x4B19,0x4B21,0x2A11,0x0A09,0x6869,0xC6E9,0xC6F1,
-  0x4DBA,0xF381,0xD48A,0x0BCD,0xE1FE,0x44FF,0x8EB6,0x3A5E,0x5F3E,0xFC4D,0x967C,0x55B3,
-  0xD4D2,0xB3E2,0x93F2,0x52D2,0x0FA2,0x8B71,0xEA48,0x8B82,0x8B93,0x8B8B,0x6A8B,0x2973,
-  0x0873,0x6A7B,0x0973,0x065A,0x0662,0x0A9B,0xCCB2,0x0DC2,0x52DA,0xF5D2,0xD5A3,0x3865,
-  0x1D4E,0x5E46,0x367E,0xAAD6,0x61FF,0x63EE,0x10AC,0x557A,0x3192,0x29D2,0xC5F9,0xA7C9,
-  0x2939,0xAE00,0xAF00,0xCF00,0xD000,0xAC00,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x4200,0x0811,0x6B19,0x4B19,0x2A11,0xE908,0x6869,0xC6E1,0xC6F1,0x2DB2,
-  0x147A,0x149B,0x89DD,0x21FF,0xE7DE,0x3586,0x1E4E,0xFE45,0xB974,0x74AB,0xD2DA,0x73FA,
-  0x71E2,0xCEA1,0x6969,0x2749,0xA620,0x6400,0xE739,0x6A7B,0x6A83,0x097B,0x4983,0x8B8B,
-  0xCC93,0xEDA3,0x0DA4,0xC972,0x275A,0x8A83,0x8B8B,0x4C93,0xCDB2,0x30D2,0x32E2,0x32CB,
-  0xD59B,0x5B5D,0x3F3E,0x3C5E,0x70AE,0x43F7,0xC2FE,0x8DC4,0x9582,0x1282,0x0ACA,0xC5F9,
-  0xA6C1,0x0A31,0xAE00,0xAF00,0xCF00,0xD000,0x8A00,0x0100,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0xE710,0x6B21,0x4B19,0x2B19,0x0901,0x4859,0xA6E1,0xE6F9,0x0DAA,0x347A,
-  0x139B,0xC8ED,0x60FF,0xC8CE,0xF965,0x3F36,0xDB4D,0x3594,0xB3E2,0x53FA,0x51D2,0xEE99,
-  0x8961,0x0821,0x8600,0x4600,0x8700,0xE841,0xAB93,0xCB93,0x4A7B,0x4A83,0xEC9B,0x4EB4,
-  0x6FB4,0x6EC4,0x8FBC,0x8B8B,0x876A,0x4A83,0x8B83,0x4A7B,0x497B,0x4C93,0xAFBA,0x11DA,
-  0x53F2,0x54C3,0xB67C,0xDD3D,0x1F3E,0x348E,0xE7E6,0xE2FE,0xACCC,0x767A,0x1382,0x09CA,
-  0xC5F9,0x86B1,0x0B21,0xAE00,0xCF00,0xCF00,0xD000,0x6600,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xA510,0x2A19,0x4B19,0x2A11,0x0A09,0x6939,0xC6D9,0xC5F9,0x0CB2,0x357A,0x129B,
-  0xC9E5,0x22FF,0xAAC6,0x3966,0x1F36,0x3975,0x13A4,0x72EA,0x32E2,0x4EAA,0x8961,0xA708,
-  0x2600,0xAB00,0xAE00,0xCD08,0x4B4A,0xCB93,0x2A7B,0xA86A,0x0973,0xED93,0x8FB4,0x6EBC,
-  0x4EBC,0x6EBC,0x6FB4,0xCC93,0xE972,0xE972,0xAB8B,0xE97A,0xA86A,0x8A7B,0x8B83,0x4C92,
-  0x51BA,0x53EA,0x90E2,0xF39B,0xBD55,0x3F36,0xDB6D,0xC7DE,0xE2FE,0xADCC,0x7582,0x3292,
-  0xC9D1,0xC5F9,0xA891,0x0C11,0xAE00,0xEE00,0xCF00,0xCD00,0x4300,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x2100,0x2919,0x4B19,0x2A19,0x2A09,0x2919,0xC9B9,0xC6F9,0x2ACA,0x1382,0xD392,0xC9ED,
-  0x40FF,0x30B6,0xFE4D,0x5F36,0xF884,0x72DA,0x32E2,0x72D2,0xCB79,0xA510,0x4600,0xAD00,
-  0xEF08,0x0F09,0x8C00,0xC939,0x2883,0x065A,0x8549,0xA649,0x275A,0x2983,0x0DA4,0x2EA4,
-  0xEC9B,0x2EA4,0xCCA3,0x8B9B,0x4A7B,0xC872,0xEDA3,0xEC9B,0xE872,0xE97A,0x8B8B,0xA76A,
-  0x0739,0xEE99,0x93E2,0x32EA,0x34BB,0xDC5D,0x5F3E,0xDA75,0xC8DE,0x01FF,0x8EC4,0x357A,
-  0x1192,0xC8D9,0xE6F1,0x8A71,0xCD00,0xCF00,0xCE00,0xEF00,0x8800,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xC610,0x2A11,0x2C3A,0x0B32,0x2A19,0x6869,0xC6F1,0x2ADA,0x128A,0x9482,0x0BCD,0x40FF,
-  0xC8D6,0x1A5E,0x5F36,0xD87C,0x93DA,0x73E2,0x4FBA,0x4839,0x8600,0xAA00,0xEE00,0xEE08,
-  0xEE08,0x8D00,0x6B21,0xEA6A,0xA872,0xA649,0x6762,0x4A8B,0x4AA3,0xC882,0xA862,0xA86A,
-  0xC86A,0x0973,0x097B,0xE972,0xC872,0x497B,0x0DA4,0xCCAB,0x4A83,0x0973,0x6A83,0x6B83,
-  0xA649,0x6208,0x8969,0xB2DA,0x53E2,0x14BB,0x7975,0x3F3E,0xDA75,0xC8DE,0xE1FE,0x30AC,
-  0x5482,0x0FA2,0x08FA,0xA6C9,0x2A39,0xAD00,0xCE00,0xEF00,0xED00,0x6600,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,
-  0x4A19,0x0A11,0x4C42,0x6B42,0x2851,0xC7D1,0xC7E9,0x70A2,0x767A,0x8DBC,0x21FF,0xC9CE,
-  0xFA65,0x5F36,0xB884,0x93D2,0x73EA,0x6FBA,0x0531,0x8800,0xAC00,0xEE08,0x0E09,0xEE08,
-  0xEE08,0x6B00,0x4A52,0x498B,0x065A,0x275A,0x8FCC,0xD4E5,0xB4ED,0x11E5,0x6FCC,0xACB3,
-  0x2A8B,0xE87A,0xE86A,0x6762,0x065A,0x6762,0x8B8B,0x0DAC,0xAB9B,0x297B,0x2973,0x4A83,
-  0x2983,0x2719,0x2208,0x4859,0x53C2,0x52EA,0x13C3,0xBB5D,0x1F36,0x1586,0x23F7,0x64EE,
-  0x529B,0x7582,0x0CBA,0xC5F9,0xA7A9,0x4C09,0xAE00,0xCE00,0x0F09,0xCA08,0x2100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,
-  0x6B21,0x4A21,0x4911,0x6939,0xA8A1,0xE6F9,0x4CBA,0xF579,0xF19B,0x83F6,0xC4EE,0xD875,
-  0x1F3E,0x997C,0xB3D2,0x73F2,0x6FB2,0x0739,0xA800,0xCD00,0xEF08,0x0E09,0xED08,0xEE00,
-  0xCE00,0xC908,0xA962,0xE97A,0xE661,0xABB3,0x15FE,0x36FE,0xF4F5,0xD4FD,0xD4FD,0x72F5,
-  0xF1DC,0xAFCC,0x2DBC,0xCCB3,0xACAB,0x6B9B,0x6A8B,0xAB8B,0x6A83,0x297B,0x297B,0x297B,
-  0x097B,0xC939,0x8800,0x2400,0x2751,0x72C2,0x53EA,0x54BB,0x7C5D,0x1E3E,0x51A6,0x41FF,
-  0xA9DD,0xB482,0xF281,0x29EA,0xC6F1,0xAB59,0xCE00,0xCD00,0x0E09,0xED08,0x8600,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x4919,
-  0x4B19,0x4A19,0xC800,0x0759,0xE7E9,0xC7D9,0x5292,0x7582,0xC7DD,0x41FF,0xF29D,0x1F3E,
-  0xBA5D,0xD3CA,0x32F2,0x6FAA,0x4741,0x8800,0x0E09,0x0E09,0xED08,0xED00,0x0E09,0xED08,
-  0xAD00,0x4A19,0x8862,0x676A,0x898A,0x10F5,0x16EE,0x93ED,0x52ED,0x93ED,0xB3F5,0xD4FD,
-  0xD4FD,0xB3FD,0x93FD,0x72FD,0x93FD,0x52ED,0x2DC4,0x6AA3,0x2983,0x297B,0x297B,0x297B,
-  0xC872,0x0842,0x0E11,0x6B00,0x6300,0x4959,0x92D2,0x12F2,0x159C,0x1E36,0x1D56,0xABD6,
-  0x60FF,0x0EB4,0x367A,0x2FAA,0xE7F1,0xA8C9,0xEA20,0xCD00,0xEE08,0x0E09,0xCA00,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x4B19,
-  0x6A21,0x0A09,0x4A29,0xA7B1,0xC6F9,0xEBA1,0x147A,0x8EB4,0xE1FE,0xCAC6,0x1D4E,0x1D4E,
-  0x139C,0xB3E2,0x50C2,0x4841,0x8700,0x0E11,0x0D09,0xED08,0xED08,0xED00,0x0D09,0xED08,
-  0xAC00,0xA929,0x2752,0x2672,0x8BB3,0xB3F5,0xB4F5,0xB3F5,0xB3F5,0xB3F5,0x93F5,0x93F5,
-  0x93F5,0x93ED,0xB4F5,0xD4F5,0xD4F5,0xD4FD,0x31ED,0x0DD4,0x8AA3,0x4A83,0x0973,0x297B,
-  0x6A8B,0x6952,0xEB08,0xD000,0xCC00,0x4300,0xCA71,0x72DA,0x12D3,0xF774,0x3F46,0x3776,
-  0x03EF,0x26EE,0x5293,0xF479,0x4CD2,0xA5F9,0x6771,0xCC08,0xCD00,0x2E11,0xEC08,0x4300,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4108,0xE718,0x4B19,0x4A19,
-  0x4A21,0x0901,0x6961,0xC7E1,0xE8E1,0x5292,0xB28A,0x63EE,0x04EF,0x3776,0xFF3D,0x7694,
-  0x53E2,0x52E2,0x8A61,0xA808,0xEC08,0x0D09,0x0C09,0xED08,0xED08,0xED08,0x0D09,0xED08,
-  0xCB00,0xA741,0xC549,0x4772,0x2DD4,0xD4FD,0xB3FD,0x93F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,
-  0xB3F5,0xB3F5,0xB3F5,0x93F5,0x93F5,0xB3F5,0xB3F5,0x8EDC,0xCCBB,0x6A8B,0x0973,0x297B,
-  0x4A8B,0xCA62,0x4B19,0x8E00,0xD000,0x8C00,0x4300,0x0D9A,0x53F2,0x13CB,0x3A65,0x5F3E,
-  0x4FAE,0x61FF,0xC9C4,0x3572,0x30A2,0xE6F1,0xE8D1,0x0A29,0xCC00,0x0E11,0xED08,0xA708,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4108,0x0819,0x6B21,0x4A19,0x4A19,
-  0x0A11,0xC808,0x67A1,0xE6F9,0xCCB9,0x5582,0xAECC,0xE0FE,0x8EAE,0x3F3E,0x5B65,0xB3D2,
-  0x73EA,0xAB91,0xC720,0xAA00,0x0D11,0x0C09,0x0C09,0x0C09,0x0D09,0x0D09,0x0D09,0xED08,
-  0xAB00,0x6739,0x065A,0xA88A,0x2DDC,0x52F5,0x52F5,0x31ED,0x72F5,0xB3FD,0xB3F5,0xB3F5,
-  0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x8EDC,0xCCD3,0x6BA3,0x2973,0x297B,
-  0xC872,0xA95A,0x4C19,0x8D00,0xEF08,0xCF00,0x6700,0x2731,0x30B2,0x73F2,0x95AB,0x1E46,
-  0x1B5E,0x05E7,0x44FE,0x92A3,0x1482,0x2CCA,0xC6F9,0x4759,0xEB00,0xED08,0x2D11,0x0B11,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC510,0x4B19,0x6B21,0x2A19,0xE910,
-  0x6919,0xAA72,0x46E2,0xC8E1,0xF091,0xD28A,0x85F6,0xE4EE,0x576E,0x1F36,0x978C,0x52EA,
-  0x13E3,0x8C6A,0x0909,0xCC00,0x2D11,0x0C09,0x0C09,0x0C09,0x0D09,0x0C09,0x0D09,0xED08,
-  0xAB00,0x6739,0x265A,0x2A83,0xF2BC,0x38CE,0x58CE,0x79D6,0x36C6,0x72CD,0x31F5,0xB3F5,
-  0xB3F5,0xB3F5,0xB3F5,0x93F5,0x93F5,0x93F5,0xD4F5,0x8FDC,0x0CDC,0x8AA3,0xA862,0x8772,
-  0x0752,0x2652,0x2A21,0xAE00,0xEE08,0xCF00,0xEE00,0x4500,0xAA71,0x51EA,0xD3CA,0x7A65,
-  0x3F3E,0x6EAE,0x41FF,0x2ACD,0x1472,0x6FAA,0xE7F9,0xA699,0x0B19,0xCD00,0x2C11,0x0C09,
-  0x6400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0811,0x6B21,0x4A19,0x2A11,0x4821,
-  0xA97A,0x4DCC,0xC8EA,0x8BB9,0x7582,0x0EB4,0x20FF,0x8CBE,0x5D4E,0x3B5D,0x13D3,0x73EA,
-  0x2D92,0xAA29,0x2B09,0xEC08,0x0C09,0x0D09,0x0C11,0x0C09,0x0C09,0x0C09,0x0D09,0x0D09,
-  0xCB00,0x6731,0x4672,0x2F9C,0xB7AD,0x13A5,0x9294,0xF39C,0x17A6,0x58B6,0x95D5,0x52F5,
-  0xB3F5,0x93FD,0xB3FD,0xB3FD,0x93FD,0x93F5,0x52F5,0xEBD3,0x0BDC,0xABB3,0x266A,0xA651,
-  0xA641,0x6641,0xCA10,0xAE00,0xEE08,0xED00,0x0F09,0x6A00,0xE720,0xEEA1,0x74EA,0xB5A3,
-  0x1E46,0x3A66,0x25E7,0x23F6,0x138B,0x328A,0xE8D9,0xE6E1,0x4A49,0xEC00,0x2C11,0x0C09,
-  0xA708,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0719,0x8B21,0x2A11,0x0911,0x085A,
-  0x2DD4,0x4DD4,0x0ACB,0x0FA2,0xD48A,0xECD4,0x85FE,0x5396,0x1D4E,0x3794,0x32F2,0x51BA,
-  0x0731,0xC900,0x0C11,0x0C11,0x0C09,0x0C09,0x0C11,0x0C09,0x0C09,0x0C11,0x0C09,0x0C09,
-  0xEB00,0x6731,0x668A,0x4FAC,0xF39C,0xABB3,0x2AA3,0xA97A,0x6D8B,0xD3A4,0xB5AD,0xB3D5,
-  0x92FD,0x94E5,0xD6CD,0xF6CD,0xF6D5,0x37DE,0x17DE,0xB0C4,0x0CD4,0xACC3,0xA97A,0x0752,
-  0x065A,0x2731,0xAB08,0xCE00,0xEE08,0xEE08,0xEE00,0xEF00,0x6800,0x6A59,0x72F2,0x93D2,
-  0x5A6D,0x1F3E,0x8FA6,0xC3FE,0xAEBC,0xF579,0x0CB2,0xE6F9,0x6881,0x0B01,0x0C09,0x2C11,
-  0xE910,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0719,0x8B21,0x2A11,0xE818,0x2772,
-  0xD0DC,0x0CCC,0xACB3,0xD29A,0xD09A,0xA9E5,0xABED,0x1976,0x7A5D,0x94BB,0x32E2,0xEE89,
-  0xC910,0x0B09,0x4C19,0x0B11,0x0C11,0x0C11,0x0C11,0x0C11,0x0C09,0x0C11,0x2C11,0x0C09,
-  0xA908,0x4631,0xA88A,0x6B93,0x8C93,0x0BDC,0x2CDC,0x29AB,0x8681,0xA779,0x0E84,0xD4AD,
-  0x52DD,0x13B5,0x149D,0xF39C,0xD294,0xF494,0x75A5,0xD7A5,0x32CD,0xEEB3,0x4D83,0x498B,
-  0x8772,0x4629,0xCA00,0xEE00,0xEE08,0xEE00,0xCE00,0x0F09,0x6B00,0x0931,0x4EB2,0x93E2,
-  0x5594,0xFE3D,0x3776,0xE6E6,0x06DE,0x7482,0x5092,0xE7F1,0x86A9,0x0921,0xCB00,0x2C19,
-  0x0A11,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0819,0x8B21,0x2A11,0xE810,0x0752,
-  0xAFDC,0xECD3,0x0EB4,0xF392,0x2DAB,0xC4F6,0x6ECD,0xFD55,0xB76C,0xD0D2,0x73DA,0xCD79,
-  0xEB08,0x0B09,0x2C19,0x2C11,0x2C11,0x2B11,0x0C09,0x0B11,0x2C11,0x0C11,0x0C09,0x2B11,
-  0x2821,0x6539,0xA882,0x6AAB,0x4AAB,0x0BCC,0x8DDC,0x6CDC,0x49AB,0xE671,0x696A,0x728C,
-  0xB2A4,0x0DA4,0xCBBB,0x69C3,0x6792,0xC661,0xE561,0x709C,0x38B6,0xB394,0x2B9B,0x6AB3,
-  0x676A,0x4629,0xAB00,0xCE00,0xEE08,0xCE00,0xCE00,0x0E09,0xAE00,0xC908,0x8A71,0x93EA,
-  0x70B3,0xBC4D,0x1D66,0x8AD6,0x82F6,0x729B,0x5382,0xE9E1,0xE5D1,0x4941,0xCB00,0x2C19,
-  0x2B11,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x8B21,0x2A11,0xE810,0x065A,
-  0x0DCC,0xEBD3,0xCFAB,0x51A3,0x29C4,0xA5EE,0xD5BD,0x1D56,0x1794,0x52EA,0x70AA,0xCB29,
-  0x0C09,0x0C11,0x2B11,0x2C11,0x2B11,0x0A09,0xEA08,0xA908,0xAA29,0xAB21,0x8900,0x6A21,
-  0xD073,0x284A,0x8782,0xECCB,0x4AB3,0xE8A2,0x0BCC,0x0BD4,0x0BD4,0xE9AA,0x8982,0x4FA4,
-  0x2DA4,0xE89A,0xCBCB,0x8DE4,0x89BB,0x8792,0x8781,0xA87A,0x9094,0x2FAC,0xC8A2,0xA88A,
-  0xE651,0x4721,0x0C09,0xEE00,0xED08,0xEE08,0xEE08,0xEE08,0xEF08,0xAA00,0x4841,0x72DA,
-  0xB2D2,0x3A6D,0x1F46,0xAEAE,0xC1FE,0x4FB4,0x557A,0xECD1,0x08EA,0x6969,0xEA00,0x2C19,
-  0x4B19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x8B21,0x2B11,0xE810,0xE651,
-  0x8FD4,0xCEE4,0xF0A2,0x2FA3,0x6AE5,0x0AE6,0xD6B5,0x5A75,0xD5AB,0x91DA,0xEE81,0x0909,
-  0x2B11,0x4C19,0x6C19,0x2C11,0xEA08,0x2A19,0x0E53,0xAD4A,0x2E5B,0xB06B,0xCD52,0x2E5B,
-  0x76A5,0x0F84,0xA882,0x0DD4,0x8FD4,0x4682,0xE8A2,0xEBCB,0x8CEC,0xE8AA,0xA992,0x72ED,
-  0x8FD4,0x0892,0x889A,0x0BCC,0x2BD4,0x8AC3,0x889A,0xA772,0xED93,0xCCB3,0x879A,0x4782,
-  0xC651,0x2821,0xEC08,0x0E09,0xED08,0xEE08,0xEE08,0xED08,0x0F09,0xAB00,0xE818,0x30A2,
-  0x73E2,0x779C,0xBF3D,0x948E,0x03FF,0x6DDD,0x7582,0xCCB9,0x06FA,0x8889,0xEA00,0x2C11,
-  0x2C11,0xA610,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B21,0x4B11,0xE810,0xC651,
-  0xAFDC,0xEFE4,0xB0B2,0x6FBB,0x2AF6,0xECED,0xB6AD,0x177D,0x94BB,0x51D2,0x8D69,0xEA08,
-  0x4B11,0xC908,0x4800,0xE908,0x4C42,0x1274,0x55A5,0xB38C,0x7284,0x1495,0xF494,0x928C,
-  0x96A5,0x1495,0x4B83,0x4DCC,0xD4F5,0xEDB3,0x4AAB,0x49B3,0x28AB,0xE9A2,0x2EC4,0xD4FD,
-  0x6FDC,0x488A,0x8779,0x689A,0xEBC3,0xADE4,0x6AB3,0x2993,0xABB3,0x6AB3,0x879A,0x488A,
-  0x4631,0xC908,0xED08,0xEE08,0xCD00,0xED00,0xED00,0xED08,0x0E09,0xCD00,0xA908,0x6A81,
-  0x52E2,0x14AC,0x9E45,0x786E,0xE7EE,0x08E6,0x7482,0xEFA9,0xE7F9,0xC7A1,0xAA11,0x0C11,
-  0x2C11,0xE710,0x4100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4B19,0xE810,0xE651,
-  0xD0DC,0xEFE4,0x8FC3,0x8ED4,0x2AF6,0xADDD,0xD7AD,0x938C,0xD3D2,0x31CA,0xEB49,0xC908,
-  0x2A11,0x8B21,0xAA29,0x8C4A,0x928C,0xD6AD,0x75A5,0xF494,0x349D,0x759D,0x349D,0xF494,
-  0xF494,0x158D,0x2F9C,0x8FCC,0x15FE,0x73F5,0xECCB,0x29AB,0x4BAB,0x8FD4,0xD4F5,0xD4FD,
-  0x32ED,0x6AAB,0x078A,0xE689,0xE89A,0xCBC3,0x6AB3,0xCBC3,0xABBB,0x49AB,0xC8A2,0xE769,
-  0x6508,0x8900,0xAC00,0xCC00,0x2D11,0x0E09,0xED08,0xED08,0xEE08,0xED00,0x4A19,0x0A72,
-  0x53E2,0xB1B3,0x9C45,0x7A5E,0xC6DE,0x84EE,0xD28A,0x1192,0xC8E9,0x68D2,0xED52,0x4C19,
-  0x2C11,0xE910,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4B19,0xE710,0xE659,
-  0x52ED,0x11E5,0x90CC,0x6EE5,0xABE5,0x30C5,0x96A5,0xF39C,0x33DB,0x6FAA,0xE829,0xA808,
-  0xAB21,0x527C,0x55A5,0x359D,0x96A5,0xB7AD,0x559D,0x149D,0x18B6,0x79BE,0x96AD,0x559D,
-  0xF494,0x1495,0x70A4,0xF0DC,0xD4FD,0xD0DC,0xCCC3,0x2DCC,0xD0D4,0x52E5,0x93F5,0xB3F5,
-  0xB3F5,0x0CCC,0x29AB,0x6AB3,0x4AAB,0x2AA3,0x8ABB,0x2DD4,0xABBB,0x29A3,0xA88A,0x6539,
-  0x8829,0x0B32,0x4D3A,0x0C32,0x6B21,0xCD00,0x0D09,0x0E09,0xCD00,0x0C11,0x2C2A,0xED5A,
-  0x72D2,0xD0D2,0x3B55,0x7B5E,0xA8DE,0xE2FE,0x1093,0x1282,0xC8D9,0x68E2,0xCE72,0x6B19,
-  0x2B11,0x0911,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6A21,0x4B19,0xE710,0xE651,
-  0x52ED,0x31F5,0xD1DC,0x0FDD,0x2BD5,0x50C5,0x559D,0xD7A5,0x55D4,0x2DA2,0x0729,0x2A11,
-  0x6E63,0xB6AD,0x79BE,0xD7AD,0xB7AD,0x7AC6,0x9AC6,0x18BE,0xDBCE,0xBEEF,0x3CE7,0x38BE,
-  0xF7B5,0x1495,0x2F8C,0xF1D4,0x72F5,0xECBB,0xEDB3,0x8FCC,0x4EC4,0xCCB3,0x0DCC,0xAFDC,
-  0xECC3,0xABC3,0x0DCC,0xD0E4,0x93F5,0x32E5,0x4DDC,0xCCCB,0x2AB3,0xA882,0xE651,0x0752,
-  0x5284,0xF48C,0x96A5,0x7284,0xAA29,0xCB00,0xEC00,0x0D09,0xCD00,0x0D11,0xAB21,0xEA39,
-  0x70C2,0x52EA,0xBA74,0x3E4E,0x4EC6,0xE2FE,0x3093,0x3382,0x0AE2,0xA5D1,0x2841,0xEA08,
-  0x4B19,0x2A19,0x4308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A19,0x6B19,0xE910,0x4839,
-  0xB0DC,0x72F5,0x4EC4,0x2DD4,0xF1DC,0x74AD,0xF7AD,0xD3C3,0x93F2,0x0FA2,0xE710,0x6929,
-  0x6FC4,0xAFBC,0xD294,0xB6A5,0xF8B5,0xD7B5,0xF7B5,0x559D,0x59BE,0x9EEF,0x5DE7,0x9AC6,
-  0xBAC6,0x96A5,0x7094,0xAFC4,0x52ED,0xAFDC,0xABA3,0x2C83,0x70C4,0xD0DC,0xACB3,0x8CBB,
-  0x6ABB,0x8ED4,0x6FC4,0x2EBC,0x11E5,0x93F5,0x4ED4,0xABC3,0x687A,0x6541,0xC651,0x6C73,
-  0xD7AD,0xDBCE,0xB6AD,0x928C,0x117C,0xED52,0x2A11,0x8B00,0xED08,0xED08,0xA900,0x2829,
-  0x50C2,0x72EA,0xBA74,0x5E3E,0x6FAE,0xE1FE,0xCFAB,0x738A,0x0ADA,0xC5E1,0x6859,0x0A09,
-  0x4B19,0x2A19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2919,0x6C21,0xE910,0xC618,
-  0xABBB,0x72F5,0x11DD,0xF1E4,0x93F5,0xD5DD,0xBBCE,0x54D5,0x32F3,0x4E81,0x4819,0xCD93,
-  0x72F5,0x2DBC,0x508C,0xD7A5,0x18BE,0x76A5,0xF494,0x55A5,0x59C6,0x1CDF,0x5DE7,0x3CDF,
-  0x38BE,0xD7AD,0x7194,0xED9B,0xD0D4,0x11E5,0x8FD4,0x0F9C,0x96AD,0x17CE,0xF2AC,0x13B5,
-  0x95BD,0x0E8C,0x6B83,0x0DAC,0x6EC4,0x8EE4,0x2DDC,0x8ABB,0x0762,0xA549,0x4B7B,0x359D,
-  0x55A5,0xB7AD,0xF48C,0xF494,0x38BE,0xF8B5,0xB06B,0x4A19,0xCB08,0x0E09,0xCC00,0x2921,
-  0x50C2,0x72EA,0xBA74,0x5E3E,0x6FAE,0xE1FE,0xEFAB,0x7482,0xEBD1,0xE5E1,0x8859,0x0A09,
-  0x4B19,0x4A19,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2919,0x8C21,0x0911,0xC610,
-  0xE89A,0x72F5,0xD4F5,0x93ED,0xF4F5,0xB4FD,0x37E6,0x35EE,0x70DC,0x2B92,0x2C8B,0xB3ED,
-  0x6ECC,0x4F9C,0x75A5,0xB7AD,0x75A5,0xD7B5,0xD7AD,0xBAC6,0x1CDF,0x79C6,0x79BE,0x3CD7,
-  0x18B6,0x18B6,0x359D,0x0E8C,0x2DBC,0xF1DC,0x31ED,0x32DD,0x12C5,0xF29C,0x148D,0x769D,
-  0x76A5,0xEE9B,0x6FC4,0xF1CC,0xEDB3,0xABCB,0x2DCC,0x4AAB,0xC659,0xE651,0x4A7B,0x0F84,
-  0x928C,0x76A5,0x559D,0xF494,0x96A5,0x18B6,0x59C6,0xF494,0xCD4A,0x2C19,0xCC00,0x6A29,
-  0x51C2,0x52E2,0x9A7C,0x3D46,0x6FAE,0xE1FE,0xEFAB,0x557A,0xEBD1,0xC5E1,0x8861,0x2A09,
-  0x6B19,0x4A19,0xA508,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8B21,0x2A11,0xC710,
-  0x888A,0x51ED,0xF5FD,0x93ED,0xB3F5,0x93F5,0x93F5,0xD5F5,0x51DD,0x8ED4,0x11ED,0x52F5,
-  0xCD93,0xD38C,0xF8AD,0xB6AD,0x96A5,0x9AC6,0x3CDF,0x7DE7,0x9EE7,0x9AC6,0x76A5,0x17B6,
-  0x79C6,0xF7B5,0xB7A5,0xD394,0xED9B,0x8FCC,0x72F5,0x93FD,0xF0E4,0x6FC4,0x91AC,0xB2B4,
-  0x90B4,0x31E5,0xB3FD,0xD0D4,0xABBB,0x0CD4,0xCCB3,0x099B,0x276A,0x275A,0xEA72,0xEE7B,
-  0x1495,0x56A5,0x55A5,0x149D,0xB38C,0xF394,0x59C6,0xFBD6,0x549D,0x6C42,0xC900,0x6A29,
-  0x50BA,0x91E2,0xB78C,0x3C56,0x90A6,0xE1FE,0x0FB4,0x7482,0x0BDA,0xC6D9,0x4849,0xA900,
-  0x4A19,0x6A21,0x4A19,0xC610,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6208,0x0919,0x8C21,0x2A11,0xE710,
-  0x677A,0xF0E4,0xD5F5,0x93ED,0x93F5,0x93F5,0xB3F5,0xB4ED,0xB4F5,0x15FE,0x93F5,0xEDBB,
-  0x728C,0x1495,0xF494,0x96A5,0x59C6,0x9AC6,0x5DE7,0x7DE7,0xFBD6,0x59C6,0x96A5,0x76A5,
-  0xBAC6,0x96A5,0x96A5,0x96A5,0x508C,0xEDB3,0x72F5,0xB4F5,0xF4FD,0x72F5,0xAFE4,0xF0EC,
-  0x52ED,0xD4F5,0xF0DC,0xECC3,0xECCB,0x0CCC,0x299B,0xE8AA,0xAC93,0x5084,0x34AD,0x79BE,
-  0xD7AD,0xD394,0x149D,0x96A5,0x559D,0x149D,0xB7B5,0xBAC6,0xBACE,0x738C,0x8921,0x2821,
-  0x51C2,0xB1EA,0x1885,0x5D4E,0x70AE,0xE1FE,0xB0AB,0x538A,0x0AE2,0xA5D1,0x4841,0x0919,
-  0x2919,0x2A19,0x6B19,0x6B21,0xE710,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x0819,0x8C21,0x2A11,0xE718,
-  0x277A,0x4ED4,0x73F5,0xB3F5,0xB3F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0x93F5,0xAFDC,0xAC9B,
-  0xB28C,0xD38C,0x7284,0x359D,0x18B6,0xB6AD,0x79BE,0x1CDF,0xF8B5,0x76A5,0x38BE,0x38B6,
-  0x7AC6,0x75A5,0x55A5,0xF8B5,0xD294,0x298B,0x8FD4,0xB3FD,0xD4FD,0xD0D4,0x6EBC,0xB4F5,
-  0xD4FD,0xF0DC,0xCCC3,0xECD3,0x0CCC,0x099B,0x09A3,0x6AC3,0xF2B4,0xBBBE,0xBEEF,0x3CDF,
-  0xF7B5,0xB6AD,0x18B6,0xD7AD,0x359D,0x75A5,0x99C6,0x5CDF,0x5DE7,0x96AD,0xCC4A,0x4941,
-  0x52D2,0x72EA,0xDB64,0x5E4E,0x4DCE,0xC2FE,0x1093,0x1282,0xC9E1,0xE5D1,0xEA8A,0x8D93,
-  0x2A4A,0x0911,0x0911,0x6B21,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE810,0x8B21,0x2A11,0x0819,
-  0x2882,0xCBCB,0x51ED,0xD4F5,0xB3F5,0xD4FD,0xD4FD,0xD4FD,0x72F5,0x2DD4,0x6AB3,0x4FA4,
-  0x75A5,0xB38C,0x117C,0x1495,0xF7AD,0x75A5,0x359D,0x18BE,0xF7B5,0xF7B5,0x7AC6,0x38BE,
-  0x38B6,0x55A5,0x35A5,0xD7A5,0x13A5,0x099B,0x29A3,0xF1DC,0x32ED,0x2DB4,0x4EB4,0xB3F5,
-  0x11ED,0x2DCC,0x0DC4,0xCCBB,0x299B,0xE8A2,0xAACB,0x0CC4,0x74B5,0x9ABE,0xDACE,0xBACE,
-  0x3CDF,0x7DDF,0xBACE,0xD7AD,0x349D,0x1495,0xD7AD,0x59BE,0x18BE,0x149D,0xD173,0xB18A,
-  0x51CA,0x10BB,0xB774,0xF67D,0xA8D6,0x45EE,0x1193,0x3092,0xA9C1,0xEBDA,0x31E5,0x32ED,
-  0x2EBC,0xC941,0xE910,0x6B19,0x6A21,0xC610,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x8B21,0x4A19,0xE818,
-  0xC651,0x6AB3,0x6EDC,0x8FDC,0xD0DC,0x31ED,0xB0E4,0x2DD4,0x0CC4,0x2DB4,0x509C,0xD394,
-  0x96A5,0x55A5,0x7284,0x527C,0xD38C,0xD38C,0xB38C,0x96A5,0xF8B5,0xB7AD,0xB7AD,0xD7AD,
-  0x75A5,0x1495,0x559D,0x1495,0x0F94,0x8BC3,0xE89A,0xACA3,0x6FB4,0x2EAC,0x0DA4,0xAFCC,
-  0x4EC4,0xEDAB,0x6AA3,0x09A3,0x6AB3,0xCCCB,0xEBD3,0x4FB4,0x95AD,0x18B6,0xF7B5,0x9AC6,
-  0x7DE7,0x1CD7,0x18B6,0x96A5,0x75A5,0x359D,0x76A5,0x559D,0x76AD,0xB284,0xCD5A,0xEF91,
-  0x91CA,0xB3B4,0x979D,0x31C6,0x24F7,0x45E6,0xB38A,0xB1A2,0x0BBB,0xECC3,0x32E5,0x11ED,
-  0xAAC3,0x6739,0xE908,0x6B21,0x4A19,0xA408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4A19,0x0911,
-  0xE618,0x099B,0x0BDC,0xCBCB,0xACCB,0xCDC3,0x2FB4,0xD2B4,0x94BD,0xF6BD,0x349D,0x317C,
-  0x1495,0x75A5,0xF494,0x117C,0xD073,0x7284,0xB38C,0x96A5,0x96A5,0x359D,0x349D,0x149D,
-  0xF394,0xD38C,0x1495,0x308C,0x4A9B,0xCBC3,0x6AB3,0xE89A,0x4A8B,0xED9B,0xECAB,0xECA3,
-  0xAB93,0x0993,0x09A3,0xABC3,0x2DD4,0x0ED4,0xABD3,0xB1A4,0xD7AD,0x59C6,0x59BE,0x59C6,
-  0xDBCE,0x79C6,0x559D,0x3495,0x96AD,0x76A5,0x359D,0xF38C,0x55A5,0x18AE,0x14A5,0x4EB3,
-  0x10DC,0x52CD,0x798D,0x51AE,0x22FF,0x8ADD,0x328A,0x30B3,0x2CC4,0x0CC4,0x4ED4,0x8BB3,
-  0x6449,0xE710,0x2A11,0x6B21,0x2919,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6B21,0x4A19,0x2A11,
-  0x4921,0xCA8A,0xCBC3,0xECBB,0x0EB4,0x50A4,0x34A5,0xF8AD,0x9ABE,0xD7A5,0xF073,0x6E6B,
-  0x317C,0x9284,0xB38C,0x7284,0xCF73,0xD06B,0x517C,0x1495,0xF494,0xD38C,0x1495,0xD394,
-  0xD394,0x928C,0x5084,0xAC9B,0x49B3,0xAABB,0xABC3,0x29B3,0xE892,0x098B,0x2A9B,0x299B,
-  0x098B,0xE8A2,0x6AC3,0x0DD4,0x0DD4,0xECD3,0xABBB,0x34A5,0x7ABE,0xBACE,0x58BE,0xF8B5,
-  0x18BE,0xF7B5,0x75A5,0x559D,0x96AD,0x96A5,0x359D,0x75A5,0x769D,0xD8A5,0x17CE,0x50ED,
-  0xEFE4,0x75A5,0x7B65,0x719D,0x87ED,0x4DC4,0x0FAB,0xB1DC,0xAFDC,0x8CC3,0xA892,0x4441,
-  0x8500,0x0911,0x6B21,0x6B21,0x0711,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA610,0x6B21,0x4A19,0x2919,
-  0xCA31,0x4E7B,0x0F9C,0x709C,0x149D,0x7695,0xB6A5,0x55A5,0x96AD,0x5284,0x8B4A,0xAC52,
-  0x4E63,0x8F6B,0xF073,0x317C,0xF073,0x6F63,0x8F6B,0xD073,0xF173,0x7284,0x1495,0x1495,
-  0xB38C,0x327C,0x8C7B,0x499B,0x6AB3,0x6AB3,0x6AB3,0x8BB3,0x29B3,0xC89A,0xC892,0xE8A2,
-  0x09AB,0xABBB,0xCBC3,0xABC3,0x8AC3,0xAAC3,0x90A4,0x18BE,0xBAC6,0x38BE,0xF7B5,0x38BE,
-  0x99C6,0xD7B5,0xD7AD,0xD7AD,0x76A5,0xB6AD,0xF7B5,0x96A5,0x9394,0x3094,0xB1BC,0x31ED,
-  0x8FCC,0x5A5D,0x997D,0x8FCC,0xADCB,0x2EC4,0x10DD,0x92F5,0x6EDC,0x888A,0x0529,0x6400,
-  0x2A19,0x6B21,0x6B21,0x2919,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6B21,0x6A21,0x2919,
-  0xA608,0x8F63,0x149D,0xD38C,0x9284,0x928C,0xB38C,0xB38C,0xB7AD,0x1495,0xAC52,0xEA31,
-  0x8C4A,0xAC52,0xEC52,0x4E63,0x8F6B,0x8F6B,0x6F63,0xEC5A,0x0D5B,0x1074,0xD38C,0xD38C,
-  0x517C,0xB063,0xEA7A,0xA79A,0x09A3,0x2AA3,0x4AA3,0x2AA3,0x6AAB,0x8ABB,0x6AB3,0x8AB3,
-  0xABBB,0x8AB3,0x8ABB,0xABC3,0x8AB3,0xCD9B,0xF7B5,0xDBD6,0x18BE,0xB7AD,0x59BE,0xBAC6,
-  0x7DDF,0x9AC6,0xF8B5,0xF7B5,0x96A5,0x96A5,0x18BE,0x938C,0x6D9B,0x6FD4,0x93ED,0xD0DC,
-  0xB1AC,0xD784,0xF4C4,0x2CDC,0xECBB,0x53ED,0x93F5,0x4CDC,0x888A,0x0529,0x8600,0x6A21,
-  0x6A21,0x6B19,0x2819,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4919,0x6B21,0x4A19,
-  0x8508,0xC839,0x5184,0xD48C,0x317C,0x7284,0x938C,0xF494,0x59BE,0x96AD,0x8C4A,0x4829,
-  0xEA39,0xEA31,0xC931,0x4B42,0xCC52,0xCD52,0x0D5B,0x4E63,0x2E63,0xCD52,0x0D5B,0xAF6B,
-  0x4E63,0x0D53,0x8972,0x6792,0xC892,0xC8A2,0x09A3,0x09A3,0xE9A2,0x29A3,0x4AA3,0x4AA3,
-  0x4AA3,0x6AB3,0x8AC3,0x49A3,0xCC83,0x75A5,0xBAC6,0x79BE,0xF7B5,0xD7AD,0xB6AD,0x96AD,
-  0x39BE,0x7AC6,0x79C6,0xD7B5,0x96A5,0x76A5,0x308C,0xACAB,0xCFE4,0x15F6,0x16EE,0x73ED,
-  0x52E5,0x32DD,0x8FDC,0xCCCB,0x4ECC,0x72F5,0x0DD4,0x4772,0xE420,0xC608,0x4A19,0x4A19,
-  0x6B19,0xE710,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B21,0x4A19,
-  0x0811,0x0719,0x4E63,0xB38C,0x7284,0xD38C,0x1495,0x559D,0xD7AD,0xD38C,0x4B42,0xE810,
-  0x8A29,0x359D,0x96AD,0xED5A,0x8929,0xCA31,0xC931,0x2B3A,0x2B3A,0xEA31,0x2A3A,0xCC52,
-  0xCD52,0x8B4A,0x2862,0x2772,0x877A,0x6892,0x6892,0xA892,0xC892,0xC89A,0xE8A2,0x09A3,
-  0x09A3,0xE8A2,0xC882,0xCE7B,0x559D,0x38B6,0x38BE,0x76A5,0x1495,0x559D,0x75A5,0x75A5,
-  0x96A5,0xD7AD,0xB6AD,0x75A5,0x1495,0x0F8C,0xEDB3,0x53E5,0x15F6,0xD4F5,0xB3F5,0x72F5,
-  0x32E5,0x52F5,0xCCBB,0x6AAB,0x8EE4,0x4DD4,0x4772,0xA418,0x8600,0x2A19,0x6B21,0x4B19,
-  0xE710,0x4100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE610,0x6B21,0x4A19,
-  0x4A19,0xC710,0x2B42,0x8F6B,0xD073,0x1074,0x117C,0xF073,0x1074,0x117C,0xCD52,0xC708,
-  0x6921,0xFCDE,0xFFFF,0xEE52,0xE818,0x56A5,0x76AD,0x0E5B,0x8C4A,0xAD4A,0xC931,0x2719,
-  0x8929,0x4B42,0x094A,0xE749,0x265A,0x0762,0x2772,0x887A,0x4872,0x4772,0x8782,0xA89A,
-  0xC78A,0xCA6A,0xAE73,0x1495,0xD7AD,0xD7AD,0xD7AD,0x55A5,0x1495,0x55A5,0x96A5,0x559D,
-  0x359D,0x55A5,0x75A5,0x569D,0xB294,0xEDA3,0x31F5,0x15FE,0xF5ED,0x93F5,0x52F5,0x32E5,
-  0xF1D4,0x2DC4,0x8AB3,0x0BCC,0x8BB3,0x6441,0xA418,0xC708,0x2A19,0x8C21,0x4A19,0xA508,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x2A19,0x4A19,0x6B21,
-  0x6B21,0x2819,0x8929,0x4B42,0x8B4A,0x8C4A,0xAC4A,0x8B4A,0x2D5B,0xF07B,0xED5A,0xA708,
-  0x8929,0x1CE7,0xFBDE,0xCD4A,0x327C,0xFFFF,0x58C6,0x928C,0xF8BD,0x55A5,0x0E5B,0x906B,
-  0x6C42,0x8929,0x4819,0x4721,0x8639,0xC741,0x8749,0xE659,0x065A,0xE759,0x2662,0x0772,
-  0x895A,0x4E5B,0x9384,0x349D,0xF494,0x1495,0x559D,0x1495,0xF394,0xF494,0xD38C,0xB38C,
-  0xF494,0xB38C,0x559D,0x3595,0x7094,0x10DD,0xD4F5,0x73ED,0x32ED,0x52ED,0x12E5,0xB0D4,
-  0x4DCC,0xABC3,0xCBCB,0x49AB,0x6539,0x4500,0xA708,0x6B21,0x8C21,0x2819,0x8408,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8B21,0x4A19,0x0A11,
-  0x0911,0xE810,0x2819,0x8929,0xC931,0x0A3A,0x4B42,0x6B42,0x0E5B,0x6F63,0x0B3A,0x8700,
-  0x4B3A,0x5DEF,0x18BE,0x349D,0xFFFF,0x9ACE,0xE939,0x76A5,0xFFFF,0xB7B5,0xB38C,0xDEF7,
-  0xF073,0xE610,0x6C42,0xD073,0x8B4A,0x4821,0xE720,0x4639,0xA641,0xA741,0xA641,0xC741,
-  0x6C42,0x6E63,0xAF73,0x8F6B,0x8F6B,0xD073,0xF073,0xF073,0xD073,0x8F6B,0x6E63,0xF073,
-  0x7284,0xF073,0xB384,0x7184,0xED9B,0x52F5,0x32E5,0x12DD,0xB0DC,0x8FDC,0x8FDC,0x4ED4,
-  0xEBD3,0x8BBB,0xA88A,0x2431,0x6500,0x4B19,0x8C21,0x4B19,0x0711,0x6308,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x4A19,0x4A19,0x4A19,0x2911,
-  0x0811,0xC710,0xC710,0x2819,0xAA29,0xEA31,0x2B3A,0x2B3A,0x4B42,0x8C42,0xAA29,0xA808,
-  0x0E5B,0x5DEF,0xDFFF,0xFFFF,0xBBD6,0xC931,0xA829,0x3CE7,0x7ACE,0x8B4A,0xB494,0xDFFF,
-  0x2E5B,0x8B4A,0xDBDE,0xFFFF,0xD073,0xA608,0xAC4A,0x0E5B,0x0B3A,0x4821,0x6921,0xA929,
-  0x2B3A,0x2A3A,0x0A3A,0x2A42,0x4B42,0x6C42,0x8C4A,0xED52,0x0D5B,0xED52,0xED52,0x4E63,
-  0xAF73,0xD073,0x3274,0xEF8B,0xABB3,0x4FD4,0xB0E4,0xAFD4,0x2ECC,0xECD3,0x0BD4,0x2DD4,
-  0x6AB3,0xE659,0x6308,0x8500,0x6B21,0x6B21,0x4A19,0xC610,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x2919,0x8C21,0xE910,0x6A21,0x317C,
-  0x159D,0x8F6B,0xCA31,0x4921,0x2919,0xC710,0xE718,0x8929,0xE939,0x2A3A,0x8A29,0x0911,
-  0xB06B,0x5DEF,0xFFFF,0xBBD6,0x2A3A,0x4300,0xD394,0xFFFF,0x3284,0xA929,0x18BE,0xBEF7,
-  0x6E63,0x39C6,0xFFFF,0xB38C,0x6500,0xCC52,0x3DE7,0xBEF7,0x159D,0xA929,0x0819,0xA929,
-  0x8929,0x2821,0x0721,0x8929,0x2B3A,0x8C4A,0xAC4A,0xCD52,0x0D5B,0x0D5B,0x4E63,0x8F6B,
-  0xCF73,0x8F6B,0x727C,0x70AC,0x8BCB,0x0DD4,0x0DD4,0x0BCC,0x0CCC,0x2DD4,0xEACB,0xA88A,
-  0xA318,0x6400,0xE810,0x4B19,0x6B21,0x4A19,0xA410,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6A19,0x8B21,0xA708,0x4C42,0x3CE7,
-  0xFFFF,0xDFFF,0x5DE7,0xF273,0x8A29,0xB06B,0x6B4A,0x2819,0xA708,0xA708,0xA808,0xA808,
-  0x6821,0xAF73,0xD394,0xAC52,0x2400,0xAC4A,0xDFFF,0xFFFF,0x2B3A,0x4821,0x7ACE,0xBEF7,
-  0xBBD6,0xFFFF,0x928C,0x4300,0xAC4A,0x1CDF,0xDEF7,0xFFFF,0xB7B5,0xC931,0xC708,0x4919,
-  0x8929,0x938C,0xB38C,0x4B42,0x8929,0x4B42,0x6B42,0xCA31,0x8929,0x2B3A,0xAC4A,0xCD52,
-  0x0D5B,0xCC52,0x559D,0xD6BD,0xCDAB,0xEBD3,0x0DD4,0x0BD4,0xCAD3,0x8AB3,0x676A,0x8310,
-  0xA700,0x0911,0x6B21,0x8C21,0x0819,0x4308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2819,0x8B21,0x0911,0x2819,0x7284,0xFFFF,
-  0xDBD6,0x76AD,0x35A5,0x8F6B,0xD073,0x3CE7,0xD394,0x8929,0x0F5B,0x327C,0x4B3A,0x2819,
-  0x0300,0x6400,0x0619,0x6600,0x6700,0x4B42,0x96AD,0xF494,0xC708,0x4C3A,0xBDEF,0xFFFF,
-  0xFFFF,0x9384,0x6400,0x4B42,0xDBDE,0x9EF7,0x1495,0xBEF7,0x56AD,0x6921,0xA808,0xE810,
-  0x0E53,0x7DEF,0x99CE,0x4B42,0xE718,0xEA31,0xE718,0xEA31,0x8C4A,0x0A3A,0xA931,0xEA31,
-  0x2A3A,0x0A3A,0x56A5,0x7DDF,0x95B5,0xCBBB,0x8ACB,0xAABB,0x2EAC,0x919C,0xEC5A,0x6500,
-  0x4A19,0x8C21,0x4A19,0xE710,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,0xAC29,0x4700,0x0B32,0x99CE,0xDFF7,
-  0xBAD6,0x55A5,0xC931,0x0A3A,0xDBD6,0xFFFF,0xD073,0x0B3A,0x18BE,0xFFFF,0x38BE,0x76AD,
-  0x9494,0xA931,0x0300,0xE810,0x6A21,0x6500,0xA410,0x4821,0xE910,0x0C32,0x35A5,0x79CE,
-  0xF49C,0x2719,0x0E5B,0x9EEF,0xFFFF,0x7DEF,0xF8BD,0x9EF7,0xD494,0x2919,0xA808,0x0819,
-  0x96AD,0xFFFF,0xF49C,0x4919,0x0919,0xE710,0xEA31,0x35A5,0x38C6,0x5184,0xC931,0x4921,
-  0xA931,0xCA31,0x159D,0xBEEF,0xBACE,0xF2A4,0x6FB4,0x6FA4,0x75A5,0x769D,0x2E5B,0x0911,
-  0x4A19,0x6B21,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B21,0x4B19,0xE810,0x127C,0xDEF7,0x5DE7,
-  0x1CDF,0x1CD7,0x6C42,0x2F63,0xFFFF,0x7ACE,0xE810,0x2721,0x928C,0x7DEF,0xFFFF,0xFFFF,
-  0xDFFF,0x7284,0x0E53,0x7384,0xD494,0x2F5B,0x0519,0xA708,0x6B19,0xA708,0x4408,0xA831,
-  0xC710,0x4821,0x97AD,0xDBDE,0x76AD,0xB6AD,0xDFFF,0xFFFF,0xB494,0xC810,0xA808,0x8C4A,
-  0x9EEF,0x1CDF,0x0B3A,0x2600,0x0911,0x8921,0x96AD,0x9EF7,0xFFFF,0x59CE,0x0A32,0x0911,
-  0x0819,0x4B42,0x76AD,0xDBD6,0xD7AD,0xB7A5,0x97A5,0x96A5,0xF8B5,0x5184,0x8929,0xE910,
-  0x4A19,0x6B19,0x6408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,0x6B21,0xC908,0x2C3A,0xF7BD,0xFFFF,0x1CE7,
-  0x76A5,0x4E63,0x8C4A,0xF8BD,0xFFFF,0x1174,0xA808,0x0200,0x0942,0x7AD6,0x7DEF,0xAE73,
-  0x2D63,0x359D,0xBEF7,0xFFFF,0xFFFF,0xFFFF,0x99C6,0x4C42,0xC808,0x6A21,0x4721,0x6408,
-  0xE910,0xC710,0x0619,0x2829,0x4510,0x6208,0x718C,0x9EF7,0xD494,0x6600,0x2919,0x359D,
-  0xFFFF,0x76AD,0xA929,0x2400,0xCA29,0xB6AD,0xDFFF,0x18BE,0x9EEF,0xF8BD,0x4821,0xE910,
-  0xC708,0x4E63,0xD7AD,0xD7AD,0xB28C,0xB28C,0xF394,0x149D,0x35A5,0x2E5B,0xC808,0x4A19,
-  0x6B19,0x2A19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x2100,0xC610,0x6B21,0x6A21,0x0911,0xEB31,0xF07B,0xF8B5,0x7DE7,
-  0xFFFF,0x5284,0xB38C,0xFFFF,0x7DEF,0x117C,0xAA29,0xA608,0xB494,0xDFFF,0xD7B5,0x2200,
-  0x2942,0x1CE7,0xFFFF,0xB394,0x0D63,0x9AC6,0xFFFF,0xB38C,0xE610,0x906B,0x9EF7,0x1595,
-  0x6A21,0x4919,0x0719,0x8608,0xE810,0xC710,0x8310,0xC839,0x2C3A,0xE910,0x0C3A,0x9AC6,
-  0xFFFF,0xFFFF,0xF8BD,0x1074,0x56A5,0xFFFF,0x7DEF,0x76AD,0x9DEF,0xF8BD,0xE810,0xE910,
-  0x2B3A,0xF073,0x359D,0xD38C,0x117C,0x5284,0x7284,0xB38C,0xB38C,0xAD4A,0xC808,0x4A19,
-  0x6B19,0xE710,0x4100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4100,0x0811,0x6B21,0x4A19,0x4A19,0xE710,0x8408,0xE418,0xC839,
-  0xAD62,0x2A42,0x9284,0x3CDF,0xFFFF,0xDFFF,0x96AD,0x4F63,0x7ACE,0xDEFF,0x6F63,0x4600,
-  0x55A5,0xDFFF,0x56A5,0xC410,0x8208,0x317C,0xFFFF,0x55A5,0xAC4A,0x55A5,0xFFFF,0x3CE7,
-  0x8929,0x7384,0xBBD6,0x127C,0xE910,0x6B21,0xC708,0x8608,0xC808,0xA900,0xA608,0xC731,
-  0x0D63,0x149D,0xD7AD,0xFBD6,0xFFFF,0xDBD6,0x9ACE,0x5DEF,0xDFFF,0x169D,0xA708,0xCB31,
-  0x6F63,0x6E63,0xD073,0xF073,0x8F6B,0xD073,0xF073,0x3184,0xD073,0x2B3A,0xE810,0x6B21,
-  0x6B21,0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B19,0x6B21,0x4A19,0xC808,0x6500,0x2400,
-  0x0400,0xA710,0x6721,0xE839,0x4D6B,0x9394,0x906B,0x5184,0xBEF7,0x9ACE,0x2819,0xE908,
-  0x7ACE,0xFFFF,0xB494,0x4400,0x2721,0xD7BD,0xFFFF,0x5284,0x317C,0x5DE7,0xFFFF,0x3DE7,
-  0xED52,0xBBD6,0xFFFF,0x327C,0x8700,0x6B21,0x8B21,0x0911,0xAA29,0xEE52,0x0C3A,0x6500,
-  0x0300,0x2300,0xC418,0x494A,0x4E63,0x4A42,0xE739,0x96AD,0xFFFF,0x369D,0x8708,0x4B42,
-  0x4E63,0xCD52,0xAC4A,0xED52,0x0D5B,0x2D63,0x4E63,0xAF6B,0xCC52,0x6921,0x0911,0x6A21,
-  0x6B21,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0xC610,0xE710,0x4919,0xAC21,0xCD29,0x8C21,
-  0x4A19,0x2A11,0x6600,0x0200,0x0300,0x4400,0x8608,0xE939,0xEF7B,0x2E63,0xC808,0xC808,
-  0x8F73,0xBEF7,0x9EF7,0x369D,0xD8B5,0xFFFF,0xDBD6,0xAC4A,0x76AD,0xFFFF,0x7DEF,0x5DE7,
-  0xF7B5,0xBFFF,0xD8B5,0xAA29,0xC810,0x8B21,0x8B21,0xA808,0xB06B,0xBAD6,0x78AD,0x2919,
-  0x2819,0xC931,0xA629,0x6208,0x0100,0x0400,0x0200,0x6729,0xEF7B,0xEE5A,0x0911,0x2A42,
-  0x8B4A,0x6B42,0x0A3A,0x0A3A,0x4B42,0x6B4A,0x8C4A,0x0D5B,0x2A42,0x2919,0x2A19,0x6A19,
-  0x4A19,0x4308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4208,0x8408,0xC610,0x0811,
-  0x4A19,0x4A21,0xAC21,0xCC29,0x6B21,0x0911,0x2919,0x4400,0x0100,0xA608,0x8B21,0x0811,
-  0xC510,0x728C,0xFBDE,0xBEF7,0x9EF7,0x59CE,0xAC52,0xAF6B,0x5DEF,0xFCDE,0xF49C,0xDFF7,
-  0xFFFF,0xDFFF,0xB16B,0x8700,0x6B19,0x4A19,0x0911,0x2819,0xB7B5,0xFFFF,0xB7B5,0x0A3A,
-  0xD494,0x5DDF,0x9DE7,0xB7B5,0x4F63,0x8B21,0x8C21,0x6308,0x0000,0x8500,0x8B21,0x8829,
-  0x8929,0x8929,0xC931,0xC931,0xC931,0xEA31,0xEA31,0x6B42,0x0A3A,0x4919,0x2B19,0x6B19,
-  0xE810,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x4208,0x8408,0xC610,0x0811,0x6A21,0x8B21,0x6B21,0x8B21,0x8B21,0x4A19,0x4B19,0x6B19,
-  0xC608,0x0200,0x6729,0x0D5B,0xCC52,0x0621,0x2400,0xB7B5,0xDFF7,0x5284,0x6C4A,0xFFFF,
-  0xFFFF,0x59C6,0x2B3A,0x8700,0x8B21,0xC908,0x4700,0x2E5B,0x7DEF,0x9ACE,0x6E63,0xB6AD,
-  0xFFFF,0x7DEF,0x1CE7,0xFFFF,0x9DEF,0x6E63,0x8700,0xAD4A,0xCF73,0x6C42,0x2911,0x0819,
-  0x0811,0x2919,0x4821,0x6821,0x6921,0x8929,0xC931,0xC939,0x6921,0x2919,0x4A19,0x6B21,
-  0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x4208,0xA410,0xE610,0x0911,0x4A19,0x6B19,0x6B21,0x6B21,
-  0x6B21,0x0811,0x6500,0x4400,0x6500,0xA708,0x0819,0xEA39,0x2D63,0xA929,0xEA31,0x9EEF,
-  0xFFFF,0x3184,0xC708,0x0911,0x6C42,0x6B42,0x4919,0x76A5,0xFFFF,0x56A5,0xD073,0xFFFF,
-  0x3CDF,0x2942,0x8410,0xF49C,0xFFFF,0xB7AD,0xE710,0x77AD,0xDFFF,0xD594,0xC708,0x8C4A,
-  0xF073,0x4C42,0xE810,0xA708,0xC710,0x2819,0x6929,0x6921,0x4919,0x4A19,0x4A19,0x4A19,
-  0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2100,0x4200,0x8408,0xC510,0xE710,
-  0x4A19,0x8B21,0x6B19,0x4A19,0x2A19,0x6A21,0x4A19,0x8508,0x8508,0xC810,0x0719,0xE839,
-  0x2E63,0x0B3A,0xA808,0x4919,0x7284,0x7EEF,0xFCDE,0xDFFF,0xDBD6,0xD073,0xD494,0xFFFF,
-  0x7384,0x2300,0x0100,0x938C,0xFFFF,0xD7B5,0x8C4A,0xDBDE,0xDEF7,0x8C42,0x6500,0x18BE,
-  0x9DEF,0xB06B,0x4B3A,0x7284,0x117C,0x4921,0xE810,0x8708,0xA808,0x2A19,0x6A19,0x4A19,
-  0x6B21,0xC610,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x6300,0x8508,0xE710,0x4919,0x6A21,0x6B21,0x6B21,0x4A19,0x2A19,0x4B19,0x0911,0x2300,
-  0x6500,0x0911,0x6B19,0xE810,0x2942,0x96B5,0x7DEF,0xFBD6,0x4E63,0x4721,0xF59C,0xFFFF,
-  0xF8BD,0x4B42,0x6F63,0x1CE7,0xBEF7,0x117C,0xF494,0x9EF7,0xFFFF,0x97AD,0xF494,0xFFFF,
-  0x9EF7,0x4B42,0xD073,0x9DEF,0x9AD6,0x8C42,0x0A32,0x7384,0x906B,0x6A21,0x0A11,0x6B19,
-  0x4B19,0x8308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x2100,0x6308,0xA508,0xE710,0x4919,0x8B21,0x6B21,0x6B21,0x8B21,
-  0x4A19,0x4B19,0x8B21,0x0911,0x4400,0xE418,0x4A42,0x6A42,0x0811,0x4500,0x8B4A,0xB9DE,
-  0xFFFF,0x1CDF,0xDFF7,0xFFFF,0x159D,0xAC4A,0xFBD6,0xDFFF,0x9ACE,0xFBDE,0xFFFF,0xFFFF,
-  0xD394,0xC931,0x76AD,0xFFFF,0xFCDE,0x6F63,0x928C,0xFFFF,0x96AD,0x2819,0x0A11,0x6B21,
-  0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x8408,0xA510,0xE710,0x2919,
-  0x8B21,0x6A21,0x4A19,0x8B21,0x6B21,0xA608,0x0200,0x0400,0x4A19,0x2911,0x6408,0x6852,
-  0x55AD,0xDBDE,0x9AD6,0x117C,0xC929,0xF17B,0xFFFF,0x59C6,0x093A,0xB073,0xFFFF,0x7DEF,
-  0x0A3A,0xF073,0x5CE7,0xFFFF,0xFCDE,0xF494,0xFCDE,0xBEF7,0xD173,0xA708,0x6B21,0x6B21,
-  0xC610,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x6208,0xA510,0xE710,0x0919,0x4A19,0xAC21,0xAC21,0xCC29,0x6B21,0x6B21,0x2919,0x2300,
-  0x2200,0x8508,0x8508,0x0200,0x0719,0xF49C,0x1CE7,0x4F63,0x0400,0xF27B,0xFFFF,0xF8B5,
-  0x2821,0xF8BD,0xFFFF,0xBBD6,0x1CDF,0x7DEF,0xFFFF,0xD6B5,0xCA29,0x8800,0xAC21,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x6308,0xC510,0x0711,0x4919,0x6A21,0x6B21,0x6B21,0x6B21,
-  0x0811,0xC708,0xC708,0x2A19,0x2919,0xA310,0x0619,0xE810,0x6921,0xF494,0x7AC6,0x4E63,
-  0x8F6B,0xDFF7,0xD7B5,0xD06B,0x9ACE,0xFFFF,0xFFFF,0x4F63,0xC808,0x4A19,0x8B21,0xE810,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2100,0x6308,0xA508,0xE710,0x6A21,
-  0x6B21,0x6B21,0x6B21,0x8C21,0x6B19,0xC708,0x8600,0x0911,0x2819,0x2521,0x2621,0x2819,
-  0xEC5A,0xD6BD,0xCD52,0x0A3A,0xDBD6,0xFFFF,0xBAD6,0xAA29,0x8700,0xAC21,0x4A19,0xA508,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4208,
-  0x8308,0xA610,0xE710,0x0819,0x4A19,0x8C21,0x8C21,0x8C21,0x2A19,0x8608,0x6500,0x0911,
-  0xC518,0x4529,0x0719,0x0819,0x2E63,0x55A5,0x8F6B,0x4919,0x0911,0x8C21,0x0819,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0x4208,0x8408,0xA510,0xE710,0x0819,0x6A21,0xAC29,0xAD29,0x8B21,
-  0xE810,0x4500,0x0919,0x0811,0x4400,0x2621,0x4821,0x4A19,0x6B19,0x6A19,0xC610,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x8408,0xC610,0xE710,0x2919,
-  0x8B21,0xCD29,0x8C21,0x6B21,0x2919,0x8600,0x2919,0x4A21,0x6B21,0x2919,0x6308,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,
-  0x6308,0xC610,0x0819,0x2919,0x6B21,0xAC21,0x8B21,0x4A19,0x6B21,0xC710,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0x4200,0x8408,0xC510,0xE810,0x4A19,0x2919,0x6308,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4200,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// Keyframe: 3741 bytes
+static const uint8_t spaceman_key_rle[3741] PROGMEM = {
+  0xBF,0x00,0xB5,0x00,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,
+  0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,
+  0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,
+  0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,
+  0xBF,0x00,0xF6,0xFA,0x00,0x10,0xFB,0xF3,0x80,0x01,0x01,0x21,0x87,0x02,0x81,0x01,
+  0xF3,0xEE,0x80,0x01,0x94,0x02,0x00,0x10,0xEF,0xEB,0x80,0x01,0x9A,0x02,0x00,0x10,
+  0xEC,0xE9,0x00,0x10,0x8C,0x02,0x00,0x60,0xC2,0x00,0x60,0x8C,0x02,0x80,0x01,0xE9,
+  0xE7,0x00,0x10,0x88,0x02,0x01,0x62,0x82,0x06,0x81,0x07,0x01,0x67,0x82,0x06,0x01,
+  0x26,0x88,0x02,0x80,0x01,0xE7,0xE5,0x80,0x01,0x86,0x02,0x02,0x64,0x60,0x8F,0x07,
+  0x80,0x06,0x88,0x02,0x00,0x10,0xE6,0xE4,0x00,0x10,0x86,0x02,0x80,0x06,0x87,0x07,
+  0x00,0x60,0xC1,0x00,0x60,0x89,0x07,0x00,0x60,0x87,0x02,0xE5,0xE3,0x86,0x02,0x00,
+  0x60,0x84,0x07,0x8F,0x06,0x84,0x07,0x00,0x60,0x86,0x02,0x00,0x10,0xE3,0xE1,0x00,
+  0x10,0x85,0x02,0x00,0x60,0x83,0x07,0x82,0x06,0x02,0x7E,0xA0,0x87,0x0B,0x81,0x0A,
+  0x82,0x06,0x83,0x07,0x00,0x60,0x86,0x02,0xE2,0xE0,0x00,0x10,0x84,0x02,0x00,0x60,
+  0x83,0x07,0x81,0x06,0x00,0xA0,0x91,0x0B,0x00,0xA0,0x81,0x06,0x83,0x07,0x00,0x60,
+  0x85,0x02,0xE1,0xDF,0x00,0x10,0x83,0x02,0x80,0x06,0x82,0x07,0x81,0x06,0x85,0x0B,
+  0x80,0x0D,0x84,0x0C,0x81,0x0D,0x85,0x0B,0x00,0xD0,0x80,0x06,0x82,0x07,0x80,0x06,
+  0x84,0x02,0xE0,0xDE,0x85,0x02,0x82,0x07,0x81,0x06,0x83,0x0B,0x00,0xD0,0x8F,0x0C,
+  0x00,0xD0,0x83,0x0B,0x81,0x06,0x82,0x07,0x85,0x02,0xDF,0xDD,0x00,0x10,0xC4,0x00,
+  0x60,0x81,0x07,0x81,0x06,0x00,0xE0,0x81,0x0B,0x00,0xE0,0x86,0x0C,0x85,0x0D,0x86,
+  0x0C,0x00,0xD0,0x82,0x0B,0x80,0x06,0x82,0x07,0x00,0x60,0x84,0x02,0xDE,0xDC,0x00,
+  0x10,0x83,0x02,0x00,0x60,0x81,0x07,0x80,0x06,0x00,0x70,0x82,0x0B,0x83,0x0C,0x80,
+  0x0D,0x02,0x6A,0x70,0x81,0x05,0x80,0x07,0x00,0x60,0x80,0x07,0x01,0xD7,0x80,0x0D,
+  0x83,0x0C,0x00,0xD0,0x81,0x0B,0x00,0xA0,0x80,0x06,0x81,0x07,0x00,0x60,0x84,0x02,
+  0xDD,0xDB,0x00,0x10,0x80,0x02,0x00,0x40,0xC1,0x00,0x60,0x81,0x07,0x80,0x06,0x00,
+  0xE0,0x81,0x0B,0x83,0x0C,0x05,0xD6,0x7A,0x96,0x80,0x08,0xC1,0x80,0x08,0x03,0xA6,
+  0xA6,0x81,0x07,0x01,0xED,0x83,0x0C,0x81,0x0B,0x00,0xE0,0x80,0x06,0x81,0x07,0x00,
+  0x50,0xC4,0x00,0x10,0xDC,0xDA,0x00,0x10,0x80,0x02,0x00,0x40,0x80,0x02,0x00,0x60,
+  0x81,0x07,0x80,0x06,0x81,0x0B,0x00,0xD0,0x82,0x0C,0x01,0xDE,0x80,0x07,0x01,0xD6,
+  0x80,0x08,0x05,0xA9,0xA8,0x59,0x82,0x08,0x82,0x06,0x02,0x7E,0xD0,0x83,0x0C,0x81,
+  0x0B,0x80,0x06,0x81,0x07,0x00,0x60,0x83,0x02,0x00,0x10,0xDB,0xDB,0x00,0x40,0x81,
+  0x02,0x00,0x50,0x81,0x07,0x80,0x06,0x81,0x0B,0x82,0x0C,0x02,0xDE,0x70,0x81,0x06,
+  0x00,0x90,0x80,0x08,0x80,0x0A,0x01,0xB9,0xC1,0x08,0x8A,0x85,0x89,0x85,0x40,0x80,
+  0x06,0x80,0x07,0x00,0xE0,0x82,0x0C,0x81,0x0B,0x01,0x96,0x81,0x07,0x00,0x50,0x83,
+  0x02,0xDB,0xD9,0x00,0x10,0x82,0x02,0x00,0x60,0x81,0x07,0x80,0x06,0x81,0x0B,0x82,
+  0x0C,0x01,0xE7,0x80,0x06,0x0A,0x35,0x8A,0x8A,0xBD,0xAD,0xA0,0x81,0x08,0x00,0xB0,
+  0x81,0x08,0x01,0xA5,0x80,0x01,0x01,0x36,0x80,0x07,0x01,0xED,0x81,0x0C,0x81,0x0B,
+  0x80,0x06,0x81,0x07,0x00,0x40,0xC1,0x02,0x42,0x10,0xDA,0xD8,0x02,0x13,0x40,0xC1,
+  0x00,0x30,0x81,0x07,0x80,0x06,0x81,0x0B,0x81,0x0C,0x00,0xD0,0x80,0x07,0x01,0x64,
+  0x80,0x01,0x0C,0x8A,0x58,0xB9,0xAB,0x98,0xA5,0x90,0x80,0x0A,0x83,0x08,0x00,0x40,
+  0x80,0x01,0x00,0x20,0x80,0x06,0x01,0x7D,0x81,0x0C,0x81,0x0B,0x01,0x96,0x81,0x07,
+  0x00,0x30,0x81,0x02,0x01,0x41,0xD9,0xD9,0x00,0x20,0xC1,0x00,0x40,0x81,0x07,0x01,
+  0x56,0x81,0x0B,0x81,0x0C,0x01,0xD7,0x80,0x06,0x00,0x10,0x80,0x02,0x81,0x08,0xC1,
+  0x02,0x9A,0x90,0x82,0x08,0x00,0x50,0x80,0x08,0x00,0xB0,0xC4,0x00,0x50,0x81,0x02,
+  0x00,0x10,0xC1,0x01,0x7D,0x81,0x0C,0x81,0x0B,0x80,0x06,0x81,0x07,0x82,0x02,0xDA,
+  0xD7,0x00,0x10,0x80,0x04,0x80,0x02,0x00,0x50,0xC2,0x01,0x6A,0xC1,0x81,0x0C,0x03,
+  0xD7,0x64,0x81,0x02,0x00,0x40,0x83,0x05,0x80,0x08,0x01,0x58,0x81,0x05,0x01,0x8A,
+  0x86,0x08,0x00,0x30,0x81,0x02,0x01,0x14,0x80,0x07,0x00,0xD0,0x81,0x0C,0x81,0x0B,
+  0xC3,0x00,0x50,0xC1,0x02,0x42,0x10,0xD8,0xD7,0x00,0x30,0x81,0x02,0x00,0x30,0x81,
+  0x07,0x01,0x6A,0x80,0x0B,0x81,0x0C,0x04,0xD7,0x65,0x10,0xC2,0x82,0x05,0x80,0x0B,
+  0x02,0xAB,0xA0,0x83,0x0B,0x01,0xEB,0x80,0x0A,0xC1,0x00,0x50,0xC1,0x00,0x50,0x83,
+  0x02,0x03,0x46,0x7D,0x81,0x0C,0xC1,0x01,0xA6,0x81,0x07,0x00,0x10,0xDC,0xD6,0x00,
+  0x10,0x80,0x04,0x02,0x23,0x50,0xC1,0x80,0x06,0x81,0x0B,0xC1,0x03,0xD7,0x64,0x82,
+  0x02,0x01,0x48,0xC1,0x00,0xA0,0x80,0x0E,0x00,0xF0,0x87,0x0E,0x00,0xB0,0x80,0x0A,
+  0x80,0x08,0x00,0xA0,0x80,0x05,0x84,0x02,0x80,0x06,0x01,0x7D,0x81,0x0C,0x80,0x0B,
+  0x01,0xD6,0xC1,0x00,0x50,0x80,0x02,0x01,0x43,0xD8,0xD6,0x01,0x32,0xC2,0x81,0x07,
+  0x00,0x60,0x81,0x0B,0x81,0x0C,0x80,0x07,0x01,0x61,0xC4,0x00,0xA0,0xC1,0x8C,0x0E,
+  0x00,0xB0,0x80,0x0A,0x04,0x85,0x83,0x40,0x84,0x02,0x00,0x50,0x80,0x07,0x00,0xD0,
+  0xC3,0x00,0xB0,0xC2,0x00,0x70,0x80,0x03,0x80,0x02,0x00,0x10,0xD7,0xD5,0x00,0x10,
+  0xC1,0x02,0x31,0x50,0xC1,0x01,0x6A,0xC1,0x81,0x0C,0x03,0xE7,0x61,0x83,0x02,0x00,
+  0x40,0x80,0x05,0x01,0xAB,0x8C,0x0E,0x01,0x7B,0x82,0x05,0x00,0x10,0x85,0x02,0x02,
+  0x67,0xE0,0x81,0x0C,0xC1,0x01,0x96,0xC1,0x04,0x51,0x24,0x30,0xD7,0xD6,0x80,0x04,
+  0x01,0x24,0x81,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,0xC1,0x02,0xD7,0x60,0x85,0x02,
+  0x01,0x48,0xC1,0x8C,0x0E,0x00,0xB0,0x80,0x0A,0xC2,0x80,0x03,0x86,0x02,0x02,0x67,
+  0x60,0xC1,0x00,0xD0,0x80,0x0B,0xC2,0x05,0x75,0x42,0x41,0xD6,0xD4,0x05,0x14,0x23,
+  0x25,0xC1,0x01,0x6A,0xC1,0x81,0x0C,0x02,0x76,0x40,0xC7,0x80,0x05,0xC3,0x00,0xB0,
+  0xC5,0x02,0xBE,0xB0,0x80,0x0E,0x02,0x7B,0xA0,0x81,0x05,0x00,0x10,0xC7,0x03,0x47,
+  0xED,0x80,0x0C,0xC1,0x01,0x96,0x81,0x07,0xDA,0xD6,0x02,0x32,0x30,0x81,0x07,0x00,
+  0x60,0x81,0x0B,0xC1,0x00,0xE0,0xC1,0x84,0x02,0x00,0x60,0x80,0x02,0xC5,0x00,0xF0,
+  0xC1,0x00,0xB0,0x83,0x0E,0x00,0xF0,0x82,0x0E,0x04,0x9A,0x85,0x30,0x87,0x02,0x02,
+  0x67,0x60,0xC1,0x00,0xD0,0x80,0x0B,0xC3,0x80,0x03,0x02,0x43,0x10,0xD5,0xD6,0x80,
+  0x04,0x00,0x50,0xC1,0x80,0x06,0xC1,0x81,0x0C,0x02,0x76,0x40,0x87,0x02,0xC5,0x00,
+  0xD0,0x83,0x0E,0x01,0xBE,0x80,0x0D,0x00,0x90,0x82,0x0D,0x01,0x8A,0xC1,0x00,0x30,
+  0xC3,0x00,0x60,0x82,0x02,0x80,0x07,0x00,0xD0,0x80,0x0C,0xC1,0x01,0x96,0xC2,0x02,
+  0x12,0x40,0x95,0x00,0xD4,0x00,0x20,0xC1,0x00,0x80,0xC3,0x00,0xA0,0xC3,0x00,0xE0,
+  0xC1,0x81,0x02,0x00,0x40,0xC5,0x02,0x35,0x90,0x80,0x0D,0x82,0x09,0x00,0xD0,0x81,
+  0x0E,0x01,0xDA,0x82,0x05,0x00,0x90,0x80,0x0A,0x81,0x05,0x87,0x02,0x80,0x06,0x01,
+  0x7E,0xC1,0x02,0xDB,0xA0,0xC2,0x04,0x52,0x42,0x30,0xD5,0xD3,0x02,0x13,0x40,0x80,
+  0x01,0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x02,0x76,0x40,0x83,0x02,0x00,0x40,
+  0xC5,0x01,0xAD,0x80,0x0A,0x82,0x05,0x02,0x9D,0x90,0x80,0x0A,0x01,0xB7,0xC1,0x00,
+  0x80,0xC3,0x00,0x30,0xC7,0x01,0x62,0x80,0x06,0x00,0x70,0x81,0x0C,0x80,0x0B,0xC2,
+  0x04,0x71,0x43,0x20,0x80,0x01,0xD3,0xD5,0x80,0x02,0x00,0x30,0xC1,0x01,0x6A,0xC4,
+  0x01,0xE6,0x80,0x02,0x02,0x42,0x40,0x84,0x02,0xC2,0x00,0x80,0x81,0x0B,0x07,0x78,
+  0x58,0xDA,0x57,0x80,0x0B,0x01,0x75,0x81,0x0A,0xC1,0x80,0x01,0x02,0x24,0x60,0x85,
+  0x02,0xC1,0x00,0xD0,0xC3,0x00,0x90,0xC3,0x01,0x32,0x81,0x04,0x00,0x30,0xD2,0xD4,
+  0x80,0x04,0x01,0x35,0xC7,0x02,0xD7,0xD0,0x83,0x02,0x02,0x42,0x60,0xC2,0x07,0x15,
+  0x8A,0x5B,0x7B,0x82,0x0A,0x04,0xB8,0x5A,0xB0,0x83,0x0A,0xC1,0x04,0x38,0x9C,0x40,
+  0xC8,0x00,0xE0,0xC3,0x01,0xA6,0xC1,0x07,0x51,0x31,0x24,0x23,0xD1,0xD3,0x00,0x30,
+  0x81,0x02,0xC5,0x00,0xD0,0xC1,0x00,0x70,0x80,0x06,0xC1,0x02,0x42,0x40,0x82,0x02,
+  0x81,0x04,0x80,0x05,0x03,0xB7,0x5A,0xC1,0x01,0x75,0x80,0x0E,0x00,0x70,0x80,0x05,
+  0x02,0x7A,0x70,0xC4,0x05,0x8C,0xFD,0xCD,0x80,0x06,0xC3,0x00,0x40,0x80,0x07,0xC1,
+  0x00,0xD0,0x80,0x0B,0xC3,0x02,0x58,0x40,0x80,0x03,0x01,0x42,0xD1,0xD2,0x02,0x32,
+  0x40,0x80,0x03,0xC3,0x80,0x0B,0x81,0x0C,0x01,0xE7,0x80,0x02,0x04,0x42,0x42,0x40,
+  0x82,0x02,0x08,0x46,0x85,0xAE,0x7A,0x70,0x80,0x0A,0x00,0xB0,0xC1,0x02,0xB7,0x50,
+  0x81,0x0A,0x01,0xB7,0x81,0x05,0x06,0x9D,0xF9,0xDF,0xD0,0x80,0x0C,0x01,0x64,0x80,
+  0x02,0xC1,0x00,0xD0,0x80,0x0C,0xC4,0x00,0x70,0x80,0x0E,0x04,0x53,0x24,0x30,0xD1,
+  0xD1,0x05,0x12,0x43,0x25,0x81,0x07,0xC5,0x03,0x76,0x24,0x81,0x02,0x00,0x40,0x80,
+  0x02,0x00,0x60,0x81,0x04,0x80,0x0D,0x00,0x80,0xC1,0x00,0xB0,0x80,0x0A,0x01,0x5B,
+  0x82,0x0E,0x00,0xA0,0x80,0x0B,0x03,0xEB,0xAB,0xC2,0x82,0x0D,0x02,0x9C,0xD0,0x80,
+  0x0F,0x04,0xDC,0x42,0x60,0xC6,0x09,0x67,0xBE,0xB7,0x13,0x42,0xD1,0xD1,0x00,0x30,
+  0x80,0x04,0x03,0x23,0x8A,0xC6,0x00,0xE0,0xC2,0x03,0x24,0x24,0x80,0x02,0x80,0x04,
+  0x05,0x9D,0x9C,0xD9,0xC1,0x80,0x0E,0x02,0xAB,0xA0,0xC1,0x01,0xB7,0x81,0x0A,0x80,
+  0x0E,0x01,0x7A,0xC1,0x02,0x89,0x80,0x85,0x0D,0x03,0xFD,0x94,0xC3,0x00,0xD0,0xC1,
+  0x00,0xD0,0x80,0x07,0x80,0x0A,0x00,0x70,0x80,0x01,0x80,0x04,0x00,0x30,0xD1,0xD2,
+  0x03,0x24,0x15,0x80,0x0A,0x02,0xB6,0xA0,0xC3,0x00,0xD0,0xC2,0x05,0x42,0x42,0x46,
+  0x80,0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x80,0x0D,0x00,0x90,0xC1,0x82,0x0A,0x02,
+  0x7A,0x70,0x83,0x0A,0x00,0xB0,0x80,0x0A,0x81,0x05,0x00,0x80,0x80,0x0D,0x00,0xC0,
+  0xC3,0x81,0x0F,0x06,0xD6,0xD7,0xEC,0xE0,0xC1,0x01,0xA6,0x81,0x0A,0x05,0x51,0x34,
+  0x21,0xD1,0xD2,0x80,0x04,0x06,0x25,0xE7,0xB7,0x60,0xC3,0x00,0xE0,0xC2,0x01,0x24,
+  0x80,0x02,0x00,0x60,0x87,0x0D,0x0B,0x9A,0xEB,0xA8,0xDE,0xAB,0xED,0xC1,0x00,0xE0,
+  0x82,0x0A,0x02,0x58,0xC0,0x84,0x0D,0x02,0xCD,0xF0,0x80,0x0D,0x80,0x06,0x01,0x7F,
+  0x80,0x0D,0x81,0x0B,0x04,0xAE,0xA5,0x10,0x80,0x03,0x01,0x41,0x91,0x00,0xD1,0x04,
+  0x12,0x41,0x30,0x80,0x0A,0x02,0x7A,0xD0,0xC3,0x00,0xD0,0x80,0x06,0x82,0x02,0x01,
+  0x6C,0xC1,0x01,0xCD,0x80,0x0F,0x82,0x0D,0xC1,0x00,0xE0,0x81,0x0A,0x82,0x0D,0x00,
+  0x90,0x80,0x0E,0x82,0x0A,0x02,0x5A,0xD0,0x81,0x0F,0x01,0xDF,0x83,0x0D,0x03,0xCD,
+  0xC9,0x80,0x0E,0x80,0x0C,0xC1,0x00,0xA0,0x80,0x0E,0x01,0x73,0xC1,0x01,0x42,0x92,
+  0x00,0xD2,0x08,0x34,0x21,0x5B,0x7E,0xA0,0xC1,0x03,0xDC,0xE7,0xC1,0x80,0x04,0x00,
+  0x60,0x81,0x0D,0x01,0xFD,0x83,0x0F,0xC1,0x03,0x9A,0xEB,0x80,0x0E,0x03,0xDA,0xDA,
+  0x80,0x0E,0x00,0xB0,0x83,0x0A,0x00,0xE0,0xC3,0x80,0x0F,0x85,0x0D,0x01,0xFD,0xC3,
+  0x01,0xEA,0x80,0x0E,0x06,0x75,0x13,0x43,0x10,0xD3,0x91,0x00,0x01,0x32,0x80,0x03,
+  0x03,0x5E,0xA7,0xC1,0x00,0xE0,0xC1,0x00,0xD0,0xC2,0x02,0x29,0xF0,0xC1,0x00,0xF0,
+  0x82,0x0D,0xC4,0x00,0xD0,0x80,0x0A,0x82,0x0E,0x00,0xA0,0x82,0x0E,0x82,0x0A,0x00,
+  0x50,0x80,0x0A,0x81,0x0D,0xC2,0x00,0xC0,0xC5,0x00,0x90,0x80,0x0E,0x81,0x0D,0x00,
+  0x70,0xC1,0x00,0xB0,0x80,0x05,0xC2,0x00,0x10,0x93,0x00,0xD2,0x01,0x14,0x80,0x02,
+  0x04,0x3A,0xEA,0x60,0x80,0x0B,0x80,0x0D,0x00,0xE0,0xC2,0x01,0x59,0x85,0x0D,0x80,
+  0x0F,0x00,0xD0,0x80,0x0F,0x00,0xC0,0x80,0x0D,0x01,0x8A,0x82,0x0E,0x00,0xB0,0xC5,
+  0x04,0x5B,0xAE,0xD0,0x80,0x0F,0x01,0xDF,0x85,0x0D,0x01,0x9A,0xC1,0x08,0xAD,0xEA,
+  0xBA,0x73,0x00,0x80,0x04,0x00,0x20,0x94,0x00,0xD3,0x04,0x34,0x31,0x70,0x80,0x0E,
+  0x01,0x7E,0xC2,0x01,0xDE,0xC2,0x04,0xAE,0x9D,0xF0,0xC1,0x81,0x0F,0x02,0xCD,0xF0,
+  0x82,0x0D,0x80,0x0A,0xC2,0x80,0x0A,0x02,0xEB,0x70,0xC1,0x00,0x70,0x81,0x0A,0x01,
+  0xFD,0xC1,0x84,0x0D,0x02,0xFC,0xA0,0x83,0x0E,0x01,0xA7,0x80,0x0A,0x04,0x50,0x42,
+  0x30,0x95,0x00,0xD3,0x04,0x14,0x21,0x50,0x82,0x0E,0xC2,0x06,0xE7,0x64,0x6E,0xA0,
+  0x82,0x0D,0x82,0x0F,0x80,0x0D,0xC4,0x03,0x95,0xAB,0xC3,0x80,0x0A,0x04,0x8A,0xB7,
+  0xB0,0x80,0x0D,0x01,0xFD,0x82,0x0F,0x04,0xDF,0xCD,0x90,0xC6,0x07,0xAB,0x50,0x34,
+  0x31,0xD6,0x92,0x00,0xC1,0x06,0x43,0x5B,0xE7,0xB0,0x80,0x0E,0x00,0xF0,0x80,0x0E,
+  0x02,0x74,0xE0,0x80,0x0A,0x00,0xC0,0xC1,0x82,0x0F,0x02,0xDF,0xC0,0xC3,0x04,0xF9,
+  0xA7,0x80,0x83,0x0A,0x01,0x57,0x82,0x0A,0x01,0xDF,0x80,0x0D,0x08,0xFC,0xFD,0xFC,
+  0xD9,0xA0,0x82,0x0E,0x02,0xB7,0xB0,0x80,0x07,0x80,0x01,0x02,0x42,0x10,0x96,0x00,
+  0xD5,0x80,0x02,0x01,0x1A,0x80,0x0E,0x00,0xA0,0x83,0x0E,0x01,0x7A,0xC1,0x00,0x90,
+  0x82,0x0D,0x00,0xC0,0xC1,0x07,0xCD,0xFD,0xFD,0xCD,0xC1,0x0D,0xA5,0xA8,0xA8,0x7A,
+  0xBA,0xB7,0xAF,0x80,0x0D,0x01,0xFC,0x80,0x0D,0x04,0xFC,0xD9,0xA0,0x82,0x0E,0x04,
+  0xBE,0xA7,0xA0,0x80,0x01,0x80,0x04,0x00,0x30,0x97,0x00,0x93,0x00,0x05,0x34,0x31,
+  0x5A,0x88,0x0E,0xC2,0x06,0x9D,0xFD,0xCD,0xF0,0x81,0x0D,0x00,0xC0,0x80,0x0D,0x00,
+  0x90,0x82,0x0A,0x03,0x75,0xA5,0x80,0x0A,0x03,0x7A,0x7A,0x80,0x0D,0x01,0xFC,0x87,
+  0x0D,0xC2,0x09,0xBE,0x7B,0xA0,0x13,0x42,0x98,0x00,0xD4,0x01,0x14,0x80,0x02,0x00,
+  0x30,0xCD,0x02,0xC9,0xC0,0x86,0x0D,0x05,0x9C,0x98,0xA7,0x81,0x0A,0x09,0x7B,0xA5,
+  0xB7,0x89,0xDF,0x83,0x0D,0x00,0xC0,0xC2,0x0A,0x9B,0xEB,0xEA,0x7E,0x71,0x00,0x80,
+  0x04,0x01,0x31,0xD9,0xD6,0x03,0x43,0x15,0xC8,0x01,0x79,0x81,0x0D,0x80,0x09,0x01,
+  0xC9,0xC2,0x00,0xC0,0xC2,0x0E,0xD8,0xA7,0x5B,0x5A,0x57,0x5A,0x5A,0x80,0x83,0x0D,
+  0x03,0xCD,0x9D,0x80,0x09,0x03,0xC9,0xAE,0x81,0x0A,0x03,0xB7,0x50,0x81,0x04,0x00,
+  0x10,0x99,0x00,0x94,0x00,0x00,0x20,0x80,0x04,0x02,0x25,0xA0,0xC6,0x80,0x0A,0xC3,
+  0x00,0xC0,0x82,0x09,0x05,0xC9,0xD9,0xDC,0x81,0x08,0x02,0xA5,0xA0,0xC2,0x00,0xB0,
+  0xC2,0x01,0x89,0xC3,0x05,0xC9,0x89,0x8C,0x81,0x09,0x07,0xAB,0x7B,0x7B,0x51,0x80,
+  0x03,0x01,0x21,0x9A,0x00,0xD5,0x02,0x14,0x30,0xC1,0x01,0x7B,0xC3,0x01,0xBA,0x80,
+  0x0E,0x00,0xD0,0x80,0x09,0x00,0xD0,0x83,0x09,0x00,0x60,0x80,0x09,0x00,0xC0,0x81,
+  0x09,0x00,0x80,0x89,0x05,0x03,0x9D,0x9C,0x80,0x09,0x80,0x08,0x00,0x40,0xC1,0x07,
+  0x98,0xCD,0xA7,0xB7,0x80,0x0A,0x04,0x93,0x24,0x30,0xDC,0xD9,0x0C,0x15,0xAB,0xAB,
+  0x7A,0xED,0xF9,0x80,0x81,0x09,0x0A,0xC6,0x94,0x94,0x94,0x98,0x40,0xC6,0x00,0xA0,
+  0xC4,0x81,0x08,0x80,0x04,0x09,0x84,0x94,0xC4,0x89,0xDE,0x82,0x0A,0x80,0x0D,0x03,
+  0x41,0x42,0x9B,0x00,0x95,0x00,0x07,0x24,0x31,0x37,0xA7,0x80,0x0A,0x00,0xD0,0xC1,
+  0x00,0xD0,0x80,0x04,0x00,0x80,0x80,0x04,0x01,0x84,0xC3,0x00,0x80,0x82,0x04,0x01,
+  0x83,0xC4,0x00,0x30,0xC1,0x06,0x38,0x34,0x34,0x80,0xC2,0x83,0x04,0x00,0x80,0x81,
+  0x0F,0x00,0xA0,0x80,0x0D,0x06,0xF9,0x23,0x43,0x10,0xDB,0xD6,0x00,0x10,0x80,0x04,
+  0x03,0x23,0x5B,0x80,0x0A,0x83,0x0D,0x00,0xC0,0x80,0x04,0x00,0x80,0x8A,0x04,0x84,
+  0x03,0x00,0x10,0x85,0x03,0x87,0x04,0x04,0x83,0x4C,0xF0,0x82,0x0D,0x05,0xC8,0x32,
+  0x42,0x9B,0x00,0x96,0x00,0x01,0x24,0x80,0x03,0x00,0x50,0x80,0x09,0x81,0x0D,0x01,
+  0x9C,0x80,0x0D,0x02,0x82,0x40,0x80,0x0D,0x02,0x94,0xC0,0x85,0x0D,0x01,0x34,0x80,
+  0x0D,0x01,0x81,0x80,0x0D,0x00,0x80,0xC2,0x00,0x40,0x80,0x0D,0x00,0x40,0x81,0x03,
+  0x00,0x90,0x80,0x0D,0x00,0x40,0x80,0x03,0x05,0x4D,0xFC,0xDC,0x80,0x0D,0x01,0x92,
+  0x81,0x03,0xDC,0xD7,0x06,0x32,0x41,0x39,0xD0,0x81,0x09,0x02,0xCD,0xE0,0xC1,0x03,
+  0x13,0xDF,0xC1,0x80,0x0F,0x00,0x90,0x80,0x0F,0x00,0x90,0x80,0x0F,0x05,0x39,0xFD,
+  0x38,0x80,0x0F,0x00,0xD0,0xC3,0x80,0x0F,0xC3,0x81,0x0F,0x01,0x81,0xC2,0x00,0xD0,
+  0x83,0x09,0x00,0x80,0xC1,0x02,0x24,0x10,0xDB,0xD7,0x00,0x10,0x80,0x04,0x06,0x21,
+  0x49,0xDC,0x90,0x80,0x0D,0x00,0xC0,0x80,0x09,0x02,0x21,0xC0,0xC1,0x09,0xCF,0xD4,
+  0xFD,0x8D,0xF8,0x80,0x0F,0x01,0x43,0x81,0x0F,0x0A,0xD4,0x13,0x9F,0xD4,0x14,0xC0,
+  0xC2,0x00,0xC0,0xC8,0x01,0xC4,0x80,0x03,0x01,0x42,0x9B,0x00,0xD8,0x00,0x30,0x80,
+  0x04,0x02,0x31,0x40,0x83,0x09,0x00,0x40,0xC1,0x02,0x41,0x90,0x82,0x0F,0x00,0x30,
+  0xC2,0x00,0x40,0xC1,0x06,0xDF,0x91,0xDF,0xD0,0x80,0x0F,0x02,0x81,0x20,0xC1,0x00,
+  0x90,0x80,0x01,0x00,0x80,0x80,0x0F,0x05,0xDF,0xD1,0x49,0x80,0x08,0x04,0x94,0x84,
+  0x90,0x80,0x04,0x02,0x24,0x30,0xDC,0x97,0x00,0x03,0x12,0x42,0x80,0x03,0x80,0x08,
+  0x02,0x48,0x40,0x80,0x08,0xC1,0x01,0x28,0xC2,0x06,0x91,0xDF,0x93,0xC0,0x81,0x0F,
+  0x01,0x34,0x83,0x0F,0x05,0x91,0x4D,0xFD,0x80,0x04,0x00,0xD0,0x82,0x0F,0x01,0xD3,
+  0xC1,0x85,0x04,0x05,0x84,0x34,0x21,0xDB,0x98,0x00,0x05,0x34,0x32,0x32,0x86,0x04,
+  0x01,0x34,0xC2,0x01,0x31,0x80,0x0F,0x02,0x91,0x90,0xC1,0x01,0x94,0x81,0x0F,0x00,
+  0xD0,0xC1,0x00,0xC0,0xC1,0x85,0x0F,0x00,0xD0,0x81,0x0F,0x80,0x03,0x01,0x48,0xC1,
+  0x00,0x80,0xC1,0x00,0x80,0x80,0x03,0x04,0x23,0x43,0x10,0xDA,0xD8,0x02,0x13,0x20,
+  0x80,0x04,0x80,0x03,0xC2,0x00,0x80,0xC1,0x03,0x84,0x24,0x80,0x09,0x0D,0x31,0x48,
+  0x94,0x24,0xD8,0x14,0x98,0x80,0x01,0x04,0x89,0x42,0x40,0x84,0x09,0x02,0x41,0x30,
+  0x80,0x08,0x00,0x20,0xC1,0x80,0x04,0x00,0x30,0x81,0x04,0x01,0x34,0xC2,0x01,0x24,
+  0xDB,0xD8,0x05,0x32,0x43,0x12,0x80,0x01,0x80,0x03,0x00,0x10,0x81,0x03,0x02,0x12,
+  0x10,0x80,0x00,0x03,0x13,0x10,0x80,0x01,0x01,0x43,0x80,0x00,0x05,0x23,0x10,0x12,
+  0x80,0x01,0x80,0x03,0x82,0x01,0x02,0x01,0x00,0x80,0x01,0x00,0x30,0x81,0x01,0x00,
+  0x40,0x80,0x03,0x00,0x10,0x80,0x03,0x00,0x10,0x81,0x03,0x03,0x12,0x43,0xDC,0xD9,
+  0x03,0x42,0x36,0x80,0x09,0x00,0xC0,0x80,0x04,0x04,0xC8,0x28,0xC0,0x81,0x09,0x03,
+  0x43,0x4D,0x80,0x09,0x08,0x42,0x38,0x94,0x14,0x90,0x80,0x04,0x05,0x21,0x24,0x98,
+  0xC1,0x01,0x8C,0x80,0x09,0x02,0x41,0x40,0x80,0x09,0x01,0x24,0x80,0x09,0x09,0x34,
+  0xC4,0x34,0xC8,0x12,0xDC,0xD8,0x03,0x24,0x14,0x82,0x0F,0x80,0x09,0x03,0xFD,0x4D,
+  0x82,0x0F,0x01,0xD9,0x82,0x0F,0x02,0xE3,0x40,0x80,0x0F,0x01,0x94,0x80,0x0F,0x01,
+  0x82,0x80,0x04,0x01,0x39,0x80,0x0F,0x01,0x4D,0x82,0x0F,0x12,0xD1,0x9F,0xD1,0x4F,
+  0xC8,0xDF,0xD3,0xDF,0x92,0x30,0xDC,0xD7,0x04,0x13,0x42,0x80,0xC2,0x02,0x94,0xC0,
+  0xC1,0x01,0x39,0xC2,0x01,0xD9,0x80,0x0F,0x01,0xD9,0x80,0x0F,0x00,0x90,0xC2,0x01,
+  0xF9,0xC1,0x08,0x41,0x42,0x3D,0xFD,0x90,0x80,0x0F,0x80,0x0D,0x80,0x0F,0x01,0x4C,
+  0x80,0x0F,0x04,0x3D,0xFD,0x40,0x81,0x0F,0x00,0x90,0x80,0x0F,0x00,0x80,0xC1,0x00,
+  0x20,0x9A,0x00,0xD8,0x03,0x42,0x19,0xC1,0x0B,0xD8,0x4E,0xF9,0x10,0x9F,0xD1,0xC2,
+  0x05,0x10,0xDF,0xDC,0xC2,0x04,0xDF,0xD4,0x20,0xC4,0x05,0xCD,0xF9,0x03,0xC1,0x01,
+  0x9D,0x83,0x0F,0x00,0x90,0xC3,0x00,0xD0,0xC1,0x04,0x41,0x24,0x10,0xDA,0xD9,0x80,
+  0x03,0x00,0xC0,0x81,0x0F,0x01,0x94,0x80,0x0F,0x03,0x41,0x2D,0xC2,0x04,0xDF,0xD0,
+  0x10,0xC2,0x00,0x90,0x83,0x0F,0x01,0xD2,0x80,0x03,0x01,0x14,0x80,0x0F,0x00,0x90,
+  0x80,0x0F,0xC1,0x00,0x40,0xC9,0x00,0x90,0x83,0x0F,0x04,0xD2,0x34,0x10,0x9A,0x00,
+  0xD7,0x04,0x34,0x24,0xD0,0xC3,0x00,0xC0,0xC1,0x02,0xD9,0x80,0xC1,0x02,0x91,0xC0,
+  0x80,0x0F,0x80,0x0D,0x80,0x0F,0x03,0x8C,0xF9,0xC3,0x04,0x12,0x9C,0xD0,0xC1,0x01,
+  0x4D,0x80,0x0F,0x00,0x90,0x80,0x0F,0x01,0xD8,0x80,0x0F,0x01,0x83,0xC1,0x00,0x40,
+  0xC1,0x80,0x0D,0xC2,0x03,0x32,0x43,0xDB,0xD7,0x03,0x24,0x14,0x82,0x0F,0x01,0xC9,
+  0x82,0x0F,0x00,0x90,0xC1,0x00,0x40,0x80,0x03,0x00,0xD0,0x82,0x0F,0x05,0x83,0xDF,
+  0x48,0xC1,0x00,0x90,0xC2,0x81,0x0F,0x02,0x91,0x80,0x82,0x0F,0x00,0xE0,0x80,0x04,
+  0xC1,0x00,0x10,0xC3,0x03,0xDF,0x94,0xC1,0x01,0xC1,0x80,0x04,0x00,0x10,0xDB,0xD7,
+  0x01,0x42,0x80,0x04,0x80,0x08,0x80,0x09,0x80,0x04,0x81,0x09,0x80,0x04,0x0F,0x98,
+  0x42,0x14,0x9D,0x95,0x13,0x98,0x42,0x80,0x08,0x11,0x24,0x24,0x9D,0x83,0x21,0x49,
+  0xD9,0x31,0x49,0x81,0x04,0x00,0x90,0x80,0x04,0x80,0x08,0x01,0x43,0x80,0x08,0x03,
+  0x43,0x23,0xDC,0xD6,0x01,0x13,0xC1,0x02,0x20,0x10,0x80,0x00,0x80,0x01,0x81,0x00,
+  0x81,0x01,0x01,0x02,0x80,0x04,0x00,0x10,0x81,0x00,0x05,0x12,0x31,0x02,0x82,0x01,
+  0x80,0x04,0x00,0x10,0x80,0x00,0x80,0x01,0x80,0x04,0x00,0x10,0x81,0x00,0x0B,0x14,
+  0x30,0x12,0x30,0x13,0x10,0x80,0x02,0x05,0x10,0x14,0x24,0xDC,0x96,0x00,0x80,0x04,
+  0x00,0x30,0x8A,0x04,0x00,0x20,0x81,0x04,0x00,0x30,0x84,0x04,0x00,0x20,0x85,0x04,
+  0x00,0x20,0x82,0x04,0x02,0x24,0x20,0x84,0x04,0x00,0x20,0x85,0x04,0x00,0x20,0x81,
+  0x04,0x00,0x30,0x81,0x04,0x02,0x24,0x30,0x9B,0x00,0xD7,0x0E,0x13,0x23,0x23,0x23,
+  0x23,0x23,0x23,0x20,0x80,0x03,0x05,0x23,0x23,0x23,0x80,0x02,0x80,0x03,0x06,0x23,
+  0x23,0x23,0x20,0x80,0x03,0x02,0x23,0x20,0x82,0x03,0x04,0x23,0x23,0x20,0x80,0x03,
+  0x04,0x23,0x23,0x20,0x81,0x03,0x00,0x20,0x80,0x03,0x02,0x23,0x20,0x80,0x03,0x80,
+  0x01,0xDB,0xBF,0x00,0x96,0x00,0x00,0x10,0x9C,0x00,0xBF,0x00,0xB5,0x00,0xBF,0x00,
+  0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,
+  0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,
+  0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,
+  0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,0xBF,0x00,0xF6,
 };
 
-const uint16_t spaceman_frame_2[14400] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x2100,0x0200,0x0200,0x2200,0x2200,0x2200,
-  0x2200,0x0200,0x2100,0x2100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0100,0x2300,0x6500,0x8700,0x8900,0xCB00,0xAC00,0xAC00,0xAD00,0xAD00,0xAD00,
-  0xAD00,0x8C00,0xAB00,0xAA00,0x6900,0x8700,0x4400,0x2300,0x0100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0x6800,
-  0x8B00,0xAD00,0xCF00,0xCF00,0xD000,0xD000,0xF000,0xD000,0xD000,0xF000,0xF000,0xF000,
-  0xF000,0xD000,0xF000,0xD000,0xD000,0xD000,0xCF00,0xCE00,0xAC00,0x8A00,0x6700,0x4400,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x6700,0xAB00,0xCE00,0xCF00,
-  0xF000,0xF000,0xF008,0xD000,0xD000,0xB000,0xB000,0xB000,0xB000,0xB000,0xB000,0xB000,
-  0xB000,0xB000,0xB000,0xB000,0xD000,0xD000,0xD000,0xF000,0xF000,0xCF00,0xCF00,0xCE00,
-  0x8B00,0x6700,0x2300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x4400,0x8800,0xAC00,0xEF00,0xF000,0xD000,0xD000,
-  0xB000,0xB000,0xAF00,0xAF00,0xCE00,0x0D01,0xEC10,0xCC10,0xEB20,0x0B29,0x0B29,0x2B39,
-  0x0B29,0x0B29,0xEC18,0xEB18,0xEC10,0xEE00,0x8D00,0xAF00,0xB000,0xB000,0xD000,0xD000,
-  0xF000,0xCE00,0xAC00,0x8900,0x4500,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4300,0x8800,0xAD00,0xD000,0xD100,0xD000,0xAF00,0x8F00,0xAE00,
-  0xEE00,0xED10,0xEC20,0x2B41,0x4969,0x8879,0x6699,0x66A1,0x86B1,0xA6B9,0xA5B9,0xA5C9,
-  0xA5B9,0xA5B9,0x86A9,0x66A1,0x6791,0x6A69,0x2B51,0x0B29,0xCC10,0xCD00,0xAE00,0x8F00,
-  0xD000,0xD000,0xF100,0xF100,0xCE00,0x8A00,0x4500,0x0100,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0x6600,0xCC00,0xF000,0xF000,0xD000,0xAF00,0xAF00,0xCE00,0xCD10,0x2C31,
-  0x8951,0x8789,0xA7B1,0xC6E1,0xE5F9,0xE7F1,0xE7F9,0xE7F9,0xC8F1,0xC8F1,0xE8E9,0xC8E9,
-  0xC8F1,0xE8F1,0xE8F1,0xE7F9,0xE6F9,0xC5F9,0x07EA,0xC7B9,0x6689,0x4961,0x2C31,0xED18,
-  0xCE00,0xAE00,0xAF00,0xD000,0xD000,0xD100,0xCF00,0x6800,0x4300,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x4300,0x8B00,0xCF00,0xCE00,0xCE00,0xCE00,0xCE00,0xCE00,0x0D11,0x4A39,0x8891,0xE8D9,
-  0xC6F9,0xC6F9,0xC7F1,0xC8E9,0xEBC9,0x2FAA,0x2FAA,0x109A,0x1092,0x3192,0x528A,0x5292,
-  0x528A,0x528A,0x118A,0x309A,0x0EB2,0xC9C1,0xE9D1,0xE8E9,0xC6F9,0xC6F9,0xC6E1,0xA8A1,
-  0x4861,0xCC18,0xAE00,0xAE00,0xAF00,0xAF00,0xD000,0xD100,0xEE00,0x8600,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6600,
-  0xED08,0xEE00,0xEE08,0xEE08,0xAF00,0xAE00,0x4B09,0x8A69,0xA8C1,0xA6F1,0xC6F9,0xE7E1,
-  0xE8C9,0x0DAA,0x5292,0x3482,0x1482,0x357A,0x928A,0x9382,0xF192,0x2F9B,0x309B,0x309B,
-  0x2F9B,0xB28A,0x9382,0x7382,0x157A,0x1482,0x3482,0x3192,0x4FB2,0x0BCA,0xC7D9,0xE6F9,
-  0xA5F1,0xC8D1,0x6971,0xCA10,0xAD00,0xAF00,0xCF00,0xCF00,0xD000,0xD000,0x8A00,0x2200,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0xC908,0xED08,
-  0x0E09,0x0E11,0xCE08,0xCE00,0x0C01,0x4959,0xA7B9,0xC6F1,0xC5F1,0x08D2,0x0FB2,0x1392,
-  0xD479,0x147A,0xD282,0xEF9B,0xECC4,0x89CD,0x25E6,0x44EE,0x63F6,0x82F6,0x81FE,0x81FE,
-  0x62F6,0x43EE,0x44EE,0xE6E5,0x2ACD,0x8DB4,0x50A3,0xF192,0x5482,0xF579,0x328A,0x4EB2,
-  0x4BD2,0xE6F1,0xA4F1,0xA8C1,0x8B71,0xEB20,0xAE00,0xAF00,0xCF00,0xD000,0xD100,0xAD00,
-  0x4400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0xC908,0x0D11,0x0E09,
-  0x0D11,0xCD00,0xAC00,0x2B39,0xA999,0xA5E1,0xC5F1,0x09DA,0x0FAA,0xF281,0x347A,0x1383,
-  0x6EB4,0x48D5,0xE4E5,0x62F6,0x63FE,0x03FE,0x04F7,0xE8DE,0xA9D6,0xCACE,0xCCC6,0xCCC6,
-  0xACC6,0xAAD6,0x06EF,0xE5EE,0xA6EE,0xC3FE,0x22FE,0xE3ED,0x48CD,0xCFB3,0x9392,0x1572,
-  0xF481,0xCE99,0x0AD2,0x28FA,0xC6F1,0x87B1,0x2A41,0xCE00,0x8F00,0xAF00,0xD000,0xD000,
-  0xCD00,0x4600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0xC908,0x2D09,0x0D11,0x0D09,
-  0xAD00,0xEC10,0x4869,0xA6C9,0xE6F9,0x08EA,0xEEA1,0xF281,0x347A,0x519B,0xCABC,0xA4E5,
-  0xC1FE,0x42FF,0x25EF,0xCBC6,0x309E,0xB395,0x5776,0x5A5E,0x3B5E,0x3C56,0x1D4E,0x1D4E,
-  0x1D4E,0x1B56,0x586E,0x7776,0x767E,0xD0AE,0xEBC6,0x06E7,0x05EF,0x44FE,0x44ED,0x8ABC,
-  0x719B,0x7382,0xF479,0xF0A1,0x08E2,0xE5F9,0xA5C9,0x6A71,0x0D11,0xCE00,0xAF00,0xAF00,
-  0xD000,0xCE00,0x6600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0xE908,0x2D11,0x0C11,0x0C09,0xEC00,
-  0xCC18,0x6881,0xC5F1,0xC6F9,0xCAC1,0x1292,0x5582,0x7193,0x4AC4,0xC5E5,0x44F7,0x04EF,
-  0x8AC6,0x719E,0x3876,0xFE4D,0x1F3E,0x1E3E,0xDE45,0x9D55,0x7C5D,0x7C65,0x5B6D,0x5B65,
-  0x5B6D,0x7C65,0x9E55,0xDE45,0xFF3D,0x1F3E,0xFE45,0xF96D,0x3686,0xAEAE,0x43EF,0x61FF,
-  0x64F6,0xC8CC,0x509B,0x7582,0x128A,0xCBB1,0xE7F1,0xE7F9,0xC891,0x2B21,0xAE00,0xAF00,
-  0xAE00,0xD000,0xCE00,0x4600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x0909,0x2C11,0x2C11,0x0D11,0xEC00,0x4A29,
-  0xE9B9,0xE7F9,0xC7E1,0x0DAA,0x3482,0x9482,0x0DBC,0x66E6,0x61FF,0x06E7,0x329E,0x196E,
-  0x1E46,0x1F3E,0xFE45,0x9B6D,0x378D,0x9594,0x92AB,0xD1C2,0xB1C2,0xD1C2,0xD1C2,0xD1C2,
-  0xB1BA,0x91C2,0x11BB,0xD2A3,0x9494,0x5885,0x9A6D,0xFD4D,0x3F3E,0x1F3E,0xFA65,0x6EB6,
-  0xE4F6,0x40FF,0xA4F6,0xABC4,0xB282,0x557A,0x30A2,0xE8E1,0xC5F9,0x87B9,0x0A39,0xCE00,
-  0xAF00,0xAE00,0xD000,0xCE00,0x4600,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,0x2C11,0x2B19,0x0C11,0x0C01,0x6A31,0xC8C9,
-  0xC6F9,0x2BD2,0x5292,0x347A,0x1193,0x69D5,0x21FF,0x01FF,0x4EBE,0x1A66,0x5E46,0x5E46,
-  0xDA6D,0x3594,0x52AB,0xD3C2,0x94E2,0x93E2,0x51CA,0x8CAA,0x2A93,0x6B8B,0x4B93,0x0C93,
-  0x4862,0xC669,0x8992,0xADB2,0x2FBA,0x71C2,0xD3D2,0x94AB,0x9484,0x7A65,0x3F3E,0x3E46,
-  0x1A66,0x6FAE,0xE4F6,0x40FF,0x25E6,0x8F93,0x357A,0x1192,0x0ACA,0xC6F9,0xA6D1,0x4951,
-  0xAE00,0xAF00,0xCE00,0xD000,0xCE00,0x6400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x2100,0xC708,0x2C11,0x2B19,0x0C19,0x0B01,0x6A39,0xC8C1,0xC6F9,
-  0x2AD2,0x3292,0x347A,0xEFA3,0x65E6,0x00FF,0x8CC6,0x367E,0x3E46,0x7F46,0x796D,0x949B,
-  0x34C3,0xB3E2,0xB4F2,0x93DA,0x10BA,0x2DB2,0x6DA3,0x8B93,0x497B,0x2973,0x297B,0x4A83,
-  0x2973,0x265A,0xA86A,0x2A8B,0x0B93,0xCDA2,0x0FCA,0x30CA,0xB2DA,0x14CB,0xD493,0x3865,
-  0xFD4D,0x5E46,0xD975,0x2BCE,0x40FF,0xA3EE,0xCCC4,0x7482,0x1382,0x4BD2,0xE6F9,0xA6D1,
-  0x4951,0xCE00,0xAE00,0xEE00,0xCF00,0xCC00,0x6300,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0xA510,0x4B19,0x2B11,0x2B19,0x0B01,0x6A39,0xC7C1,0xE6F9,0x0AD2,
-  0x338A,0x747A,0x8BBC,0xE1F6,0xE3F6,0xF0AD,0x1C56,0x5F36,0x7B55,0x5594,0x34D3,0x53F2,
-  0x51E2,0x0EBA,0xAB81,0xE840,0x2841,0x2A8B,0x8A7B,0x497B,0x4A7B,0x6B83,0x8B93,0xEDAB,
-  0x2DB4,0x0973,0xA862,0x6A7B,0xCB83,0x2A7B,0xCB8A,0x0C9B,0x4FC2,0x12E2,0xB3EA,0x12D3,
-  0xF59B,0x595D,0x1F3E,0xFD55,0x50A6,0x24F7,0x20FF,0xEBC4,0x9582,0xF381,0x0BC2,0xC6F9,
-  0xC6D1,0x0A39,0xAE00,0xCF00,0xCE00,0xCF00,0xCB08,0x2200,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x8408,0x2A19,0x4B19,0x2A19,0x0C09,0x4A21,0xA8B1,0xE6F9,0xEAC9,0x3392,
-  0x7482,0xCABC,0xA0FE,0xA4EE,0xF395,0xDF45,0xFD45,0xF87C,0x73BB,0x92EA,0x33EA,0x2FAA,
-  0x8971,0x2641,0x2400,0x4300,0x2652,0xAB8B,0x297B,0x297B,0xCC93,0x6EAC,0x8EBC,0xAFC4,
-  0x4EBC,0xCC9B,0xA86A,0xC972,0xAC93,0x097B,0x086B,0x6973,0x2B93,0x4C9A,0x2FA2,0x73DA,
-  0x73E2,0x53C3,0xD684,0xDD45,0x1F3E,0x3586,0xC7DE,0x21FF,0xEACC,0x757A,0xF379,0x2BCA,
-  0xC6F9,0x86B9,0x0A29,0xAD00,0xCE00,0xEE00,0xEF00,0x8700,0x0100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x4200,0x0919,0x6B19,0x2A11,0x0A09,0x2A11,0x8999,0xA5F1,0xE9D1,0x338A,0x7382,
-  0xABC4,0x42FF,0x46E6,0x367D,0x1F3E,0xDB5D,0x549C,0xB3E2,0x32EA,0x50C2,0xCB81,0x0621,
-  0x6500,0x4600,0x6808,0x4A52,0xEBA3,0x2A7B,0x0973,0xAC8B,0xAEB4,0xEFC4,0xAEBC,0xAEBC,
-  0xEDA3,0x2EAC,0xE97A,0xA862,0xAB93,0x8B8B,0xE972,0xC86A,0x8B8B,0x0873,0xA641,0xCB59,
-  0x90B2,0x73EA,0x92E2,0xF3A3,0x9B5D,0x5F36,0xFA6D,0xC7DE,0x21FF,0xEBCC,0x7582,0x338A,
-  0x0BC2,0xE6F9,0x86A1,0xEB10,0xCE00,0xEE08,0xCE00,0xED00,0x6400,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xE710,0x4B19,0x4B21,0x2A11,0xEA08,0x6879,0xC6F1,0xE7E1,0xF089,0x7482,0x8AB4,
-  0x40FF,0xCACE,0xFA65,0x3F3E,0x796D,0x52BB,0x53EA,0x94DA,0x0CA2,0xE438,0x4400,0x8900,
-  0xCF00,0xAE00,0x6B52,0x488B,0x6862,0x2752,0x886A,0x4B83,0x4DAC,0x4DB4,0xCC9B,0xECA3,
-  0xAC8B,0xCC93,0x0973,0x0973,0xED9B,0x0DA4,0x8B8B,0xC86A,0xE972,0xEC9B,0xC972,0x4200,
-  0x6431,0x2DA2,0x73DA,0x52E2,0x53B3,0xBB5D,0x5F3E,0xF96D,0xC8DE,0x20FF,0xEBC4,0x5482,
-  0x338A,0xE9D9,0xE6F9,0xAA81,0xED00,0xCE00,0xEE00,0x0E09,0xC908,0x4200,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8408,0x2A19,0x6B21,0x2A11,0x0A11,0x2951,0xC6E9,0xC6E9,0x2F9A,0x557A,0x0CB4,0x01FF,
-  0xE3FE,0x1776,0x1F36,0x5965,0x52B3,0x73E2,0x51DA,0xCB79,0xA518,0x6800,0xEF00,0xCF00,
-  0xAD00,0xAB21,0xEA6A,0x6772,0xA649,0x275A,0x2672,0xA87A,0xC872,0xC86A,0xC86A,0xC86A,
-  0xC86A,0xE972,0x6862,0x8862,0x8B8B,0x0DAC,0xCC93,0x2A7B,0x0973,0x4A83,0x6A8B,0x675A,
-  0x8508,0x4308,0xC869,0xB0D2,0x53EA,0xF3CA,0x7975,0x5F3E,0xF96D,0xA8DE,0x20FF,0xEBC4,
-  0x5482,0x10A2,0x08F2,0xC6E1,0x6A61,0xAD00,0xED08,0xEE08,0x0C09,0x8500,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x0819,0x6B19,0x6B21,0x2A09,0x4929,0xC8B9,0xC5F9,0x2CC2,0x147A,0xD09B,0xA4EE,0xE3F6,
-  0x148E,0x3F3E,0x5965,0x52B3,0x73EA,0x72DA,0x4951,0x8608,0x8A00,0xED00,0xEF08,0xCE00,
-  0xAA00,0xCA62,0xC872,0x4549,0x2772,0x6EBC,0xF1DC,0xD0D4,0x0EBC,0xABAB,0x499B,0xC892,
-  0xA88A,0x097B,0xA86A,0x4662,0xE872,0xEC93,0xED93,0x4A7B,0x0973,0x297B,0x2983,0xC96A,
-  0x0B11,0x8A00,0x6408,0x0451,0x0EC2,0x54F2,0x13CB,0x797D,0x3F3E,0x367E,0x24EF,0xE2F6,
-  0x8FAB,0x5582,0xEDA1,0xC6F1,0xA7C9,0xEA20,0xCE00,0x0D09,0x0E09,0xAA08,0x2100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8508,
-  0x4B19,0x2A19,0x0A09,0x2A19,0x6879,0xE7F9,0x09DA,0x138A,0x128B,0xC6E5,0x42FF,0x11A6,
-  0x3F3E,0xDB4D,0xB3AB,0x53F2,0x52D2,0x6959,0x8800,0x8B00,0xEE08,0x0E09,0xEE00,0xAD00,
-  0x2A11,0x6B83,0x6862,0x8551,0xCCBB,0xD4FD,0x15FE,0xD4FD,0x93F5,0x72F5,0x31ED,0xD0DC,
-  0x8FDC,0x8FCC,0x8FC4,0x6EC4,0x0DBC,0x6C9B,0x2A93,0x097B,0x2973,0x297B,0x297B,0xC86A,
-  0x8B21,0xCF00,0x8C00,0x4400,0xE440,0x2EBA,0x33EA,0x53C3,0x7A65,0x3F3E,0x5296,0x20FF,
-  0x45EE,0x1293,0xD371,0xE9C9,0xA5F9,0x8989,0xCC00,0xEC00,0x0E11,0x0C09,0xA608,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,
-  0x4B19,0x0C3A,0x8A11,0x2841,0xA6D1,0xC7F1,0x70A2,0x157A,0xEBC4,0x40FF,0x8ACE,0x1D4E,
-  0xFC4D,0x3394,0xB3EA,0x72DA,0x8959,0x6700,0xAC00,0xEE08,0xEE08,0xED08,0xEE00,0xAD00,
-  0x8A21,0x2A73,0x4662,0xA882,0x31E5,0xD4F5,0x93F5,0x93F5,0xD4F5,0xF4FD,0xF5FD,0xF4FD,
-  0xF4FD,0xB3FD,0xD4FD,0x15FE,0x93FD,0x2ED4,0x6ABB,0x4A83,0x2973,0x097B,0x4A7B,0x4A83,
-  0xE841,0xCC08,0xF100,0xCD00,0x4500,0x0449,0x90CA,0x52E2,0xB3AB,0xDC4D,0x3E46,0x6CBE,
-  0x80FF,0xC9CC,0x757A,0xF099,0xE7F1,0xC7E1,0x2831,0xCC00,0xED08,0x4D11,0xEA08,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,
-  0x4A19,0xCD52,0x2B32,0x4681,0xE6F9,0xEAC9,0x357A,0x509B,0x42F6,0x25EF,0x3776,0x3F3E,
-  0x758C,0xB3DA,0x73E2,0xEB71,0xA600,0xAD00,0x0E09,0xED08,0xED08,0x0E09,0xCE00,0xCC00,
-  0xC931,0x8862,0x4672,0x8BB3,0xB4F5,0xB4ED,0x93F5,0x93F5,0x93F5,0x93F5,0x93F5,0xB3F5,
-  0xB3F5,0xB3F5,0x93F5,0xB3F5,0xD4FD,0x72F5,0x6DDC,0xABA3,0x4A7B,0x0973,0x4A7B,0x4A83,
-  0x275A,0xEB10,0xAD00,0x1009,0xAD00,0x4500,0xC869,0x92DA,0x92E2,0x558C,0x3E3E,0x1C56,
-  0xA7DE,0xC3FE,0xEFAB,0xF579,0x4DC2,0xA5F9,0xA891,0xEB10,0xEC00,0x2D19,0xEB08,0x6408,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B19,
-  0x4A19,0x6919,0x6951,0x86C9,0xE7F9,0x30AA,0x357A,0x69D5,0xE1FE,0x509E,0xFF3D,0x796D,
-  0xF2BA,0x74EA,0xCC89,0xE718,0xCC00,0x0E09,0x0D09,0x0D09,0x0D09,0x0D09,0xCE00,0xCC00,
-  0xE751,0x475A,0x887A,0x2DCC,0xD4FD,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,
-  0xB3F5,0xB3F5,0xB3F5,0x93F5,0xB4F5,0x93F5,0x4DD4,0xCBCB,0x4A93,0x0973,0x097B,0xA86A,
-  0x0752,0xEB10,0xAE00,0xEE00,0xCF00,0xAE00,0x6300,0xEC91,0x73F2,0x13CB,0x386D,0x3F3E,
-  0xF685,0x63F7,0x65DD,0xB482,0x3292,0xE8E1,0xE8D9,0x4939,0x0B01,0x0D11,0x2C11,0xC710,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x4B19,
-  0x2A19,0xE700,0x6689,0xE6F9,0xEBC9,0x557A,0x8F93,0xC1F6,0xC8DE,0x1A66,0xDD4D,0x92AB,
-  0x73E2,0x91B2,0x2931,0x6900,0x0E11,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0xCE00,0xAB00,
-  0xA649,0x2652,0xC88A,0x8EDC,0xD4FD,0x93F5,0x93F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,
-  0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xD4F5,0xB3F5,0x8EDC,0x0CD4,0x299B,0xC86A,0xC86A,0x475A,
-  0xA551,0xEB10,0xAE00,0xEE00,0xCE00,0xCE00,0x8B00,0xE618,0x4F9A,0x74F2,0x54B3,0xFD55,
-  0xFE4D,0x8ACE,0xC1FE,0x6DB4,0xF579,0x4DC2,0xC6F9,0x8789,0xEB10,0xCD00,0x4C19,0x0911,
-  0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6B21,0x4A19,
-  0x2A11,0x2931,0x86C1,0x07FA,0x10A2,0x757A,0x69D5,0x00FF,0x519E,0x1F46,0x3885,0x92DA,
-  0x72DA,0x6959,0xC900,0xED08,0x2D11,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0xED08,0xAB00,
-  0x2631,0x074A,0xE88A,0x4DD4,0x73ED,0x72ED,0xB3F5,0x72ED,0x11E5,0x52ED,0xD3F5,0xB3F5,
-  0xB3F5,0xB3F5,0x93FD,0x51F5,0x52F5,0x72F5,0x6EE4,0x2CDC,0x6BB3,0x4772,0xA649,0xC651,
-  0xC551,0xEA10,0xAE00,0xEE08,0xED08,0xEE00,0xD000,0x6700,0x4651,0xEFD1,0xD3DA,0x3675,
-  0x3F3E,0x1586,0x24F7,0xA6E5,0x7382,0x309A,0xC6F9,0xE8D1,0x2B39,0xCA00,0x4B21,0x2C11,
-  0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0811,0x4B21,0x4A19,
-  0x2A09,0x6A59,0xC6E1,0x0AE2,0x1282,0x109B,0xA3F6,0x88DE,0x3B5E,0xBD4D,0xD3B3,0x53E2,
-  0x2FAA,0xE820,0xCB00,0x2E11,0x0C09,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0xED08,0xAC00,
-  0xC718,0xE659,0x0993,0xF2C4,0x17C6,0x75B5,0xF7C5,0x38CE,0x58CE,0xB4DD,0x51F5,0xB3F5,
-  0x93F5,0x72F5,0xD5E5,0x17D6,0x16DE,0xF6DD,0xEFCC,0xCACB,0xAAD3,0x0993,0xE649,0xE649,
-  0x6639,0xAA08,0xAE00,0x0E09,0xED08,0xCE00,0xEF00,0xAD00,0xA610,0xAB81,0xB3E2,0x73B3,
-  0xFD55,0xFC55,0xAACE,0x63F6,0xCFA3,0xF381,0xC9C9,0xE7F1,0x4861,0xE900,0x4B19,0x2C11,
-  0xC708,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0919,0x6B19,0x4A19,0x2B11,
-  0xC900,0x6889,0xE6F1,0xCCB9,0x747A,0x8BC4,0x20FF,0x50A6,0x3F3E,0xF96C,0xB1DA,0xD3E2,
-  0xEF82,0x0C11,0xAC00,0x2C11,0x0C09,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x0C09,
-  0xE720,0xE571,0x0FA4,0x96A5,0x13AD,0xF093,0xEF83,0x508C,0xF49C,0x55B5,0x73DD,0x93FD,
-  0x92FD,0x94D5,0xB6B5,0xB7AD,0xB7A5,0xB6AD,0xD5B5,0x31C5,0x4FBC,0xED9B,0x6A83,0x886A,
-  0x2629,0xAB00,0xCE00,0x0E09,0xEE00,0xEE00,0xED08,0x0F09,0x8A00,0x2841,0x0FD2,0x73DA,
-  0x377D,0x1E3E,0x5296,0xE3FE,0x89D5,0x3482,0xCD99,0xC6F9,0x6699,0x0911,0x0B09,0x2C11,
-  0x0911,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,0x6B19,0x4A19,0x2A11,0x0A11,
-  0x8939,0xA6D1,0xE6F1,0xB091,0xF38A,0x45EE,0x02F7,0x3776,0x1E46,0x569C,0x52EA,0x10BB,
-  0xAC52,0x0C09,0xCC08,0x2C11,0x0C09,0x0C09,0x0C09,0x0D09,0x0D09,0x0D11,0x0D09,0xEC08,
-  0x2721,0x267A,0x2F9C,0x919C,0x89B3,0x67B3,0x6692,0xA571,0xC679,0xAE83,0x55A5,0x53D5,
-  0x53D5,0x14A5,0xB0A4,0xED9B,0x4C73,0x6D7B,0x9294,0x59BE,0x349D,0xCD8B,0xABAB,0x878A,
-  0x6639,0xAB08,0xCE00,0xEE08,0xEE08,0xEE08,0xED00,0x0E09,0xAC00,0xA618,0xA991,0x94E2,
-  0xF2A3,0xFE3D,0x596E,0x06EF,0x63EE,0xD18A,0x328A,0xE8F1,0xA7C1,0x0931,0xCA00,0x2C19,
-  0x2A19,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B21,0x2A19,0x0A09,0x8929,
-  0xACBB,0x87FA,0x0ADA,0xF489,0x709B,0x41FF,0x8CC6,0x5D4E,0x9B4D,0x93C3,0x53DA,0x2D72,
-  0x8708,0xEA08,0x2D11,0x0C09,0x0C09,0x0C09,0x0C11,0x0C09,0x0C09,0x2C11,0x0D09,0xAB00,
-  0xA618,0xE569,0xE98A,0x0C9B,0x0AC4,0xA9DD,0x4BD4,0x2AB3,0x2782,0x276A,0xCE7B,0x149D,
-  0x718C,0x8BAB,0xEBD3,0x6AB3,0x2672,0xC671,0x8569,0x9294,0xF1AC,0x49A3,0x8792,0x467A,
-  0xC551,0xCA08,0xCE00,0x0E09,0xEE08,0xEE08,0xED00,0x0E09,0xCE08,0xA900,0x6949,0xB3DA,
-  0xB2CA,0x7B65,0x3E4E,0x8CBE,0xA1FE,0xEE9B,0x757A,0xEBC9,0xC7D1,0x8A61,0x4B11,0x2A19,
-  0x4B19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4A19,0x6B21,0x0911,0x4921,0x2C8B,
-  0x0CD4,0xEBDB,0xAFAA,0x528A,0x2BB4,0x66EE,0x14BE,0x5F4E,0xF764,0x12DB,0x31CA,0x2941,
-  0xC900,0x0C11,0x2D11,0x0C09,0x0C09,0x0C09,0x2C11,0x2C11,0x0C09,0x0D09,0x4D11,0x4B19,
-  0x8508,0xC559,0x49AB,0x4AAB,0x2AB3,0x4BD4,0x89DD,0x6BD4,0xE9B2,0x677A,0x6A83,0xAEBC,
-  0xE992,0x29AB,0x0CD4,0x2CDC,0x8BC3,0x6792,0xC671,0x6C73,0x0DAC,0x4ABB,0x8792,0xE669,
-  0x4631,0xCB08,0xEE00,0x0E09,0x0E09,0xEE08,0xEE08,0xED08,0x0E09,0x8B00,0xC820,0x4FC2,
-  0x72DA,0xF794,0xFF45,0x538E,0xA2FE,0x2ACD,0x7582,0xCCB1,0xA6E9,0xCCBA,0x4F4B,0x0A19,
-  0x4B19,0xC610,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A19,0x8C21,0xC808,0x8831,0x2EC4,
-  0x0CD4,0xEBD3,0x10A3,0x9282,0x0CB4,0xA9DD,0x1696,0x3D4E,0xF693,0x72EA,0x2FAA,0x2919,
-  0x2C11,0x2B11,0x2C11,0x2C11,0x2C19,0x2D11,0xAC00,0x0B11,0x6C19,0xAA00,0xA908,0x8C4A,
-  0x4E5B,0xE761,0x6ABB,0x2DCC,0xA89A,0xE9AA,0x4BCC,0x8ADD,0xABCC,0x889A,0x4AA3,0x92F5,
-  0x4AAB,0x6782,0x09A3,0xECD3,0x6DE4,0xCBCB,0x888A,0x2B8B,0xCCB3,0x49B3,0x8792,0xE669,
-  0xE618,0xAB00,0xCE00,0xAD00,0xCD00,0xEE08,0x0D09,0xED08,0x0E09,0xEC00,0x4B29,0x2E9A,
-  0x53E2,0x75A4,0xFD45,0x596E,0xA8DE,0xC7E5,0x7482,0xF099,0xE7F9,0xE7C1,0xCA31,0x0A11,
-  0x6B19,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x2A19,0x8C21,0xC800,0x2729,0xACB3,
-  0x0CD4,0xEBDB,0x90B3,0x329B,0xEAC3,0xA9D5,0xB77D,0xFB5D,0xB6B3,0x11EA,0x0E82,0x2A09,
-  0x2C11,0x2A19,0x2A19,0x2B19,0x0B09,0xCA00,0x2A19,0x8A21,0xAD4A,0x6D42,0xCA31,0xB06B,
-  0xD7AD,0x4C73,0x299B,0xCFE4,0x2DC4,0x8792,0x2AAB,0x4AC4,0x68AB,0xC9A2,0x8FD4,0xF4FD,
-  0xCBBB,0x467A,0x2672,0xE89A,0xEBCB,0x2CD4,0xE8A2,0xCCC3,0xABB3,0xE9A2,0xA89A,0xA651,
-  0x8608,0xC908,0x2A19,0x2A11,0x2D11,0x0E11,0x0D11,0x0D09,0xCE00,0x6D19,0xAC42,0xAD72,
-  0x53E2,0x92BB,0x9C4D,0x7A5E,0xC8DE,0x84EE,0xD28A,0x128A,0x09EA,0x65C9,0x0831,0x2A09,
-  0x6B19,0x0919,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8C21,0xE908,0x0721,0x09A3,
-  0x2CD4,0x2BDC,0xD1B3,0x11AC,0xC9DC,0x6CD5,0xB785,0x996D,0x75C3,0x32DA,0x0E6A,0xE908,
-  0x2C11,0x4C19,0x4B19,0x0A11,0x4A19,0x6C3A,0xF073,0x8F63,0x117C,0xB28C,0x3184,0x9384,
-  0xF7B5,0x7084,0x4B8B,0xD0E4,0xD4FD,0x6ECC,0xAABB,0xE9A2,0x0AAB,0x8FCC,0xD4F5,0xD4FD,
-  0x10E5,0x099B,0x467A,0x878A,0x09A3,0x8ABB,0x6ABB,0xECD3,0x8BBB,0xE9A2,0x6782,0xA641,
-  0x2B3A,0xCD52,0xCF73,0x0D5B,0xE910,0x6B00,0xAD00,0x0E09,0xED08,0x2C19,0xE929,0x2A4A,
-  0x93DA,0xD1D2,0x1B5D,0x7B56,0xA9D6,0xE1FE,0x4FA3,0x1282,0xEAE1,0xA6D9,0x6949,0x0A09,
-  0x4B19,0x2A19,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x2919,0x8B21,0x0A11,0x0729,0xC892,
-  0x8EDC,0xEDDB,0xF2B2,0x8EBC,0xC7ED,0x10DD,0x1686,0x5675,0x34C3,0x31D2,0xEB59,0x0A09,
-  0x0C11,0xEC10,0xCA00,0x4919,0xED52,0x149D,0xD7AD,0x1595,0xF48C,0x559D,0x359D,0xF494,
-  0x1495,0xB28C,0xEEA3,0xD0DC,0x15FE,0x72F5,0x0CD4,0xCBC3,0xB0D4,0x93ED,0xB3F5,0xB3FD,
-  0x73F5,0xCBC3,0x29B3,0xCBC3,0xECBB,0xECC3,0x2CDC,0xCCC3,0x2AAB,0x878A,0xE661,0x695A,
-  0xF394,0xB7AD,0x18BE,0x938C,0x4C42,0xAC21,0xCB08,0xAB00,0x0D09,0xED08,0x8900,0x0929,
-  0x92CA,0x72E2,0xD974,0x5D4E,0x4EBE,0xE1FE,0xECAB,0x5382,0xEBD9,0xC6E1,0x6959,0x0A09,
-  0x4B19,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0819,0x8B21,0x2A11,0xC818,0x277A,
-  0x31DD,0xD2E3,0x33C2,0x6CCC,0x26F6,0x30DD,0x1786,0xF47C,0x54CB,0x0EBA,0x4741,0x0A09,
-  0x2A19,0x2A19,0x4919,0xED52,0x1495,0x96A5,0xF494,0xD38C,0x96A5,0xD7AD,0x559D,0x3495,
-  0xF494,0x1495,0x4FA4,0x10DD,0xB3F5,0xCCC3,0x8CB3,0xB0CC,0x8FC4,0x0DBC,0x6ED4,0xAEDC,
-  0x8BBB,0xCBC3,0x2CD4,0xF0E4,0xD4FD,0xB3F5,0x4DD4,0xECCB,0x6872,0x4439,0xE751,0xCE7B,
-  0xF7AD,0xBACE,0x359D,0xD38C,0xF7B5,0x55A5,0xED52,0x0A11,0xCB08,0x2D11,0xEC00,0x2921,
-  0x50BA,0x52EA,0xB984,0x3E46,0x71A6,0x01FF,0x4BB4,0x537A,0xCBD1,0xE6F1,0x6A71,0x0A09,
-  0x4B19,0x4B19,0x2919,0x8508,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x6B21,0x2B11,0xC710,0xE659,
-  0x11DD,0x6FCC,0x8EAB,0xABC4,0x89E5,0x30DD,0x3786,0x538C,0x93E2,0x91B2,0xEA21,0x6800,
-  0xA929,0x517C,0x96A5,0x96A5,0xB7AD,0xF8B5,0xF6AD,0xF7B5,0xDBCE,0x7DE7,0xFBCE,0x18B6,
-  0xF7B5,0x1595,0xEE8B,0xAFCC,0x93F5,0x2ECC,0xACAB,0xAC93,0x8FBC,0x4ECC,0x6BB3,0xABC3,
-  0xCBBB,0x4DC4,0x4EB4,0x0DAC,0xB0CC,0x52E5,0x0CD4,0x8ABB,0x486A,0x6441,0xEA6A,0x3495,
-  0x359D,0x75A5,0xF494,0xD394,0xB6A5,0x38BE,0x18B6,0x938C,0xCC4A,0x4A21,0xAA00,0x0919,
-  0x2EAA,0x51EA,0xB794,0x5E3E,0x548E,0xE1FE,0x4CC4,0x537A,0xCBC9,0xE6F1,0x6A71,0xAA00,
-  0x0A09,0x4A19,0x4B19,0x6B19,0x0811,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B21,0x4B19,0xC800,0x8739,
-  0x11E5,0x10DD,0x70C4,0x2CD5,0x89D5,0xCFBC,0x759D,0xF7AD,0xF5E3,0xEFA9,0x2929,0xEA10,
-  0xEE52,0x76A5,0x59BE,0xD7AD,0xD7AD,0x79C6,0x99C6,0xD7AD,0x59BE,0x7DE7,0x7DEF,0x9AC6,
-  0xBAC6,0xB7AD,0x5184,0x4FAC,0x52ED,0x11DD,0x2EBC,0x8D7B,0x75AD,0x7AD6,0x33BD,0xEFC4,
-  0xB5C5,0x5094,0x4B83,0x0DB4,0xAFCC,0xEDC3,0x0CD4,0x8BBB,0x0662,0xC749,0x2C6B,0xCE7B,
-  0x0F84,0x75A5,0xB6AD,0x349D,0x1495,0x149D,0x38BE,0xDACE,0xF7B5,0x8F6B,0x6919,0x0A19,
-  0x2EAA,0x51E2,0x56A4,0xFD55,0x5486,0x01FF,0x8DC4,0x5282,0xEBC1,0xC7D9,0x4871,0x6729,
-  0x8731,0xE910,0x0A11,0x6B21,0x4B19,0xC710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A21,0x6B19,0xC808,0x6739,
-  0x32E5,0x72ED,0xD1D4,0xCED4,0xABD4,0xB0C4,0x75AD,0xF59C,0x75DB,0xCFB1,0xA728,0xC710,
-  0x0E8C,0xF1BC,0xD3A4,0x769D,0x38BE,0xF7B5,0x96AD,0x359D,0xD7AD,0x1CD7,0x9EEF,0x1CD7,
-  0x9AC6,0xF7B5,0xF48C,0x0F94,0x4EC4,0x32DD,0xD0D4,0xF1CC,0x32C5,0x34A5,0x3495,0x53A5,
-  0x55A5,0x4E94,0x8FC4,0x12DD,0x2EC4,0xAAC3,0x2CCC,0x29AB,0x467A,0x2752,0x6952,0x8D7B,
-  0x149D,0x55A5,0x1495,0x349D,0x349D,0xF494,0x96A5,0xBBD6,0xDBD6,0x75A5,0x8C42,0x6700,
-  0x0DA2,0x72EA,0x979C,0x1E46,0x7586,0xE1FE,0x4BC4,0x9482,0xADB9,0x07DA,0x2CB3,0x2DBC,
-  0xECB3,0x0952,0x0911,0x4A19,0x6B21,0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4919,0x6C21,0xE910,0x2629,
-  0x4ECC,0x93F5,0x8FD4,0x2ED4,0xD0EC,0x53DD,0x59B6,0x93B4,0x12E3,0xCFA9,0xE720,0x0942,
-  0x30DD,0x6DCC,0x3094,0x769D,0xF7B5,0xB6AD,0x1495,0x96A5,0x9AC6,0xBACE,0xDBCE,0x1CDF,
-  0x79C6,0xF7B5,0xB6A5,0x7194,0x8C9B,0x8FC4,0x73ED,0xD4FD,0xF0EC,0x4EBC,0xB1A4,0xD2AC,
-  0xB0B4,0x10D5,0xF4FD,0xF1DC,0xABB3,0x2CD4,0xABB3,0x09A3,0x2A9B,0xAD83,0xB28C,0x18BE,
-  0x79BE,0x1495,0x149D,0xB6AD,0x76A5,0x559D,0xB6A5,0x9ACE,0x1CDF,0x79C6,0x517C,0xCA39,
-  0x8FAA,0x31E2,0x1694,0xBC4D,0x339E,0xE1FE,0x8BCC,0x747A,0x2EB2,0x29E3,0x8FDC,0xD4FD,
-  0x71FD,0xE88A,0x2719,0x2A09,0x6B21,0x0911,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0919,0x8C21,0x0911,0xC610,
-  0xE89A,0x72F5,0xD0E4,0xAFDC,0xD4FD,0xF5ED,0x99D6,0x56E6,0x92EC,0xEC99,0xC959,0xB0B4,
-  0x72F5,0x2EB4,0x139D,0xD7AD,0x55A5,0x18B6,0x38BE,0xDACE,0x9DE7,0x1CD7,0xD7AD,0xF7B5,
-  0x79C6,0x17B6,0xD7AD,0x559D,0x2F8C,0xECA3,0x93ED,0xD4FD,0xD4FD,0xB3FD,0x11E5,0xD0DC,
-  0x52ED,0xF5FD,0x11DD,0xEDC3,0xCCCB,0xECC3,0xE99A,0x6AB3,0x2EB4,0xB7B5,0x9DE7,0x9EEF,
-  0x9ACE,0x18BE,0x9AC6,0x7AC6,0x75A5,0xF494,0x96A5,0x7AC6,0xDBD6,0x18BE,0xB384,0x6F6B,
-  0xD2BA,0x51CA,0xF39B,0x178D,0xAEC5,0x21FF,0x0DC5,0x5292,0xEEB2,0x0BCC,0x2ECC,0x11E5,
-  0x0CC4,0xC659,0xE710,0x4B11,0x6B21,0xE810,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0811,0x8C21,0x2A11,0xC710,
-  0x066A,0x10E5,0xF4FD,0x93F5,0xB4F5,0xB3F5,0xB3F5,0x57E6,0x93DD,0x6BBB,0xADBB,0xB3F5,
-  0xECC3,0x0F8C,0x559D,0xD7B5,0xB6AD,0xF7B5,0x3CDF,0x9EEF,0x7DEF,0x5DDF,0x38B6,0xF494,
-  0x79C6,0xF7B5,0x75A5,0xB7A5,0x34A5,0xCC93,0x8FC4,0x93F5,0x15FE,0x72ED,0x8FCC,0xF0D4,
-  0xD4FD,0x73ED,0x4DC4,0xECC3,0xECC3,0x29A3,0x09A3,0xAACB,0xD1B4,0x18AE,0xBAC6,0x9AC6,
-  0xFBD6,0x9EEF,0x3CDF,0x18B6,0x559D,0x1495,0x559D,0x76A5,0x559D,0xD394,0xD06B,0xAD52,
-  0x70C2,0x52BB,0x35A5,0x76AD,0xCCD5,0x21FF,0x4CBC,0xD3BA,0xAECB,0xEBC3,0xCDC3,0xEBCB,
-  0xA549,0x6500,0xE910,0x8B21,0x4A19,0xC610,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x8B21,0x4A19,0x0909,
-  0x8541,0x2DCC,0xD3F5,0xD5ED,0xB4ED,0xB3F5,0xB3F5,0xD4F5,0xD4ED,0x93ED,0x93FD,0x52ED,
-  0xACAB,0xD39C,0xD394,0xF39C,0x18B6,0x59BE,0x9AC6,0x5DDF,0xDBCE,0x17B6,0xF6AD,0xB6AD,
-  0xBAC6,0xF7B5,0x559D,0xB7A5,0x96AD,0x0FA4,0xC892,0x4EC4,0xD4F5,0x32E5,0x2DB4,0xEFC4,
-  0xB3F5,0x6FDC,0xECC3,0xCBB3,0xE99A,0xC89A,0xCBC3,0xEAD3,0xB1B4,0xD8AD,0x18B6,0x18B6,
-  0xFBD6,0x7DE7,0x99C6,0x75A5,0x75A5,0x76A5,0x76A5,0x559D,0xF394,0xB6AD,0x59BE,0x14A5,
-  0x4FCC,0xAFDC,0x369D,0xB975,0x4FB6,0x25EE,0x2DBC,0xEEC3,0x32DD,0xF0DC,0x09A3,0xA651,
-  0x8408,0x0911,0x6B19,0x6B19,0x2919,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4B19,0x0A11,
-  0x0621,0xABBB,0x92FD,0xD4ED,0xB3F5,0x93F5,0xB3F5,0x93F5,0x93F5,0xF5F5,0xB3FD,0x6DDC,
-  0xEE8B,0xD38C,0xB28C,0x7284,0xB6A5,0x38B6,0x96A5,0x38BE,0x59BE,0xD6AD,0xF7B5,0x7AC6,
-  0x59BE,0xF7AD,0x559D,0x759D,0x96AD,0x51A4,0xE89A,0x09A3,0x6EC4,0x8FC4,0x0CA4,0x8EBC,
-  0xAFCC,0x4EB4,0xABAB,0x09A3,0x09AB,0xABCB,0x0CD4,0x8BC3,0xD2AC,0x18AE,0x58BE,0x9AC6,
-  0x99C6,0xDBCE,0x18B6,0x1495,0x559D,0xB7AD,0x75A5,0x1495,0x55A5,0x96A5,0x96AD,0xB4E5,
-  0x51E5,0xF0CB,0xF974,0xD97D,0xEED4,0x4AD4,0x2DC4,0x52E5,0x32E5,0xACC3,0xC669,0x8408,
-  0x0811,0x4A19,0x6B21,0x2A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6A21,0x4B19,0x0A11,
-  0x0721,0x4AA3,0x31F5,0xD4FD,0xB4F5,0xB3F5,0xB3F5,0xD4F5,0xF4FD,0xB3F5,0x6EE4,0x49B3,
-  0xB294,0x3595,0x9284,0x3184,0x139D,0xB6AD,0xF494,0x349D,0x18BE,0x18BE,0xB7AD,0x18B6,
-  0xD7AD,0x559D,0x149D,0x5595,0xD39C,0xACAB,0xCBC3,0x09AB,0xE992,0x8B9B,0x0DAC,0x0EB4,
-  0xEDAB,0x4A93,0xE892,0x29B3,0xECCB,0x2DD4,0x0CD4,0xCDB3,0x14A5,0x9ABE,0xBACE,0x59BE,
-  0xF8B5,0x18B6,0xB7AD,0x96A5,0xB6A5,0x75A5,0x96AD,0xF7B5,0x979D,0x7284,0x2EA4,0x31ED,
-  0x52ED,0xF39B,0xD76C,0x54A5,0xECE3,0xCCBB,0x11E5,0x52ED,0x4DDC,0x277A,0xA518,0xE808,
-  0x6B21,0x8B21,0x2A19,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B19,0x2A11,
-  0xE720,0xA892,0x6EDC,0x72ED,0xD4F5,0x93ED,0xB4F5,0xB3FD,0x31F5,0x6EDC,0xCBC3,0xACA3,
-  0x349D,0x96A5,0x149D,0x7184,0x3184,0xB38C,0xB38C,0xB38C,0x96AD,0xD7B5,0x559D,0x75A5,
-  0x349D,0xD394,0xD38C,0xB384,0x0F8C,0x49B3,0xCBC3,0x8BBB,0xC89A,0xC992,0x4B9B,0x2A93,
-  0x2A9B,0xE99A,0x29AB,0xCBCB,0x0DD4,0x0CCC,0xAAC3,0x70A4,0xF8B5,0x9AC6,0x38B6,0x18B6,
-  0x59BE,0xBACE,0x38BE,0x18B6,0x18B6,0x76A5,0xB7AD,0x39B6,0x718C,0x8C9B,0xD0D4,0xB4E5,
-  0x52E5,0x13B5,0x14AD,0x8FC4,0xCBCB,0x4EC4,0xB3F5,0x8EE4,0x6682,0xE420,0xC700,0x6B21,
-  0x6B21,0x2A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0811,0x8C21,0x4A19,
-  0xC718,0x0672,0xABC3,0xD0DC,0x10ED,0xF0DC,0xD0E4,0xAFDC,0x4EC4,0x6FC4,0x11BD,0x12A5,
-  0xB28C,0x1495,0x76A5,0xD38C,0xD073,0xD073,0x117C,0x928C,0x559D,0x359D,0xD394,0x1495,
-  0xD394,0xD394,0x9384,0xEF7B,0x8C8B,0x8AB3,0x6AB3,0x8AB3,0x8AB3,0x09A3,0xA892,0xC892,
-  0xC8A2,0x6AB3,0xEBCB,0xCBC3,0xABBB,0xAAC3,0x8BB3,0x55AD,0xBBC6,0x58BE,0xB6A5,0x38BE,
-  0x79C6,0x3CDF,0xBACE,0x38BE,0x18B6,0x96A5,0xB6A5,0xD38C,0xACA3,0x4DDC,0xF5F5,0x57E6,
-  0x73E5,0x72ED,0x52ED,0x0DC4,0x8BB3,0x8FDC,0x6DD4,0xA88A,0x8318,0x6500,0x6A21,0x6B21,
-  0x2A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC710,0x8C21,0x4A19,
-  0xC708,0x6649,0x2AB3,0x2CDC,0xCBCB,0xCBCB,0xABBB,0x2FA4,0x55A5,0x79BE,0x39BE,0xB284,
-  0xAF73,0x117C,0x9384,0xB38C,0x317C,0xD073,0x8F6B,0x117C,0x9384,0x728C,0x718C,0xF494,
-  0x1495,0xD494,0x527C,0x8E7B,0x0B93,0x29AB,0x4AAB,0x4AAB,0x6AB3,0x6AB3,0x4AAB,0x6AAB,
-  0x8BB3,0x8AB3,0x8AB3,0x8AB3,0x6AB3,0x4AA3,0x50A4,0x79C6,0x9AC6,0xF7B5,0xF6AD,0xB6AD,
-  0x759D,0xD7AD,0x59C6,0x59BE,0xD7AD,0x349D,0x1495,0xCD9B,0xD0DC,0x15FE,0xB4ED,0x93F5,
-  0x52F5,0x32E5,0xD0E4,0xABC3,0x6ABB,0x0CD4,0x467A,0x6210,0xA600,0x6B21,0x6B21,0x2A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4B19,
-  0x0911,0x2719,0xC982,0xCBCB,0x8BBB,0xECA3,0xD294,0x96A5,0xD7AD,0xF7AD,0x1495,0x0D5B,
-  0x0D5B,0x6F63,0xAF6B,0xF073,0x117C,0xF073,0x8F6B,0x6F63,0xED5A,0x2D5B,0x317C,0xD48C,
-  0x1495,0x7284,0x8F63,0xEB72,0xA89A,0xC8A2,0x09A3,0x09A3,0x09A3,0x09A3,0x09A3,0x09A3,
-  0x29A3,0x29AB,0x4AAB,0x29AB,0x2A9B,0x308C,0xD7AD,0x59C6,0xD7B5,0x3495,0x1495,0x559D,
-  0x769D,0x75A5,0x76A5,0x76A5,0x76A5,0x149D,0xAD9B,0xD0DC,0xF4FD,0xD4F5,0x93F5,0x52F5,
-  0x32E5,0x30ED,0xCCBB,0x6AB3,0x0CD4,0xA892,0x6210,0xA800,0x6B19,0x6B21,0x2919,0x6308,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B19,0x4A19,
-  0x0919,0xAA21,0x4D6B,0x2F9C,0x5094,0x139D,0x5595,0x559D,0x1495,0x75A5,0x1495,0xED52,
-  0x4B42,0x8B4A,0xAB52,0xCC52,0x2E5B,0x4E63,0x8F6B,0xB06B,0x8F6B,0x2E63,0x2D5B,0x6E63,
-  0xD073,0x8F6B,0x0E53,0xAA6A,0x468A,0x6782,0xC892,0xE892,0xC892,0xC892,0xC892,0xC8A2,
-  0xC89A,0xE9A2,0xC8A2,0xE98A,0xF07B,0x769D,0xF7AD,0xD7B5,0x75A5,0x349D,0x559D,0xB6AD,
-  0x359D,0x1495,0x349D,0x75A5,0x559D,0xD394,0x0DC4,0x93FD,0xB3F5,0x32E5,0x52E5,0x10E5,
-  0xAFDC,0x2CCC,0xEBCB,0xEBD3,0xA892,0xA318,0xC808,0x4B19,0x8C21,0x2919,0x6308,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4B19,0x4A19,
-  0x4A19,0xE710,0x0D5B,0xF38C,0xD38C,0x9284,0x928C,0xB38C,0x9284,0x96A5,0xF7B5,0x8F6B,
-  0x8921,0xC931,0x4A42,0x2A3A,0x2B3A,0xAC4A,0x4B42,0x0A3A,0x6B42,0xAC4A,0x4A42,0x2A3A,
-  0xAC4A,0xCC52,0xAC4A,0x6A52,0x476A,0x876A,0x8772,0x477A,0x277A,0x6782,0x878A,0x878A,
-  0x878A,0x8692,0x887A,0x8E6B,0x148D,0x96A5,0x75A5,0x96A5,0x75A5,0x149D,0xF494,0xF494,
-  0x928C,0xF494,0xB38C,0xD38C,0xF494,0x718C,0xD0D4,0x72ED,0x73E5,0x11E5,0xAFDC,0x4ED4,
-  0x0CD4,0x2CE4,0x8AB3,0x0662,0xA320,0xA600,0x6B19,0x8C21,0x0919,0x6308,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2A19,0x6B19,
-  0x6B19,0x8500,0x6729,0xF07B,0xF394,0x317C,0x7284,0xD48C,0x1495,0xF7B5,0xF7B5,0x8F63,
-  0x2819,0x0719,0x8F63,0x359D,0xD173,0x6921,0x093A,0x0D53,0xED52,0x4B42,0x4B3A,0x0A32,
-  0x8929,0x6821,0x0A3A,0x0A42,0x8739,0xA639,0xE739,0x0762,0xE669,0x066A,0x4772,0x276A,
-  0x276A,0x2762,0xCC5A,0x1174,0xB38C,0x7284,0x5184,0x517C,0x5184,0x117C,0xAF6B,0x4E63,
-  0x6F63,0x317C,0x117C,0x1174,0x5184,0x0E9C,0x6ECC,0xD0D4,0xF1DC,0x8EDC,0x0CD4,0x0DD4,
-  0x0CDC,0x6BAB,0x8649,0x4300,0xA600,0x6B21,0x6B21,0x0819,0x6308,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x6B19,
-  0x4B19,0x2919,0x8508,0x094A,0x928C,0xB38C,0xD38C,0xF394,0x1495,0x1495,0xB38C,0x6F63,
-  0x8A21,0x4600,0x938C,0xFFFF,0xD8BD,0xA508,0x728C,0x5CDF,0xF494,0xB073,0x938C,0x2E5B,
-  0xEE5A,0x8D4A,0xCA31,0x6821,0x8929,0x8831,0xA931,0xC839,0x6639,0x6639,0xC741,0xE841,
-  0xE841,0x0A3A,0xCD4A,0x2E63,0x0D5B,0x0D5B,0xEC52,0xCC52,0xED52,0x0D5B,0xED5A,0xCD52,
-  0x0E5B,0x6F6B,0xD073,0x1174,0x3084,0xECAB,0xCACB,0x2DD4,0x2DD4,0xEBD3,0x0BD4,0x0CD4,
-  0x2AA3,0x2729,0x4500,0xE910,0x8C29,0x6B19,0x0919,0x4208,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,
-  0x4A19,0x6B19,0xE810,0x8829,0x2D5B,0xAF6B,0xD073,0xD073,0x8F6B,0x2E5B,0x8F6B,0x117C,
-  0xCC29,0x2500,0x3284,0xFFFF,0x359D,0x4B42,0xBEF7,0x9EF7,0x117C,0xF8B5,0xBEF7,0x517C,
-  0xBBD6,0x1BDF,0x4B42,0x2719,0x928C,0xB38C,0x4B42,0x0819,0x8A21,0xEA31,0x6829,0x4821,
-  0x8921,0xEA31,0xEA39,0xC931,0xA929,0xEA31,0x4B42,0xAC4A,0xCD52,0xCC52,0xCC52,0x2E63,
-  0x6E63,0x8F6B,0x4E63,0xD073,0x1495,0xD1AC,0xECCB,0xCBD3,0xECD3,0xECD3,0x0CD4,0x8CB3,
-  0x4731,0x6500,0x2A19,0x8C21,0x4A19,0x0819,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x2A19,
-  0x4A19,0x6B19,0x0911,0x2819,0xC939,0x6B42,0x4B42,0x4B42,0x4A42,0xAC4A,0x6E6B,0x6F63,
-  0xAB29,0x2600,0x938C,0xBDEF,0x38B6,0x38BE,0xFFFF,0xAC5A,0xAC52,0xBEF7,0x9ACE,0x4B42,
-  0x9EEF,0x7DEF,0x2B3A,0x2F5B,0xDFFF,0xFCDE,0x4821,0xC931,0xB7B5,0xBBD6,0xD073,0xE810,
-  0x6921,0x6929,0x8929,0x8929,0x6921,0xCA29,0x0A3A,0x4B42,0x6B42,0x4B42,0x0B3A,0x4B42,
-  0x8B4A,0xCD52,0x4B42,0xED52,0xB7A5,0x1BDF,0x6EBC,0x8BBB,0xACCB,0x8BC3,0x0EA4,0xF49C,
-  0x8C42,0x0919,0x2A19,0x6B21,0xE810,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x4A19,
-  0x4A19,0x6B21,0x6B21,0x6A21,0xA931,0xEB31,0x0A3A,0x4B42,0x6B42,0x8B4A,0xAB52,0x8B4A,
-  0x8B21,0x6700,0x5384,0x9EEF,0x9EEF,0xFFFF,0xB394,0x0300,0x3284,0xFFFF,0x938C,0x4921,
-  0x9EF7,0x79CE,0x317C,0xFCDE,0x9EF7,0x0A42,0xE710,0xF8BD,0xFFFF,0xFFFF,0x76A5,0xE710,
-  0x4821,0xC710,0x6B42,0xD7B5,0xB7B5,0x0B3A,0x4821,0xCA31,0x6929,0x6929,0x0A32,0xA929,
-  0xA929,0x0A3A,0x8829,0x4B42,0x76A5,0xBEEF,0x99CE,0xB1AC,0x2EAC,0x91A4,0x76A5,0x76A5,
-  0x4C42,0x0919,0x4A19,0x6A19,0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6C21,0x4B19,
-  0x4A19,0xC908,0x8700,0x2600,0x4600,0x0719,0xA929,0xA929,0xCA31,0x0A3A,0x2A3A,0x2A42,
-  0xAB29,0xC808,0x5384,0xFFFF,0xFFFF,0xD7BD,0xE518,0x8829,0xFCDE,0x7DEF,0xAC4A,0x4919,
-  0x1CE7,0xFBDE,0x3CE7,0x9DF7,0xED5A,0x0300,0xF49C,0xFBDE,0x59C6,0x7DEF,0xF8BD,0xC810,
-  0x2919,0x6600,0xF173,0xFFFF,0xDBDE,0x6921,0x4A21,0xE810,0x6921,0x3284,0x18BE,0xB48C,
-  0xAA29,0x8929,0x2819,0x0A3A,0x349D,0x3CDF,0x7ABE,0x75A5,0x339D,0x96A5,0xD7AD,0x7284,
-  0x6921,0xE810,0x6B21,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B21,0x2A19,
-  0x2919,0xEE4A,0x9063,0xCE52,0x2B3A,0xA929,0x2819,0x0819,0x4819,0x4919,0x2819,0xE710,
-  0xE810,0x8700,0x0A3A,0x7294,0xD49C,0x4A42,0x4500,0x6F63,0x9DEF,0xF8BD,0x2719,0xCA29,
-  0xBEF7,0xFFFF,0xFFFF,0x117C,0x8508,0x537C,0xFFFF,0x5DE7,0xF8BD,0x3CE7,0xB7B5,0xC808,
-  0x0A11,0xE810,0x96AD,0xDFF7,0x5284,0xA708,0x2A11,0xE810,0x117C,0xBEF7,0xFFFF,0x3CDF,
-  0xEB31,0x2919,0xC810,0x4B3A,0x96A5,0x38BE,0xF494,0xD494,0x1495,0x55A5,0x349D,0x8F6B,
-  0xE810,0x0911,0x8C21,0x2919,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x6B19,0x0811,
-  0x8929,0x59BE,0xFFFF,0x5CE7,0x58C6,0xB06B,0x0B32,0xB073,0x2E5B,0x6921,0x6921,0xCB31,
-  0x6921,0x0819,0x4300,0x0100,0x2408,0x6600,0xA900,0xA929,0xCF73,0x2E5B,0xC808,0xCA31,
-  0xF8BD,0xFCDE,0xF394,0x4719,0x2E5B,0xFFFF,0x5DE7,0xFBDE,0xBEF7,0xFFFF,0xF8B5,0xE810,
-  0xA800,0x8C42,0xFCDE,0xFBDE,0x2A3A,0x4500,0xA800,0x6F63,0xFBDE,0x5DEF,0xFBDE,0x1CDF,
-  0xEB31,0xE810,0xE810,0xED52,0xB6A5,0x76A5,0x5184,0x117C,0x3084,0x928C,0xD38C,0x4E63,
-  0x2919,0x0911,0x8C21,0x0811,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x2A19,0xE810,
-  0x2E5B,0x5DEF,0x7DEF,0xBBD6,0x39C6,0x8F6B,0x517C,0xFFFF,0x76AD,0x0A3A,0x5184,0x9ACE,
-  0x169D,0x3284,0xD073,0x4B42,0xC610,0x2819,0x6A21,0x8508,0x0000,0x8408,0x4B19,0xE710,
-  0xA518,0xE939,0xE610,0x4721,0x7284,0xD7B5,0xAF6B,0x6952,0x75B5,0xBEF7,0x19BE,0xE910,
-  0x6600,0x5284,0xFFFF,0xDBDE,0xED5A,0x6921,0x6C42,0x3DE7,0xDEF7,0x96A5,0x79CE,0x9EEF,
-  0x0B32,0xC808,0x0B3A,0x8F6B,0x7284,0x938C,0xD073,0xD073,0xD073,0x317C,0x317C,0xCD52,
-  0x0919,0x0911,0x8B21,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x8C21,0xE910,0x0811,
-  0x349D,0xFFFF,0x1CE7,0x149D,0xAC4A,0x2819,0x79CE,0xFFFF,0xB16B,0x6821,0x96AD,0xFFFF,
-  0xDFFF,0xDFFF,0xFFFF,0x97AD,0x2B3A,0x159D,0x9AD6,0x59C6,0x5184,0xEA31,0xE910,0x2919,
-  0x8608,0x0400,0xC808,0x0811,0x2200,0x4108,0x8408,0x2300,0x0619,0xED5A,0x4E63,0x2A19,
-  0x0919,0xF49C,0x9DF7,0xFFFF,0x9EEF,0x39BE,0x3CDF,0xFFFF,0xFFFF,0xBEF7,0xDFFF,0x3CE7,
-  0xEB31,0x2819,0x0E5B,0x8F6B,0xED5A,0x6F63,0x2E63,0x4F63,0x6F63,0xB06B,0x4E63,0xC931,
-  0x0919,0x2A19,0x6B21,0xE710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8B21,0xC808,0x6921,
-  0x9ACE,0x7DEF,0xDBDE,0x59C6,0xB06B,0xEA31,0x9EF7,0x3CE7,0xAD4A,0x4308,0xA731,0x55AD,
-  0xFFFF,0xB7B5,0x6E63,0x938C,0xDBDE,0xFFFF,0x5DE7,0xFFFF,0xDFFF,0x76AD,0x6821,0xAA29,
-  0x97AD,0xF8B5,0x6D42,0x0819,0x6B4A,0x293A,0x2919,0x0911,0xA708,0x6400,0xC710,0x0911,
-  0x8700,0x0519,0xE941,0xEE62,0xAF73,0x718C,0x17BE,0xF29C,0x8B5A,0xF183,0xFFFF,0xFFFF,
-  0x0C32,0x2819,0xCD52,0x0D5B,0x4A42,0x6B4A,0x6B42,0x8C4A,0x8B4A,0xEC52,0xCC52,0xAA29,
-  0x2A11,0x4A19,0x6B19,0xA610,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x6B21,0x2A11,0x0911,0x906B,
-  0xFFFF,0xFFFF,0x9AD6,0x34A5,0x4E63,0xD173,0xBEF7,0x149D,0x0819,0x0300,0x2821,0x38C6,
-  0xFFFF,0xAC4A,0x4300,0xF49C,0xFFFF,0xF7BD,0x8A4A,0x6E6B,0x5DEF,0x5DEF,0xEE52,0xAD52,
-  0xDFFF,0xFFFF,0x6F63,0x2B3A,0xDBD6,0xBBCE,0xEC31,0x2B11,0x6B21,0xE908,0xC808,0xCA31,
-  0x6B42,0x2719,0x0300,0x0200,0x0000,0x0100,0xA318,0xC510,0x2400,0xC518,0x0C63,0xD083,
-  0xAB29,0x6921,0x4B42,0x8C4A,0x0B3A,0xEA31,0x0A3A,0x0A3A,0xE939,0x4A42,0x6B42,0xAA29,
-  0x2A19,0x4A19,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x8B21,0xEA10,0x4A19,0x107C,
-  0xDADE,0x7DEF,0x7DEF,0xF49C,0x4E63,0x9BCE,0xFFFF,0x7ACE,0x3284,0x0C3A,0x7163,0xFFFF,
-  0x5DE7,0x2719,0xEA31,0x5CE7,0x3DE7,0x2942,0x0000,0x0519,0xBBD6,0x1DE7,0xD173,0x938C,
-  0xBEF7,0xFFFF,0x938C,0x738C,0xFFFF,0xDBD6,0x4921,0xA808,0xAC29,0x2A19,0x6A21,0x5184,
-  0x59C6,0x906B,0x2819,0x0A32,0x6F6B,0x4E63,0x2942,0xE610,0xE908,0xA708,0x0200,0x0300,
-  0xE910,0x6A21,0x4821,0x0711,0x2919,0xAA29,0x8929,0xA929,0xA929,0xEA31,0x0A32,0x6A21,
-  0x4A19,0x4A19,0x4B19,0xC610,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x2919,0x6B21,0x2A19,0x4A19,0xC931,
-  0xAA5A,0x8E6B,0x34A5,0x728C,0x6F6B,0xF8C5,0xFBDE,0xBEF7,0x5CE7,0x928C,0xB394,0xFFFF,
-  0x55A5,0x8608,0xCD4A,0xDEF7,0x5DEF,0x2E5B,0x4721,0x7284,0xFFFF,0x19BE,0x4E5B,0x9ACE,
-  0xDEF7,0xDFF7,0x59C6,0xDBD6,0xBEF7,0xF073,0xC708,0x0919,0xCC29,0xA708,0xEA31,0xFBDE,
-  0xFFFF,0x906B,0xED52,0x79CE,0xFFFF,0xFFFF,0xFFF7,0xF49C,0xAA29,0xE910,0x8E42,0x0F5B,
-  0x0C32,0x0911,0x4819,0x6821,0x2819,0x2819,0x0811,0xE710,0x4921,0x6921,0x0811,0xE810,
-  0x4A19,0x4A19,0x4B19,0x4A19,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6300,0x4A19,0x6B19,0x4A19,0x4A19,0x8608,
-  0x0200,0x0200,0x0100,0x4300,0xC710,0xE520,0xC931,0x2D5B,0x0D5B,0x6C4A,0x7284,0x79C6,
-  0x4E63,0xA708,0x6821,0x55A5,0xFFFF,0x7DE7,0x38BE,0x9EF7,0xBEF7,0x317C,0x0E5B,0xFFFF,
-  0x59BE,0x79C6,0x9DEF,0xFFFF,0xDBDE,0x2B3A,0xE908,0x2A19,0x2A19,0xA708,0x4F63,0xFFFF,
-  0x99C6,0xAF6B,0x59C6,0xFFFF,0xD7B5,0xD394,0x7DEF,0xFFFF,0x706B,0x2719,0xF7B5,0xFFFF,
-  0xB073,0x8608,0x906B,0xB6AD,0xEE5A,0x2819,0x8C42,0xEA31,0x2819,0x0811,0xE710,0xE810,
-  0x4A19,0x4A19,0x4A19,0x4B19,0xA608,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x6B19,0x4B19,0x6B21,0x6B19,
-  0x6B19,0x4B19,0x2A19,0x2919,0x0919,0xA608,0x4500,0x2300,0x6500,0xA608,0xC510,0xC418,
-  0x0819,0x8B21,0xA608,0x6629,0xD2A4,0x5DE7,0xBEF7,0xFBD6,0xED62,0x8831,0x96AD,0xFFFF,
-  0x8F6B,0x938C,0x5DEF,0xFFFF,0xB7AD,0x0911,0x0A11,0x2919,0x6600,0xC710,0x938C,0xFFFF,
-  0xB38C,0x349D,0xFFFF,0x39C6,0xE510,0x8110,0xF39C,0xFFFF,0x938C,0xED4A,0x5CDF,0xBEF7,
-  0xEA31,0x2719,0x39C6,0xDFFF,0xF073,0x6C42,0x3DE7,0x3CDF,0x0B32,0xAA29,0xF494,0xD073,
-  0x6A21,0x0911,0x6B21,0x2919,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x6308,0x8408,0xA510,0xC710,
-  0x0811,0x2A19,0x6B19,0x6B21,0x6B21,0x6C19,0x4B19,0x2911,0x2A11,0x2A19,0xE810,0xA708,
-  0x0911,0x4A19,0x2A19,0x8508,0x8310,0x6629,0xC839,0x6629,0x6408,0x2719,0xF073,0xF494,
-  0x8929,0xAC4A,0xDBD6,0xDEF7,0x317C,0x8600,0x0911,0x9484,0xB7AD,0x56A5,0x1CE7,0xFFFF,
-  0x0E5B,0xD7B5,0xFFFF,0xB494,0x0100,0x4400,0x96AD,0xFFFF,0xB494,0x117C,0xFFFF,0xFFFF,
-  0x39C6,0xB7B5,0xDFFF,0x39C6,0x6B42,0x7284,0xFFFF,0xFFFF,0x0E5B,0x7063,0xBEF7,0x18B6,
-  0x4921,0xE910,0x8C21,0x0811,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,
-  0x2100,0x4200,0x6308,0x8408,0xA508,0xE710,0x0819,0x4A19,0x6A21,0x6A19,0x6B19,0x8C21,
-  0x6C21,0x6B19,0x8C21,0x4B19,0xA708,0x2400,0x2400,0x4500,0x0811,0x2919,0xE610,0x0519,
-  0x0919,0x0619,0x494A,0x0D5B,0xEB31,0x0911,0xE810,0xD06B,0x3CE7,0xFFFF,0xFFFF,0x55A5,
-  0xE710,0xF494,0xFFFF,0xBBD6,0xF27B,0x169D,0xDFFF,0x1CDF,0x6E63,0xD49C,0xFFFF,0xFBDE,
-  0x1BE7,0xBEF7,0xFFFF,0x938C,0xCA31,0xDBD6,0xFFFF,0xFFFF,0x149D,0xD7B5,0xFFFF,0x938C,
-  0xE710,0x0911,0x8C21,0xA608,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4200,0x6308,0x8408,0xA508,0xC610,
-  0xE710,0x0819,0x0919,0x4A19,0x8C21,0xAC21,0x8C21,0xAD21,0xAD21,0x4B19,0xC808,0x8608,
-  0x6B19,0xE810,0x0300,0x2400,0x0911,0x6B19,0x0911,0xE618,0xAB52,0x7294,0xD07B,0xA929,
-  0x6700,0x0A3A,0xB6B5,0xDEF7,0xFFFF,0xFFFF,0xFBDE,0x0D5B,0x4E63,0x3DE7,0xBEF7,0xCC52,
-  0x2D5B,0x3CE7,0xBFF7,0x4F63,0x6C42,0xFFFF,0x5DEF,0x7DEF,0xFBDE,0x9DEF,0x1CDF,0x0A3A,
-  0xE710,0x4A19,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x2100,0x2200,0x4308,0x6308,0x8408,0xC610,0xE710,0xE810,0x0811,0x2919,0x8B21,0x8C21,
-  0x6B19,0x8C21,0x8C21,0x6B21,0x6B21,0x6B19,0x6B21,0xE710,0x0200,0x0100,0x0300,0x8700,
-  0x6B19,0x4400,0x6529,0xEF7B,0x149D,0xB38C,0xAC52,0x0300,0x6F6B,0x5DEF,0x76AD,0x0300,
-  0x0A32,0x9EEF,0x5ACE,0x6C42,0xB48C,0xFFFF,0xB294,0x18BE,0xFFFF,0xFFFF,0xF8B5,0x0811,
-  0x2919,0x6B21,0x2919,0x4308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4200,0x6308,0x8408,
-  0xC610,0xE710,0x2911,0x4A19,0x4A19,0x4A19,0x6B19,0x8C21,0x8C21,0x6B21,0x6B21,0x6B21,
-  0x4A19,0x4A19,0x8508,0x0100,0x0100,0x0100,0x4500,0x0911,0xAA29,0x8A4A,0x0A3A,0x0819,
-  0x6F63,0x99CE,0x906B,0x8C42,0xDBD6,0x5DEF,0xC931,0xB38C,0xFFFF,0x9EF7,0x5284,0xA708,
-  0x4A19,0x8C21,0xC610,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0x2200,0x4308,0x8408,0xA510,0xC710,0x0819,0x2919,0x4A19,0x4B19,
-  0x6B19,0x6B21,0x6B19,0x4A19,0x2A19,0x2A19,0x6B19,0x4A19,0xC708,0x4500,0xA708,0x4A19,
-  0xC510,0x8310,0xC610,0x6921,0xAB52,0x0B63,0xC710,0xAC4A,0x59C6,0x17BE,0x6B42,0xC908,
-  0x4B19,0x6B21,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x2100,0x2100,0x4200,0x6408,
-  0x8508,0xC610,0x0811,0x2919,0x4A19,0x6B21,0x8B21,0x6B21,0x4B19,0x4B19,0x4B19,0x6B21,
-  0x0911,0xA708,0x0911,0x0811,0x6400,0x6508,0x0911,0xC610,0x0421,0x4721,0x2919,0x4B19,
-  0x4B19,0x2919,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0x2100,0x2200,0x4300,0x6308,0x8408,0xA610,0xE710,0x2819,0x2919,0x2919,
-  0x4B19,0x8C21,0x8C21,0x6B19,0x2A11,0x0A11,0x6B21,0x0911,0x6500,0x6600,0x0911,0x4A19,
-  0x6B19,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x4200,0x6308,
-  0x6408,0xA508,0xC610,0x0711,0x4919,0x4A19,0x2A19,0x6C21,0xAD21,0xAC21,0x6B21,0x6B21,
-  0x6C21,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0x4300,0x8408,0x8508,0xC610,0xE710,0x0811,0x2919,
-  0x0919,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x4200,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// Delta 0: 85x83 at (18, 22), 3875 bytes
+static const uint8_t spaceman_delta_0_rle[3875] PROGMEM = {
+  0xEB,0x00,0x00,0xE7,0xE3,0x01,0x21,0xC8,0x81,0x01,0x00,0x00,0xE1,0xDC,0x80,0x01,
+  0x00,0x20,0xD4,0x01,0x10,0xDD,0xD9,0x80,0x01,0x00,0x20,0xDA,0x00,0x10,0xDB,0xD7,
+  0x00,0x10,0x80,0x02,0xCB,0x00,0x60,0x81,0x02,0x00,0x60,0xCD,0x00,0x10,0xD9,0xD5,
+  0x00,0x10,0x80,0x02,0xC7,0x02,0x62,0x60,0xC3,0x00,0x70,0xC6,0x02,0x26,0x20,0xC8,
+  0x00,0x10,0xD7,0xD3,0x80,0x01,0x00,0x20,0xC6,0x01,0x64,0xD3,0x00,0x20,0xC8,0x00,
+  0x10,0xD5,0xD2,0x01,0x12,0xC6,0x80,0x06,0x00,0x70,0xC7,0x00,0x60,0x80,0x07,0x00,
+  0x60,0x80,0x07,0xC9,0x00,0x20,0xC7,0x00,0x00,0xD3,0xD1,0x00,0x20,0xC7,0x00,0x70,
+  0xC4,0x00,0x60,0xD6,0x00,0x20,0xDA,0xCF,0x01,0x12,0xC6,0x00,0x70,0xC3,0x82,0x06,
+  0x02,0x7E,0xA0,0xC9,0x80,0x0A,0xC8,0x01,0x62,0xD8,0xCE,0x00,0x10,0xC5,0x01,0x67,
+  0xC3,0x81,0x06,0x01,0xAB,0xD2,0x81,0x06,0x00,0x70,0xC3,0x00,0x60,0xC6,0x00,0x00,
+  0xCF,0xCD,0x00,0x10,0xC4,0x00,0x60,0xC4,0x81,0x06,0x00,0xB0,0xC5,0x80,0x0D,0x84,
+  0x0C,0x81,0x0D,0xC6,0x00,0xD0,0x80,0x06,0x82,0x07,0x00,0x60,0xC3,0x00,0x20,0xD1,
+  0xCC,0x00,0x20,0xC5,0x82,0x07,0x81,0x06,0x00,0xB0,0xC3,0x01,0xDC,0xD0,0x00,0xB0,
+  0xC3,0x00,0x60,0xC5,0x85,0x02,0xCE,0xCB,0x00,0x10,0xC4,0x00,0x60,0x81,0x07,0x81,
+  0x06,0x00,0xE0,0x81,0x0B,0x01,0xEC,0xC6,0x00,0xD0,0xD2,0x80,0x06,0x82,0x07,0x00,
+  0x60,0xC4,0x00,0x20,0xCD,0xCA,0x00,0x10,0xC4,0x00,0x60,0x81,0x07,0x80,0x06,0x00,
+  0x70,0x82,0x0B,0x00,0xC0,0xC3,0x80,0x0D,0x02,0x6A,0x70,0x81,0x05,0x80,0x07,0x00,
+  0x60,0x80,0x07,0x01,0xD7,0x80,0x0D,0xC4,0x00,0xD0,0x81,0x0B,0x00,0xA0,0xC4,0x00,
+  0x60,0x84,0x02,0xCC,0xC9,0x00,0x10,0x80,0x02,0x00,0x40,0x80,0x02,0x00,0x60,0x81,
+  0x07,0x80,0x06,0x00,0xE0,0x81,0x0B,0x00,0xC0,0xC3,0x05,0xD6,0x7A,0x96,0x80,0x08,
+  0x80,0x05,0x80,0x08,0x02,0xA6,0xA0,0xC5,0x00,0xC0,0xC3,0x81,0x0B,0x00,0xE0,0x80,
+  0x06,0x81,0x07,0x00,0x50,0x82,0x02,0xCD,0xC8,0x00,0x10,0x80,0x02,0x00,0x40,0x80,
+  0x02,0x00,0x60,0x81,0x07,0x80,0x06,0x81,0x0B,0x00,0xD0,0xC3,0x01,0xDE,0x80,0x07,
+  0x01,0xD6,0x80,0x08,0x05,0xA9,0xA8,0x59,0x82,0x08,0x00,0x60,0xC3,0x02,0xED,0xC0,
+  0xC6,0x80,0x06,0x81,0x07,0x00,0x60,0x82,0x02,0xCC,0xC9,0x00,0x40,0x81,0x02,0x00,
+  0x50,0x81,0x07,0x80,0x06,0x81,0x0B,0x82,0x0C,0x02,0xDE,0x70,0x81,0x06,0x00,0x90,
+  0x80,0x08,0x80,0x0A,0x0C,0xB9,0x85,0x8A,0x85,0x89,0x85,0x40,0xC4,0x82,0x0C,0x81,
+  0x0B,0x01,0x96,0x81,0x07,0x00,0x50,0x83,0x02,0xCA,0xC7,0x00,0x10,0xC3,0x00,0x60,
+  0x81,0x07,0x80,0x06,0x81,0x0B,0x82,0x0C,0x01,0xE7,0x80,0x06,0x0A,0x35,0x8A,0x8A,
+  0xBD,0xAD,0xA0,0x81,0x08,0x00,0xB0,0x81,0x08,0x01,0xA5,0x80,0x01,0x01,0x36,0x80,
+  0x07,0x00,0xE0,0xC3,0x81,0x0B,0x80,0x06,0x81,0x07,0x00,0x40,0x80,0x02,0x00,0x40,
+  0xCB,0xC6,0x02,0x13,0x40,0x80,0x02,0x01,0x37,0xC3,0x81,0x0B,0x81,0x0C,0x00,0xD0,
+  0x80,0x07,0x01,0x64,0x80,0x01,0x0C,0x8A,0x58,0xB9,0xAB,0x98,0xA5,0x90,0x80,0x0A,
+  0x83,0x08,0x00,0x40,0x80,0x01,0x00,0x20,0x80,0x06,0x01,0x7D,0x81,0x0C,0x81,0x0B,
+  0x00,0x90,0xC3,0x00,0x30,0x80,0x02,0xCB,0xC8,0x02,0x42,0x40,0x81,0x07,0x01,0x56,
+  0x81,0x0B,0x81,0x0C,0x01,0xD7,0x80,0x06,0x00,0x10,0x80,0x02,0x81,0x08,0x04,0x58,
+  0x9A,0x90,0x82,0x08,0x00,0x50,0x80,0x08,0x00,0xB0,0x83,0x08,0x00,0x50,0x81,0x02,
+  0x01,0x16,0x80,0x07,0x00,0xD0,0x81,0x0C,0x81,0x0B,0x00,0x60,0xC3,0x82,0x02,0x00,
+  0x10,0xC8,0xC5,0x00,0x10,0x80,0x04,0x80,0x02,0x00,0x50,0xC3,0x00,0xA0,0x80,0x0B,
+  0x81,0x0C,0x03,0xD7,0x64,0x81,0x02,0x00,0x40,0x83,0x05,0x80,0x08,0x01,0x58,0x81,
+  0x05,0x01,0x8A,0x86,0x08,0x00,0x30,0x81,0x02,0x01,0x14,0x80,0x07,0x00,0xD0,0x81,
+  0x0C,0x81,0x0B,0x00,0x60,0x81,0x07,0x00,0x50,0x80,0x02,0x02,0x42,0x10,0x80,0x00,
+  0xC5,0xC5,0x00,0x30,0x81,0x02,0x00,0x30,0x81,0x07,0x01,0x6A,0x80,0x0B,0x81,0x0C,
+  0x04,0xD7,0x65,0x10,0x81,0x02,0x82,0x05,0x80,0x0B,0x02,0xAB,0xA0,0x83,0x0B,0x01,
+  0xEB,0x80,0x0A,0x80,0x08,0x00,0x50,0x80,0x08,0x00,0x50,0xC4,0x03,0x46,0x7D,0x81,
+  0x0C,0x80,0x0B,0x01,0xA6,0x81,0x07,0x04,0x12,0x42,0x10,0x82,0x00,0xC3,0xC4,0x00,
+  0x10,0x80,0x04,0x02,0x23,0x50,0x80,0x07,0x80,0x06,0x00,0xB0,0xC3,0x03,0xD7,0x64,
+  0x82,0x02,0x01,0x48,0x80,0x05,0x00,0xA0,0x80,0x0E,0x01,0xFE,0xC4,0x81,0x0E,0x00,
+  0xB0,0x80,0x0A,0x80,0x08,0x00,0xA0,0x80,0x05,0x84,0x02,0x80,0x06,0x01,0x7D,0xC4,
+  0x01,0xD6,0x80,0x07,0x00,0x50,0x80,0x02,0x01,0x43,0x83,0x00,0xC2,0xC4,0x04,0x32,
+  0x42,0x30,0x81,0x07,0x01,0x6B,0xC4,0x80,0x07,0x01,0x61,0x82,0x02,0x01,0x4A,0x80,
+  0x05,0x85,0x0E,0xC3,0x81,0x0E,0x00,0xB0,0x80,0x0A,0x04,0x85,0x83,0x40,0xC5,0x00,
+  0x50,0x80,0x07,0x00,0xD0,0x80,0x0C,0x81,0x0B,0x00,0x60,0x81,0x07,0x80,0x03,0x80,
+  0x02,0x00,0x10,0x82,0x00,0xC2,0xC3,0x05,0x13,0x23,0x15,0x80,0x07,0x01,0x6A,0x80,
+  0x0B,0x81,0x0C,0x03,0xE7,0x61,0x83,0x02,0x00,0x40,0x80,0x05,0x01,0xAB,0xC9,0x82,
+  0x0E,0x01,0x7B,0x82,0x05,0x00,0x10,0xC5,0x03,0x26,0x7E,0x81,0x0C,0x80,0x0B,0x01,
+  0x96,0x80,0x07,0x04,0x51,0x24,0x30,0x82,0x00,0xC2,0xC3,0x00,0x10,0x80,0x04,0x01,
+  0x24,0x81,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x02,0xD7,0x60,0x85,0x02,
+  0x03,0x48,0x5A,0xCB,0x80,0x0E,0x00,0xB0,0x80,0x0A,0x81,0x05,0x80,0x03,0x80,0x02,
+  0xC4,0x03,0x26,0x76,0x80,0x0C,0x00,0xD0,0x80,0x0B,0x00,0x60,0x81,0x07,0x04,0x54,
+  0x24,0x10,0x82,0x00,0xC1,0xC2,0x05,0x14,0x23,0x25,0x80,0x07,0x01,0x6A,0x80,0x0B,
+  0x81,0x0C,0x02,0x76,0x40,0xC3,0x81,0x02,0x00,0x40,0x80,0x05,0x00,0xA0,0x81,0x0E,
+  0x00,0xB0,0xC3,0x80,0x0E,0x02,0xBE,0xB0,0x80,0x0E,0x02,0x7B,0xA0,0x81,0x05,0x00,
+  0x10,0xC5,0x80,0x02,0x03,0x47,0xED,0x80,0x0C,0x80,0x0B,0x00,0x90,0xC3,0x03,0x42,
+  0x41,0x82,0x00,0xC1,0xC2,0x04,0x14,0x32,0x30,0x81,0x07,0x01,0x6B,0xC3,0x03,0xE7,
+  0x62,0xC3,0x01,0x26,0x80,0x02,0x80,0x05,0x00,0xA0,0x81,0x0E,0x00,0xF0,0xC6,0x01,
+  0xEF,0x82,0x0E,0x04,0x9A,0x85,0x30,0xC8,0x02,0x67,0x60,0x80,0x0C,0x00,0xD0,0x80,
+  0x0B,0x00,0x60,0x81,0x07,0x80,0x03,0x02,0x43,0x10,0x81,0x00,0xC1,0xC2,0x00,0x10,
+  0x81,0x04,0x00,0x50,0x80,0x07,0x80,0x06,0x80,0x0B,0x81,0x0C,0x03,0x76,0x42,0xC4,
+  0x81,0x02,0x80,0x05,0x00,0xA0,0x81,0x0E,0x00,0xD0,0xC4,0x01,0xBE,0x80,0x0D,0x00,
+  0x90,0x82,0x0D,0x02,0x8A,0x50,0x80,0x03,0x82,0x02,0x00,0x60,0xC3,0x80,0x07,0x00,
+  0xD0,0x80,0x0C,0x80,0x0B,0x01,0x96,0x80,0x07,0x03,0x31,0x24,0x81,0x00,0xC2,0xC2,
+  0x00,0x20,0x80,0x04,0x01,0x85,0x80,0x07,0x01,0x6A,0x80,0x0B,0x80,0x0C,0x02,0xE7,
+  0x60,0x81,0x02,0x00,0x40,0x84,0x02,0x02,0x35,0x90,0x80,0x0D,0x82,0x09,0x00,0xD0,
+  0x81,0x0E,0x01,0xDA,0x82,0x05,0x00,0x90,0x80,0x0A,0x81,0x05,0x87,0x02,0x80,0x06,
+  0x01,0x7E,0x80,0x0C,0x03,0xDB,0xA6,0x80,0x07,0x04,0x52,0x42,0x30,0x80,0x00,0xC2,
+  0xC1,0x02,0x13,0x40,0x80,0x01,0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x02,0x76,
+  0x40,0xC4,0x00,0x40,0x82,0x02,0x03,0x35,0xAD,0x80,0x0A,0x82,0x05,0x02,0x9D,0x90,
+  0x80,0x0A,0x01,0xB7,0x80,0x05,0x00,0x80,0x80,0x0A,0x80,0x05,0x00,0x30,0x86,0x02,
+  0x01,0x62,0x80,0x06,0x00,0x70,0x81,0x0C,0x80,0x0B,0x00,0x60,0x81,0x07,0x04,0x14,
+  0x32,0x10,0xC3,0xC1,0x01,0x13,0x80,0x02,0x00,0x30,0x80,0x07,0x01,0x6A,0x80,0x0B,
+  0x81,0x0C,0x01,0xE6,0x80,0x02,0x02,0x42,0x40,0xC3,0x80,0x02,0x03,0x35,0xA8,0x81,
+  0x0B,0x07,0x78,0x58,0xDA,0x57,0x80,0x0B,0x01,0x75,0x81,0x0A,0x80,0x05,0x80,0x01,
+  0x02,0x24,0x60,0x85,0x02,0x02,0x67,0xD0,0x80,0x0C,0x80,0x0B,0x00,0x90,0x81,0x07,
+  0x02,0x13,0x20,0x81,0x04,0x00,0x30,0xC1,0xC2,0x80,0x04,0x01,0x35,0x80,0x07,0x01,
+  0x6A,0xC3,0x02,0xD7,0xD0,0x83,0x02,0x02,0x42,0x60,0x81,0x02,0x07,0x15,0x8A,0x5B,
+  0x7B,0x82,0x0A,0x04,0xB8,0x5A,0xB0,0x83,0x0A,0x80,0x05,0x04,0x38,0x9C,0x40,0x85,
+  0x02,0x02,0x67,0xE0,0x80,0x0C,0x80,0x0B,0x01,0xA6,0x80,0x07,0x07,0x51,0x31,0x24,
+  0x23,0xC0,0xC1,0x00,0x30,0x81,0x02,0x00,0x50,0x80,0x07,0x03,0x6A,0xBD,0x80,0x0C,
+  0x00,0x70,0x80,0x06,0x80,0x02,0x02,0x42,0x40,0x82,0x02,0x81,0x04,0x80,0x05,0x07,
+  0xB7,0x5A,0xBA,0x75,0x80,0x0E,0x00,0x70,0x80,0x05,0x02,0x7A,0x70,0x81,0x0A,0x80,
+  0x05,0x05,0x8C,0xFD,0xCD,0x80,0x06,0x82,0x02,0x00,0x40,0x80,0x07,0x80,0x0C,0x00,
+  0xD0,0x80,0x0B,0x00,0x60,0x80,0x07,0x80,0x05,0x01,0x84,0x80,0x03,0x01,0x42,0xC0,
+  0xC0,0x02,0x32,0x40,0x80,0x03,0x00,0x50,0x80,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,
+  0x01,0xE7,0x80,0x02,0x04,0x42,0x42,0x40,0xC3,0x08,0x46,0x85,0xAE,0x7A,0x70,0x80,
+  0x0A,0x00,0xB0,0x80,0x0E,0x02,0xB7,0x50,0x81,0x0A,0x01,0xB7,0x81,0x05,0x06,0x9D,
+  0xF9,0xDF,0xD0,0x80,0x0C,0x01,0x64,0x80,0x02,0x80,0x07,0x00,0xD0,0x80,0x0C,0x80,
+  0x0B,0x00,0x60,0x81,0x07,0x80,0x0E,0x04,0x53,0x24,0x30,0xC0,0x05,0x12,0x43,0x25,
+  0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x03,0x76,0x24,0x81,0x02,0x00,0x40,0x80,
+  0x02,0x00,0x60,0x81,0x04,0x80,0x0D,0x03,0x8A,0xEB,0x80,0x0A,0x01,0x5B,0x82,0x0E,
+  0x00,0xA0,0x80,0x0B,0x03,0xEB,0xAB,0x81,0x05,0x82,0x0D,0x02,0x9C,0xD0,0x80,0x0F,
+  0x06,0xDC,0x42,0x67,0xD0,0x80,0x0C,0x80,0x0B,0x80,0x06,0x08,0x7B,0xEB,0x71,0x34,
+  0x20,0xC0,0x00,0x30,0x80,0x04,0x03,0x23,0x8A,0x80,0x07,0x00,0x60,0x80,0x0B,0x80,
+  0x0C,0x02,0xE7,0x60,0x80,0x02,0x02,0x42,0x40,0x80,0x02,0x80,0x04,0x06,0x9D,0x9C,
+  0xD9,0xA0,0x81,0x0E,0x02,0xAB,0xA0,0x80,0x0E,0x01,0xB7,0x81,0x0A,0x80,0x0E,0x01,
+  0x7A,0x80,0x05,0x02,0x89,0x80,0x81,0x0D,0xC3,0x08,0xFD,0x94,0x67,0xDC,0xD0,0x80,
+  0x0B,0x00,0xD0,0x80,0x07,0x80,0x0A,0x00,0x70,0x80,0x01,0x80,0x04,0x00,0x30,0xC0,
+  0x04,0x32,0x41,0x50,0x80,0x0A,0x02,0xB6,0xA0,0x80,0x0B,0x80,0x0C,0x09,0xD7,0x62,
+  0x42,0x42,0x46,0x80,0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x80,0x0D,0x00,0x90,0x80,
+  0x0E,0x82,0x0A,0x02,0x7A,0x70,0x83,0x0A,0x00,0xB0,0x80,0x0A,0x81,0x05,0x00,0x80,
+  0x80,0x0D,0x00,0xC0,0x82,0x0D,0x81,0x0F,0x06,0xD6,0xD7,0xEC,0xE0,0x80,0x0B,0x01,
+  0xA6,0x81,0x0A,0x05,0x51,0x34,0x21,0xC0,0x00,0x30,0x80,0x04,0x06,0x25,0xE7,0xB7,
+  0x60,0x80,0x0B,0x80,0x0C,0x02,0xE7,0x60,0x80,0x02,0x00,0x40,0x80,0x02,0x00,0x60,
+  0x87,0x0D,0x0B,0x9A,0xEB,0xA8,0xDE,0xAB,0xED,0x80,0x0A,0x00,0xE0,0x82,0x0A,0x02,
+  0x58,0xC0,0x84,0x0D,0x02,0xCD,0xF0,0x80,0x0D,0x80,0x06,0x01,0x7F,0x80,0x0D,0x81,
+  0x0B,0x04,0xAE,0xA5,0x10,0x80,0x03,0x01,0x41,0xC1,0x04,0x12,0x41,0x30,0x80,0x0A,
+  0x02,0x7A,0xD0,0x80,0x0B,0x80,0x0C,0x00,0xD0,0x80,0x06,0x82,0x02,0x01,0x6C,0x80,
+  0x0D,0x01,0xCD,0x80,0x0F,0x82,0x0D,0xC4,0x00,0xA0,0x82,0x0D,0x00,0x90,0x80,0x0E,
+  0x00,0xA0,0xC3,0x01,0xAD,0x81,0x0F,0x01,0xDF,0x83,0x0D,0x03,0xCD,0xC9,0x80,0x0E,
+  0x80,0x0C,0x80,0x0B,0x00,0xA0,0x80,0x0E,0x05,0x73,0x13,0x42,0xC2,0x09,0x13,0x42,
+  0x15,0xB7,0xEA,0x80,0x0B,0x05,0xDC,0xE7,0x62,0x80,0x04,0x00,0x60,0x81,0x0D,0x01,
+  0xFD,0x83,0x0F,0x80,0x0D,0x03,0x9A,0xEB,0x80,0x0E,0x03,0xDA,0xDA,0x80,0x0E,0x00,
+  0xB0,0xC4,0x01,0xED,0x83,0x0F,0x85,0x0D,0x01,0xFD,0x80,0x0E,0x80,0x0C,0x01,0xEA,
+  0x80,0x0E,0x06,0x75,0x13,0x43,0x10,0xC2,0xC0,0x01,0x32,0x80,0x03,0x0B,0x5E,0xA7,
+  0xAB,0xED,0xCD,0x76,0x80,0x02,0x01,0x9F,0x80,0x0D,0x00,0xF0,0x82,0x0D,0x81,0x0F,
+  0x81,0x0D,0x80,0x0A,0x82,0x0E,0x00,0xA0,0x82,0x0E,0x82,0x0A,0x00,0x50,0x80,0x0A,
+  0x81,0x0D,0x81,0x0F,0x00,0xC0,0x84,0x0D,0x00,0x90,0x80,0x0E,0x81,0x0D,0x03,0x7A,
+  0xEB,0x80,0x05,0x03,0x13,0x41,0xC3,0xC0,0x01,0x14,0x80,0x02,0x04,0x3A,0xEA,0x60,
+  0x80,0x0B,0x80,0x0D,0x05,0xE7,0x62,0x59,0x85,0x0D,0x80,0x0F,0x00,0xD0,0x80,0x0F,
+  0x00,0xC0,0x80,0x0D,0x01,0x8A,0x82,0x0E,0x00,0xB0,0x81,0x0E,0x81,0x0A,0x04,0x5B,
+  0xAE,0xD0,0x80,0x0F,0x01,0xDF,0x85,0x0D,0x01,0x9A,0x80,0x0E,0x08,0xAD,0xEA,0xBA,
+  0x73,0x00,0x80,0x04,0x00,0x20,0xC4,0xC0,0x05,0x13,0x43,0x17,0x80,0x0E,0x02,0x7E,
+  0xB0,0x81,0x0D,0x08,0xE6,0x25,0xAE,0x9D,0xF0,0x80,0x0D,0x81,0x0F,0x01,0xCD,0xC3,
+  0x00,0xD0,0xC4,0x80,0x0A,0x02,0xEB,0x70,0x80,0x0A,0x00,0x70,0x81,0x0A,0x02,0xFD,
+  0xF0,0xC3,0x81,0x0D,0x02,0xFC,0xA0,0x83,0x0E,0x01,0xA7,0x80,0x0A,0x04,0x50,0x42,
+  0x30,0xC5,0xC0,0x80,0x01,0x03,0x42,0x15,0x82,0x0E,0x00,0xB0,0x80,0x0D,0x06,0xE7,
+  0x64,0x6E,0xA0,0x82,0x0D,0x82,0x0F,0x80,0x0D,0x00,0xF0,0x82,0x0D,0x04,0x95,0xAB,
+  0xE0,0x80,0x0A,0x00,0xE0,0x80,0x0A,0x04,0x8A,0xB7,0xB0,0x80,0x0D,0x01,0xFD,0x82,
+  0x0F,0x05,0xDF,0xCD,0x9A,0x83,0x0E,0x80,0x0A,0x06,0xB5,0x03,0x43,0x10,0xC5,0xC0,
+  0x01,0x01,0x80,0x04,0x05,0x35,0xBE,0x7B,0x80,0x0E,0x00,0xF0,0x80,0x0E,0x02,0x74,
+  0xE0,0x80,0x0A,0x00,0xC0,0x80,0x0D,0x82,0x0F,0x03,0xDF,0xCF,0x81,0x0D,0x04,0xF9,
+  0xA7,0x80,0x83,0x0A,0x01,0x57,0x82,0x0A,0x01,0xDF,0x80,0x0D,0x08,0xFC,0xFD,0xFC,
+  0xD9,0xA0,0x82,0x0E,0x02,0xB7,0xB0,0x80,0x07,0x80,0x01,0x02,0x42,0x10,0xC6,0xC0,
+  0x02,0x01,0x40,0x80,0x02,0x01,0x1A,0x80,0x0E,0x00,0xA0,0x83,0x0E,0x04,0x7A,0xEA,
+  0x90,0x82,0x0D,0x00,0xC0,0x80,0x0F,0x08,0xCD,0xFD,0xFD,0xCD,0x90,0x80,0x0A,0x01,
+  0x5A,0xC3,0x06,0xAB,0xAB,0x7A,0xF0,0x80,0x0D,0x01,0xFC,0x80,0x0D,0x04,0xFC,0xD9,
+  0xA0,0x82,0x0E,0x04,0xBE,0xA7,0xA0,0x80,0x01,0x80,0x04,0x00,0x30,0xC7,0xC0,0x80,
+  0x00,0x05,0x34,0x31,0x5A,0x88,0x0E,0x09,0xA9,0xD9,0xDF,0xDC,0xDF,0x81,0x0D,0x00,
+  0xC0,0x80,0x0D,0x00,0x90,0x82,0x0A,0x03,0x75,0xA5,0x80,0x0A,0x03,0x7A,0x7A,0x80,
+  0x0D,0x01,0xFC,0x87,0x0D,0x81,0x0E,0x0A,0xBE,0x7B,0xA0,0x13,0x42,0x00,0xC7,0xC0,
+  0x80,0x00,0x01,0x14,0x80,0x02,0x01,0x3A,0x88,0x0E,0x05,0xA9,0xDC,0x9C,0x86,0x0D,
+  0x05,0x9C,0x98,0xA7,0x81,0x0A,0x09,0x7B,0xA5,0xB7,0x89,0xDF,0x83,0x0D,0x00,0xC0,
+  0x81,0x0D,0x0A,0x9B,0xEB,0xEA,0x7E,0x71,0x00,0x80,0x04,0x01,0x31,0x80,0x00,0xC6,
+  0xC1,0x01,0x01,0x80,0x04,0x02,0x31,0x50,0x87,0x0E,0x01,0x79,0x81,0x0D,0x80,0x09,
+  0x01,0xC9,0x81,0x0D,0x00,0xC0,0x80,0x0D,0x0F,0x9D,0x8A,0x75,0xB5,0xA5,0x75,0xA5,
+  0xA8,0x83,0x0D,0x03,0xCD,0x9D,0x80,0x09,0x03,0xC9,0xAE,0x81,0x0A,0x03,0xB7,0x50,
+  0x81,0x04,0x00,0x10,0x81,0x00,0xC6,0xC1,0x80,0x00,0x00,0x20,0x80,0x04,0x02,0x25,
+  0xA0,0x85,0x0E,0x80,0x0A,0x00,0x90,0x81,0x0D,0x00,0xC0,0x82,0x09,0x05,0xC9,0xD9,
+  0xDC,0x81,0x08,0x0B,0xA5,0xA5,0xA5,0xB5,0xA5,0x89,0x82,0x0D,0x05,0xC9,0x89,0x8C,
+  0x81,0x09,0x07,0xAB,0x7B,0x7B,0x51,0x80,0x03,0x01,0x21,0x82,0x00,0xC6,0xC2,0x07,
+  0x01,0x43,0x25,0x7B,0x82,0x0E,0x01,0xBA,0x80,0x0E,0x00,0xD0,0x80,0x09,0x00,0xD0,
+  0x83,0x09,0x00,0x60,0x80,0x09,0x00,0xC0,0x81,0x09,0x00,0x80,0x89,0x05,0x03,0x9D,
+  0x9C,0x80,0x09,0x80,0x08,0x0A,0x49,0x89,0x8C,0xDA,0x7B,0x70,0x80,0x0A,0x05,0x93,
+  0x24,0x31,0x83,0x00,0xC5,0xC3,0x10,0x14,0x32,0x15,0xAB,0xAB,0x7A,0xED,0xF9,0x80,
+  0x81,0x09,0x0B,0xC6,0x94,0x94,0x94,0x98,0x48,0x84,0x05,0x00,0xA0,0xC3,0x00,0x90,
+  0x81,0x08,0x80,0x04,0x09,0x84,0x94,0xC4,0x89,0xDE,0x82,0x0A,0x80,0x0D,0x03,0x41,
+  0x42,0x85,0x00,0xC4,0xC3,0x08,0x02,0x43,0x13,0x7A,0x70,0x80,0x0A,0x01,0xDE,0x80,
+  0x0D,0x80,0x04,0x00,0x80,0x80,0x04,0x06,0x84,0x94,0x94,0x80,0x82,0x04,0x01,0x83,
+  0x83,0x05,0x00,0x30,0x80,0x05,0x08,0x38,0x34,0x34,0x84,0x80,0x84,0x04,0x00,0x80,
+  0x81,0x0F,0x00,0xA0,0x80,0x0D,0x06,0xF9,0x23,0x43,0x10,0x84,0x00,0xC4,0xC5,0x80,
+  0x04,0x03,0x23,0x5B,0x80,0x0A,0x83,0x0D,0x00,0xC0,0x80,0x04,0x00,0x80,0x8A,0x04,
+  0x84,0x03,0x00,0x10,0x85,0x03,0x87,0x04,0x04,0x83,0x4C,0xF0,0x82,0x0D,0x05,0xC8,
+  0x32,0x42,0x86,0x00,0xC3,0xC4,0x02,0x02,0x40,0x80,0x03,0x00,0x50,0x80,0x09,0x81,
+  0x0D,0x01,0x9C,0x80,0x0D,0x02,0x82,0x40,0x80,0x0D,0x02,0x94,0xC0,0x85,0x0D,0x01,
+  0x34,0x80,0x0D,0x01,0x81,0x80,0x0D,0x00,0x80,0x81,0x03,0x00,0x40,0x80,0x0D,0x00,
+  0x40,0x81,0x03,0x00,0x90,0x80,0x0D,0x00,0x40,0x80,0x03,0x05,0x4D,0xFC,0xDC,0x80,
+  0x0D,0x01,0x92,0x81,0x03,0x85,0x00,0xC4,0xC5,0x06,0x32,0x41,0x39,0xD0,0x81,0x09,
+  0x0A,0xCD,0xED,0x81,0x3D,0xF9,0x40,0x80,0x0F,0x00,0x90,0x80,0x0F,0x00,0x90,0x80,
+  0x0F,0x05,0x39,0xFD,0x38,0x80,0x0F,0x00,0xD0,0x81,0x03,0x00,0x40,0x80,0x0F,0x00,
+  0x40,0x81,0x03,0x81,0x0F,0x03,0x81,0x34,0x80,0x0D,0x83,0x09,0x05,0x82,0x32,0x41,
+  0x85,0x00,0xC3,0xC5,0x00,0x10,0x80,0x04,0x06,0x21,0x49,0xDC,0x90,0x80,0x0D,0x00,
+  0xC0,0x80,0x09,0x0E,0x21,0xCF,0x9C,0xFD,0x4F,0xD8,0xDF,0x80,0x80,0x0F,0x01,0x43,
+  0x81,0x0F,0x0A,0xD4,0x13,0x9F,0xD4,0x14,0xC0,0x81,0x0F,0x03,0xC1,0x34,0x80,0x0D,
+  0x82,0x09,0x01,0xC4,0x80,0x03,0x01,0x42,0x86,0x00,0xC3,0xC5,0x01,0x13,0x80,0x04,
+  0x02,0x31,0x40,0x83,0x09,0x00,0x40,0x80,0x09,0x02,0x41,0x90,0x82,0x0F,0x0D,0x34,
+  0xFD,0x4D,0xFD,0xF9,0x1D,0xFD,0x80,0x0F,0x05,0x81,0x29,0xF9,0x80,0x01,0x00,0x80,
+  0x80,0x0F,0x05,0xDF,0xD1,0x49,0x80,0x08,0x04,0x94,0x84,0x90,0x80,0x04,0x02,0x24,
+  0x30,0x86,0x00,0xC3,0xC6,0x03,0x12,0x42,0x80,0x03,0x80,0x08,0x02,0x48,0x40,0x80,
+  0x08,0x03,0x94,0x28,0x81,0x0F,0x06,0x91,0xDF,0x93,0xC0,0x81,0x0F,0x01,0x34,0xC3,
+  0x06,0xF9,0x14,0xDF,0xD0,0x80,0x04,0x00,0xD0,0x82,0x0F,0x03,0xD3,0x49,0x85,0x04,
+  0x05,0x84,0x34,0x21,0x85,0x00,0xC3,0xC7,0x05,0x34,0x32,0x32,0x86,0x04,0x01,0x34,
+  0x81,0x0F,0x01,0x31,0x80,0x0F,0x02,0x91,0x90,0x80,0x0F,0x01,0x94,0x81,0x0F,0x00,
+  0xD0,0x80,0x0F,0x02,0xC1,0x40,0x85,0x0F,0x00,0xD0,0x81,0x0F,0x80,0x03,0x01,0x48,
+  0x80,0x04,0x00,0x80,0x80,0x04,0x00,0x80,0x80,0x03,0x04,0x23,0x43,0x10,0x84,0x00,
+  0xC3,0xC6,0x02,0x13,0x20,0x80,0x04,0x80,0x03,0x81,0x04,0x00,0x80,0x80,0x04,0x03,
+  0x84,0x24,0x80,0x09,0x0D,0x31,0x48,0x94,0x24,0xD8,0x14,0x98,0x80,0x01,0x04,0x89,
+  0x42,0x40,0x84,0x09,0x02,0x41,0x30,0x80,0x08,0x01,0x23,0x81,0x04,0x00,0x30,0x81,
+  0x04,0x07,0x34,0x32,0x32,0x41,0x84,0x00,0xC3,0xC6,0x05,0x32,0x43,0x12,0x80,0x01,
+  0x80,0x03,0x00,0x10,0x81,0x03,0x02,0x12,0x10,0x80,0x00,0x03,0x13,0x10,0x80,0x01,
+  0x01,0x43,0x80,0x00,0x05,0x23,0x10,0x12,0x80,0x01,0x80,0x03,0x82,0x01,0x02,0x01,
+  0x00,0x80,0x01,0x00,0x30,0x81,0x01,0x00,0x40,0x80,0x03,0x00,0x10,0x80,0x03,0x00,
+  0x10,0x81,0x03,0x05,0x12,0x43,0x41,0x84,0x00,0xC3,0xC6,0x04,0x34,0x23,0x60,0x80,
+  0x09,0x00,0xC0,0x80,0x04,0x04,0xC8,0x28,0xC0,0x81,0x09,0x03,0x43,0x4D,0x80,0x09,
+  0x08,0x42,0x38,0x94,0x14,0x90,0x80,0x04,0x05,0x21,0x24,0x98,0x80,0x01,0x01,0x8C,
+  0x80,0x09,0x02,0x41,0x40,0x80,0x09,0x01,0x24,0x80,0x09,0x0B,0x34,0xC4,0x34,0xC8,
+  0x12,0x41,0x84,0x00,0xC3,0xC6,0x03,0x24,0x14,0x82,0x0F,0x80,0x09,0x03,0xFD,0x4D,
+  0x82,0x0F,0x01,0xD9,0x82,0x0F,0x02,0xE3,0x40,0x80,0x0F,0x01,0x94,0x80,0x0F,0x01,
+  0x82,0x80,0x04,0x01,0x39,0x80,0x0F,0x01,0x4D,0x82,0x0F,0x14,0xD1,0x9F,0xD1,0x4F,
+  0xC8,0xDF,0xD3,0xDF,0x92,0x34,0x10,0x85,0x00,0xC2,0xC5,0x04,0x13,0x42,0x80,0x81,
+  0x0F,0x06,0x94,0xCF,0xD3,0x90,0x81,0x0F,0x01,0xD9,0x80,0x0F,0x01,0xD9,0x80,0x0F,
+  0x01,0x94,0x81,0x0F,0x00,0x90,0x80,0x0F,0x08,0x41,0x42,0x3D,0xFD,0x90,0x80,0x0F,
+  0x80,0x0D,0x80,0x0F,0x01,0x4C,0x80,0x0F,0x04,0x3D,0xFD,0x40,0x81,0x0F,0x00,0x90,
+  0x80,0x0F,0x03,0x82,0x32,0x85,0x00,0xC3,0xC5,0x04,0x14,0x21,0x90,0x80,0x0F,0x0C,
+  0xD8,0x4E,0xF9,0x10,0x9F,0xD1,0x90,0x80,0x0F,0x05,0x10,0xDF,0xDC,0x81,0x0F,0x0F,
+  0xDF,0xD4,0x24,0x23,0xDF,0xCD,0xF9,0x03,0x80,0x0F,0x00,0x90,0xC3,0x80,0x0F,0x01,
+  0x94,0x81,0x0F,0x00,0xD0,0x80,0x0F,0x04,0x41,0x24,0x10,0x80,0x00,0xC7,0xC5,0x01,
+  0x14,0x80,0x03,0x00,0xC0,0x81,0x0F,0x01,0x94,0x80,0x0F,0x0F,0x41,0x2D,0xFD,0x1D,
+  0xFD,0x01,0xDF,0xD9,0x83,0x0F,0x01,0xD2,0x80,0x03,0x01,0x14,0x80,0x0F,0x00,0x90,
+  0x80,0x0F,0x02,0x90,0x40,0x80,0x0F,0x01,0x9D,0x83,0x0F,0x80,0x09,0x83,0x0F,0x04,
+  0xD2,0x34,0x10,0xCA,0xC5,0x04,0x34,0x24,0xD0,0x81,0x0F,0x01,0x9C,0x80,0x0F,0x07,
+  0xD9,0x8D,0xF9,0x1C,0x80,0x0F,0x80,0x0D,0x80,0x0F,0x03,0x8C,0xF9,0x81,0x0F,0x05,
+  0xD1,0x29,0xCD,0x80,0x0F,0x01,0x4D,0x80,0x0F,0x00,0x90,0x80,0x0F,0x01,0xD8,0x80,
+  0x0F,0x01,0x83,0x80,0x0F,0x02,0x49,0xF0,0x80,0x0D,0x80,0x0F,0x04,0xD3,0x24,0x30,
+  0xCA,0xC5,0x03,0x24,0x14,0x82,0x0F,0x01,0xC9,0x82,0x0F,0x03,0x9D,0xF4,0x80,0x03,
+  0x00,0xD0,0x82,0x0F,0x05,0x83,0xDF,0x48,0x80,0x0F,0x03,0x91,0x29,0x81,0x0F,0x02,
+  0x91,0x80,0x82,0x0F,0x00,0xE0,0x80,0x04,0x80,0x0F,0x01,0x13,0x80,0x0F,0x04,0x4D,
+  0xF9,0x40,0x80,0x0F,0x01,0xC1,0x80,0x04,0x00,0x10,0xCA,0xC5,0x01,0x42,0x80,0x04,
+  0x80,0x08,0x80,0x09,0x80,0x04,0x81,0x09,0x80,0x04,0x0F,0x98,0x42,0x14,0x9D,0x95,
+  0x13,0x98,0x42,0x80,0x08,0x11,0x24,0x24,0x9D,0x83,0x21,0x49,0xD9,0x31,0x49,0x81,
+  0x04,0x00,0x90,0x80,0x04,0x80,0x08,0x01,0x43,0x80,0x08,0x04,0x43,0x23,0x10,0xCA,
+  0xC4,0x06,0x13,0x24,0x20,0x10,0x80,0x00,0x80,0x01,0x81,0x00,0x81,0x01,0x01,0x02,
+  0x80,0x04,0x00,0x10,0x81,0x00,0x05,0x12,0x31,0x02,0x82,0x01,0x80,0x04,0x00,0x10,
+  0x80,0x00,0x80,0x01,0x80,0x04,0x00,0x10,0x81,0x00,0x0B,0x14,0x30,0x12,0x30,0x13,
+  0x10,0x80,0x02,0x06,0x10,0x14,0x24,0x10,0xCA,0xC5,0x80,0x04,0x00,0x30,0x8A,0x04,
+  0x00,0x20,0x81,0x04,0x00,0x30,0x84,0x04,0x00,0x20,0x85,0x04,0x00,0x20,0x82,0x04,
+  0x02,0x24,0x20,0x84,0x04,0x00,0x20,0x85,0x04,0x00,0x20,0x81,0x04,0x00,0x30,0x81,
+  0x04,0x02,0x24,0x30,0xCB,0xC5,0x0E,0x13,0x23,0x23,0x23,0x23,0x23,0x23,0x20,0x80,
+  0x03,0x05,0x23,0x23,0x23,0x80,0x02,0x80,0x03,0x06,0x23,0x23,0x23,0x20,0x80,0x03,
+  0x02,0x23,0x20,0x82,0x03,0x04,0x23,0x23,0x20,0x80,0x03,0x04,0x23,0x23,0x20,0x81,
+  0x03,0x00,0x20,0x80,0x03,0x02,0x23,0x20,0x80,0x03,0x80,0x01,0xCA,0xCE,0x9D,0x00,
+  0xD8,0x00,0x10,0xCC,0xCD,0x9A,0x00,0xEA,0xCE,0x95,0x00,0xEE,0xCE,0x91,0x00,0xF2,
+  0xCE,0x8E,0x00,0xF3,0x80,0x00,0xCE,0x89,0x00,0xFA,0xCE,0x85,0x00,0xFE,0xCF,0x80,
+  0x00,0xFF,0xC2,
 };
 
-const uint16_t spaceman_frame_3[14400] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0100,0x0100,0x2200,0x2200,
-  0x2200,0x2200,0x0200,0x2200,0x2200,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x2300,0x4600,0x6700,0x8900,0x8900,0x8A00,0xAC00,0xAC00,
-  0xAC00,0xAC00,0x8C00,0xAC00,0xAB00,0x8900,0x6700,0x4600,0x2400,0x0100,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,
-  0x2400,0x6700,0x8900,0xAC00,0xCE00,0xCF00,0xCF00,0xCF00,0xCF00,0xD000,0xD000,0xD000,
-  0xD000,0xD000,0xD000,0xD000,0xD000,0xD000,0xCF00,0xCF00,0xCF00,0xCE00,0xAC00,0x6700,
-  0x4400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6500,0x8900,0x8B00,
-  0xAE00,0xCF00,0xCF00,0xF000,0xF008,0xCF00,0xD000,0xD000,0xB000,0xB000,0xB000,0xB000,
-  0xB000,0xB000,0xB000,0xB000,0xB000,0xD000,0xD000,0xD000,0xF000,0xD000,0xD000,0xCF00,
-  0xAE00,0xAB00,0x8800,0x2300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x6700,0x8A00,0xAD00,0xEF00,0xD000,
-  0xD000,0xB000,0xB000,0xAF00,0x8E00,0xAF00,0xCE00,0xCC00,0xEB08,0xEB10,0xEB10,0x0B21,
-  0xEB10,0xCB10,0x0D01,0x2D01,0xED00,0xAE00,0x8E00,0x8F00,0xAF00,0xAF00,0xAF00,0xF000,
-  0xF000,0xD000,0xCF00,0xAC00,0x6800,0x4300,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2200,0x6600,0xAA00,0xCF00,0xF100,0xD000,0xB000,0xAF00,
-  0x8E00,0xCE00,0xED00,0xEC20,0x0C39,0x4A59,0x6961,0x4781,0x6699,0x6699,0x66A1,0x85B1,
-  0x6699,0x6699,0x8789,0xC881,0x6871,0x2A59,0x2B49,0xEC28,0xCC10,0xCD00,0xCE00,0x8F00,
-  0xAF00,0xAF00,0xD000,0xF000,0xD000,0xAC00,0x8800,0x4300,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0x4500,0xAB00,0xCF00,0xF100,0xD000,0xAF00,0xAF00,0xCE00,0xCD08,
-  0xED20,0x6A41,0x8771,0x87A1,0xC7D1,0xE5F9,0xC5F1,0xE7F9,0xE7F9,0xE7F9,0xE7F9,0xE8F9,
-  0xE8F1,0xE7F9,0xE7F9,0xE7F9,0xE7F9,0xE5F9,0x07EA,0xA7B1,0x4689,0x4861,0x2B31,0xCD18,
-  0xCE08,0xAE00,0xAF00,0xAF00,0xCF00,0xD000,0xD000,0xAD00,0x6600,0x2100,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2400,0xAB00,0xD000,0xD000,0xCF00,0xCF00,0xCF00,0xAF00,0xEE08,0x2A29,0x6871,
-  0xE8C9,0xC6F1,0xC6F9,0xC7F9,0xE8E9,0xEAD1,0xCAB9,0x0EAA,0x30A2,0x2EAA,0x2FA2,0x3292,
-  0x3292,0x2FA2,0x2EAA,0x2FA2,0x0EAA,0xEAD1,0xEAD1,0xE8E9,0xC6F9,0xC6F9,0xC7D9,0xC8A1,
-  0x6871,0x0B29,0xAE08,0xAF00,0xCF00,0xCF00,0xCF00,0xD000,0xF000,0xAB00,0x2400,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x6700,0xAE00,0xD000,0xCF00,0xCF00,0xAF00,0x8E00,0x2C01,0x8A59,0xA8B1,0xA6D9,0xC5F9,
-  0xE6F9,0xC7D9,0x0CB2,0x529A,0x3482,0x1482,0x147A,0x157A,0x5382,0x728A,0x7382,0x7382,
-  0x7382,0x7382,0x928A,0x7382,0x157A,0x1482,0x1482,0x319A,0x4EB2,0x2BCA,0xE7E9,0xE6F9,
-  0xC5F9,0xA6E1,0x8799,0x2A31,0xED00,0xAF00,0xCF00,0xEE00,0xCE00,0xEF00,0xED08,0x6700,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x8900,
-  0xCF00,0xD000,0xCF00,0xAF00,0xAF00,0x0D01,0x6B61,0xA8B1,0xC5E9,0xE5F9,0x08EA,0x2CCA,
-  0x319A,0xF381,0xF479,0x747A,0x5193,0x8DBC,0x2BC5,0x89D5,0x07DE,0x45E6,0x43EE,0x43EE,
-  0x43EE,0x43EE,0xE6DD,0xC7D5,0x69D5,0x6EBC,0x11A4,0x1293,0x5282,0x1382,0xF389,0x51A2,
-  0x4BCA,0x07F2,0xC5F1,0xA6E1,0x8891,0x2A29,0xCD00,0xAF00,0xCE08,0xEE08,0xEF00,0xEE08,
-  0xA800,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0x8B00,0xCF00,
-  0xD000,0xCF00,0xAF00,0xCD00,0x2A39,0x8891,0xC6E9,0xE5F9,0x09EA,0x0EB2,0xD191,0x1382,
-  0xF482,0x30A4,0x0ACD,0xA5DD,0x42F6,0xE1FE,0x02FF,0x05F7,0x24F7,0x06EF,0xAADE,0xAADE,
-  0xAADE,0xAADE,0xE7E6,0x05EF,0xE5EE,0xA3FE,0x84FE,0x24EE,0x87D5,0x8CBC,0x929B,0x757A,
-  0xD579,0xF291,0x2CC2,0x27FA,0xC5F9,0xA6C9,0x8A79,0xEB18,0xAD00,0xCE00,0xEE08,0xEE08,
-  0x0E09,0xA800,0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4400,0xAC00,0xD000,0xCF00,
-  0xAF00,0xAE00,0xED10,0x4A61,0xA6C9,0xE6F9,0x08F2,0x0DBA,0xF289,0x557A,0x538B,0x6BB4,
-  0x85E5,0xA3FE,0x41FF,0x63F7,0x09CF,0x8DB6,0xB0A6,0x957E,0x9676,0x586E,0xFD5D,0x1C5E,
-  0xFC5D,0xFD5D,0x586E,0x967E,0x7586,0xCFA6,0xABC6,0xE7E6,0x25F7,0xE3FE,0x43FE,0x07D5,
-  0x0EAC,0xF482,0x147A,0xF191,0x2DC2,0x08FA,0xE7F9,0x86A1,0x0941,0xCD00,0xCE00,0xED08,
-  0x0E09,0x0D09,0xC808,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0xAC00,0xD100,0xCF00,0xAF00,
-  0xCE00,0x2C19,0xA989,0xC6F1,0xC7F9,0x0DBA,0x119A,0x3582,0x118B,0x6BBC,0x07EE,0x03F7,
-  0x44EF,0xEAC6,0x8FA6,0x567E,0x1D4E,0xDF45,0x1F46,0xDF45,0xDF45,0xFE45,0xDD55,0x9C55,
-  0xFD4D,0xFD4D,0xDE45,0xFE45,0x1E3E,0xFF3D,0xDE4D,0xDB6D,0x5686,0xADAE,0x06E7,0x63FF,
-  0x42FF,0x86DD,0xCEAB,0xB482,0x357A,0x109A,0xE9D9,0xE6F9,0xC6D9,0x4961,0xCD08,0xCD00,
-  0xED08,0x0D09,0x2D09,0xC808,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0xCD00,0xF000,0xCF00,0xAF00,0xAE00,
-  0x6A21,0xC9A9,0xE7F9,0xC6E9,0xECA1,0x557A,0x7482,0x8EB3,0x45EE,0xA0FF,0x04EF,0x8FAE,
-  0x3876,0x1D4E,0x3F3E,0x1E46,0xDB5D,0x9875,0x1785,0x14A4,0xB2AB,0xF3A3,0x72B3,0x91CA,
-  0xB3AB,0xD4AB,0xB3B3,0x13AC,0xB494,0x1885,0x9B65,0xFC55,0x3E46,0x1F3E,0xBD5D,0xF695,
-  0xC9D6,0x42FF,0x61FF,0xA7DD,0x109B,0x5482,0x328A,0x0CC2,0xC6F9,0xC6F1,0x8981,0xCB08,
-  0xCD00,0x0D09,0x0D09,0x2D09,0xE808,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0xCC00,0xCF00,0xEE00,0xCF00,0xAE00,0x2941,
-  0xA7C9,0xC5F9,0x09DA,0x319A,0x3482,0x50A3,0xA9D5,0x01FF,0x05EF,0x6FAE,0x3876,0x5E46,
-  0x5E46,0xBB65,0xB78C,0xB4AB,0xD1B2,0x6C9A,0x6CA2,0xCCA2,0x6DB2,0x0EB2,0x2EBA,0x2FCA,
-  0x4FC2,0x92D2,0x93DA,0x93E2,0x93EA,0x93E2,0xB3CA,0xD2BA,0x139C,0x986D,0x1E46,0x5F3E,
-  0x3C4E,0xF695,0x8AD6,0x61FF,0xC3F6,0xCBCC,0x928A,0x557A,0x0DAA,0xC5E9,0xC6F9,0xC9A9,
-  0x0A11,0xED00,0x0C11,0x0D11,0x0C11,0xC708,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2200,0xCB08,0xEF00,0xEE00,0xCE00,0xAD00,0x2949,0xA6D9,
-  0xC5F9,0x2BCA,0x128A,0x357A,0x0EAC,0x83F6,0x40FF,0x8ADE,0x177E,0x7E46,0x7E46,0x9B65,
-  0xB5A3,0xB1BA,0xAEB2,0xEDB2,0xABAA,0xE671,0x8651,0x686A,0x2B8B,0x0C8B,0xEB92,0x2B93,
-  0x0B93,0x6DA3,0xCE9A,0x8C81,0x8B81,0x8FAA,0x70E2,0x52EA,0x93EA,0xF3D2,0x74AB,0xD77C,
-  0x1C56,0x5F46,0x1D4E,0x719E,0x23F7,0x20FF,0xE7DD,0x709B,0x1482,0x309A,0x09E2,0xC6F9,
-  0xC9A9,0x2A19,0xEC00,0x0D11,0x2D11,0x0C11,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x8800,0x1009,0xEE08,0xCE08,0xAC00,0x0939,0xA6C9,0xC5F9,
-  0x2BCA,0x1382,0x967A,0x8DBC,0xC1FE,0x61FF,0x4EB6,0x1C5E,0x3F46,0x3A65,0xF59B,0x74C3,
-  0x6DC2,0xACB2,0x0B9B,0x0A83,0x097B,0x097B,0xA862,0x065A,0x0973,0x0C8C,0x6A83,0xE872,
-  0x086B,0x6973,0x4A7B,0xA972,0xC641,0xE518,0x0641,0xAA79,0x2EAA,0x91D2,0xB3EA,0xF3DA,
-  0xB4B3,0xD77C,0xDE45,0x3F46,0x5676,0xCBC6,0x60FF,0x64EE,0xCFA3,0x3572,0x319A,0x09E2,
-  0xC6F9,0xA9A1,0x2B19,0xEC00,0x2C19,0x2D11,0x0B11,0x4300,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4500,0xED00,0xEE08,0xEE08,0xCE00,0x0A31,0x86B9,0xC6F9,0xEBC1,
-  0x1482,0xD38A,0xEBCC,0x03FF,0x44EF,0x7296,0xFE4D,0xBD45,0xD784,0x33CB,0x11F2,0x10D2,
-  0x2C9B,0xCB83,0x8B83,0x4A7B,0x8B8B,0x2DAC,0xECA3,0xA97A,0x6872,0x4A8B,0xAC93,0x0A8B,
-  0xC972,0xE872,0x297B,0x6A8B,0xE972,0x4529,0x4400,0xA608,0x6831,0xC951,0x0C8A,0x0FCA,
-  0x73EA,0xF3DA,0xF4A3,0x5A5D,0x3F36,0x1D56,0x4DB6,0x82FF,0x83EE,0xCEAB,0x357A,0x3192,
-  0xE9D9,0xE6F9,0x8889,0x2B11,0x0C09,0x2C11,0x2D11,0xC808,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2300,0xCB08,0x0E09,0xED08,0xCD00,0x0C11,0xA8A9,0xC5F9,0xEAC1,0x3482,
-  0xB38A,0x49D5,0x40FF,0x06DF,0x377E,0x3F36,0xFC55,0xF4A3,0x92E2,0x53E2,0x30C2,0x8C9A,
-  0xAB8B,0x4A83,0x2A83,0xAC9B,0x6EB4,0x8EBC,0x0DB4,0x2DA4,0xE87A,0xA772,0x0D9C,0x4DAC,
-  0x8B8B,0x297B,0x0973,0x097B,0x8B93,0x8B8B,0x8A31,0x8C00,0x6A00,0x4600,0x6300,0x2651,
-  0x6E92,0x92D2,0x31EA,0x32C3,0x1885,0x3D46,0xFF45,0x319E,0x62F7,0x82F6,0xCEA3,0x357A,
-  0x3192,0xE8E1,0xC7F1,0x8979,0x0A09,0x0C09,0x2C11,0x4C19,0xA508,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0xA808,0x2E11,0x0C11,0xED00,0xAB00,0x8979,0xC6E9,0x09E2,0x1292,0x7482,
-  0x49D5,0x21FF,0xE6E6,0x5776,0x3F36,0x7A65,0xF4A3,0x93E2,0x94EA,0xCD91,0x8749,0x497B,
-  0x4A83,0x0973,0xAB93,0x4EB4,0x8EBC,0xADBC,0x0DA4,0x0DA4,0x6A83,0xE972,0x6B8B,0x0CA4,
-  0xCC93,0x6B8B,0x297B,0x0973,0x0973,0x0973,0x885A,0x2C11,0xB000,0xF000,0xAC00,0x6600,
-  0xA500,0xC869,0x70CA,0x33EA,0xB2D2,0xD48C,0x1D4E,0xDF3D,0x319E,0x62FF,0xA3F6,0xAEA3,
-  0x5482,0x3192,0x08EA,0xA5E1,0x4951,0xAB00,0x0C09,0x6B19,0x0911,0x4300,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x8508,0x0B11,0x2D11,0xED08,0xCD00,0x4859,0xA5E9,0x09EA,0x1192,0x5482,0x0CBC,
-  0x01FF,0x06E7,0x3776,0x5F36,0x5A65,0xD1C2,0x52E2,0xF4E2,0xEB61,0x4300,0x6731,0xAB93,
-  0x297B,0x6A83,0x2DAC,0xCEC4,0xCDBC,0x2DA4,0xCC93,0x4A83,0x0973,0x4862,0x276A,0x6B8B,
-  0x2DA4,0x8B93,0x097B,0x0973,0x0973,0x097B,0x4A8B,0x2A42,0xEC08,0xAF00,0x0F09,0xEE00,
-  0xCD00,0x4600,0xC530,0x0EA2,0x94EA,0x92D2,0xF4A3,0xFC55,0xFF3D,0x329E,0x62FF,0xA5EE,
-  0x6FA3,0x557A,0x0EB2,0xE6F9,0xA7C1,0x0931,0xAB00,0x0A09,0x6B19,0xC710,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x2100,0xE910,0x2D11,0x0D11,0xED00,0xE928,0xA7C9,0xE6F9,0x2FB2,0x3572,0xAEAB,0xA2FE,
-  0x06E7,0x567E,0x5F3E,0x3A65,0xF1C2,0x52EA,0x71DA,0x6759,0x4308,0xE610,0xCA5A,0x8B93,
-  0x497B,0x6A8B,0xCC9B,0xCC93,0x497B,0xE96A,0xC96A,0xA86A,0x876A,0x6772,0xE98A,0xAC9B,
-  0x4A9B,0x2A93,0x4A83,0x2A7B,0x0973,0x0973,0x297B,0xE872,0x6921,0x8C00,0x0F09,0xEE00,
-  0xEF00,0xCE00,0x8900,0xE628,0x0C8A,0xD3DA,0x72DA,0x14A4,0xDD4D,0xFF45,0x2FAE,0x60FF,
-  0x26E6,0x118B,0x1382,0x2ADA,0xC6F9,0xC999,0xCB31,0x8B19,0x6B21,0x2A19,0x8408,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8508,0x2C11,0x2C19,0xEC00,0xEC08,0x8879,0xC6F9,0x2BD2,0x1382,0x5193,0x25EE,0x43F7,
-  0xF58D,0x5F3E,0x3A65,0x12C3,0x52EA,0x71D2,0x2751,0x4500,0x4800,0x0A3A,0x297B,0x485A,
-  0x2752,0x676A,0x097B,0xE97A,0xC882,0x2A93,0x2A93,0x6AA3,0xCBB3,0x4EC4,0x10DD,0x32E5,
-  0x8FCC,0xCCC3,0x8ABB,0x4A93,0x2A7B,0x4A83,0x2973,0xC77A,0xC741,0xEB08,0xCE00,0xED00,
-  0xEE00,0x0F09,0xEE00,0xAA00,0xE718,0xEB69,0xB3D2,0x72E2,0x7494,0x3D46,0xFD4D,0x8CBE,
-  0x60FF,0x09D5,0x9482,0x1192,0xE8E1,0xE7E9,0x0C83,0x0C32,0x2B11,0x4B19,0x0811,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x0A11,0x2C11,0x0D11,0xCC00,0xE930,0xC7D9,0xC6E9,0x309A,0x757A,0x09CD,0x81FF,0x6FAE,
-  0xFE45,0xDC55,0x73B3,0x11F2,0x71CA,0x4759,0x4400,0x8C00,0x2E11,0x6A52,0xA772,0x8639,
-  0xE651,0x6B9B,0x4EB4,0x4EBC,0x8FD4,0xF0E4,0xF0E4,0x10ED,0x72F5,0xB4FD,0xD4FD,0xF4FD,
-  0xD4FD,0xF0EC,0xECDB,0x8ABB,0x4A8B,0x097B,0xE87A,0x2662,0xE649,0x4921,0xAD00,0xEE00,
-  0xEE00,0xCD00,0xEE08,0xEF08,0x8C00,0x8708,0x4C82,0x93E2,0xD2DA,0xD684,0x5F3E,0x3B5E,
-  0x05E7,0x01FF,0xEEB3,0x1572,0x4EB2,0xC6F9,0x89CA,0xAA39,0x0A09,0x4B21,0x4A19,0x8408,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,
-  0x2C11,0x2C19,0xED00,0x0B19,0x6791,0xC6F9,0xE9C1,0xD379,0xF1A3,0xA3FE,0x07DF,0x1C56,
-  0x5E46,0x1594,0xB3EA,0x72D2,0x6861,0x2400,0xCC00,0x8F00,0x6B19,0xA962,0x676A,0xC751,
-  0xABAB,0xB3FD,0x36FE,0xF4FD,0xF5FD,0xD4FD,0xD4FD,0xD4FD,0xD4FD,0xB3F5,0x93ED,0x93F5,
-  0xB3F5,0x93ED,0x8FD4,0xCCD3,0x8BB3,0xA86A,0x0662,0xA641,0xC649,0x4829,0xAC00,0xEE00,
-  0xEE00,0xEE00,0xCE00,0xEE08,0xEF08,0xAC00,0xE620,0x4E9A,0x33EA,0xF3D2,0x396D,0x5F3E,
-  0x5296,0x62F7,0xA5E5,0xF38A,0x338A,0x09DA,0x85F1,0x2751,0x0909,0x4B19,0x4B19,0xE810,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE810,
-  0x2C11,0x2C19,0xEB00,0x6A51,0xE7E9,0xE7E9,0x509A,0x547A,0x86DD,0x62FF,0x538E,0x3F3E,
-  0x3975,0xB3CA,0x74F2,0xEC79,0x8500,0xAD00,0x0F09,0x6C00,0xCA31,0x2A6B,0x4762,0x276A,
-  0xF1E4,0x15F6,0xB4ED,0x73ED,0x93F5,0x93F5,0x93F5,0x93F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,
-  0x93F5,0xD4FD,0xF0E4,0x2CD4,0x0CD4,0x4A9B,0xE749,0xA641,0xE651,0x6729,0xCB00,0xEE00,
-  0xEE00,0xEE00,0xEE00,0xEE00,0xEE08,0xEF08,0xAC00,0xE730,0x0EB2,0x72F2,0x53AB,0xDC55,
-  0xDE4D,0x8CBE,0x03FF,0xADBC,0xF579,0x4DB2,0xC6F9,0x86A9,0x2929,0x2B09,0x4B21,0x2A19,
-  0xC610,0xA410,0x6208,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4300,0x2B19,
-  0x4B19,0x2A11,0x0A11,0x6791,0xE5F9,0xC9B9,0x1482,0x4EB4,0xC2FE,0xAACE,0xDD55,0xBC5D,
-  0x32B3,0x73EA,0xEEA9,0xE728,0x8900,0x0F09,0x0E09,0x6B00,0xCA31,0x0A6B,0x8762,0xE97A,
-  0x32ED,0xF4FD,0xB3F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x93F5,0xB3F5,
-  0xB3F5,0xB3FD,0x31ED,0x0CCC,0x89CB,0xCBC3,0x2B73,0x4A7B,0x887A,0x6641,0xE908,0xCE00,
-  0xEE08,0xEE08,0xEE08,0xEE08,0xED08,0xEE00,0xEF08,0x6900,0x8959,0x4FD2,0x93DA,0x5594,
-  0x3F3E,0xF97D,0x06EF,0x23EE,0x3293,0x538A,0xEAD9,0xC6F1,0x4859,0x2A01,0x6B21,0x4B19,
-  0x6B19,0x4B19,0x4B19,0xE710,0x4108,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xA508,0x6B19,
-  0x6B21,0xCA00,0x2A41,0xC7C9,0xE8F1,0x109A,0x347A,0xE6DD,0x42FF,0x748E,0x1F3E,0xF58C,
-  0x72DA,0x6FDA,0x2649,0x4700,0xEF08,0xEE08,0x0E09,0xAE00,0x8A29,0xA85A,0xA86A,0xE892,
-  0x32ED,0xD4FD,0x93F5,0xB3F5,0xB4F5,0xB4F5,0xB4F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x52F5,
-  0x31ED,0xD5D5,0x17CE,0xB6C5,0x33C5,0xAFBC,0x1084,0xACA3,0xC792,0xA649,0x0911,0xED08,
-  0xEE08,0x0E09,0x0E09,0xEE08,0xEE08,0xEE00,0xCE00,0x6B21,0x894A,0xCD9A,0x31E2,0xF3C2,
-  0xFB65,0xFF45,0xADB6,0x01FF,0xADBC,0x357A,0x0EB2,0xE6F9,0x6699,0x0A19,0xEB08,0xE908,
-  0x0A11,0x4A19,0x6B19,0x4B19,0xE710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0911,0x6B19,
-  0x4B19,0x0A01,0x6979,0xE6F1,0xEBD1,0x5482,0xEEB3,0xC1FE,0xAACE,0x1C56,0x9B55,0x71BB,
-  0x94E2,0xCB79,0xA608,0x8B00,0x0F09,0xED00,0x0E09,0xAE00,0x4A19,0x2752,0x676A,0xE98A,
-  0x11E5,0xD4FD,0xB3FD,0x72FD,0x52F5,0x51F5,0x52F5,0x93FD,0xB4F5,0x93F5,0x73ED,0xB5D5,
-  0x17CE,0xF8AD,0x969D,0x349D,0xB6A5,0x17BE,0xEE8B,0x09A3,0x878A,0x0652,0x6829,0xCC00,
-  0x0E09,0xEE08,0xED00,0x0D09,0x0E09,0x0D09,0xCD00,0x8C21,0xC921,0x8841,0xCDA9,0x94E2,
-  0x959C,0x1F3E,0x3876,0xE7EE,0x25E6,0x928A,0x538A,0xE8E9,0xA7C9,0x4939,0x6821,0xEA59,
-  0x2811,0x0911,0x2A19,0x6C19,0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x4B19,0x4B19,
-  0x2A11,0x4A19,0x87A9,0xE6F9,0xCFA9,0x557A,0xC8DD,0x03F7,0x348E,0xFF3D,0xF884,0x52DA,
-  0x91D2,0xE730,0x8900,0x0E09,0xED08,0x0E09,0x0E09,0xCE00,0x0B09,0xC749,0x4572,0xA87A,
-  0xD0DC,0x93FD,0x94E5,0xB4DD,0xD5E5,0xF6E5,0xD6E5,0x73DD,0x73ED,0x72FD,0x73E5,0xB7A5,
-  0xF39C,0x2F94,0x0C7B,0x2A6A,0x4E83,0x74A5,0x2DA4,0xE8A2,0x878A,0x476A,0x6739,0x8A00,
-  0xAD00,0xCC00,0xEC08,0xED08,0xCD00,0x0D09,0x0E09,0x0D11,0xAB00,0xA708,0x6961,0x72E2,
-  0x12CB,0x9B5D,0xDE4D,0x8DC6,0xE0FE,0xEEB3,0x557A,0xEBC9,0xA6D9,0x299A,0xCC9B,0x2ED4,
-  0xAA7A,0x4821,0x0911,0x6B21,0x2919,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x6B21,0x4A19,
-  0x0A09,0x4941,0xA6D1,0x09EA,0x1292,0xD292,0x84EE,0xC9D6,0x5A5E,0xDD45,0x15B4,0x53EA,
-  0x0A92,0xC618,0xAB00,0x0E09,0xED08,0x0D09,0xED08,0xEE08,0xCB00,0x8831,0x466A,0x6772,
-  0x4ECC,0x73E5,0xD6BD,0xF8AD,0xD7AD,0xD7AD,0xD6AD,0x53AD,0x32D5,0x72ED,0x33C5,0xB19C,
-  0xA9AB,0xE7A2,0x088A,0x2779,0xA779,0x4A83,0x6EBC,0x29AB,0xC79A,0x2872,0xC720,0x8800,
-  0xEA08,0x2D32,0xCC29,0xAA08,0xAA00,0xEC00,0xCC00,0xCC00,0xEE08,0xEB00,0x4931,0x4FC2,
-  0x52E2,0x379D,0x1D56,0x5296,0x02FF,0x69D5,0x5482,0xEDA1,0x65D9,0xEAEA,0x93ED,0x72F5,
-  0xCAC3,0x4731,0xE908,0x8C21,0x4A19,0x8308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4100,0xE710,0x6C21,0x4A19,
-  0x0A09,0x8971,0xE6E9,0xEBD1,0x528A,0xCDB3,0xE1FE,0x2FBE,0x5E4E,0xF96C,0x50E2,0x52D2,
-  0x6749,0xCA00,0xED00,0x0D11,0x0D09,0x0D09,0xED08,0x0E09,0xCC00,0x2819,0xC649,0x6672,
-  0xCDAB,0xD6BD,0xD7AD,0x9294,0xAD83,0x6B83,0x4B83,0x5184,0x12AD,0x33AD,0x3194,0x49B3,
-  0x49DD,0x6BD4,0xACC3,0x6ABB,0xC79A,0xC87A,0xECBB,0x09AB,0xC8A2,0xE659,0xC608,0xEA31,
-  0x4E63,0x349D,0x6F63,0xEA31,0x6C42,0xAC29,0x0A09,0x0A09,0x2B11,0xEB00,0x0B19,0xEF89,
-  0x32DA,0xF5D4,0x5D66,0x3966,0xE8DE,0x65E6,0xB38A,0x119A,0xEAD1,0x0BD3,0x11D5,0xAFDC,
-  0x6772,0xC510,0x0911,0x8C21,0x2A19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x6B21,0x4B19,
-  0x2909,0x87A9,0xE6F9,0xEEB1,0x9582,0xECCC,0x02FF,0x1496,0xFF45,0x988C,0x31EA,0x2EBA,
-  0xE718,0xCC00,0x0E09,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x0E09,0xAA08,0x0421,0x6772,
-  0x30A4,0x96AD,0x0EA4,0x87A2,0xC89A,0x888A,0x8871,0xA761,0x6D73,0x709C,0x8B9B,0xA892,
-  0xAABB,0xEBCB,0x6CDC,0x8DDC,0x8ABB,0x09A3,0x0DCC,0x4AAB,0xE89A,0x066A,0xE841,0x5284,
-  0x59BE,0xB6AD,0xD394,0x96A5,0x59BE,0x359D,0x317C,0xD073,0xED5A,0xAB21,0xE908,0x4A59,
-  0x32DA,0x93C3,0xBB55,0x3E4E,0x4EC6,0xE2FE,0x33AC,0x5392,0xCBB2,0xCAC3,0x2DCC,0xCBC3,
-  0x0521,0xA700,0x2A19,0x6B21,0x0811,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x2A19,0xC908,
-  0x0919,0xA7C1,0xE6F1,0xAF99,0xF48A,0x07E6,0x04EF,0x5966,0xFE45,0x16AC,0x52E2,0x4C7A,
-  0xA808,0xCC00,0x2E11,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x0E11,0xCB00,0xE618,0x4772,
-  0x2EA4,0x728C,0xCBB4,0xC9DC,0xEBCB,0x6ABB,0xCAB2,0x4782,0xA87A,0x8FC4,0xF0DC,0x8892,
-  0x8879,0x8892,0x69AB,0xAAC3,0x8AC3,0x6AB3,0xEDCB,0x4AB3,0xC78A,0xC559,0x4952,0x75A5,
-  0xBACE,0x55A5,0xD38C,0x55A5,0xD6AD,0x18B6,0x99CE,0x79C6,0x96AD,0xB06B,0x4819,0xC718,
-  0x91BA,0xD1D2,0x7784,0x5B6D,0xCFBD,0x02FF,0xEEC4,0x5292,0x4FBB,0xCEDC,0x0CC4,0x867A,
-  0x8408,0x0911,0x6C21,0x4A19,0xA508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A19,0xAB21,0xEB31,
-  0x4941,0x86D1,0x08EA,0xD091,0x909B,0x03F7,0xE8DE,0x7C56,0x7B55,0x94CB,0x31DA,0xC959,
-  0xAA00,0xEC00,0x2D11,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x2D11,0xEC00,0xE910,0xC861,
-  0x499B,0x4C8B,0xCAA3,0x6AD4,0x8EE4,0xADE4,0x0ADD,0x0AC4,0x669A,0x2DC4,0x15FE,0x69B3,
-  0xC681,0x4782,0x668A,0xC8A2,0xABBB,0xECCB,0x2DD4,0x29AB,0x276A,0xA549,0xEA6A,0x96A5,
-  0x75A5,0x359D,0x149D,0x149D,0xF494,0x359D,0x18BE,0xFBD6,0x1CDF,0x59CE,0x7284,0x8C4A,
-  0x12BB,0x51CA,0x54AC,0xB9A5,0xD1C5,0x23EF,0xA9D5,0xCEAA,0x32CC,0x70F5,0x4AAB,0x2631,
-  0xA608,0x4A19,0x8C21,0xE810,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x4B19,0xEB29,0xCC52,
-  0x8961,0x85E1,0x2BDA,0x1382,0xADA3,0x42FF,0x6EBE,0x7E4E,0x9874,0xD2E2,0x10C2,0xC738,
-  0xCC08,0x0D09,0x0D11,0x0D09,0x0D09,0x0D09,0x0D09,0x0D09,0x0D11,0x0D09,0xCA08,0xC528,
-  0x0672,0x6CBB,0x0AAB,0xA89A,0x4AB3,0x0BC4,0xC9D4,0xA9C3,0xE8AA,0x8FCC,0xF5FD,0xF0E4,
-  0x0CCC,0x09A3,0x29AB,0x4ECC,0x11DD,0xAFDC,0x2DD4,0x4AAB,0xE751,0x074A,0xCD83,0x928C,
-  0x517C,0x75A5,0x96A5,0x349D,0x359D,0xF494,0x769D,0x9AC6,0x1CDF,0xBBD6,0x559D,0x2E63,
-  0x4E9A,0x10C3,0xF2CC,0xD7A5,0xF695,0x4BD6,0xE9D4,0xADC3,0xF3E4,0x0FED,0x6792,0xA710,
-  0xE908,0x6B19,0x4B19,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x6A19,0x8A29,
-  0x6869,0xA5E9,0x2CCA,0x147A,0xCCB3,0x22FF,0x149E,0x7F3E,0x3684,0x51EA,0x51BA,0x6A29,
-  0xCC08,0x0D09,0x2C11,0x0D09,0x0D09,0x0D09,0x0D11,0x0D09,0xED08,0x0D11,0x4B19,0x6721,
-  0xA651,0x6BB3,0x4DDC,0x8BB3,0xA892,0x09A3,0x4ABB,0xC8A2,0x2EBC,0xB4F5,0xD4FD,0xB4F5,
-  0xB0DC,0xABC3,0x2DD4,0x52ED,0x93ED,0x11E5,0x0DD4,0xABB3,0x476A,0x074A,0x0B6B,0x6E6B,
-  0xB38C,0x559D,0x1495,0x359D,0x96AD,0x559D,0x76A5,0x18B6,0x39BE,0x55A5,0x717C,0xD073,
-  0xEE7A,0x6FC4,0x30D5,0x7685,0xDA6D,0xB1C4,0xABCB,0xAFDC,0x52ED,0x2DCC,0xE669,0xA508,
-  0x2A19,0x6C21,0xE710,0x4100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x8B21,0x0911,0x8800,
-  0x4869,0xC5E9,0x0CCA,0x7382,0x6AC4,0x22FF,0x5586,0x5E46,0x168C,0x51E2,0xF2C2,0xED4A,
-  0xCB00,0xEC08,0x2C11,0x0C09,0x0C11,0x0C11,0x0C11,0x2C11,0xED08,0xCB08,0x0C3A,0x317C,
-  0x2C63,0x2672,0x8FD4,0x93FD,0x4DCC,0x2DC4,0x8AB3,0xCCBB,0xD0D4,0x52ED,0x31ED,0xAFDC,
-  0x49AB,0x0CCC,0x2DCC,0xCCAB,0x2EB4,0xAFDC,0x0DD4,0x8BBB,0x8882,0xA651,0x084A,0x317C,
-  0x9AC6,0x559D,0xF49C,0x18BE,0x18BE,0x349D,0xD494,0x559D,0x559D,0x359D,0xD7AD,0x9AC6,
-  0x18BE,0xF1DC,0x91C4,0x7875,0x9785,0x2CDC,0xCBCB,0x52E5,0x11F5,0x099B,0x2521,0x8608,
-  0x6B19,0x4A19,0x6408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B21,0x2A11,0x0A11,
-  0xA989,0xE6F1,0xECC1,0xB28A,0xE9CC,0x22FF,0x5586,0x1D46,0xD6A3,0x72EA,0xB09A,0x8921,
-  0x0C09,0x0C11,0x0C11,0x0C11,0x0C11,0x0C11,0x0C11,0x8B21,0x4B19,0xC908,0x0B3A,0xF494,
-  0x18B6,0x2A6B,0x6BAB,0xB4FD,0xD4F5,0x11E5,0xECBB,0x8FCC,0x6FCC,0xABBB,0x6ABB,0x6ABB,
-  0xCCBB,0x6EC4,0x8B93,0xCC9B,0x6FD4,0x8ABB,0x0DCC,0xABAB,0xC8A2,0xC98A,0x928C,0xFBD6,
-  0x9DE7,0x9AC6,0x1BD7,0x1CD7,0xF7AD,0x76A5,0x559D,0x76A5,0x559D,0x349D,0x559D,0x75A5,
-  0x53BD,0xF0DC,0x12BC,0x768C,0x33A5,0x6CDC,0xECC3,0xF0DC,0x2CDC,0x8461,0x4400,0x4A19,
-  0x6B19,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B21,0x2A11,0x2A11,
-  0xC991,0xE6F1,0x0FB2,0xB47A,0xE9CC,0x02FF,0x5586,0x1D4E,0xD7A3,0x51EA,0x0D82,0xC708,
-  0x0C09,0x2C11,0x0C11,0x0C11,0x2C11,0x2C11,0xA908,0x6921,0x2E5B,0xF073,0x117C,0x1495,
-  0xB6A5,0xF38C,0xEE9B,0xF1DC,0xD4F5,0x2DCC,0xEDB3,0xCCA3,0x8FB4,0xF0C4,0x8FBC,0xD0BC,
-  0x75C5,0x95B5,0x4E9C,0xAFCC,0x11ED,0x49B3,0x0CCC,0x6AAB,0x08B3,0xEDB3,0xD7AD,0x5DDF,
-  0xDBCE,0xDBCE,0x9DE7,0x1CD7,0xB6A5,0x55A5,0x96A5,0x96A5,0x559D,0x55A5,0x3595,0x518C,
-  0x8FC4,0x72ED,0x33DD,0x13D5,0x31D5,0x4DD4,0x8BB3,0x4EDC,0xAA82,0x8510,0xC708,0x8B21,
-  0x4A19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0811,0x8B21,0x2A11,0xEA08,
-  0x6989,0xE6F9,0x10B2,0xB572,0xE8D4,0x41FF,0x557E,0x1D46,0xD7A3,0x30EA,0xEC91,0xC800,
-  0x0C09,0x2C11,0x2C11,0x2C11,0xEC08,0xEA10,0xCD4A,0x8F63,0x7284,0x559D,0x1495,0xB38C,
-  0xB38C,0x559D,0x508C,0x6FBC,0x72F5,0x8FD4,0x6FC4,0x6A8B,0x2F8C,0xB6B5,0xD6B5,0x349D,
-  0x76A5,0x919C,0xF1CC,0x93F5,0xB0D4,0xCCBB,0x2DC4,0x09A3,0x08BB,0x8ECC,0xB5B5,0x59BE,
-  0x18B6,0x9AC6,0x5DDF,0xFBCE,0x96A5,0x349D,0xB6AD,0x76A5,0xB6AD,0x18AE,0xD294,0x6B9B,
-  0x32E5,0x16F6,0xD3F5,0x72F5,0x11E5,0x2DD4,0x6ABB,0x8AC3,0x6641,0x4700,0x6B21,0x4B19,
-  0xE610,0x2000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4A19,0x6B21,0x0A09,0x2919,
-  0x499A,0xC5F1,0xEEB1,0xF482,0xE9CC,0x23F7,0x369E,0x1D4E,0xD69B,0x51EA,0x4E9A,0x0A11,
-  0x0C11,0x0C11,0x4C11,0x2C11,0x0B11,0x6C42,0x559D,0x1495,0xB38C,0x359D,0x55A5,0x359D,
-  0x559D,0x55A5,0xB384,0x2F9C,0xAFD4,0x52ED,0x11E5,0x4EBC,0x70AC,0x34BD,0x34B5,0x92A4,
-  0xB2AC,0x4EC4,0x72F5,0x73ED,0x2DC4,0x0DC4,0xCCB3,0x09A3,0x69C3,0x4DCC,0x13AD,0x18AE,
-  0x59BE,0x79C6,0x9AC6,0x38B6,0xB6A5,0x96A5,0xB6A5,0x559D,0xF7B5,0xB7A5,0x3094,0x0CCC,
-  0xF5F5,0x15F6,0x52ED,0x32ED,0xD0DC,0xCBC3,0xEBD3,0xA992,0xC520,0xA808,0xAC21,0x2919,
-  0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x2919,0x8B21,0x2A19,0x0911,0x0842,
-  0xCBC3,0xA7EA,0x2DAA,0x128B,0xAAC4,0x66EE,0xF5BD,0x1D56,0xB69B,0x72F2,0xB09A,0x4A11,
-  0x0B11,0x2C19,0x0C11,0xCA08,0xEB31,0xB38C,0xB7AD,0xB394,0x149D,0x58BE,0xBAC6,0x9ACE,
-  0x59BE,0x18B6,0x97A5,0x9194,0x0D9C,0x6EC4,0xF0DC,0x52ED,0x72F5,0x11ED,0xD0DC,0xD0E4,
-  0xAFD4,0x93F5,0xF5FD,0xF0E4,0x0CCC,0x2DC4,0x299B,0x6BB3,0xEBD3,0xEDBB,0xB3A4,0x59BE,
-  0xDBCE,0x59C6,0xD7B5,0x38B6,0x79BE,0x38B6,0xF7AD,0x96A5,0xB6A5,0xD394,0x2FA4,0x93F5,
-  0xF5F5,0xB3F5,0x32ED,0x11E5,0x8ED4,0x8BBB,0xCBC3,0x8651,0xA710,0x4B19,0x6A21,0xC610,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x8B21,0xEA10,0x4921,0x097B,
-  0x2DD4,0x4BDC,0xCEAA,0x3292,0x0CBC,0x27E6,0x13A6,0x1C56,0xD793,0x72FA,0x71AA,0x2911,
-  0x0A11,0x6B19,0xC908,0xC810,0x0E53,0x759D,0x76A5,0x559D,0xF7B5,0xFBCE,0x9DE7,0x7DEF,
-  0xBACE,0x9AC6,0x18B6,0x559D,0x718C,0xAB93,0x4DAC,0x11D5,0x93F5,0xD4FD,0xF4FD,0x93F5,
-  0xCDBC,0x72E5,0xB4FD,0xD0E4,0x0DBC,0xECA3,0xC8A2,0xACC3,0x0CDC,0xCCBB,0xD3A4,0x59C6,
-  0xBAC6,0xF7B5,0x38B6,0x3CDF,0x3CD7,0x38B6,0x79C6,0xD7AD,0xF494,0x709C,0xCFCC,0xD4FD,
-  0xD4ED,0x72ED,0x32ED,0xAFDC,0x4DDC,0xEDCB,0x466A,0x6208,0xC708,0xAC21,0x0911,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A19,0x8B21,0xE908,0x4829,0x8BAB,
-  0xB0DC,0x0BCC,0x0EC3,0x13AA,0x0DAB,0x47EE,0x73BE,0x1A76,0xB67C,0x53D3,0x30BA,0x0831,
-  0x0A09,0x0A09,0x8A29,0x2E63,0x1495,0xB7AD,0x59BE,0xDACE,0xF7B5,0xB7AD,0xFBD6,0x9DEF,
-  0x1CD7,0x1CD7,0x38B6,0xB6A5,0xD7AD,0xF394,0xAB93,0xCCA3,0x32DD,0xF4FD,0xD4FD,0x73ED,
-  0x0DB4,0xD0DC,0x11ED,0x8FCC,0xACAB,0xC8A2,0x69BB,0x0DCC,0x0CD4,0xCCBB,0xF4AC,0xBAC6,
-  0xF7AD,0x18BE,0x59BE,0x18B6,0x59BE,0xBAC6,0xD7AD,0x75A5,0x7284,0x0FA4,0x11ED,0xD4FD,
-  0x32ED,0x11E5,0xAFDC,0x4DD4,0x2DDC,0x29A3,0x6110,0xA600,0x6B21,0x4B19,0xA608,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x8B21,0x0A11,0xE818,0x086A,
-  0xD1DC,0xCBCB,0x0DCC,0xF2BB,0x6DAB,0x89DD,0x72BD,0x597D,0xB67C,0x74CB,0x31D2,0x2749,
-  0xC808,0x2911,0x1174,0x59BE,0x18B6,0xB6A5,0x38BE,0x18B6,0x76A5,0x76A5,0x79BE,0x1CD7,
-  0x38BE,0xDBCE,0x9AC6,0xD7AD,0xB6AD,0xB7A5,0x34A5,0xCC93,0x6A9B,0x6FC4,0x52E5,0xF1DC,
-  0xEDB3,0x0DB4,0x4EC4,0x0DB4,0x4A9B,0xE8A2,0xECCB,0x0CD4,0xAACB,0xCDB3,0x35A5,0xBAC6,
-  0x18B6,0xF7B5,0x96A5,0x559D,0x96A5,0x96A5,0x76A5,0x96A5,0xD48C,0x91AC,0x52F5,0x52ED,
-  0x11E5,0xAFDC,0xEBCB,0x2CDC,0x0DCC,0xA751,0x6500,0x2A11,0x8C21,0xE810,0x2100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x6B21,0x6B19,0xE910,0xE620,
-  0x8BBB,0x2BD4,0x4CCC,0x90C3,0x8EBB,0x69DD,0x6DD5,0x96A5,0xB68C,0xF3CA,0xF2D9,0xAC61,
-  0xA808,0xCA29,0x728C,0x76B5,0x35A5,0xB6A5,0x38B6,0xB6A5,0x1495,0xB7AD,0xFBD6,0x3CD7,
-  0x18B6,0x559D,0x39C6,0x38BE,0x3495,0xB7AD,0x18AE,0xF39C,0x2A93,0xC8A2,0x8BB3,0xCCAB,
-  0x4EAC,0x2DAC,0xED9B,0x2A93,0xE8A2,0x6ABB,0xABCB,0xCBCB,0x48C3,0xEDAB,0xD7A5,0xBACE,
-  0xD7AD,0x149D,0x559D,0x76A5,0x359D,0x1495,0xF494,0x75A5,0xD38C,0x50A4,0xCFE4,0xD1DC,
-  0xAFDC,0x0CCC,0x0CD4,0x0CCC,0x677A,0x4308,0x2A19,0x6B21,0x4A19,0x8408,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4919,0x8B21,0x2A11,0xE710,
-  0x2772,0x8DD4,0xAEDC,0xF0BA,0x11CB,0x29DD,0x89E5,0xF5BD,0x179D,0x53C4,0x92EB,0x0E92,
-  0xC810,0xA921,0xCF93,0x4FBC,0x30A4,0xB6A5,0xD7AD,0xD7AD,0x18B6,0xDBD6,0x7DEF,0x5CDF,
-  0x79BE,0xF494,0xF8B5,0x9ACE,0x96A5,0x75A5,0xB6AD,0x35A5,0xEEB3,0x08BB,0xE8A2,0x099B,
-  0x6A93,0x8B9B,0x4A93,0xE892,0x29B3,0x8AC3,0x6ABB,0x8AC3,0x2AA3,0x709C,0x59B6,0x59BE,
-  0x559D,0xD494,0x96A5,0x96A5,0xF494,0xF494,0x5184,0x9384,0x5184,0xAC9B,0xECD3,0x8FDC,
-  0x2DD4,0x0CCC,0xECDB,0xABB3,0x4852,0xA508,0x4A19,0x6B21,0x0811,0x4208,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4100,0x0711,0x6B21,0x4A19,0x0911,
-  0x4629,0xCDB3,0x71ED,0xF1C3,0xF1C2,0xEEE4,0x49DD,0x31B5,0x779D,0xB4B5,0x72EC,0x0FC2,
-  0xC818,0x6619,0x6FBC,0x10E5,0x2F9C,0xB6A5,0x55A5,0xD7AD,0xFBCE,0xBEEF,0x7DEF,0xDBCE,
-  0xF7AD,0x18B6,0x59BE,0x79C6,0xD8B5,0x1495,0x759D,0x72A4,0xEDBB,0xEBD3,0x8AC3,0x09AB,
-  0xA89A,0xA792,0xC8A2,0x4AB3,0x8BB3,0x6AB3,0x8AB3,0x49AB,0xAD8B,0x3595,0x58BE,0xD7AD,
-  0x75A5,0x349D,0x1495,0x9284,0x1074,0x317C,0xF073,0xD073,0x517C,0x0E9C,0x89C3,0xEBD3,
-  0xECD3,0x0CDC,0x8AC3,0x2FAC,0x517C,0xAA29,0x0911,0x6B19,0x2919,0x6308,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A19,0x6B21,0x2A19,
-  0xA508,0x477A,0x50ED,0xB2DC,0x6FBB,0x92E5,0x69DD,0x6BC4,0x74AD,0xD5AC,0x71D2,0x52D2,
-  0x0939,0x8A52,0x11DD,0xD1CC,0x317C,0xD7AD,0xD7B5,0x18B6,0x59BE,0xDBCE,0x1CDF,0x9AC6,
-  0x75A5,0x38BE,0x79BE,0xD7AD,0x359D,0xF494,0x1495,0xF09B,0x6BAB,0x6AB3,0x6AB3,0x8AB3,
-  0x8ABB,0x6AAB,0x6AAB,0x4AAB,0x4AA3,0x4AA3,0x4AAB,0x298B,0x508C,0x96A5,0x96A5,0x76A5,
-  0x76A5,0xB28C,0xF073,0x4E63,0xCD52,0x4E63,0xF073,0x8E6B,0x9284,0x54AD,0x4DBC,0xAAC3,
-  0xEBCB,0xAAC3,0xCEAB,0x96B5,0x359D,0xA929,0xE910,0x4B19,0x6A19,0x8408,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4100,0xE718,0x6B21,0x4A19,
-  0xE808,0x2529,0x6FBC,0xB3F5,0x50C4,0xD0D4,0x49D5,0x2FE5,0xD8C5,0x58CE,0xF3F4,0x90CA,
-  0x0C72,0x0FB4,0x10ED,0x4FBC,0x3184,0x3495,0xF494,0xF8B5,0x18B6,0x76A5,0xB6AD,0x59BE,
-  0x39BE,0x96A5,0xB6A5,0x96A5,0xF494,0xD38C,0x9284,0xCD8B,0x6AA3,0x4AAB,0x4A9B,0x4AA3,
-  0x6AA3,0x6AA3,0x29A3,0x09A3,0x09A3,0x09A3,0xA892,0x2C73,0xB384,0x559D,0xF494,0xB38C,
-  0xF07B,0x6E6B,0x0D5B,0xCD52,0xED5A,0x8F6B,0xAF6B,0xED5A,0xAF73,0x38BE,0x3CDF,0x75B5,
-  0x4EBC,0x70A4,0x359D,0x18B6,0xB38C,0x4921,0x0911,0x4A19,0x6B19,0x8508,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6B19,0x4A19,
-  0x4A19,0xA500,0x0A93,0xB3FD,0x52DD,0x0CCC,0x0FE5,0xB3ED,0xD5ED,0x15EE,0x15F6,0x13E5,
-  0x6FCC,0x52ED,0x32ED,0x2FAC,0x3184,0xD494,0x5284,0x149D,0xF7AD,0x559D,0x928C,0x149D,
-  0xF8B5,0x55A5,0x1495,0xF494,0xB28C,0xB38C,0x117C,0x8B83,0x299B,0x09AB,0x09A3,0x09A3,
-  0xC892,0xC892,0xC892,0xA892,0xC89A,0xC892,0xA77A,0x8E6B,0x527C,0x317C,0x8F6B,0x0E53,
-  0xCD52,0xCD52,0xCD52,0xED52,0x2E5B,0x0E5B,0xAC4A,0x2B3A,0x6B42,0x359D,0xBEE7,0xDBCE,
-  0xB5B5,0x55A5,0x559D,0x96A5,0xB38C,0xCA31,0x0911,0x4A19,0x6B21,0xA610,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4100,0x0711,0x6B19,
-  0x6B21,0xC808,0x8641,0x2DBC,0xB3F5,0xD0DC,0x32ED,0xB4ED,0xD4F5,0x93F5,0xD4F5,0x14F6,
-  0xB3ED,0xD4F5,0x10ED,0x2FAC,0x9284,0xF494,0x7284,0x5284,0xD394,0xD494,0x9284,0xB38C,
-  0x96A5,0x559D,0xD38C,0xF494,0x349D,0xB38C,0xF073,0x6C73,0x0993,0xC89A,0xE88A,0xE88A,
-  0xC882,0x877A,0x677A,0x877A,0x8782,0x4772,0x6952,0x2D5B,0x4E63,0xEC52,0x6B42,0x4B42,
-  0x8C4A,0xAC4A,0x8C4A,0xEA39,0x6821,0x8929,0x0A3A,0xEA31,0x4821,0xB06B,0xDBCE,0x99C6,
-  0x559D,0x1495,0xB38C,0xF394,0xB28C,0x8C4A,0x0911,0x2A19,0x8B21,0xE710,0x2100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6B19,
-  0x6A21,0x4B19,0xC608,0x075A,0xCFE4,0xF4FD,0x93F5,0xB4ED,0xB4F5,0x93F5,0x93F5,0x93ED,
-  0xB4ED,0xD4F5,0x6DDC,0xADA3,0xF48C,0x96A5,0x349D,0x9284,0xF073,0xF073,0x317C,0x7284,
-  0xB38C,0x317C,0x317C,0xB38C,0xF494,0x928C,0xAF6B,0x2C63,0x887A,0x6782,0xA772,0x8872,
-  0x8872,0x2662,0x265A,0x2662,0xE659,0xC849,0xEA31,0x4B42,0xE939,0x2721,0x4821,0x2A3A,
-  0x6C42,0x2A42,0xA931,0x0A3A,0xAD52,0x6C42,0x6921,0x8A21,0xE710,0xED52,0x18B6,0xB6A5,
-  0x7284,0x317C,0x517C,0x7284,0x317C,0xAC4A,0x2919,0x2919,0x8C21,0x0819,0x4108,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,
-  0x4A19,0x8B21,0xE908,0xE520,0xE99A,0x92F5,0xD4F5,0xD4ED,0xB3F5,0x93F5,0xB3F5,0xB3F5,
-  0xB4F5,0x11ED,0xCBCB,0xAD9B,0xF48C,0x96A5,0x75A5,0xF394,0x317C,0xAF73,0x8F6B,0xAF6B,
-  0x8F6B,0x2E63,0x6F6B,0xB06B,0x8F6B,0x8F6B,0x0E5B,0xAB52,0x0852,0xE759,0xE659,0x6651,
-  0xC759,0xA741,0x6631,0x2631,0x2731,0xA929,0xC931,0x8929,0x8929,0x2B42,0x4C42,0xA929,
-  0xA929,0x2821,0x8929,0x7284,0x1BDF,0x97AD,0x4821,0xE910,0xE818,0x8C4A,0x759D,0x559D,
-  0x117C,0xD073,0xD073,0xF073,0xAF6B,0x6C42,0x2919,0x2919,0x8B21,0x2919,0x4208,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,
-  0x6A19,0x6B19,0x6B19,0xC908,0x4741,0x4DD4,0xB3FD,0xB4F5,0x93F5,0xB3F5,0xB4F5,0xD4FD,
-  0x93F5,0x0CD4,0x2CC4,0xD1A4,0x9284,0x5184,0x928C,0x7284,0x7284,0x117C,0xAF6B,0x6F63,
-  0x4E63,0x4E63,0x0D5B,0xAC4A,0x6C42,0x2A42,0x2A42,0x2A3A,0xEA31,0xA929,0x2821,0x0821,
-  0x8829,0x6821,0xA931,0xEA39,0xAA29,0x6829,0x8929,0xC708,0xCD52,0xBACE,0xF8B5,0x4821,
-  0x2821,0x8700,0x0F5B,0xDAD6,0xFFFF,0x7EEF,0x6C4A,0xC708,0x4919,0xAC52,0x317C,0x7284,
-  0xAF73,0x2E63,0x2E5B,0x2E5B,0x0E5B,0x8C4A,0x4A21,0x0911,0x6B21,0x4A19,0xA508,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,
-  0x0911,0x4A19,0x6B21,0xE908,0x0721,0x08A3,0xB0DC,0x93F5,0xB3F5,0xB3F5,0xB3F5,0x32E5,
-  0x4DD4,0x8FBC,0x58CE,0xD7AD,0x8F6B,0x6E63,0xAF73,0xAF6B,0xAF6B,0x8F6B,0x4E63,0x2E5B,
-  0xED52,0x8B4A,0x6B4A,0x2A3A,0xA929,0x8929,0x4821,0x6829,0x4821,0xA929,0x4E63,0x117C,
-  0xA929,0x0A3A,0x76A5,0xFBDE,0xF17B,0xC710,0x4A21,0x6700,0x906B,0xFFFF,0xBBD6,0x4821,
-  0x0919,0xC708,0x56A5,0x3CE7,0x38CE,0xDFFF,0x5284,0xA708,0xCA31,0xAF6B,0x2E5B,0xED52,
-  0xCD4A,0x8B4A,0x4B42,0x2B3A,0x4B42,0x6B42,0x8929,0x2A19,0x4A19,0x6A21,0x4A19,0xC610,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x8408,0x4A19,0x6B21,0x2A11,0xE918,0xC761,0x8BBB,0xD0DC,0x12DD,0xD0E4,0x4DDC,0xCBCB,
-  0x50A4,0xF7BD,0xBAC6,0xF494,0xAC52,0x6B42,0xCD52,0xCC52,0x0A3A,0xC929,0x0A3A,0x4B42,
-  0x0A3A,0x6B42,0x8C4A,0x6F63,0xD073,0x6F63,0x96A5,0xF494,0x4821,0xEE5A,0x3DE7,0x39C6,
-  0xC710,0x3174,0xFFFF,0xFFFF,0x18BE,0x4819,0x2919,0x6600,0xB06B,0xFFFF,0x59C6,0x8608,
-  0x4600,0xEA31,0x9AD6,0x1CE7,0x96AD,0xDFFF,0xF8BD,0x2919,0x6921,0x6F63,0xED52,0x2B3A,
-  0x0A3A,0xEA31,0xEA31,0xEA31,0xCA31,0xC931,0xA931,0x8B21,0x4B19,0x4A19,0x6B19,0x2919,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0711,0x6B21,0x4B19,0x2A11,0x0721,0x6882,0xCBC3,0x4ED4,0xECD3,0x6ACB,0xEEAB,
-  0x76A5,0xF8AD,0x96A5,0x149D,0xD06B,0xEA31,0x0B3A,0xEA31,0xED5A,0x117C,0x8C4A,0x2819,
-  0x117C,0x59C6,0xB38C,0x96AD,0x9ACE,0xF073,0xDEF7,0x9DEF,0x4B3A,0x327C,0xFFFF,0x317C,
-  0xC610,0x5AC6,0xDAD6,0x79CE,0x5DEF,0x6B42,0x0911,0x6700,0xB06B,0xBDF7,0xF8BD,0xE610,
-  0xA608,0x5284,0xDFFF,0xFFFF,0x3CDF,0xFFFF,0xFFFF,0x0F5B,0x0819,0x6B42,0x8C4A,0x2B3A,
-  0xCA31,0xA929,0x8929,0x8929,0x8929,0x4821,0xC710,0x8800,0x0A11,0x4A19,0x4B19,0x4A19,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x8308,0x2919,0x8B21,0x4A19,0xE810,0x2531,0xA792,0x89CB,0x69BB,0xEDA3,0x14A5,
-  0x75A5,0xF394,0xB38C,0xF7B5,0x96A5,0x2B42,0x4821,0x0719,0xD494,0x9DEF,0x938C,0xE718,
-  0xDBD6,0xFFFF,0x728C,0xF8B5,0x7DEF,0xAC4A,0x39C6,0xBEF7,0xB38C,0xF8B5,0x3CE7,0x0619,
-  0xAC4A,0x7EEF,0x9ACE,0x59C6,0xDFFF,0x5284,0x0911,0x2600,0x5384,0xFFFF,0xBEF7,0x97AD,
-  0xF594,0x3CE7,0x9EF7,0x75AD,0x1084,0x55AD,0xF7C5,0xCD52,0xE710,0x8929,0xC931,0x0719,
-  0xE810,0x2819,0xE718,0xC610,0xE710,0x2919,0xAA29,0x0B3A,0x8B21,0x2A19,0x6B19,0x2919,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0xC610,0x6B19,0x6A21,0x4A19,0x8600,0x284A,0x8BA3,0xEFA3,0x7284,0x1495,
-  0x928C,0x928C,0xD38C,0x18B6,0xF7B5,0x4E63,0x4919,0x4500,0x3284,0xFFFF,0x5ACE,0x6C42,
-  0xDFFF,0x75AD,0x093A,0x76AD,0x1CE7,0xEA31,0xF17B,0x5DEF,0x1BE7,0x7DEF,0x96B5,0x6408,
-  0xB7AD,0xFFFF,0x7EEF,0x7DEF,0xFFFF,0x9BCE,0x8A21,0x2600,0x327C,0x3BE7,0x1CE7,0x1CE7,
-  0xD7B5,0x55A5,0xAE73,0xA410,0x0100,0x0719,0xE518,0xC610,0xE910,0x4919,0x6921,0x6921,
-  0x6921,0x2919,0x4C42,0x2E63,0xCB31,0x0811,0x149D,0x38C6,0xCE52,0xA808,0x8B21,0x4A19,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x4200,0x0811,0x6B21,0x4A19,0x2919,0xC931,0xCF73,0x1595,0xB48C,0x3184,
-  0x7284,0xB28C,0x359D,0x559D,0xF394,0x317C,0x6C42,0x4600,0x2B3A,0xBAD6,0x7DEF,0x559D,
-  0xFFFF,0x2F63,0x8821,0x59C6,0x3DE7,0xC931,0x4B42,0xFBDE,0xFFFF,0x1BE7,0x0D63,0x8A29,
-  0x9EF7,0xBEF7,0xD394,0xB394,0xFBDE,0x7ACE,0xEC31,0xA808,0x4C3A,0xEB5A,0xE841,0x0619,
-  0x2200,0x0000,0x0000,0x8508,0x2A19,0xE810,0xA608,0x2B3A,0x4D3A,0xE910,0x2C3A,0x96AD,
-  0x938C,0x0A3A,0x56AD,0xFFFF,0x35A5,0x8929,0x3DE7,0xFFFF,0x2F5B,0x6700,0xAC29,0x4A19,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0xA508,0x6B21,0x4A19,0x6B21,0xC608,0xC739,0x0F7C,0xF494,0x928C,
-  0xB38C,0xD394,0xF394,0xF073,0x4E63,0x117C,0x2E5B,0x0911,0x2819,0x359D,0xFFFF,0x9EF7,
-  0x3CE7,0x6921,0x6821,0xFBDE,0x5DEF,0x0A3A,0xC710,0x39C6,0xFFFF,0x76AD,0x6821,0xED52,
-  0x55AD,0x0E63,0x6308,0x6308,0x2621,0xE518,0x2919,0x0A11,0x6600,0x2400,0x2400,0x2400,
-  0xE710,0xCC52,0x327C,0xF173,0xCA31,0xA808,0x6F63,0x5DEF,0x76AD,0xC608,0x6D42,0xFFFF,
-  0x59C6,0x4B3A,0x76AD,0xFFFF,0xDBDE,0x3184,0x79CE,0x9DEF,0x2F5B,0x6700,0xAC21,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4308,0x2919,0x6B21,0x4A19,0x2A19,0xA510,0x8729,0x8F6B,0x7284,
-  0x317C,0xF073,0x2D5B,0x8B4A,0xCD52,0x6F63,0x0D5B,0x8A29,0x4600,0xD173,0xFFFF,0xFFFF,
-  0x56A5,0x8508,0x0A3A,0x79C6,0xD7B5,0xEA31,0xE910,0x8C4A,0x8A52,0x2621,0xC708,0x6921,
-  0x8210,0x0200,0x8700,0x0911,0xA708,0x8600,0xE910,0xEB31,0x317C,0xD16B,0x4821,0x2B3A,
-  0x39C6,0xBFF7,0xFFFF,0xBEF7,0xD7B5,0xCA29,0x8F6B,0xFFFF,0x59C6,0x2A3A,0x327C,0xFFFF,
-  0xB7B5,0x4B42,0x97AD,0xFFFF,0xBFF7,0x3CE7,0x7DEF,0x1CDF,0xCE52,0x6700,0xAC21,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0xA508,0x6B19,0x6B19,0x6B21,0x0911,0xA608,0x8929,0x0E5B,
-  0xCD52,0x6B42,0x2A3A,0x4B42,0xAC4A,0x8C4A,0x8C4A,0xEC31,0xE910,0x6D42,0x34A5,0xD2A4,
-  0x2942,0xE810,0x2919,0x8729,0x0419,0x8608,0x4B19,0xC708,0x0300,0xA508,0x0811,0xA708,
-  0xC839,0xAF6B,0xAF42,0x2B19,0x8B21,0x8B21,0xA808,0x2E5B,0x9DEF,0xF8BD,0xAC4A,0x18BE,
-  0xFFFF,0x97B5,0x3284,0xFBDE,0xFFFF,0x5284,0x8F6B,0x1CE7,0x9EF7,0xFCDE,0x9EF7,0xDFFF,
-  0x35A5,0x2B3A,0xD8B5,0x7DEF,0x18BE,0xFFFF,0xFFFF,0x1CDF,0xAE4A,0x8700,0xAC29,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x4A19,0x4A19,0x6B21,0x2A19,0x0819,0xC931,
-  0x0A3A,0xEA31,0x0B3A,0x4B42,0x0A3A,0xEA31,0xC931,0x4919,0xA908,0x8700,0x6308,0x2200,
-  0x4400,0xC808,0xE810,0x0519,0x6629,0x6821,0xE908,0xE810,0x4F5B,0x36A5,0xD073,0x0811,
-  0x37A5,0xFFF7,0x1274,0x8700,0x8B21,0x6B21,0xC808,0xD173,0xFFFF,0xD8BD,0xB06B,0xFFFF,
-  0x1CE7,0x6729,0x0000,0x5384,0xFFFF,0x18BE,0xF073,0x1CDF,0x7DEF,0xF7BD,0x79D6,0xDFFF,
-  0x76AD,0x4B42,0x5AC6,0x1CDF,0x6E63,0x38C6,0xFFFF,0x9EEF,0xCE4A,0x8700,0xAC29,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0811,0x4B19,0x4A19,0x4A19,0x2A19,0xE818,
-  0x2819,0x8929,0xA929,0x4821,0x2819,0x6921,0x6821,0x2819,0x4919,0x6921,0x8929,0xAA29,
-  0x2919,0x0B32,0x7284,0xBACE,0x3CDF,0x75A5,0x2C3A,0x0711,0xB7B5,0xFFFF,0xDBD6,0xAC4A,
-  0xB6AD,0xFFFF,0x3384,0x8700,0x8B21,0x4A19,0x8700,0x8F6B,0xBEF7,0x18BE,0x5284,0xFFFF,
-  0x58CE,0x2621,0x4208,0xB494,0xFFFF,0x55A5,0xD073,0x9EF7,0xD7B5,0xA310,0xEC5A,0xFFFF,
-  0x96AD,0x6B42,0x18C6,0x7ACE,0xEA31,0x0D5B,0x7ACE,0x76AD,0x0B32,0xA808,0x8B21,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x6B19,0x4A19,0x2A19,0xE910,0xC808,
-  0xA608,0x0811,0x0819,0x8929,0xCA31,0x4821,0x0B3A,0x117C,0x149D,0xD7B5,0x7DE7,0x1CDF,
-  0x2E5B,0x18B6,0xFFFF,0x9EF7,0x9EF7,0xFFFF,0x39C6,0xEA31,0xF59C,0xFFFF,0x7DEF,0xF8B5,
-  0xF7BD,0xDEFF,0xD273,0x6700,0x8B21,0x2A19,0x6600,0x6F63,0xFFFF,0xF8BD,0x8F6B,0xFFFF,
-  0xBEF7,0x906B,0x2E5B,0x1CDF,0x5DE7,0x2D5B,0xB06B,0xBEF7,0x35A5,0x8508,0xEE5A,0x7DEF,
-  0x728C,0x0A32,0xAF73,0xCF7B,0x4819,0xC710,0xE718,0xA410,0xE710,0x4A19,0x6B21,0x4A19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x6B21,0x2A19,0x8A29,0x6C42,0x2E5B,
-  0x7284,0x6F63,0x6B42,0x76AD,0x7ACE,0x4B42,0xB06B,0x5DEF,0xFFFF,0xFFFF,0x5DEF,0x34A5,
-  0x55A5,0xFFFF,0xF8BD,0x6821,0x6B4A,0xBEF7,0xFFFF,0x6F63,0x56A5,0xFFFF,0xBEF7,0xDFFF,
-  0x9EF7,0xDEF7,0x916B,0x8800,0x6B21,0x6A21,0x4B42,0xD394,0xFFFF,0x77AD,0x8929,0xB7AD,
-  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xB294,0x8308,0xED52,0x149D,0x0E5B,0x0919,0x6A21,0x2621,
-  0xE518,0x0911,0x6408,0x4308,0x0819,0x2A19,0xA708,0xC810,0x4A19,0x6B21,0x6B21,0x6B19,
-  0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x6B21,0xC908,0x7163,0xFCDE,0x7DEF,
-  0xFFFF,0xF49C,0x0D53,0x59C6,0xBEF7,0xCD52,0xEB39,0xEB62,0x99DE,0xFFFF,0x3184,0xE318,
-  0xF8BD,0xFFFF,0xF07B,0x0000,0x0719,0x9ACE,0xFFFF,0xB06B,0xB7B5,0x5DE7,0x55A5,0x1BE7,
-  0xDFFF,0xDFFF,0xB16B,0x2700,0x8A21,0xB38C,0x7EEF,0xFFFF,0xBEF7,0xF173,0x2400,0xA829,
-  0xEF7B,0x35A5,0xB294,0x8952,0xE518,0xC710,0x4821,0xA410,0xA510,0x2919,0x0911,0x6500,
-  0xC710,0x2A19,0x0911,0x0911,0x6B21,0x8C21,0x6B21,0x6B21,0x6B19,0x4A19,0x2919,0xE710,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x6B19,0xA708,0x5384,0xFFFF,0x3CDF,
-  0x55A5,0x8C4A,0xAC4A,0x9ACE,0x7DEF,0x8C4A,0x6600,0x0200,0x96B5,0xFFFF,0x4E63,0x0300,
-  0x59C6,0xFFFF,0x738C,0x0519,0xCD52,0x7DEF,0xBEF7,0xAC4A,0xD8B5,0xFFFF,0x8F6B,0xD073,
-  0xFFFF,0xFFFF,0x5063,0x6700,0x6A21,0xED52,0xF3A4,0x14A5,0x2C63,0x2621,0xC810,0xA708,
-  0xA410,0xE418,0xA410,0x2300,0xA608,0x6B21,0x0911,0x8708,0xE810,0x6B21,0x6B21,0x8B21,
-  0x6C21,0x6B21,0x8B21,0x6B21,0x2819,0xE710,0xE610,0xA510,0x8408,0x6308,0x4208,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4B19,0xC710,0x5284,0xDFFF,0xDBCE,
-  0x76A5,0x6B4A,0x8B4A,0xBACE,0x3CE7,0xE931,0x4400,0xC610,0xD8BD,0xFFFF,0x327C,0x8708,
-  0x9384,0xFFFF,0x9EEF,0xB8AD,0xFBDE,0xFFFF,0x528C,0x4821,0xF49C,0x9AD6,0x6C42,0x2819,
-  0x928C,0x3084,0xAA29,0x0911,0x4A19,0x8600,0x8308,0xA410,0x2300,0x8608,0x8B21,0x8B21,
-  0xE910,0x8608,0xC708,0x6B19,0xAC29,0x6B21,0x6B21,0xAC21,0x8B21,0x4919,0x2819,0x0819,
-  0xC710,0xA508,0x8408,0x6308,0x4200,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4B19,0xE810,0x7384,0xFFFF,0xBEF7,
-  0x9EF7,0x3184,0x0D5B,0x7ACE,0x9EF7,0x327C,0xB06B,0x6C42,0x39C6,0xFFFF,0x327C,0x4600,
-  0x8921,0x55A5,0x1CE7,0x7DF7,0xFBE6,0xB394,0x8510,0xC710,0x8B52,0x494A,0x2819,0xE810,
-  0x2400,0x0200,0xC608,0x6B19,0x6B19,0x6A19,0x0811,0xC708,0x4A19,0xAC21,0x4B19,0x4A19,
-  0x8B21,0x8B21,0x8B21,0x4919,0xE810,0xC710,0xC610,0x8508,0x8408,0x6308,0x4108,0x2100,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4B19,0xE810,0x938C,0xFFFF,0x9ACE,
-  0x34A5,0xAF6B,0xD073,0x59C6,0xFFFF,0xFFFF,0xFFFF,0x8F6B,0x35A5,0xDBDE,0x2E5B,0xE810,
-  0xC808,0xC710,0xC839,0x484A,0x2521,0x0200,0xA608,0x4B19,0x8508,0x2300,0x0811,0x6B21,
-  0x4A19,0x4A19,0x6B21,0x6B21,0x4A21,0x6B21,0x8B21,0x8B21,0x4A19,0x0819,0xE810,0xC710,
-  0xA508,0x8308,0x4208,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x2A19,0x0819,0xD494,0xFFFF,0xFFFF,
-  0xFFFF,0x38BE,0x1074,0xB394,0xD6B5,0x7194,0x6C6B,0x8929,0x0719,0x0519,0xC510,0x4A19,
-  0x6B19,0x0911,0x6500,0x2400,0x8608,0x0911,0x6B19,0x6B21,0x6B19,0x6B19,0x8B21,0x6B21,
-  0x6B21,0x4A19,0x2919,0x0811,0xE710,0xC610,0x8408,0x4208,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4A19,0x0919,0x2F5B,0xD39C,0xAE7B,
-  0xAD5A,0x093A,0x6821,0xE618,0xC318,0x8310,0x4300,0xC710,0xC708,0x8600,0xE810,0x6B21,
-  0x6B21,0x8B21,0x4B19,0x4B19,0x6B19,0x6B21,0x4B19,0x4919,0x2919,0x0819,0xC610,0xA510,
-  0x6408,0x4208,0x4100,0x2100,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4A19,0x4A19,0x4A19,0x2919,0xE518,0x6308,
-  0x0400,0x4500,0xC708,0xA708,0x8600,0xC708,0xE910,0x4B19,0x8C21,0x8C21,0x6B21,0x4A19,
-  0x2919,0x2919,0x2819,0x0719,0xE610,0xA508,0x6408,0x6308,0x4200,0x2100,0x0100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x6B21,0x6A21,0xE910,0x8700,0x0911,
-  0x4A19,0x6B21,0x8B21,0xAC21,0xAC21,0x8B21,0x6A21,0x2919,0xE810,0xE710,0xA510,0x8408,
-  0x6308,0x4308,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6B19,0x6B21,0x4A19,0x8B21,0xAB21,0x8B21,
-  0x4A19,0x2919,0xE710,0xC610,0x8508,0x6308,0x4300,0x4208,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA610,0x0811,0xE810,0xA610,0x8408,0x6308,
-  0x2200,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// Delta 1: 86x82 at (16, 22), 3885 bytes
+static const uint8_t spaceman_delta_1_rle[3885] PROGMEM = {
+  0xE5,0x04,0x10,0x10,0x10,0x80,0x00,0x00,0x10,0xE7,0xE0,0x81,0x01,0x82,0x02,0xCA,
+  0x00,0x00,0xE1,0xDD,0x00,0x10,0x80,0x02,0xD4,0x01,0x10,0xDD,0xDA,0x00,0x10,0x80,
+  0x02,0xDA,0x00,0x10,0xDB,0xD8,0x01,0x12,0xCC,0x05,0x62,0x62,0x62,0xCE,0x00,0x00,
+  0xD7,0xD6,0x01,0x12,0xC8,0x82,0x06,0x87,0x07,0x82,0x06,0xCB,0x00,0x00,0xD5,0xD5,
+  0x80,0x02,0xC6,0x80,0x06,0x80,0x07,0xDC,0x00,0x00,0xD4,0xD3,0x01,0x12,0xC6,0x00,
+  0x60,0x80,0x07,0xC5,0x01,0x67,0x83,0x06,0x01,0x76,0xD1,0x00,0x10,0xD3,0xD2,0x00,
+  0x10,0xC5,0x02,0x46,0x70,0xC4,0x00,0x60,0xC5,0x80,0x0A,0x01,0x6A,0xD5,0x00,0x00,
+  0xD1,0xD0,0x00,0x10,0x81,0x02,0x00,0x40,0x80,0x02,0x02,0x46,0x70,0xC3,0x82,0x06,
+  0x80,0x0A,0x80,0x0B,0xC8,0x00,0xB0,0xD2,0x00,0x10,0xD0,0xCF,0x03,0x13,0x24,0x81,
+  0x02,0x01,0x67,0xC3,0x81,0x06,0x01,0xAB,0xDB,0x00,0x40,0xD6,0xCE,0x03,0x13,0x24,
+  0x80,0x02,0x01,0x45,0x82,0x07,0x81,0x06,0x00,0xB0,0xC5,0x81,0x0C,0xC5,0x80,0x0C,
+  0xC6,0x80,0x0A,0xC6,0x00,0x20,0xD4,0xCD,0x02,0x12,0x40,0x81,0x02,0x00,0x40,0x82,
+  0x07,0x81,0x06,0x00,0xB0,0xC3,0x01,0xDC,0xD0,0x00,0xC0,0xC3,0x00,0xE0,0xC5,0x00,
+  0x60,0xD4,0xCC,0x07,0x13,0x24,0x21,0x57,0xC4,0x00,0xA0,0x82,0x0B,0x00,0xC0,0xC6,
+  0x01,0xDE,0x80,0x0D,0x00,0x90,0xCA,0x82,0x0B,0x00,0xE0,0xC5,0x00,0x40,0xD2,0xCB,
+  0x03,0x13,0x24,0x80,0x02,0x01,0x57,0xC3,0x00,0x90,0x82,0x0B,0x00,0xC0,0xC5,0x09,
+  0xE7,0xE7,0x67,0x6A,0x87,0x80,0x05,0x01,0x8A,0xC6,0x82,0x0B,0x80,0x06,0x82,0x07,
+  0x00,0x40,0xC4,0x00,0x10,0xCB,0xCA,0x06,0x13,0x24,0x23,0x50,0x81,0x07,0x80,0x06,
+  0x00,0xA0,0x81,0x0B,0x00,0xC0,0xC3,0x01,0xDE,0x80,0x07,0x82,0x06,0x01,0x79,0x80,
+  0x08,0x00,0x50,0x80,0x08,0x80,0x05,0x00,0x60,0x80,0x07,0x01,0x6E,0xC7,0x00,0xA0,
+  0xC4,0x00,0x60,0xD0,0xCA,0x05,0x32,0x43,0x25,0x81,0x07,0x80,0x06,0x82,0x0B,0x82,
+  0x0C,0x00,0xD0,0x80,0x07,0x81,0x06,0x02,0x31,0x30,0x82,0x08,0x01,0xA9,0x80,0x0A,
+  0x01,0x85,0x80,0x08,0x00,0x90,0x80,0x07,0x01,0xE6,0xC3,0x00,0xB0,0xC7,0x00,0x20,
+  0xCF,0xC9,0x02,0x32,0x40,0x80,0x02,0x00,0x50,0x81,0x07,0x80,0x06,0x81,0x0B,0x82,
+  0x0C,0x00,0xD0,0x80,0x07,0x80,0x06,0x00,0x40,0x80,0x01,0x02,0x23,0xA0,0x80,0x08,
+  0x83,0x0A,0x04,0xD8,0x58,0xA0,0x80,0x08,0x00,0x60,0x80,0x07,0x01,0xED,0xC6,0x00,
+  0x60,0xC3,0x00,0x20,0xCE,0xC8,0x03,0x13,0x42,0x80,0x03,0x81,0x07,0x80,0x06,0x81,
+  0x0B,0x82,0x0C,0x01,0xE7,0x80,0x06,0x00,0x40,0x82,0x02,0x03,0x59,0x85,0x80,0x08,
+  0x80,0x0A,0x03,0xDB,0xA9,0x83,0x08,0x80,0x09,0xC3,0x00,0xC0,0xCA,0x82,0x02,0xCA,
+  0xC8,0x04,0x32,0x32,0x30,0x81,0x07,0x01,0x56,0x81,0x0B,0x81,0x0C,0x00,0xD0,0x80,
+  0x07,0x01,0x64,0x83,0x02,0x01,0x48,0x82,0x05,0x03,0x8A,0x9A,0xC3,0x01,0x5B,0x80,
+  0x08,0x02,0x5A,0x50,0x80,0x06,0x00,0x70,0xC6,0x01,0xE6,0x81,0x07,0x00,0x50,0x83,
+  0x02,0x00,0x00,0xC7,0xC7,0x01,0x12,0x81,0x04,0x00,0x50,0x81,0x07,0x00,0x60,0x81,
+  0x0B,0x81,0x0C,0x03,0xD7,0xD6,0x84,0x02,0x01,0x46,0x81,0x05,0x02,0x8A,0x50,0xC4,
+  0x00,0x50,0x80,0x08,0x80,0x0A,0x82,0x08,0x05,0x31,0x67,0xE6,0xC4,0x01,0xA6,0x81,
+  0x07,0x00,0x40,0xC3,0x00,0x20,0xC7,0xC7,0x81,0x04,0x01,0x83,0x81,0x07,0x01,0x6A,
+  0x80,0x0B,0x81,0x0C,0x01,0xD7,0x80,0x06,0x00,0x10,0x84,0x02,0x01,0x68,0x80,0x05,
+  0x00,0xA0,0x80,0x0E,0x80,0x0B,0x00,0xA0,0x80,0x08,0x82,0x05,0x00,0x80,0x80,0x0A,
+  0x81,0x08,0x00,0xA0,0x80,0x01,0x80,0x06,0xC6,0x00,0x90,0xC3,0x82,0x02,0xC8,0xC6,
+  0x00,0x10,0x80,0x04,0x01,0x34,0x81,0x07,0x01,0x69,0x80,0x0B,0x00,0xD0,0x80,0x0C,
+  0x04,0xD7,0xE6,0x10,0x85,0x02,0x03,0x58,0x5A,0x84,0x0E,0x80,0x0B,0x05,0xAB,0x8A,
+  0x89,0x82,0x08,0x80,0x05,0x03,0x21,0x67,0xC3,0x00,0xD0,0x80,0x0B,0x80,0x06,0x80,
+  0x07,0x00,0x60,0x83,0x02,0xC6,0xC5,0x05,0x13,0x42,0x15,0x81,0x07,0x00,0x60,0x81,
+  0x0B,0x80,0x0C,0x01,0xD7,0x80,0x06,0x00,0x20,0xC3,0x81,0x02,0x01,0x48,0x80,0x05,
+  0x01,0xBF,0xC7,0x80,0x0E,0x80,0x0B,0x00,0xA0,0x83,0x08,0x00,0x50,0x80,0x02,0x03,
+  0x16,0x7E,0x81,0x0C,0x81,0x0B,0x00,0x60,0x81,0x07,0x83,0x02,0xC6,0xC5,0x04,0x12,
+  0x32,0x40,0x80,0x07,0x02,0x56,0xA0,0x80,0x0B,0x81,0x0C,0x02,0xE7,0x60,0x80,0x02,
+  0xC3,0x81,0x02,0x00,0x40,0x80,0x05,0x00,0xA0,0xCA,0x81,0x0E,0x80,0x0A,0x80,0x08,
+  0x00,0xA0,0x80,0x05,0x81,0x02,0x01,0x16,0x80,0x07,0x00,0xC0,0xC3,0x01,0xD6,0x80,
+  0x07,0x00,0x50,0x80,0x02,0xC8,0xC4,0x05,0x34,0x34,0x25,0x81,0x07,0x00,0x60,0x80,
+  0x0B,0x81,0x0C,0x02,0xD7,0x60,0x80,0x02,0xC4,0x03,0x26,0x24,0x80,0x05,0x00,0xA0,
+  0xCB,0x80,0x0E,0x00,0xB0,0x80,0x0A,0x00,0x50,0x81,0x08,0x00,0x30,0x81,0x02,0x03,
+  0x16,0xE6,0x80,0x0C,0x00,0xD0,0x80,0x0B,0x80,0x06,0x80,0x07,0x02,0x42,0x60,0x80,
+  0x02,0xC5,0xC3,0x06,0x34,0x23,0x21,0x50,0x80,0x07,0x01,0x6A,0x80,0x0B,0x80,0x0C,
+  0x03,0xD7,0x64,0xC3,0x00,0x40,0x83,0x02,0x00,0x40,0x80,0x05,0x00,0xB0,0x80,0x0E,
+  0x02,0xBE,0xB0,0xC5,0x81,0x0E,0x00,0xB0,0x80,0x0A,0x00,0x50,0x80,0x08,0x01,0x54,
+  0xC3,0x03,0x47,0xED,0x80,0x0C,0x80,0x0B,0x01,0xA6,0x80,0x07,0x00,0x50,0x82,0x02,
+  0x00,0x00,0xC4,0xC2,0x00,0x10,0x81,0x04,0x02,0x23,0x80,0x81,0x07,0x00,0x60,0x80,
+  0x0B,0x81,0x0C,0x02,0xE7,0x60,0x81,0x02,0x00,0x40,0xC3,0x81,0x02,0x02,0x35,0x80,
+  0x81,0x0E,0x00,0xF0,0xC5,0x01,0xEB,0x81,0x0E,0x04,0xB7,0xA5,0x80,0x80,0x05,0x00,
+  0x30,0xC4,0x00,0x60,0x80,0x07,0x80,0x0C,0x00,0xD0,0x80,0x0B,0x00,0x60,0x81,0x07,
+  0x00,0x10,0x81,0x02,0xC5,0xC2,0x06,0x32,0x32,0x35,0xA0,0x80,0x07,0x01,0x6A,0x80,
+  0x0B,0x80,0x0C,0x02,0xD7,0x60,0xC6,0x00,0x40,0x82,0x02,0x02,0x45,0xA0,0x83,0x0D,
+  0x00,0xF0,0xC3,0x00,0xE0,0xC3,0x00,0xB0,0x80,0x0A,0x80,0x05,0x81,0x03,0xC4,0x03,
+  0x36,0x7D,0x80,0x0C,0x80,0x0B,0x01,0x96,0x80,0x07,0x00,0x50,0x80,0x02,0x02,0x42,
+  0x00,0xC3,0xC2,0x06,0x34,0x23,0x5A,0xB0,0x80,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,
+  0x80,0x0C,0x02,0x7E,0x40,0x82,0x02,0x00,0x40,0x81,0x02,0x00,0x40,0x81,0x02,0x80,
+  0x05,0x04,0xAD,0xA8,0x50,0x80,0x09,0x00,0xD0,0x83,0x0E,0x00,0xF0,0x81,0x0E,0x80,
+  0x0A,0x00,0x80,0x80,0x05,0x80,0x03,0x84,0x02,0x02,0x67,0xE0,0x80,0x0C,0x00,0xD0,
+  0x80,0x0B,0x00,0x60,0x80,0x07,0x00,0x50,0x81,0x02,0x00,0x30,0xC4,0xC2,0x05,0x14,
+  0x31,0x5E,0x80,0x0A,0x01,0x69,0x80,0x0B,0x80,0x0C,0x02,0xD7,0x60,0x80,0x02,0x04,
+  0x42,0x42,0x40,0x81,0x02,0x00,0x60,0x80,0x02,0x06,0x37,0x89,0xAB,0x70,0x80,0x05,
+  0x03,0xAD,0xBE,0x80,0x0D,0x00,0x90,0x81,0x0D,0x01,0xEA,0x80,0x08,0x02,0x53,0x10,
+  0xC5,0x03,0x47,0x6D,0x80,0x0C,0x80,0x0B,0x80,0x06,0x80,0x07,0x04,0x12,0x42,0x10,
+  0xC3,0xC2,0x04,0x34,0x23,0x50,0x81,0x0A,0x01,0x97,0xC3,0x02,0xE7,0x60,0x80,0x02,
+  0x00,0x40,0x80,0x02,0x80,0x04,0x01,0x24,0x81,0x02,0x02,0x43,0x50,0x81,0x0A,0x00,
+  0xB0,0x80,0x0A,0x03,0x58,0x9D,0x81,0x0A,0x81,0x05,0x00,0xA0,0x80,0x0D,0x80,0x0A,
+  0x00,0x50,0x80,0x03,0xC4,0x80,0x02,0x02,0x67,0xD0,0x80,0x0C,0x80,0x0B,0x01,0xD6,
+  0x80,0x07,0x03,0x52,0x42,0x81,0x00,0xC1,0xC2,0x0B,0x14,0x21,0x5A,0xBA,0xDA,0xBF,
+  0x80,0x0C,0x01,0x76,0xC8,0x80,0x04,0x02,0x24,0x60,0x80,0x05,0x80,0x0A,0x00,0x70,
+  0x80,0x0A,0x04,0xB7,0x5A,0x90,0x80,0x0A,0x00,0xB0,0x80,0x0A,0x04,0x58,0x9A,0x80,
+  0x80,0x05,0x00,0x30,0x80,0x02,0xC3,0x04,0x62,0x67,0x60,0x80,0x0C,0x00,0xD0,0x80,
+  0x0B,0x00,0x60,0x80,0x07,0x04,0x51,0x24,0x10,0x81,0x00,0xC0,0xC2,0x08,0x34,0x23,
+  0x5E,0xA7,0x60,0x80,0x0B,0x04,0xDC,0xDE,0x60,0x80,0x02,0x1C,0x42,0x42,0x46,0x46,
+  0x96,0x8D,0x98,0xBA,0x57,0xAB,0x78,0xEB,0x57,0xAB,0x70,0x80,0x05,0x81,0x0A,0x80,
+  0x05,0x80,0x03,0x81,0x02,0x00,0x60,0xC5,0x00,0xD0,0xC3,0x00,0x60,0x80,0x07,0x04,
+  0x53,0x24,0x10,0x82,0x00,0xC2,0x02,0x14,0x20,0x80,0x03,0x03,0xAE,0x7E,0x80,0x0B,
+  0x06,0xFC,0xD7,0x62,0x40,0x81,0x02,0x01,0x59,0x80,0x0D,0x03,0x9C,0xD9,0x80,0x0D,
+  0x02,0x8A,0xE0,0x80,0x0A,0x03,0x7A,0x5B,0x80,0x0E,0xC3,0x00,0xB0,0x82,0x0A,0x81,
+  0x05,0x00,0x10,0x83,0x02,0xC3,0x02,0x67,0xD0,0x80,0x0C,0x80,0x0B,0x00,0xD0,0x81,
+  0x07,0x00,0x10,0x80,0x02,0x00,0x30,0x82,0x00,0xC2,0x06,0x14,0x23,0x5E,0xB0,0x80,
+  0x0A,0x01,0xBE,0x80,0x0D,0x80,0x07,0x00,0x60,0x80,0x02,0x80,0x04,0x01,0x69,0x80,
+  0x0D,0x00,0xC0,0x81,0x0D,0x03,0xCD,0xCA,0x81,0x0E,0x01,0xB5,0xC3,0x01,0xE7,0x81,
+  0x05,0x80,0x0A,0x00,0x70,0x81,0x0A,0x01,0x50,0x87,0x02,0x03,0x46,0x7D,0x80,0x0C,
+  0x80,0x0B,0x01,0x96,0x80,0x07,0x04,0x84,0x23,0x10,0x81,0x00,0xC1,0x01,0x01,0x80,
+  0x04,0x01,0x15,0x82,0x0E,0x01,0xBE,0x80,0x0D,0x05,0xE6,0x42,0x49,0x85,0x0D,0x00,
+  0xF0,0x82,0x0D,0x00,0x90,0x80,0x0E,0x03,0xB7,0xBA,0xC3,0x01,0xB7,0x80,0x0A,0x03,
+  0x7A,0xBA,0x81,0x05,0x00,0x30,0x82,0x04,0x83,0x02,0x80,0x06,0x80,0x07,0x80,0x0C,
+  0x80,0x0B,0x01,0xA6,0x80,0x07,0x03,0x84,0x23,0x82,0x00,0xC1,0x0B,0x01,0x42,0x15,
+  0xEA,0xEA,0xBE,0x80,0x0D,0x06,0xE6,0x43,0x6D,0xF0,0x80,0x0D,0x80,0x0F,0x00,0xD0,
+  0x81,0x0F,0x81,0x0D,0x02,0x9B,0xE0,0x80,0x0A,0x00,0xE0,0x81,0x0A,0xC3,0x02,0xBE,
+  0xB0,0x81,0x0A,0x81,0x05,0x00,0x90,0x81,0x0D,0x00,0x40,0x84,0x02,0x02,0x4D,0x70,
+  0x80,0x0C,0x03,0xDB,0xA6,0x80,0x07,0x04,0x51,0x24,0x10,0x81,0x00,0xC1,0x01,0x01,
+  0x80,0x04,0x03,0x23,0xAE,0x80,0x0A,0x00,0xE0,0x80,0x0D,0x00,0xA0,0x80,0x07,0x04,
+  0x23,0xAE,0x90,0x83,0x0D,0x83,0x0F,0xC5,0x01,0x8E,0x83,0x0A,0x01,0xEA,0x80,0x0E,
+  0x01,0xB7,0xC4,0x00,0xF0,0x80,0x0D,0x01,0x96,0x83,0x02,0x00,0x40,0x80,0x07,0x80,
+  0x0C,0x03,0xDB,0xA6,0x80,0x07,0x04,0x51,0x42,0x10,0x81,0x00,0xC1,0x03,0x01,0x32,
+  0x80,0x03,0x00,0xA0,0x83,0x0E,0x00,0xF0,0x80,0x0E,0x08,0x64,0xAE,0xA9,0xDF,0xC0,
+  0x81,0x0D,0x81,0x0F,0x81,0x0D,0x00,0x80,0x80,0x0E,0x80,0x0A,0x06,0xDF,0xED,0xE9,
+  0x80,0x80,0x0A,0x02,0xB7,0xA0,0x80,0x05,0x00,0x80,0x81,0x0D,0x00,0xC0,0x80,0x0D,
+  0x01,0xFC,0x80,0x02,0x00,0x60,0x80,0x02,0x01,0x7E,0x80,0x0C,0x00,0xD0,0x80,0x0B,
+  0x00,0x60,0x80,0x07,0x00,0x50,0x80,0x02,0x00,0x30,0x81,0x00,0xC0,0xC1,0x07,0x01,
+  0x34,0x31,0x7B,0x85,0x0E,0x02,0x76,0xE0,0x80,0x0A,0x81,0x0D,0x01,0xFD,0x81,0x0F,
+  0x00,0xC0,0x80,0x0F,0x80,0x0D,0x01,0x9A,0x82,0x0E,0x00,0x90,0x81,0x0D,0x80,0x0A,
+  0x00,0xE0,0x80,0x0A,0x01,0xEA,0x80,0x05,0x00,0x80,0x80,0x09,0x81,0x0D,0x00,0xC0,
+  0x81,0x0D,0x00,0x60,0x80,0x02,0x00,0x40,0x80,0x07,0x80,0x0C,0x03,0xDB,0xA6,0x80,
+  0x07,0x05,0x51,0x43,0x10,0xC1,0xC1,0x02,0x01,0x30,0x80,0x02,0x01,0x18,0x86,0x0E,
+  0x00,0x70,0x80,0x0E,0x03,0xAC,0xDF,0x80,0x0D,0x82,0x0F,0x80,0x0D,0x01,0xFC,0x80,
+  0x0D,0x80,0x0A,0x80,0x0E,0x80,0x0A,0x00,0xD0,0x80,0x0A,0x81,0x0E,0x80,0x0A,0x01,
+  0x78,0x81,0x05,0x00,0x90,0x84,0x0D,0x80,0x0F,0x08,0xC4,0x24,0x67,0xDC,0xD0,0x80,
+  0x0B,0x01,0x67,0xC5,0x01,0x31,0xC0,0xC2,0x02,0x03,0x40,0x80,0x03,0x01,0x5B,0x87,
+  0x0E,0x01,0xA9,0x80,0x0D,0x00,0xC0,0x83,0x0F,0x00,0xC0,0x80,0x0D,0xC3,0x00,0x90,
+  0xC4,0x00,0xE0,0xC3,0x06,0x7A,0xBA,0x78,0x90,0x84,0x0D,0x00,0xC0,0x80,0x0D,0x80,
+  0x0F,0x00,0x90,0x80,0x04,0x01,0x7E,0x80,0x0C,0x03,0xDB,0xA9,0x80,0x07,0x01,0x51,
+  0x80,0x02,0x02,0x42,0x10,0xC0,0xC3,0x00,0x30,0x80,0x02,0x02,0x35,0xA0,0x86,0x0E,
+  0x04,0xBA,0xD9,0xC0,0xC3,0x00,0xF0,0x80,0x0D,0x08,0xFD,0xFC,0xDF,0x98,0xB0,0x80,
+  0x0E,0x01,0xBA,0x81,0x0E,0x06,0xAB,0xA7,0x5B,0xA0,0x81,0x0F,0x81,0x0D,0xC3,0x80,
+  0x0F,0x02,0xD6,0x40,0x80,0x07,0x80,0x0C,0x80,0x0B,0x01,0x96,0x80,0x07,0x07,0x5A,
+  0x43,0x24,0x31,0xC2,0x02,0x03,0x40,0x80,0x03,0x01,0x57,0x85,0x0E,0x02,0xA7,0x90,
+  0x80,0x0D,0x00,0x90,0x81,0x0D,0x06,0xCF,0xDF,0xDF,0xC0,0x82,0x0D,0x01,0xA7,0x80,
+  0x0E,0x80,0x0A,0x80,0x0E,0x00,0x70,0x81,0x0A,0x02,0x5B,0xA0,0x80,0x0D,0x83,0x0F,
+  0xC3,0x00,0xF0,0x80,0x0D,0x03,0x96,0x7D,0x80,0x0C,0x80,0x0B,0x01,0xA6,0x80,0x07,
+  0x07,0xBE,0xA5,0x23,0x41,0xC2,0x0E,0x01,0x42,0x35,0xAB,0xEB,0xEB,0xAB,0xA0,0x82,
+  0x0D,0x80,0x09,0x00,0xC0,0x83,0x0D,0x01,0xCF,0x82,0x0D,0x02,0x9A,0x50,0x82,0x0A,
+  0x00,0xE0,0x81,0x0A,0x00,0x70,0x80,0x0A,0x04,0x7A,0xDF,0xD0,0x81,0x0F,0x83,0x0D,
+  0x05,0xCD,0xC8,0x67,0x80,0x0D,0x00,0xE0,0x80,0x0B,0x03,0x9A,0x7A,0x80,0x0E,0x00,
+  0x70,0x80,0x03,0x02,0x42,0x10,0xC6,0x07,0x13,0x7A,0x7A,0x7A,0x81,0x0E,0x01,0xD9,
+  0x81,0x0D,0x81,0x09,0x00,0xC0,0x83,0x0D,0x04,0xC9,0xD9,0x80,0x81,0x0A,0x02,0x8A,
+  0x90,0x80,0x0A,0x00,0x80,0x81,0x0A,0x01,0xBA,0x81,0x0D,0x04,0xFD,0xFD,0xC0,0x86,
+  0x0D,0x00,0xA0,0x80,0x0E,0x01,0xCE,0x80,0x0B,0x00,0x90,0x83,0x0A,0x04,0x51,0x24,
+  0x30,0xC0,0xC7,0x01,0x38,0x81,0x0A,0x00,0xE0,0x80,0x0D,0x07,0xFC,0x98,0x9C,0x9C,
+  0x81,0x09,0x05,0xCD,0xCD,0x9D,0x81,0x09,0x81,0x0A,0x05,0x75,0x8A,0x85,0x82,0x0A,
+  0x03,0x7A,0xDF,0xC3,0x87,0x0D,0x05,0xFE,0x7D,0xCD,0x80,0x0B,0x00,0x70,0x80,0x0E,
+  0x07,0x7A,0x50,0x34,0x31,0xC0,0xC3,0x01,0x14,0x80,0x03,0x02,0x48,0xA0,0x84,0x0D,
+  0x01,0x94,0x80,0x08,0x82,0x09,0x00,0x60,0x82,0x09,0x80,0x0D,0x00,0xC0,0x80,0x09,
+  0x84,0x0A,0x02,0x5A,0x50,0x83,0x0A,0x0A,0xBA,0xED,0xFD,0xFD,0xFC,0xF0,0xC3,0x02,
+  0xC9,0xD0,0x80,0x0E,0x80,0x0C,0x00,0xE0,0x80,0x0A,0x80,0x0E,0x04,0xA8,0x10,0x20,
+  0x80,0x04,0x01,0x21,0xC0,0xC3,0x00,0x10,0x80,0x04,0x03,0x31,0x9D,0x81,0x09,0x00,
+  0xC0,0x81,0x0D,0x00,0x80,0x81,0x04,0x09,0x86,0x94,0xC4,0x8C,0x9C,0x80,0x09,0x06,
+  0x85,0xA5,0xA5,0xB0,0x83,0x0A,0x05,0x7B,0x78,0xDF,0x80,0x0D,0x01,0xFD,0x80,0x0F,
+  0x82,0x0D,0x01,0xFC,0x80,0x0A,0x00,0xE0,0x80,0x0A,0x03,0xCE,0x7A,0x80,0x0E,0x05,
+  0xA7,0x31,0x34,0x80,0x03,0xC2,0xC3,0x0A,0x13,0x24,0x13,0x9D,0x9C,0x90,0x81,0x0D,
+  0x84,0x04,0x14,0x84,0x89,0x84,0x89,0x84,0x85,0xA5,0xA7,0x5A,0x5A,0x70,0x80,0x0A,
+  0x02,0x5A,0xD0,0x80,0x0F,0xC3,0x02,0xFC,0xF0,0x81,0x0D,0x02,0xCA,0xB0,0x84,0x0E,
+  0x80,0x0A,0x07,0xEA,0x53,0x04,0x34,0x80,0x01,0xC2,0xC4,0x02,0x34,0x20,0x80,0x03,
+  0x02,0x8C,0x90,0x83,0x0D,0x81,0x04,0x80,0x0D,0x00,0x90,0x85,0x04,0x02,0x84,0x90,
+  0x81,0x05,0x00,0x70,0x80,0x05,0x02,0xA5,0x70,0xC3,0x00,0x80,0x81,0x0D,0xC4,0x82,
+  0x0D,0x02,0xCD,0xA0,0x85,0x0E,0x04,0x7A,0xBA,0x70,0x80,0x01,0x03,0x34,0x23,0xC4,
+  0xC4,0x05,0x14,0x32,0x14,0x83,0x09,0x04,0xC9,0x82,0x30,0x80,0x0F,0x01,0x82,0x80,
+  0x0D,0x04,0x94,0x94,0x30,0x80,0x04,0x82,0x05,0xC4,0x00,0xA0,0x80,0x05,0x00,0x80,
+  0x81,0x0D,0x02,0xFD,0xC0,0x86,0x0D,0x01,0xAB,0x84,0x0E,0x82,0x0A,0x00,0x50,0x80,
+  0x01,0x00,0x30,0x80,0x04,0x00,0x10,0xC5,0xC3,0x02,0x14,0x20,0x80,0x04,0x00,0x30,
+  0x82,0x04,0x04,0x84,0x89,0x40,0x80,0x03,0x80,0x0F,0x01,0x4C,0x80,0x0F,0x00,0xC0,
+  0x80,0x0D,0x01,0x89,0x80,0x04,0x81,0x03,0x00,0x50,0xC5,0x02,0x58,0xC0,0x81,0x0D,
+  0x00,0xC0,0x81,0x0D,0x00,0xC0,0x80,0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x84,0x0E,
+  0x02,0xBA,0x70,0x80,0x0A,0x02,0x50,0x10,0x80,0x04,0x01,0x31,0xC6,0xC2,0x05,0x13,
+  0x43,0x21,0x80,0x03,0x82,0x04,0x05,0x84,0xC4,0x14,0x80,0x0F,0x00,0xD0,0x80,0x0F,
+  0x0D,0x3D,0xFD,0xCF,0xC1,0x49,0x43,0x13,0x80,0x05,0x06,0x35,0x49,0x89,0x80,0x81,
+  0x09,0x02,0x89,0x80,0x81,0x09,0x00,0xC0,0x80,0x09,0x81,0x0E,0x01,0xBE,0x83,0x0A,
+  0x01,0x01,0x80,0x04,0x02,0x23,0x10,0xC7,0xC2,0x05,0x14,0x23,0x23,0x80,0x01,0x00,
+  0x30,0x80,0x04,0x00,0x80,0x80,0x04,0x03,0x84,0x28,0x82,0x0F,0x01,0x43,0x80,0x0F,
+  0x02,0x8D,0xF0,0x80,0x08,0x80,0x0F,0x01,0x91,0x80,0x08,0x82,0x03,0x01,0x83,0x81,
+  0x04,0x05,0x84,0x84,0x84,0x81,0x09,0x02,0xC9,0xA0,0x80,0x0B,0x08,0xE7,0xAB,0x7A,
+  0x50,0x10,0x80,0x04,0x01,0x21,0xC9,0xC2,0x80,0x04,0x05,0x23,0x9D,0x64,0x81,0x03,
+  0x00,0x10,0x81,0x04,0x80,0x03,0x00,0x90,0x81,0x0F,0x0D,0x41,0xDF,0x94,0xDF,0x9D,
+  0xFD,0x18,0x80,0x0F,0x00,0xD0,0x85,0x03,0x03,0x84,0x84,0x81,0x09,0x02,0x4C,0x80,
+  0x80,0x09,0x80,0x0A,0x03,0x7A,0xB7,0x80,0x0A,0x80,0x01,0x80,0x03,0x02,0x42,0x10,
+  0xCA,0xC1,0x04,0x13,0x41,0x40,0x82,0x0F,0x03,0x94,0x94,0x80,0x03,0x08,0x12,0x14,
+  0x9D,0x81,0x80,0x80,0x0F,0x80,0x04,0x82,0x0F,0x02,0xD1,0x40,0x81,0x0F,0x01,0xD4,
+  0x81,0x03,0x03,0xD9,0x83,0x84,0x04,0x06,0x94,0x8C,0xEA,0xB0,0x82,0x0A,0x00,0x50,
+  0x80,0x01,0x00,0x30,0x80,0x04,0x80,0x01,0x80,0x00,0xC9,0xC1,0x04,0x34,0x23,0x90,
+  0x80,0x0F,0x80,0x0D,0x80,0x09,0x06,0xFD,0x38,0xC4,0x30,0x83,0x01,0x00,0x40,0x80,
+  0x0D,0x01,0x34,0x81,0x0F,0x02,0xD1,0x40,0x80,0x0F,0x06,0xDF,0xD4,0x13,0x80,0x80,
+  0x0F,0x05,0x43,0x43,0x48,0x83,0x04,0x02,0xDF,0xD0,0x82,0x0A,0x05,0xE8,0x13,0x42,
+  0x80,0x01,0x80,0x00,0xCA,0xC0,0x04,0x13,0x41,0x40,0x81,0x0F,0x00,0xD0,0x80,0x04,
+  0x80,0x0F,0x02,0x94,0xD0,0x80,0x0F,0x06,0xD9,0x41,0x23,0x10,0x81,0x03,0x05,0x4D,
+  0xFD,0x38,0x83,0x0F,0x00,0xD0,0x81,0x03,0x02,0xCF,0xD0,0x81,0x03,0x00,0x40,0x80,
+  0x0D,0x00,0xC0,0x80,0x03,0x80,0x04,0x00,0xD0,0x80,0x0F,0x00,0xD0,0x80,0x0A,0x80,
+  0x0D,0x04,0x82,0x34,0x10,0x82,0x00,0xCA,0xC0,0x01,0x14,0x80,0x02,0x00,0x90,0x82,
+  0x0F,0x01,0x89,0x80,0x0F,0x02,0x23,0xD0,0x82,0x0F,0x04,0xD8,0x9D,0x60,0x80,0x01,
+  0x07,0x42,0x13,0x13,0xDF,0x80,0x0D,0x80,0x0F,0x03,0xD2,0x14,0x80,0x0F,0x01,0x41,
+  0x80,0x03,0x00,0xD0,0x81,0x0F,0x81,0x03,0x02,0x8D,0xF0,0x82,0x0D,0x06,0xF9,0x42,
+  0x32,0x10,0x83,0x00,0xC9,0x00,0x10,0x80,0x04,0x02,0x24,0xE0,0x80,0x0F,0x08,0xD9,
+  0x4D,0xF9,0x20,0x40,0x80,0x0F,0x80,0x09,0x00,0xD0,0x83,0x0F,0x01,0x42,0x80,0x03,
+  0x02,0x13,0x20,0x80,0x03,0x80,0x01,0x0B,0xDF,0xD1,0x3D,0xFD,0x41,0x4D,0x81,0x0F,
+  0x01,0xD4,0x80,0x03,0x01,0x8C,0x84,0x0D,0x05,0x82,0x34,0x31,0x84,0x00,0xC8,0x01,
+  0x14,0x80,0x03,0x01,0x49,0x81,0x0F,0x01,0xCD,0x80,0x0F,0x07,0xC3,0x1D,0xFE,0x14,
+  0x80,0x0F,0x01,0xD9,0x80,0x0F,0x04,0xD1,0x9F,0xD0,0x80,0x03,0x80,0x01,0x80,0x03,
+  0x00,0x10,0x80,0x04,0x01,0x34,0x82,0x0F,0x01,0x9D,0x80,0x0F,0x00,0xD0,0x80,0x0F,
+  0x03,0x13,0x49,0x80,0x0D,0x80,0x09,0x07,0xC9,0xC4,0x32,0x31,0x85,0x00,0xC8,0x04,
+  0x32,0x42,0x30,0x80,0x01,0x03,0x48,0x49,0x81,0x0F,0x01,0xD9,0x80,0x0F,0x0B,0x91,
+  0xDF,0xD3,0x09,0xFD,0x8C,0x80,0x0F,0x05,0x49,0xF9,0x24,0x80,0x01,0x04,0x32,0x13,
+  0x90,0x80,0x0D,0x84,0x0F,0x02,0xD1,0x40,0x87,0x09,0x01,0x43,0x80,0x04,0x00,0x10,
+  0x85,0x00,0xC8,0x04,0x13,0x24,0x30,0x83,0x01,0x80,0x04,0x01,0x9D,0x80,0x09,0x80,
+  0x0F,0x80,0x02,0x80,0x0F,0x06,0xD1,0x3D,0xFC,0x90,0x81,0x0F,0x00,0x80,0x80,0x0F,
+  0x01,0xC1,0x80,0x04,0x03,0x23,0x84,0x80,0x01,0x03,0x01,0x49,0x80,0x04,0x05,0xDF,
+  0xD2,0x48,0x80,0x04,0x0A,0x84,0x94,0x98,0x42,0x32,0x10,0x85,0x00,0xC8,0xC0,0x80,
+  0x01,0x01,0x32,0x81,0x04,0x03,0x24,0x10,0x81,0x01,0x02,0x49,0x80,0x80,0x01,0x00,
+  0x90,0x80,0x0F,0x80,0x0D,0x80,0x0F,0x01,0x8D,0x81,0x0F,0x00,0xD0,0x80,0x0F,0x01,
+  0x31,0x80,0x04,0x07,0x19,0xFD,0x23,0x43,0x80,0x00,0x02,0x10,0x40,0x80,0x09,0x02,
+  0x24,0x80,0x82,0x04,0x04,0x84,0x94,0x20,0x80,0x03,0x01,0x41,0x85,0x00,0xC8,0xC4,
+  0x80,0x01,0x00,0x20,0x80,0x03,0x81,0x04,0x08,0x23,0x10,0x24,0x21,0xD0,0x82,0x0F,
+  0x00,0x80,0xC3,0x81,0x0F,0x00,0x90,0x80,0x02,0x07,0x42,0x3D,0xFD,0x4D,0x80,0x0F,
+  0x01,0xE9,0x80,0x04,0x04,0x10,0x14,0x30,0x87,0x04,0x03,0x34,0x23,0x85,0x00,0xC9,
+  0xC8,0x80,0x01,0x03,0x23,0x43,0x80,0x04,0x0D,0x32,0x41,0x03,0x98,0x31,0xDF,0xD4,
+  0x81,0x0F,0x02,0x41,0x40,0x80,0x01,0x00,0x60,0x80,0x0F,0x01,0x9D,0x83,0x0F,0x04,
+  0x91,0x89,0x40,0x84,0x03,0x81,0x04,0x00,0x80,0x80,0x03,0x02,0x24,0x10,0x86,0x00,
+  0xC8,0xC7,0x83,0x00,0x80,0x01,0x02,0x23,0x20,0x81,0x04,0x00,0x30,0x82,0x01,0x04,
+  0x24,0x93,0x40,0x80,0x0F,0x02,0xD1,0x20,0x81,0x04,0x03,0xDF,0xD9,0x80,0x0F,0x0C,
+  0x81,0xDF,0xD2,0xDF,0xD1,0x49,0x40,0x85,0x03,0x00,0x20,0x80,0x03,0x01,0x41,0x84,
+  0x00,0xC9,0xC7,0x86,0x00,0x82,0x01,0x06,0x24,0x23,0x24,0x30,0x80,0x01,0x07,0x23,
+  0x59,0x42,0x3D,0x82,0x0F,0x06,0x9C,0xFD,0x10,0xD0,0x80,0x0F,0x00,0x40,0x80,0x0F,
+  0x01,0x81,0x80,0x0F,0x03,0x94,0xC9,0x80,0x03,0x00,0x10,0x80,0x03,0x03,0x24,0x21,
+  0x84,0x00,0xC9,0xC7,0x8A,0x00,0x81,0x01,0x01,0x43,0x80,0x04,0x00,0x20,0x80,0x03,
+  0x00,0x20,0x80,0x01,0x04,0x23,0x14,0xD0,0x80,0x0F,0x02,0x92,0xD0,0x80,0x0F,0x01,
+  0x48,0x80,0x0F,0x01,0x9D,0x80,0x0F,0x01,0xDC,0x80,0x0F,0x01,0x49,0x80,0x0F,0x80,
+  0x04,0x03,0xC9,0x23,0x80,0x04,0x00,0x10,0x84,0x00,0xC9,0xC7,0x8E,0x00,0x81,0x01,
+  0x00,0x30,0x81,0x04,0x0B,0x32,0x34,0x31,0x35,0x43,0x18,0x83,0x0F,0x01,0xD4,0x84,
+  0x0F,0x02,0xD4,0xD0,0x80,0x0F,0x80,0x09,0x05,0xFD,0x32,0x43,0x85,0x00,0xC9,0xC6,
+  0x92,0x00,0x82,0x01,0x00,0x30,0x80,0x04,0x02,0x32,0x40,0x81,0x01,0x04,0x23,0x15,
+  0xD0,0x80,0x0F,0x02,0x94,0xC0,0x80,0x0F,0x01,0x49,0x80,0x0F,0x01,0x89,0x81,0x0F,
+  0x00,0xC0,0x80,0x0F,0x00,0x90,0x80,0x03,0x01,0x21,0x85,0x00,0xC9,0xC7,0x96,0x00,
+  0x81,0x01,0x01,0x43,0xC3,0x03,0x23,0x10,0x81,0x01,0x05,0x3D,0xF9,0x19,0x80,0x0F,
+  0x01,0x2D,0x84,0x0F,0x01,0x32,0x80,0x04,0x00,0x10,0x84,0x00,0xCA,0xC7,0x9A,0x00,
+  0x81,0x01,0x01,0x43,0x80,0x04,0x01,0x23,0x80,0x01,0x01,0x23,0x81,0x01,0x04,0x4D,
+  0xF8,0x90,0x80,0x0F,0x00,0x90,0x81,0x0F,0x04,0x91,0x24,0x10,0x86,0x00,0xC9,0xE7,
+  0x81,0x01,0x80,0x04,0x00,0x20,0x81,0x04,0x80,0x01,0x01,0x23,0x80,0x01,0x04,0x28,
+  0xD8,0x40,0x81,0x0F,0x01,0x41,0x80,0x04,0x00,0x10,0xC4,0x00,0x00,0xCB,0xEB,0x80,
+  0x01,0x80,0x03,0x00,0x20,0x81,0x04,0x00,0x20,0x80,0x01,0x07,0x31,0x31,0x28,0xD9,
+  0x80,0x02,0x01,0x43,0xD2,0xEF,0x80,0x01,0x81,0x03,0x81,0x04,0x01,0x21,0x80,0x03,
+  0x00,0x10,0x81,0x03,0x02,0x42,0x10,0xD2,0xF3,0x80,0x01,0x02,0x32,0x30,0x80,0x04,
+  0x07,0x23,0x12,0x34,0x31,0xD2,0xF7,0x80,0x01,0x80,0x03,0x81,0x04,0x02,0x24,0x10,
+  0xD3,0xFA,0x81,0x01,0x80,0x03,0x01,0x21,0xD3,0xFE,0x00,0x10,0xD5,
 };
 
-const uint16_t spaceman_frame_4[14400] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0100,0x2200,0x2200,0x2200,
-  0x2200,0x2200,0x2200,0x2200,0x0100,0x0100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0100,0x2300,0x4400,0x6600,0x8900,0x8B00,0xAC00,0xCC00,0xCE00,
-  0xCE00,0xAE00,0xED00,0xCD00,0x8B00,0x8900,0xA800,0x6700,0x4500,0x2200,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x2200,0x6700,0xAA00,0xCC00,0xAE00,0xCF00,0xD000,0xD000,0xD000,0xD000,0xF000,0xF000,
-  0xD000,0xD000,0xD000,0xD000,0xD000,0xD000,0xD000,0xCF00,0xCF00,0xCE00,0xAB00,0x6800,
-  0x4500,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2300,0x6700,0x8A00,
-  0xAD00,0xCF00,0xF000,0xF000,0xD000,0xD000,0xD000,0xB000,0xB000,0xB000,0xB000,0xB000,
-  0xB000,0xB000,0xB000,0xB000,0xB000,0xD000,0xD000,0xD000,0xD000,0xD000,0xD000,0xCF00,
-  0xAE00,0x8C00,0x6800,0x4400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4400,0x8900,0xAC00,0xCF00,0xF000,
-  0xF000,0xD000,0xB000,0xB000,0xAF00,0x8E00,0xCE00,0x0D01,0x0C09,0xEC18,0xEC10,0xEC10,
-  0xEC10,0xEC10,0xEC18,0x0C09,0x0E01,0xCE00,0x8E00,0x8E00,0xAF00,0xB000,0xB000,0xF000,
-  0xF000,0xD000,0xCF00,0xAD00,0xAA00,0x4500,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x4400,0x6800,0xCD00,0xF000,0xD100,0xD000,0xAF00,
-  0x8F00,0xCE00,0xED08,0x0C29,0x2C39,0x2B49,0x4961,0x8971,0x8791,0x66A1,0x6699,0x6699,
-  0x6699,0x6699,0x66A1,0x8791,0x8871,0x4A61,0x2B49,0x0C39,0xEC28,0xED08,0xCE00,0xAE00,
-  0xAF00,0xAF00,0xD000,0xF000,0xF000,0xAD00,0x8900,0x4400,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x2300,0x8800,0xEE00,0xF100,0xD100,0xAF00,0xAF00,0xAE00,0xCD00,
-  0xCD18,0x6B41,0x8779,0x86B1,0xE7D1,0x08E2,0xC6F1,0xC5F9,0xE6F9,0xE7F9,0xE7F9,0xE7F9,
-  0xE7F9,0xE7F9,0xE7F9,0xE7F9,0xE7F9,0xC5F1,0x08E2,0xE7D1,0x86B1,0x8779,0x6A41,0xEC20,
-  0xCD08,0xCE00,0xAF00,0xAF00,0xAF00,0xCF00,0xF000,0xCD00,0x8700,0x4200,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x2100,0x8800,0xCF00,0xD100,0xD000,0xCF00,0xCF00,0xAE00,0xED08,0x0B21,0x4959,
-  0xC8A9,0xC6E9,0xC6F9,0xC6F9,0xE8E9,0x0BD2,0xEAC1,0xCAB9,0x0DAA,0x509A,0x109A,0x109A,
-  0x109A,0x109A,0x2F9A,0x4FA2,0x0FB2,0xEAC1,0x0BD2,0xE8E9,0xC6F9,0xC6F9,0xC6F1,0xC8C9,
-  0x6881,0x4A31,0xED08,0xAE00,0xCF00,0xCF00,0xEE00,0xEF00,0x0F01,0xCB08,0x6400,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x4400,0xAC00,0xD000,0xD000,0xCF00,0xAF00,0xAE00,0xEC00,0x6941,0xA7A1,0xA6D9,0xA6F9,
-  0xC6F9,0xE7E1,0x0CC2,0x70A2,0xB392,0x1482,0x1482,0x147A,0x7482,0xB48A,0x9482,0x9482,
-  0x9482,0x9482,0x948A,0x7482,0x157A,0x1482,0x1482,0x3482,0x319A,0x0BC2,0xE7E1,0xC5F1,
-  0xC5F9,0xA6E1,0xA7A1,0x8941,0x0C01,0x8E00,0xAE00,0xEE08,0xEE08,0xEF08,0xED08,0x8608,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6700,
-  0xAE00,0xD000,0xCF00,0xD000,0xAF00,0xCD00,0x2A39,0x8891,0xA5E1,0xE5F9,0x28F2,0x4BCA,
-  0x319A,0xD381,0xF479,0xB582,0x348B,0xB1A3,0xCEC4,0x89D5,0xA6DD,0xE6DD,0x44E6,0x44EE,
-  0x44EE,0x44EE,0xE6E5,0xA6DD,0x89D5,0xCEC4,0x6FB3,0x1393,0x9582,0xF481,0xD381,0x119A,
-  0x2DC2,0x08E2,0xC5F1,0xC5E1,0xA7A9,0x6949,0xCC00,0xAE00,0xEE08,0x0D09,0xEE08,0xED08,
-  0xA908,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x8800,0xCE00,
-  0xD000,0xEF08,0xAF00,0xAE00,0x0C29,0xAA81,0xA6C9,0xE6F9,0x08F2,0x0DC2,0xD291,0xD479,
-  0xD482,0xF2A3,0xACC4,0x67D5,0xE5ED,0x43FE,0xC3FE,0xE1FE,0xC5F6,0xC8EE,0x07EF,0xA9DE,
-  0xC9DE,0xC9D6,0xA9E6,0xC5F6,0xE2FE,0xC3FE,0x22FE,0x04F6,0xC6DD,0xEBC4,0xF2A3,0xF482,
-  0x3482,0xD289,0x0DBA,0x09EA,0xE5F9,0xC5D9,0x8891,0x0B29,0xCD00,0xED00,0xED10,0x0D09,
-  0x0D09,0xC908,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0xAA00,0xF000,0xD000,
-  0xCF00,0xAF00,0xED08,0x4951,0x87B1,0xE6F9,0x07F2,0x0DC2,0x1292,0x547A,0xF48A,0x0DAC,
-  0x86DD,0x84FE,0xE5FE,0xE5F6,0xE6E6,0xEAC6,0xAFA6,0x7296,0x777E,0x7976,0x5976,0x1B5E,
-  0x1B5E,0x1B5E,0x5A6E,0x7786,0x7296,0xAFA6,0xCCBE,0x06DF,0x44F7,0x04FF,0x84FE,0x86DD,
-  0x6CB4,0x138B,0x5582,0x128A,0xEDB1,0xE8F1,0xC4F9,0x86B9,0x4951,0x0B09,0xEC00,0xEC08,
-  0x2C11,0x2D11,0xC908,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x8B00,0xD100,0xCF00,0xCF00,
-  0xAF00,0xCD10,0x6869,0xE5E1,0xE6F9,0xE9D1,0x0F92,0x547A,0x138B,0x2DBC,0xA7E5,0x01FF,
-  0x42FF,0xE8D6,0x71A6,0x3786,0x196E,0x3E4E,0x1F3E,0x1F3E,0xFE45,0xBD4D,0xBD4D,0xBD55,
-  0xBD4D,0xBD4D,0xBD4D,0xDE45,0x1F36,0x1F36,0xFF35,0xFA65,0x178E,0x72A6,0xE8CE,0x42FF,
-  0xE1FE,0xA6ED,0x2DBC,0xF38A,0x357A,0x1192,0x09CA,0xE6F9,0xC5E1,0x8771,0x0B19,0xEC00,
-  0x0C09,0x2C11,0x2D11,0xC910,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xAB00,0xD000,0xCF00,0xCF00,0xCF00,
-  0x0C11,0xA989,0xC6F1,0xC7F1,0x2CB2,0xB482,0x7482,0xAFAB,0xC6E5,0x20FF,0x22F7,0x6BC6,
-  0x1496,0xDC5D,0x1F3E,0x3E46,0x1D4E,0xBB65,0x187D,0xB58C,0xD3AB,0x33BB,0x73BB,0x53BB,
-  0x53BB,0x73BB,0x53C3,0xD3B3,0xD594,0x397D,0xBB65,0xFC55,0x1E46,0x3F3E,0xFD55,0xF495,
-  0x6BC6,0x23F7,0x20FF,0xC6E5,0xAEAB,0x7482,0xB482,0x2DB2,0xA6E9,0xE7F9,0xC9A1,0x2A19,
-  0xEC00,0x0C09,0x2C11,0x2C11,0xE910,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0xA900,0xD000,0xD000,0xAF00,0xCF00,0x4C19,
-  0xCAA1,0xC6F9,0x09DA,0x509A,0x357A,0xD48A,0x2CD5,0xE3FE,0x41FF,0x89D6,0x158E,0x3D46,
-  0x5F3E,0xBB5D,0x377D,0x9694,0x75B3,0x91CA,0x50BA,0x4FBA,0x50CA,0x51D2,0x51D2,0x51D2,
-  0x51D2,0x72E2,0x93EA,0x93EA,0x93E2,0x93E2,0x93DA,0x74B3,0x958C,0x3775,0x9B5D,0x3F3E,
-  0x3E46,0xF96D,0x2DBE,0x02FF,0x02FF,0x2CD5,0xD48A,0x157A,0x509A,0x29D2,0xC6F9,0xA7C1,
-  0x0929,0xCC00,0x0C09,0x2C11,0x2C11,0xE810,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x6700,0xCF00,0xD000,0xCF00,0xCE00,0x2B21,0xA7B9,
-  0xC6F9,0x29DA,0x3092,0x367A,0x919B,0xC6E5,0x00FF,0xE7F6,0x539E,0x3C4E,0x5E46,0xBC5D,
-  0x588C,0x14C3,0x0FB3,0xA97A,0x2872,0xEB9A,0x4C9B,0x0B93,0x0B93,0x2C9B,0x2C9B,0x2C9B,
-  0x0C93,0x8A71,0x4A51,0xAA61,0xAB89,0xEFA9,0x30DA,0x93EA,0xF4EA,0xD3DA,0x14BB,0x5784,
-  0xBC55,0x3F3E,0x3D4E,0x3586,0x89D6,0x00FF,0x44EE,0xEFAB,0x547A,0x1192,0x0AD2,0xC5F9,
-  0xA6C1,0x0929,0xEC00,0x2C11,0x2B11,0x2B11,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x6600,0xCE00,0xCF00,0xCF08,0xAF00,0x2D19,0xA8A1,0xC5F9,
-  0x28DA,0x3192,0x557A,0x0EAC,0x83EE,0x21FF,0x6CBE,0x3976,0x7F3E,0xDE4D,0x578C,0x32AB,
-  0x0DB3,0xCCB2,0xCA92,0x876A,0x054A,0x8652,0xCB83,0xEB8B,0x6A7B,0x086B,0xE86A,0x6973,
-  0x6A7B,0xC96A,0xE641,0x0411,0x8608,0xE728,0x2649,0x4969,0x8C91,0xEFC9,0x72F2,0xD3EA,
-  0x54BB,0x768C,0x9B55,0x1F3E,0x1B66,0x8DB6,0x23FF,0xC2F6,0x6DBC,0x5582,0x128A,0x2ACA,
-  0xC5F9,0x86B9,0x2931,0xEA00,0x2B19,0x4C19,0x2B11,0x6308,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4400,0xED08,0xEF00,0xED00,0xCE00,0x0D11,0x8991,0xE6F9,0x09D2,
-  0x3192,0x357A,0x2DB4,0xA2FE,0x22F7,0x519E,0x1E4E,0xFE3D,0x596D,0xB4AB,0x6FCA,0xADAA,
-  0x4A93,0x6973,0x6A73,0x8B8B,0x0A83,0x475A,0xA872,0x8B93,0x8B8B,0x2A83,0x0983,0xE972,
-  0x2A7B,0x8A8B,0x2983,0x075A,0xC610,0x2700,0x4600,0x8600,0xC618,0x2749,0xCA79,0x0FBA,
-  0x31EA,0xB3EA,0x74C3,0xF77C,0x3E3E,0x5F46,0xF395,0x03F7,0xE1FE,0x6CBC,0x5582,0x328A,
-  0x0ACA,0xE5F9,0x87B1,0x2A29,0xEA00,0xEA08,0x4B19,0x0811,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0xA900,0x0F09,0xED08,0xCE00,0xEC08,0x8979,0xC6F1,0xE8D9,0x3192,
-  0x5582,0x2DB4,0xC1FE,0x23F7,0xF395,0xFF3D,0xDD4D,0xB58C,0xF2DA,0x10DA,0xEDA2,0xEB83,
-  0x6A83,0x097B,0xCC93,0x4EBC,0x2EB4,0x8B93,0x8872,0xC872,0xCC9B,0x4EB4,0xEC9B,0x2A7B,
-  0x297B,0xE972,0x4A7B,0x498B,0x4862,0x0C11,0xAF00,0xCE00,0xCB00,0x6700,0x6500,0x2731,
-  0xEB89,0x50CA,0x32E2,0xF2D2,0x9594,0xDC55,0x1F3E,0x1396,0x04EF,0xE3FE,0x6DBC,0x5482,
-  0x338A,0x09D2,0xE7F9,0xA999,0x4919,0x8B19,0x2A19,0x4B19,0xC610,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x8600,0x0D09,0x0E09,0xEE00,0xAD00,0x6861,0xC5E9,0x08EA,0x318A,0x3582,
-  0x0EAC,0xE2FE,0x03FF,0x138E,0x3F36,0xDB5D,0x94B3,0x72E2,0x53DA,0x0FB3,0xAB93,0x4A83,
-  0x0973,0xCC93,0x8EBC,0xAEC4,0x4DBC,0x0EAC,0xEC93,0x686A,0x2A8B,0x2EB4,0xEC9B,0xCC93,
-  0x6A83,0x297B,0x0973,0x2973,0x0973,0x4952,0xCC00,0xCF00,0xEF00,0xEF00,0xAE00,0x8900,
-  0x8400,0x0641,0x2EA2,0x93E2,0x52DA,0x94B3,0xDB5D,0x5F36,0x1976,0xE8E6,0x01FF,0x4EBC,
-  0x5482,0x318A,0x08E2,0x65E9,0x4A9A,0x4E5B,0x4B19,0x2B11,0x4A19,0x8408,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x4300,0xCB08,0x0F09,0xED00,0xAE00,0x0A31,0xA6D1,0xE6F9,0x0DAA,0x757A,0xB0A3,
-  0xA3F6,0xE3FE,0x148E,0x3F36,0xDB5D,0x94B3,0x73E2,0x73EA,0xEC91,0x886A,0x6A8B,0x0973,
-  0x8B8B,0x6EB4,0xAEC4,0xCEC4,0x8EBC,0xCC93,0x8B8B,0x8872,0x676A,0x2A83,0xED9B,0xEC9B,
-  0x297B,0x0973,0x2973,0x0973,0x497B,0x4A83,0xC931,0xCC00,0xCE00,0xEE08,0xEE00,0xEF00,
-  0xCD00,0x8800,0x0629,0xEC91,0x73EA,0x73E2,0x94AB,0x9B65,0x3F36,0x3586,0xE3FE,0x02FF,
-  0x0DB4,0x557A,0xEEA1,0xA5E9,0x27EA,0xCB7A,0x2A11,0x2A11,0x6C21,0xE910,0x4200,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xC808,0x0E09,0x0E09,0xED00,0xCC08,0x87A9,0xA4F9,0x6BCA,0x757A,0xF292,0x25EE,
-  0x41FF,0x1296,0x3F3E,0xBC55,0x94AB,0x72DA,0x93F2,0x4959,0x2329,0xA872,0xAB8B,0x0973,
-  0xEC9B,0xCFC4,0xAFCC,0x2DAC,0xAB8B,0x4A7B,0x886A,0x2762,0x076A,0x0A8B,0xAC93,0x0B93,
-  0x0A93,0x2A83,0x2973,0x2A7B,0x4A83,0xC87A,0x686A,0x2A19,0xAD00,0xCE00,0xEE08,0xEE00,
-  0xEE08,0xCE00,0xAB00,0xA710,0x6969,0x71DA,0x73E2,0x94B3,0xBB55,0x5F3E,0x148E,0xE3F6,
-  0xA3F6,0x119B,0xF671,0x4EBA,0xE7F9,0xC7B9,0x0821,0x0B09,0x4B19,0x4A19,0xC610,0x2100,
-  0x2200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x6308,0xEC08,0x0E11,0xED00,0xEC08,0x6859,0xC5F9,0x07E2,0x118A,0xF682,0x49DD,0x20FF,
-  0x4EB6,0x1F46,0x9C55,0xB3AB,0x72E2,0x72E2,0x8969,0x0300,0x6631,0x6B93,0xAB8B,0x4A7B,
-  0x8B83,0xCB8B,0x2A83,0x886A,0x876A,0x897A,0xC88A,0x2A9B,0x0EBC,0xF1DC,0x11D5,0x4FCC,
-  0xCCC3,0xCCB3,0x6A8B,0x4A7B,0x4A83,0xA772,0x2662,0x6829,0xCC00,0xCE00,0xEE08,0xEE00,
-  0xEE08,0xEE08,0xEF00,0xAB00,0xA708,0x4859,0x71DA,0x93EA,0xB4B3,0x9C55,0x3F3E,0x51A6,
-  0x60FF,0xC8D5,0xF57A,0x1482,0x2ADA,0xA6F1,0x8879,0x0A11,0x2A11,0x6B21,0x4A19,0x0819,
-  0x0811,0xE710,0x6408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xC810,0x0D09,0x0D11,0xED00,0x2A21,0xC6C1,0xC6F9,0x4EAA,0x1572,0x4DBC,0x23FF,0x8ACE,
-  0xDC55,0x1D46,0x149C,0x72EA,0x93DA,0xAB79,0x6400,0x4700,0x8B62,0x8A93,0x8862,0x8762,
-  0x886A,0xE982,0xC982,0x098B,0x8BA3,0xCEBB,0x8FD4,0x10ED,0xB3FD,0xF4FD,0xF4FD,0xD3FD,
-  0x8FE4,0x0CD4,0xECB3,0x2A83,0x8862,0x6762,0xE649,0x8539,0xEA10,0xCE00,0xEE08,0xEE08,
-  0xEE08,0xED08,0x0E09,0x0F09,0xCC00,0x8600,0x8969,0x31D2,0x52EA,0x149C,0x3D46,0x3D56,
-  0x6ACE,0x82FF,0xCCBC,0x157A,0x2FA2,0xE6F1,0xC7D9,0x2939,0x0B09,0x4B19,0x2B11,0x6C19,
-  0x6B21,0x6C21,0x2A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,
-  0xEB10,0x2D11,0xED08,0x0C01,0x8861,0xC6F9,0x2ADA,0x148A,0x7193,0x23EE,0x04EF,0xF975,
-  0x7F3E,0xF684,0xD2D2,0x73EA,0x2D92,0x6400,0x8A00,0x4C11,0xEB6A,0xC772,0x8541,0x2662,
-  0x4CA3,0x0FCC,0xB0DC,0x31ED,0x73F5,0xD3FD,0xD4FD,0xD4FD,0xB3F5,0x73ED,0x93F5,0xB3F5,
-  0x32ED,0x0DD4,0x0CD4,0x8BAB,0x276A,0xE651,0xE651,0xE551,0x0821,0xAC00,0xEE08,0xEE08,
-  0xEE08,0xEE08,0xED08,0xED08,0x0F09,0xED00,0xA608,0x0B7A,0x72DA,0xF2D2,0xD684,0x3E46,
-  0xF975,0xE4EE,0x63F6,0xB1A3,0xF481,0x09CA,0xC6F9,0x6889,0xEA10,0xE900,0x2821,0xE908,
-  0x2A19,0x4A19,0x8C21,0xE710,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8608,
-  0x0C09,0x2C11,0xEC00,0x2A29,0xC5B9,0xC6F9,0x4FAA,0x5582,0x29CD,0x02FF,0x2FAE,0x3E46,
-  0x3A66,0x33C3,0x33F2,0x0EA2,0xE528,0x8900,0xAE00,0x8B21,0xA86A,0x265A,0xE651,0x0CC4,
-  0xD4FD,0x14FE,0xD4FD,0xD4FD,0xD3F5,0x93F5,0x93F5,0x93F5,0x93F5,0xB3F5,0x93F5,0xB3F5,
-  0xD4FD,0xD0DC,0x0CCC,0x0BDC,0x6AB3,0x486A,0x686A,0x2662,0x4729,0xCB00,0xEE08,0xED08,
-  0xEE08,0xED08,0xED08,0x0D09,0xED00,0xEE08,0x4C19,0x6A3A,0xCF9A,0x32EA,0x13C3,0x5A6D,
-  0x3F3E,0x30A6,0x41FF,0x88D5,0x5582,0x4FAA,0xC7F1,0xC7D1,0x0839,0x8831,0x887A,0x8831,
-  0x2919,0x2A19,0x6B21,0x0911,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x0911,
-  0x2C11,0x0C11,0x2C01,0x6861,0xC6F1,0x0ADA,0x1482,0x729B,0x63FE,0x07DF,0xDC55,0x1E46,
-  0xF5A3,0x93E2,0x31C2,0x2949,0x4600,0xEF00,0xAE00,0xEA39,0xC872,0x065A,0x686A,0x11ED,
-  0xD4F5,0xB3F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x93F5,0x93F5,
-  0x93FD,0x11ED,0x0DD4,0xAAD3,0xCBC3,0xAC8B,0x8C9B,0xA78A,0xA651,0x0A11,0xED00,0x0D09,
-  0x0D09,0x0D09,0xED08,0x0D09,0xED00,0xCD00,0x8C21,0xEB29,0x8849,0xADA9,0xB4EA,0xF5A3,
-  0x1D46,0xFC5D,0xC8D6,0x03FE,0x30B3,0x3482,0xEAC9,0xA6E1,0x49B2,0x2FB4,0x31ED,0xECC3,
-  0x8839,0xE910,0x4B19,0x4A19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6300,0x2C11,
-  0x4B19,0x0C09,0x2B19,0x86A1,0xE7F9,0x0FAA,0x7482,0x2ACD,0xE1FE,0x70A6,0x1F36,0x7A6D,
-  0x92CA,0x52E2,0x8969,0x8608,0xCE00,0x0F01,0xAD00,0xEA41,0x0973,0x6762,0xA97A,0x12ED,
-  0xB4F5,0x93F5,0x93F5,0x93F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x72FD,0x32ED,
-  0x17D6,0x79D6,0x18CE,0xF7CD,0x75BD,0xEF8B,0x4AA3,0x8792,0xE561,0x4729,0xCC00,0x0E09,
-  0x0E09,0xAD00,0xEE00,0x2E11,0x0E09,0x0D09,0x2C11,0xEB10,0xA708,0x8B61,0x71EA,0xB3CA,
-  0x9A6D,0x1F36,0x50A6,0xC1FE,0x29CD,0x7482,0x4FAA,0x66E9,0xE9E2,0x32DD,0x72FD,0xCBCB,
-  0x2631,0xE810,0x6B19,0x4A19,0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x4C19,
-  0x4C19,0x0B01,0x6A51,0xC6E1,0xC8E1,0x5382,0x3193,0x83F6,0xC5EE,0x1876,0x1E46,0x35A4,
-  0x73EA,0xEDA1,0xC520,0x6900,0x3009,0xED08,0xAD00,0x6929,0x096B,0xC86A,0xA982,0x11ED,
-  0xB4F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0xB3F5,0x72F5,0x73E5,0x18CE,
-  0xF9AD,0x349D,0x0E8C,0xD294,0xD7A5,0x5094,0xE89A,0x8792,0x056A,0x2629,0xCA00,0xCC00,
-  0xAB00,0x2B11,0xEC08,0x6C00,0xAC00,0xCC00,0xCD00,0xCD00,0xCC00,0x2A21,0xAD99,0x53EA,
-  0xD3B3,0xFA65,0x396E,0xC8D6,0xA2F6,0x51A3,0x348A,0xAACA,0x69CB,0x8FC4,0x8FDC,0x8792,
-  0x8518,0xE910,0x8C21,0x2919,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0811,0x4B19,
-  0x2B11,0xEA00,0x8989,0xE6F9,0xAAB9,0x757A,0x6EBC,0xE1FE,0x8DB6,0x1E4E,0x7A6D,0xD2D2,
-  0x92E2,0x4851,0xA800,0xCE00,0x0E09,0xED00,0xCD00,0x0A11,0x695A,0x676A,0x8872,0xD0E4,
-  0xB4F5,0xB3F5,0x72F5,0x52ED,0x52ED,0x52ED,0x72ED,0x92F5,0x92FD,0x93E5,0xB5BD,0x54A5,
-  0xEE93,0x487A,0x4469,0xE761,0xAF7B,0x91AC,0x09A3,0xC7A2,0x6672,0x2521,0x6700,0x2A11,
-  0x6D42,0xAC52,0x8A21,0x0A11,0x4B19,0xC908,0xEA08,0x0B11,0xCC00,0xAA00,0x6B51,0x92D2,
-  0x70E2,0x568D,0x1F3E,0x719E,0x20FF,0x0DBD,0x7582,0x6EAB,0xCABB,0xCDC3,0xCBBB,0xC559,
-  0x8608,0x2A11,0x8C21,0xE810,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4A19,0x4B19,
-  0x0B09,0x0911,0x86B1,0xE6F1,0xCE99,0x948A,0xE9E5,0xE5FE,0x767E,0xDF45,0x36A4,0x32E2,
-  0x2EB2,0xC620,0xAA00,0x0F09,0xED08,0xED08,0xEE00,0xCB00,0xC849,0x065A,0x2762,0x4DDC,
-  0xB3F5,0x93F5,0x93ED,0xB5DD,0xB5D5,0xB5CD,0x94CD,0x73DD,0x72F5,0xB5D5,0x34A5,0xAAAB,
-  0xE7AA,0x279A,0x0892,0xA679,0x4972,0x30AC,0x69B3,0xE8A2,0x677A,0x6631,0x4821,0x2E5B,
-  0x95AD,0x5284,0x8F6B,0x3184,0x317C,0x2E5B,0x2E5B,0xCD52,0xEC39,0xE908,0xE918,0x0EA2,
-  0x53E2,0x379C,0x9C55,0x3496,0x05EF,0x88DE,0x319B,0x2EAB,0x4ED4,0x2EDC,0xC792,0x4531,
-  0xE810,0x4B19,0x6B21,0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4B19,
-  0x0B09,0x4941,0xA6D1,0x09EA,0x338A,0x3193,0xC2F6,0xABDE,0x7C5E,0x3B5D,0x12D3,0x72E2,
-  0x6969,0x8808,0xCD00,0x0E09,0xED00,0xED08,0x0D09,0xAC00,0x6831,0xE551,0x2662,0x8ABB,
-  0x52ED,0x53DD,0xD6C5,0x38B6,0xB6AD,0x76A5,0x14A5,0x12A5,0x73D5,0xD2B4,0xCE8B,0xCACB,
-  0xADE4,0x6CDC,0xEBCB,0x29AB,0xE8A2,0xABB3,0x8ABB,0x28AB,0x277A,0xE851,0x6E6B,0x96AD,
-  0x7AC6,0xF394,0x96AD,0x9ACE,0x38BE,0x79C6,0x9ACE,0x39BE,0x349D,0xAD42,0xC710,0x8971,
-  0x72E2,0x33C3,0xD5AC,0x16AE,0xCCCE,0xC2FE,0xABBB,0x8EC3,0x52ED,0xAFDC,0xC571,0x8408,
-  0x2A19,0x6C21,0x2919,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0xC710,0x6C21,0x2A19,
-  0xEA08,0x8971,0xC5F1,0xECC9,0x9572,0x4CBC,0xE1FE,0x31A6,0x3F3E,0xF874,0xD0E2,0x91CA,
-  0xE630,0xAA00,0x0E01,0x0D09,0xED00,0xED08,0x0D09,0xED00,0xC810,0x4539,0x055A,0x878A,
-  0x11BD,0xF8B5,0xD29C,0x298B,0x4782,0xC881,0xC781,0x4B83,0xB09C,0x4F94,0x0983,0x08AB,
-  0x8ABB,0x0BD4,0xADE4,0x4CDC,0x8AC3,0xAAC3,0xAAC3,0x69BB,0x4672,0x274A,0x3084,0x39BE,
-  0xF8B5,0xD394,0xB38C,0xF494,0x349D,0xB6AD,0x79C6,0x9AC6,0x79C6,0xB7AD,0x517C,0x2F6B,
-  0xB2D2,0x8EDB,0x33BD,0xF895,0x4FAE,0x62F6,0x2AD4,0x50DC,0x52ED,0x0DCC,0xA561,0xA608,
-  0x4A19,0x6C21,0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x0819,0x6B19,0x2A11,
-  0x0A09,0x87A1,0x06FA,0x0FB2,0x5582,0x2AD4,0xE1FE,0x357E,0xDE45,0x569C,0x51EA,0x2FA2,
-  0xA710,0xCB00,0x0E09,0x0D09,0x0D09,0x0D09,0x0D09,0x0E09,0x8A00,0xE620,0xE461,0x6782,
-  0x359D,0xF2AC,0xABB3,0x28B3,0xE8AA,0x669A,0x2692,0x8679,0x8C9B,0x31D5,0xCDBB,0x267A,
-  0x678A,0xA78A,0x08A3,0x28AB,0x28B3,0xEBD3,0xEBD3,0xE98A,0xC551,0x0752,0xEF7B,0x96A5,
-  0x359D,0x359D,0x75A5,0x359D,0xF494,0x359D,0x18B6,0x1CD7,0x7DE7,0x38C6,0x1074,0x6C4A,
-  0xEFA1,0x0FE4,0x73CD,0xD885,0xD58D,0xABDC,0x0AD4,0x31ED,0x11ED,0x29AB,0x6539,0xA708,
-  0x4B19,0x4A19,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x2919,0x6B19,0x2B11,
-  0x0911,0x86B9,0x06FA,0xD0A1,0xD38A,0xA5F5,0xA4F6,0x596E,0xBC4D,0xF4BB,0x32E2,0xEE81,
-  0x8808,0xEC00,0x0D11,0xED08,0x0D09,0x0D09,0x0D09,0x2D11,0xEC08,0xC908,0x4541,0xA78A,
-  0x909C,0xEDA3,0x0BCC,0xADEC,0x8DDC,0x4CD4,0xCAC3,0x88A2,0xE9A2,0x10DD,0x32ED,0xE892,
-  0x2682,0x2682,0x8892,0xACB3,0x6ECC,0x2DCC,0xECD3,0xA882,0x6449,0x8A5A,0x117C,0xEF7B,
-  0xD38C,0x76A5,0x559D,0x359D,0x55A5,0x349D,0x96A5,0x59BE,0x39BE,0x76A5,0xF394,0xB38C,
-  0x54A4,0xD1E4,0xF3C4,0x986D,0xB77D,0x0ED4,0xECCB,0x72ED,0xCFE4,0x0572,0xA408,0x0911,
-  0x6B19,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B19,0x2A11,
-  0x0929,0xA6D1,0x27EA,0xB189,0x3193,0xE2FE,0x6AD6,0x7C56,0x3A5D,0x73D3,0x32D2,0x6B59,
-  0x8900,0xEC08,0x2D11,0xEC08,0x0C09,0x0C09,0x0C09,0x0C09,0x2D11,0xCA00,0xC618,0x677A,
-  0x8AA3,0x6B93,0x8BAB,0x2BD4,0x8DDC,0xADE4,0x4CE4,0x69B3,0x49A3,0xD0D4,0xF4FD,0xD0DC,
-  0xABBB,0x08AB,0x8BBB,0x32E5,0xB4FD,0xAFDC,0xECD3,0xE8A2,0xC559,0x074A,0x0B63,0x2D63,
-  0x55A5,0x149D,0xD394,0xB7AD,0xF7B5,0x349D,0x1495,0x559D,0x149D,0x149D,0xD7AD,0x79BE,
-  0x37C6,0x11E5,0x31B4,0xF674,0x959D,0x2CD4,0xCCB3,0x10E5,0x0CC4,0x2439,0x4500,0x6B21,
-  0x6B19,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A21,0x2A19,0xEA08,
-  0x2939,0xA6D9,0x49DA,0xF379,0x509B,0xA3F6,0x8ECE,0x7E4E,0x996C,0xD3E2,0x31CA,0x0939,
-  0xCB00,0x0D09,0x0D11,0xEC08,0x0C09,0x0C09,0x0C09,0x0C09,0x0D11,0xEC08,0xC708,0x4439,
-  0x878A,0x8CB3,0x2AA3,0xA79A,0x29AB,0xAAC3,0xCBCB,0xC8A2,0x0DBC,0xB3F5,0xF4FD,0xB4FD,
-  0x8ED4,0xEBCB,0x6DCC,0xF0D4,0xF1E4,0xB0DC,0xECD3,0x8ABB,0x4772,0x8441,0x695A,0xB38C,
-  0xBACE,0x76A5,0xD7B5,0xDBD6,0x18BE,0x559D,0x349D,0x75A5,0x559D,0x359D,0x559D,0x149D,
-  0xF1D4,0x11ED,0x71CC,0x93A4,0x33BD,0x2DD4,0x8AAB,0x8CE4,0xC882,0x8410,0xC810,0x6B21,
-  0x2919,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x4B19,0x4A19,0x2A11,
-  0x4841,0xA5E1,0x0ADA,0xF481,0xAFA3,0x22FF,0x6EC6,0x5D4E,0xB96C,0xF2DA,0x10C2,0x0939,
-  0xCC00,0x0D09,0x0C11,0x0C09,0x0D11,0x0D11,0x0D11,0x0D11,0x0D09,0x2D11,0x0911,0xC410,
-  0xA759,0xACC3,0x8EDC,0x8BB3,0xA79A,0x29A3,0x28AB,0x6AAB,0xF1DC,0xD4FD,0x52ED,0x8FDC,
-  0x69BB,0x4DCC,0x2EBC,0xEDA3,0x0DB4,0xECBB,0xECCB,0xCCBB,0xC89A,0xA972,0xB384,0xDBCE,
-  0x5DDF,0xFBD6,0x5DDF,0xFBD6,0xB7AD,0x76A5,0x96A5,0x75A5,0x349D,0x76A5,0x359D,0x108C,
-  0x6ECC,0x93F5,0xB4F5,0x53E5,0x32DD,0x2DD4,0x6ABB,0xEBD3,0xC659,0x6500,0x6B21,0x4B19,
-  0xA510,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA608,0x4A21,0x0B32,0x8C4A,
-  0x6959,0x85E1,0x2BDA,0x1482,0xAEAB,0x21FF,0x31A6,0x5E46,0xB874,0x12DB,0x30B2,0xE818,
-  0xEC08,0x0D09,0x0D11,0x0D11,0x0D11,0x0D11,0x0D11,0x0C09,0x0D09,0x0C11,0x0C32,0xAF6B,
-  0x2D6B,0x2672,0x4ECC,0xD4FD,0x11E5,0x90DC,0xAAC3,0x6ED4,0xCFCC,0x0DBC,0x8BB3,0xABB3,
-  0xCCBB,0xAECC,0x8B8B,0xEEA3,0x11E5,0x8BB3,0x0CC4,0x6CA3,0x29AB,0x0CB4,0xD6BD,0x3CDF,
-  0xBAC6,0xBACE,0x5DDF,0x1CD7,0xF7B5,0x359D,0x75A5,0x76A5,0xD7B5,0x18B6,0xF39C,0x8CA3,
-  0x52ED,0x36F6,0xB4ED,0x72F5,0x12DD,0xECC3,0xAAC3,0x28BB,0x2539,0x8700,0x8C21,0x2919,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4B21,0xCB29,0x0B3A,
-  0x6961,0xA6E1,0x2BD2,0x738A,0x6DBC,0x01FF,0x12A6,0x5E46,0xD874,0xD2E2,0xB2CA,0xCD4A,
-  0xEB00,0xEC08,0x2D11,0x2C11,0x2C11,0x2C11,0x2C11,0x6C19,0x0B11,0x4800,0x8A29,0xB38C,
-  0xF7B5,0x4D6B,0x4A9B,0x51F5,0xF4FD,0xD1E4,0xABB3,0x6DC4,0xCECC,0x4DC4,0x2CCC,0x6ED4,
-  0x74BD,0xB7B5,0x6F9C,0xCFD4,0x52ED,0x8AAB,0xECCB,0x4AAB,0x49B3,0x2DBC,0x54AD,0x59BE,
-  0x18B6,0x59BE,0x1CD7,0xDBD6,0xD7AD,0x559D,0xB6AD,0x359D,0x96AD,0xB7A5,0x9194,0x2CBC,
-  0xB3FD,0xF4FD,0x93ED,0x52ED,0xB0DC,0xAAC3,0xEAD3,0xC761,0x8610,0x0A11,0x6B21,0xC610,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x2A11,0xE810,
-  0x4859,0xC6E1,0x0BD2,0xB392,0xCCC4,0x01FF,0x11A6,0x5E46,0xD874,0xD2DA,0xB1C2,0x8B42,
-  0x0B09,0xEC08,0x2C11,0x2C11,0x2C11,0x2C11,0xEB08,0x0911,0xEB31,0x8D4A,0x2E5B,0xD394,
-  0xB7AD,0x1495,0xEF83,0xB0C4,0xD3FD,0xB0DC,0x2DC4,0x6B93,0xED83,0x74B5,0xF6D5,0x34B5,
-  0x569D,0x9294,0xD0CC,0xB3F5,0x12D5,0xCCBB,0xCDCB,0x09A3,0x49BB,0x0CC4,0xB1AC,0xD7AD,
-  0x18B6,0x99C6,0x59BE,0xF8B5,0x18B6,0xF8B5,0xD7B5,0xB6AD,0xD7AD,0x159D,0x71A4,0x31E5,
-  0x15EE,0xB3F5,0x32ED,0xD1E4,0x6EDC,0xECD3,0x49B3,0xA320,0x8700,0x8C21,0x2919,0x4308,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x8B21,0x2A11,0xC908,
-  0x4959,0xC6E1,0x2BD2,0x548A,0x2DB4,0x21FF,0x12A6,0x5E46,0xB874,0x12DB,0x4FAA,0x2819,
-  0x0A09,0x2C11,0x2C11,0x2C11,0x2C11,0xEB08,0x0A11,0xAA29,0x8F6B,0xF394,0xF494,0xB38C,
-  0xB28C,0x55A5,0xB384,0x509C,0xF0EC,0x32ED,0xD0E4,0xCDAB,0xEF9B,0x34B5,0x94B5,0xD29C,
-  0xB1A4,0x4EC4,0x31F5,0xB4F5,0xD0CC,0x0DC4,0x8DAB,0x09A3,0xABC3,0x0CD4,0x6EBC,0xF7AD,
-  0x9ACE,0x99C6,0xD7AD,0x38BE,0xDBD6,0x79C6,0x38BE,0x18BE,0x96A5,0x7194,0x70C4,0xD4FD,
-  0xF5ED,0x52ED,0xF1E4,0x4ED4,0x2DDC,0x2DD4,0xA559,0x6408,0x0911,0x8C21,0xE710,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4A11,0x0A11,
-  0x6959,0xA5E1,0x2BDA,0x1482,0xAFA3,0x21FF,0x31AE,0x5E46,0xB874,0x12DB,0x30B2,0xE820,
-  0x0A09,0x2C09,0x2C11,0x4C11,0x0B09,0xEA08,0xAD4A,0x117C,0xB38C,0xF494,0x359D,0x149D,
-  0x559D,0x55A5,0xF494,0x308C,0x2EAC,0xF1DC,0xF1E4,0x11ED,0x32F5,0xF0E4,0xAECC,0xCFD4,
-  0xCFDC,0x51ED,0xF4FD,0x72ED,0x6DD4,0xECBB,0x2A9B,0x6AB3,0x2CD4,0x0CD4,0x4EB4,0xD7AD,
-  0xDBCE,0x18BE,0x18BE,0xBACE,0xBACE,0x79C6,0x59C6,0xB6AD,0x1495,0x2F94,0x4EC4,0xF4FD,
-  0x52F5,0xF1E4,0x8FD4,0x0DCC,0x0CDC,0x6AB3,0x8310,0xC808,0x6C21,0x4A19,0xA408,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x4A21,0x4B11,0x0A09,
-  0x4859,0xA6E1,0x0ADA,0xF381,0xAFA3,0x22FF,0x8ECE,0x7D4E,0xB96C,0xF2E2,0x11C2,0x2941,
-  0x0A09,0x2C11,0x4C11,0x2C11,0x0A11,0xCB29,0x149D,0x96AD,0xD394,0x149D,0x38BE,0x9ACE,
-  0x39BE,0x79C6,0xF7B5,0x5595,0x718C,0x8B9B,0x8ECC,0xD0DC,0x52ED,0xD4F5,0xF4FD,0xD4FD,
-  0xD0D4,0x6ECC,0x92ED,0x52F5,0xECCB,0x8BAB,0x09A3,0xABC3,0x2CD4,0xCBCB,0x4FBC,0xF8AD,
-  0x59BE,0x18B6,0x38BE,0xD7AD,0x76A5,0x18B6,0xB6AD,0x76A5,0x969D,0xB29C,0x4EC4,0x93F5,
-  0xF1E4,0xD0D4,0x0CCC,0x0DDC,0xECCB,0xE569,0x8410,0x2911,0x8C21,0xE710,0x2100,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x6B21,0x4A19,0x0A11,
-  0x4841,0xA5E1,0x29E2,0x3282,0x8FA3,0xC3F6,0x8EC6,0x7D56,0xB974,0xD2DA,0x52DA,0xAD71,
-  0xEA08,0x2B11,0x6C19,0xEB08,0x6B19,0xAF6B,0x76A5,0x349D,0xF494,0x18BE,0x5DE7,0x7DEF,
-  0xDBD6,0xDBD6,0x38BE,0xB7A5,0x559D,0x308C,0xEC9B,0xECAB,0xF1D4,0xB3F5,0xD4FD,0xD3FD,
-  0xD0DC,0x0DAC,0x90D4,0xD0DC,0xADA3,0x2B9B,0x69B3,0xCBCB,0x0CD4,0x8AC3,0x2EB4,0x79BE,
-  0x79C6,0xF8B5,0x55A5,0x55A5,0x76A5,0x359D,0x1495,0x349D,0x559D,0xB394,0x50B4,0xF0DC,
-  0xCFD4,0x0CD4,0xABCB,0x2CDC,0x6BB3,0x2721,0xC708,0x2A19,0x6B21,0xC610,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0819,0x8B21,0x2A11,0x0911,
-  0x4A72,0xE9D9,0xEBC9,0x518A,0x319B,0x89DC,0x4DDD,0x1B66,0x595D,0x93CB,0x52DA,0xCD71,
-  0x0A11,0x2B11,0x2C19,0x4800,0x4919,0x7284,0xB6A5,0x18B6,0x18BE,0xF8B5,0x59C6,0x5DE7,
-  0x5DDF,0x7DE7,0xBACE,0xF8B5,0xF7B5,0x96A5,0x349D,0x308C,0x6D9B,0x2DBC,0x51DD,0x32ED,
-  0xCFCC,0x0DAC,0x0EBC,0x2EB4,0x8B9B,0xE89A,0xCBCB,0xECD3,0xEBD3,0x8AB3,0x4FA4,0x7AC6,
-  0x7AC6,0x55A5,0xF494,0x76A5,0x76A5,0x1495,0x349D,0x5184,0xB384,0x718C,0xACA3,0x2DD4,
-  0x6ED4,0xECCB,0xCCD3,0xECCB,0xEDAB,0x8F63,0x4A19,0x0911,0x8B21,0x0919,0x4308,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA510,0x4A19,0x6B21,0x0911,0x2821,
-  0x2A9B,0x6BD3,0x2CD3,0x919A,0x938A,0x0CCC,0x6AED,0x959D,0xB965,0x16AC,0x12EA,0x0E82,
-  0x0A19,0x0B11,0xEA10,0x0B32,0x527C,0x96A5,0xB7AD,0x79C6,0x59BE,0x96A5,0x96A5,0xBACE,
-  0xDBCE,0x79BE,0xBAC6,0x9AC6,0xD7AD,0x96A5,0xD7AD,0x969D,0x0E94,0x299B,0x6AAB,0xACB3,
-  0x0DAC,0x0DAC,0xCDA3,0x4B9B,0xE89A,0x49B3,0xCBCB,0xCBC3,0x69C3,0x6AA3,0xD294,0x79C6,
-  0x18B6,0x349D,0x1495,0x759D,0x1495,0x7284,0x5184,0xF07B,0xF07B,0x7184,0x0E9C,0x49BB,
-  0xAACB,0xECD3,0x8ACB,0xCCAB,0x14A5,0x1495,0x6921,0xE910,0x6C21,0x4A19,0x8408,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xE710,0x6B21,0x4B19,0xE910,0x4829,
-  0x0DC4,0x0DD4,0x2BD4,0x91B3,0xB492,0xEBBB,0xAAE5,0x93C5,0x9A7D,0x5794,0xB2E2,0x90AA,
-  0x8A21,0xC900,0x6A29,0x527C,0x7ABE,0xD7AD,0xB7AD,0x38BE,0xB6AD,0x149D,0xD7AD,0xDBCE,
-  0xDBCE,0xB7AD,0x96A5,0x59BE,0x39BE,0x149D,0x96AD,0xF8AD,0x13A5,0x8BAB,0xE7AA,0x08A3,
-  0x2A9B,0x2A9B,0xE99A,0xA89A,0xE8AA,0xAAC3,0x69BB,0x69B3,0x08AB,0xAC93,0x3595,0x18BE,
-  0xB7AD,0x96A5,0x359D,0x9384,0xD073,0x4D63,0x6E63,0x117C,0x8F6B,0x527C,0xD7B5,0xB0BC,
-  0x0CBC,0xEDBB,0xEDB3,0xB2A4,0xD7AD,0xF494,0x6829,0xE810,0x6B19,0x4A19,0xA510,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4A19,0x6B19,0x0A09,0x2821,
-  0xECB3,0x2FDC,0x6BD3,0x8ECB,0x92B3,0x8CB3,0xC8E5,0x12CE,0xDA85,0xB77C,0x33C3,0x52D2,
-  0xEB49,0xA700,0x0B32,0x928C,0x55AD,0xF49C,0x96AD,0xF7B5,0x76A5,0x55A5,0x79C6,0x9DE7,
-  0x7DE7,0x59BE,0x1495,0xF8B5,0xDBD6,0x96A5,0x559D,0x759D,0xB39C,0xEEB3,0xCACB,0x8ABB,
-  0x29AB,0xC8A2,0xC79A,0x08A3,0x49B3,0x69B3,0x29AB,0x08B3,0x098B,0x2F84,0x96A5,0x96AD,
-  0x76A5,0x149D,0x7284,0x8F6B,0xED52,0xCC5A,0x4F63,0xD073,0x0D5B,0x8F6B,0x18B6,0x5DDF,
-  0x16C6,0xD3A4,0x15A5,0x96A5,0x96AD,0xF394,0x0A3A,0x0811,0x2A19,0x6B21,0xE810,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x2919,0x6B21,0x2A11,0xA808,
-  0x8539,0x8FC4,0x4EF3,0x4ADA,0xCEC3,0x2DB4,0x44EE,0x8BD6,0x5686,0x177D,0x53CB,0x93E2,
-  0xEE91,0xC818,0x8A19,0xED93,0xAEC4,0x51A4,0x75A5,0x96A5,0xD7AD,0x9AC6,0x5DE7,0x7DEF,
-  0xFBD6,0x18BE,0x18B6,0x59BE,0x39BE,0xF7B5,0x149D,0x3595,0x7094,0xAAAB,0x6ABB,0x6ABB,
-  0x8ABB,0x8ABB,0xABB3,0x6AB3,0x08AB,0x09A3,0x09A3,0xE8A2,0xEA7A,0x317C,0x75A5,0xF394,
-  0xB28C,0xAF6B,0x0E5B,0xED5A,0xED5A,0x2E5B,0x2E5B,0xED5A,0x6B42,0x2A3A,0x317C,0x7DE7,
-  0x3CDF,0x18B6,0x559D,0x1495,0x1495,0xF394,0x0D5B,0x2919,0x0A11,0x8C21,0x2919,0x4300,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC710,0x6B19,0x4A19,0x2A11,
-  0xC610,0x8782,0x6EDC,0x50E4,0x4DC3,0xCDBB,0xCAE5,0xE8ED,0xD2BD,0x989D,0x95B5,0x33DD,
-  0x8FC2,0xA920,0x0519,0xECB3,0x31ED,0xED9B,0x96AD,0xB7A5,0x96AD,0x79C6,0x1CDF,0x3CDF,
-  0xBAC6,0x96A5,0xF7B5,0x79C6,0xD7B5,0x359D,0xD394,0xD38C,0x2F8C,0x6AA3,0x08AB,0x09A3,
-  0x09A3,0x09A3,0x29A3,0x09A3,0xE8A2,0xE8A2,0xE8A2,0xA782,0x2C6B,0x327C,0x7284,0x8F6B,
-  0xEC5A,0x8B4A,0xCC52,0xED52,0xAC4A,0x8C4A,0x0A3A,0x0A3A,0x2A3A,0x6829,0xAC4A,0x38BE,
-  0x79C6,0x149D,0xB28C,0xB38C,0x7284,0x7284,0x6F63,0x6921,0xE910,0x8C21,0x4A19,0x8408,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x6B21,0x4A19,
-  0xE908,0x6541,0xCBB3,0x31ED,0x0FCC,0x4CB3,0xAED4,0xA9ED,0x8FCD,0x96A5,0x34A5,0x31CB,
-  0x52E2,0xEA50,0x6B42,0xB1C4,0xD1DC,0x308C,0x559D,0x75A5,0x18B6,0x39BE,0xB7AD,0xD7AD,
-  0x38BE,0x59BE,0xB6AD,0x96A5,0x96AD,0xD394,0xD394,0x938C,0xAE83,0x0993,0x09A3,0x09A3,
-  0xE8A2,0xE89A,0xC8A2,0x8792,0x6682,0x668A,0x878A,0x4862,0xEC5A,0x6F63,0x2E5B,0xAC4A,
-  0x4B42,0x8C4A,0x8C4A,0x4B42,0xC931,0x4821,0xA929,0x8929,0xAA29,0x0819,0xCA29,0xF494,
-  0xD7B5,0xB38C,0x107C,0x1074,0xF073,0xF073,0x4F63,0x6921,0xE910,0x6B21,0x4A19,0xC610,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x4A19,
-  0x4A19,0xC610,0x066A,0xAEDC,0x32E5,0xCDBB,0x12D5,0xADE5,0xECD4,0x34B5,0xB7B5,0x93E4,
-  0xF2EB,0xAC91,0x0D83,0x10CD,0x90D4,0x5284,0x3595,0xB38C,0x359D,0x18B6,0xB6AD,0xF394,
-  0x149D,0xF7B5,0x96AD,0xF494,0xF494,0xF394,0xD394,0x5284,0x8E73,0x0A8B,0xC7A2,0xA78A,
-  0x878A,0x8792,0x878A,0x687A,0x4772,0x277A,0xE561,0xE841,0x4B42,0x6B42,0x8929,0xE718,
-  0xA931,0x4A42,0x2A42,0x6821,0x0B3A,0xD494,0xB7B5,0x8D4A,0x0819,0xE910,0x6A21,0xF073,
-  0x76A5,0x938C,0x8F6B,0x6F63,0x6E63,0x2D63,0x0C5B,0xEA31,0x2A19,0x4A19,0x6B19,0x2919,
-  0xA408,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE810,0x6B19,
-  0x6B21,0xE908,0xA420,0x4BA3,0xF4FD,0xF0DC,0x90CC,0xCED4,0xEEE4,0x94DD,0x99DE,0x97F6,
-  0xB2ED,0xB0D3,0x4FCC,0x50ED,0x90D4,0xEF8B,0xF494,0x5284,0x3184,0x359D,0x76A5,0x938C,
-  0x7284,0x359D,0x76A5,0xF394,0xD38C,0x559D,0xF494,0x107C,0x6E5B,0xEB72,0x668A,0x4772,
-  0x677A,0x4672,0x0662,0x265A,0xE659,0x2641,0x8639,0xC931,0xC931,0x6929,0xCA31,0xAD4A,
-  0x2B42,0xA929,0x4821,0x0819,0x7063,0xFFFF,0xFFFF,0xD394,0x4919,0xC808,0x0B32,0x8F6B,
-  0x117C,0xD073,0x0D5B,0xCD52,0xAC4A,0x4A42,0x6B4A,0x2A3A,0x6A21,0x4A19,0x6B19,0x4A19,
-  0x4A19,0x8508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x4A19,
-  0x4A19,0x6B21,0x8700,0xC859,0x11ED,0xD4F5,0xEEC3,0x4FCC,0x93F5,0x15FE,0x15EE,0xF5ED,
-  0xD4F5,0xB3ED,0xD4F5,0x93FD,0x6ECC,0xCC93,0x1495,0xD48C,0x7284,0x327C,0x117C,0x517C,
-  0x317C,0x938C,0x7284,0x517C,0x7284,0x928C,0x7284,0xAF73,0x0E5B,0x8B52,0x275A,0x2762,
-  0xC751,0xA641,0x8541,0x8541,0x4531,0x0721,0x6921,0xC931,0x4829,0x2821,0xD16B,0xBACE,
-  0xD073,0x6921,0x6700,0xCA31,0x149D,0x7DEF,0x3CE7,0xDAD6,0x6D42,0x4600,0x8D4A,0x8F6B,
-  0xCC52,0x8C4A,0x4B42,0x0A3A,0x0A3A,0xE931,0xEA31,0xC931,0x4921,0x2A19,0x4A19,0x4A19,
-  0x6B21,0xE710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2000,0xC610,
-  0x4B19,0x6B21,0x2A11,0xC718,0x8982,0x72F5,0x93ED,0x52E5,0x93ED,0xD4F5,0xB3F5,0x93F5,
-  0xB4F5,0xB4F5,0xF5F5,0x31ED,0xCCC3,0x0D9C,0x96A5,0x76A5,0x349D,0x928C,0xD073,0xD073,
-  0x8F6B,0xAF6B,0x4E63,0x0E5B,0x2E5B,0x0D5B,0xED5A,0xCD52,0x8C4A,0x2B3A,0xC839,0x8541,
-  0xC620,0x4829,0x4721,0x8929,0x0E5B,0xF07B,0xAA29,0x4921,0x0811,0x4819,0xB394,0xFFFF,
-  0x5284,0x4919,0x0600,0xCE4A,0x9ACE,0x79CE,0xB6B5,0xFFFF,0x748C,0xA708,0xEB31,0x4E5B,
-  0xAC4A,0xEA39,0xC931,0xC931,0xA929,0xA929,0xA931,0x8929,0x0911,0x0911,0x4A19,0x4A19,
-  0x4B19,0x0819,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,
-  0x2919,0x4B19,0x6B21,0xC808,0xA418,0xE89A,0x93F5,0xB3F5,0x93ED,0xB4F5,0xB3F5,0xB3F5,
-  0x93F5,0x93F5,0xD4F5,0xCFE4,0x69BB,0xCC8B,0x1495,0x559D,0xF494,0xB38C,0x517C,0xF07B,
-  0xAF6B,0x6F63,0x6F63,0x6F63,0x0E5B,0xAC4A,0x2B3A,0xA929,0x4721,0x6829,0x8929,0xC931,
-  0x8F6B,0xD073,0x2821,0xEE52,0xBEF7,0x9EF7,0xB073,0x2819,0xC808,0x0811,0x117C,0xFFFF,
-  0x928C,0xE710,0x0500,0xB163,0xDEF7,0xBEF7,0xBEF7,0xFFFF,0xBACE,0xCD4A,0xC810,0x6B42,
-  0x2A3A,0xC931,0xA931,0xA929,0x4921,0xE710,0x2819,0x2919,0x8A21,0x0B3A,0xCB31,0x2A19,
-  0x4B19,0x2919,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xA508,0x4A19,0x6B21,0x4A19,0xC808,0xE428,0xCBC3,0x92FD,0xD4F5,0xB3F5,0x93F5,0x93F5,
-  0x93F5,0xF4FD,0x31ED,0x2CD4,0x8EBC,0x55A5,0x317C,0x117C,0x317C,0xF07B,0xF073,0xF073,
-  0x6F63,0x2E5B,0xCC52,0x2A42,0xE931,0xE931,0xA931,0x2B3A,0xF073,0x0E5B,0x2719,0x6F63,
-  0x5DE7,0xB394,0x6821,0x938C,0xFFFF,0xFFFF,0x38C6,0xCB31,0xA808,0x2819,0x906B,0xDFFF,
-  0x1495,0xC929,0x8829,0x76AD,0xFFFF,0xFBDE,0xD29C,0x38C6,0xB9D6,0x6F63,0xC808,0xAA29,
-  0x8929,0xC710,0xA708,0x0819,0xAA29,0x4B42,0x4919,0x4919,0x36A5,0x9ACE,0xEE52,0xC808,
-  0x6B19,0x4A19,0x4308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0xE810,0x4B19,0x6B21,0x2A11,0xA800,0x056A,0x6EDC,0x93F5,0xB3ED,0xD3FD,0xD4FD,
-  0xB3F5,0x51ED,0xECCB,0x8FBC,0x58C6,0x76A5,0x2E5B,0x0D5B,0x4E63,0x0D5B,0x8C4A,0x2A3A,
-  0x4B42,0x4B42,0x8B4A,0xAC4A,0x4E63,0x7284,0x1495,0x117C,0xBACE,0xB7B5,0xEA31,0x938C,
-  0xFFFF,0xED5A,0x0A3A,0x59C6,0xBACE,0x76AD,0x9EF7,0x0E5B,0x8700,0xC808,0x706B,0xFFFF,
-  0x9EEF,0xDBD6,0x59C6,0xFBDE,0x59C6,0x6A4A,0x0419,0x083A,0xE839,0xC510,0x8700,0x4919,
-  0x8A29,0xEE52,0x8D4A,0xEB31,0x117C,0x79CE,0xF59C,0x8929,0xF8BD,0xFFFF,0xB06B,0x8800,
-  0x4B19,0x6B21,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x4308,0x2919,0x6B21,0x4A19,0x2B11,0x0621,0xE89A,0x8EDC,0x52ED,0x73F5,0x11E5,
-  0xF0E4,0x0CCC,0x2EB4,0xD6B5,0x9ABE,0x1495,0xCD52,0x4B42,0x8B4A,0x6B42,0x8C4A,0xCD52,
-  0x4B42,0x4721,0x317C,0x18BE,0x149D,0x59C6,0xFFFF,0xD073,0x39C6,0x7DEF,0x117C,0x97AD,
-  0xBEF7,0x4721,0xCD52,0x9EEF,0x3CDF,0xBAD6,0xFFFF,0x18BE,0xEB31,0x2600,0x305B,0x5DE7,
-  0xDBDE,0x39CE,0xB394,0x2C63,0x6621,0x0000,0x0400,0x2400,0x4300,0xE939,0xEF52,0x4919,
-  0xAA29,0x38BE,0xB6AD,0xED52,0xF49C,0xFFFF,0xFFFF,0xAF6B,0xB7B5,0xDFF7,0x1174,0x8700,
-  0x4A19,0x6B21,0x8408,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0xA508,0x4A19,0x6B19,0x4A19,0xE910,0x6549,0x29AB,0x8FE4,0x8FDC,0xECD3,
-  0xAACB,0xEDAB,0x96AD,0x18AE,0x75A5,0x76A5,0x327C,0x2A42,0x8829,0xA929,0xB06B,0x7ACE,
-  0x738C,0x2719,0xF8BD,0xDEFF,0x317C,0x76AD,0xFFFF,0x2B42,0x117C,0xBEF7,0x9ACE,0xFBDE,
-  0x59C6,0x4721,0x7384,0xFFFF,0x7DEF,0xFBDE,0x5DEF,0x3CE7,0xEE5A,0x4700,0x0D32,0x4D63,
-  0x294A,0x8508,0x0100,0x0000,0xE418,0xEA31,0x0D32,0xC908,0x4C42,0x79CE,0x9ACE,0x8921,
-  0xA929,0x3DE7,0xDBD6,0xED52,0x117C,0xDFFF,0xFFFF,0xDBCE,0x3DE7,0x9DEF,0x527C,0x6700,
-  0x2A19,0x8B21,0xA508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x2100,0xC710,0x6B21,0x4A19,0x4A19,0xA710,0xC661,0x69BB,0xECD3,0xCBCB,
-  0xABB3,0xD39C,0x769D,0x149D,0xF494,0x96A5,0x58BE,0x0D5B,0x0719,0xC710,0x706B,0xFFFF,
-  0xDBD6,0xAC4A,0x59C6,0x59C6,0xC931,0x159D,0xFFFF,0x6D4A,0x0A3A,0x9ACE,0xFFFF,0xDFFF,
-  0xF07B,0xA829,0xD8BD,0xBEF7,0x6E6B,0x0621,0x8F73,0x8D73,0xA931,0x0A11,0xE810,0x0200,
-  0x4300,0x4500,0xAA29,0x938C,0xDBCE,0xFBDE,0xB6AD,0x8A21,0x2C3A,0xDBDE,0x5DE7,0x4E63,
-  0x6F6B,0x5DEF,0xDBD6,0x0D5B,0xF07B,0xFFFF,0xFBD6,0x9EF7,0xFFFF,0xBEF7,0xD48C,0xA708,
-  0x4A19,0x8C21,0xA508,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x4308,0x2A19,0x6B19,0x4A19,0x0911,0x8610,0xC661,0x69C3,0x8BAB,
-  0x508C,0x1495,0xF494,0x928C,0xD38C,0x96A5,0xF7B5,0x5184,0x2B42,0x6700,0x8A29,0x18BE,
-  0xDFF7,0x55A5,0x7DEF,0x36A5,0x8508,0xD494,0xFFFF,0x5063,0xA608,0xB394,0xFFFF,0xDFFF,
-  0x6B4A,0x0A3A,0xF07B,0xAB5A,0x4300,0x6500,0x8508,0x4300,0xA608,0x2A19,0xAD4A,0x337C,
-  0x2B3A,0xEA31,0xD8BD,0xFFFF,0xDFF7,0xFFFF,0xFFFF,0x36A5,0xCD52,0x56A5,0xFFFF,0xDFF7,
-  0xFFFF,0xFFFF,0xFBDE,0x2E5B,0x6F6B,0xFFFF,0x7284,0x34A5,0x7DF7,0xFFFF,0x97A5,0xC808,
-  0x2A19,0x8C21,0xC710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x8408,0x6B19,0x4A19,0x6B19,0xC908,0x6829,0xAD83,0xF39C,
-  0xD38C,0x517C,0x317C,0x9284,0x1495,0x55A5,0x928C,0x3184,0x8F6B,0x4921,0xA708,0xF073,
-  0xDFFF,0x7EEF,0xDFFF,0xF07B,0x2300,0x359D,0xFFFF,0x938C,0xA608,0x4C42,0x728C,0xCC5A,
-  0xA610,0x4919,0xA510,0x0100,0xA708,0x4A19,0x0A11,0x4A19,0xA808,0x8A21,0x76A5,0x7EEF,
-  0x4F63,0x7284,0xFFFF,0x19CE,0xA831,0xCC62,0x7DEF,0xBEEF,0x117C,0x159D,0xFFFF,0x58CE,
-  0x518C,0xFCDE,0x9EF7,0x4F63,0x4F63,0xFFFF,0x159D,0xE939,0x9394,0x18BE,0xED5A,0xE810,
-  0x4A19,0x6B21,0xC710,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0xC610,0x4B19,0x6B19,0x4A19,0x2911,0x0932,0x517C,
-  0x149D,0x928C,0x7284,0xD38C,0xD394,0x317C,0x0D5B,0x6F6B,0xAF73,0x2B3A,0x8700,0xEA31,
-  0x1CE7,0xFFFF,0x7DEF,0x8C4A,0x8608,0xF073,0x7294,0x2A42,0x2919,0x6A19,0xC510,0x0200,
-  0x0619,0x8700,0x2819,0x117C,0xD594,0xCB29,0x4A19,0xCC29,0xE910,0x8A21,0xB6B5,0xFFFF,
-  0xF07B,0xF8B5,0xFFFF,0x3284,0x0000,0x2408,0xBBD6,0xFFFF,0x117C,0xF49C,0xFFFF,0xF073,
-  0x4208,0x79CE,0xFFFF,0xF173,0x2B42,0xB5B5,0x4E6B,0xC710,0x4821,0x6629,0x8408,0x2919,
-  0x4A19,0x6B21,0x0811,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2200,0x4919,0x4B19,0x4A19,0x0911,0xC610,0xA731,
-  0x8E6B,0x9284,0x928C,0x117C,0x8F63,0xCC52,0x8B42,0xED52,0xED5A,0x4B42,0x2911,0x2A19,
-  0x938C,0xF8BD,0xF07B,0x4821,0xE910,0xE710,0x0200,0x0300,0xC808,0xA808,0xE710,0x6F63,
-  0x159D,0x0B32,0x8C42,0x7DE7,0x7DEF,0xEA31,0xE808,0x6B21,0x2A19,0x6921,0xD494,0xBEF7,
-  0x3184,0x18BE,0xFFFF,0x369D,0x4621,0xAD42,0x9EF7,0x5DEF,0xAC4A,0x938C,0xFFFF,0xB073,
-  0x4400,0x117C,0x34A5,0x4B42,0x0819,0x6729,0xA510,0x2919,0xA708,0x2400,0xE810,0x6B21,
-  0x6B19,0x6B21,0xE810,0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xC510,0x4B19,0x4B19,0x4B19,0x0911,0x8600,
-  0x2721,0xED5A,0x4E63,0x8C4A,0x2A3A,0x2A3A,0x8C4A,0x8C4A,0x4A42,0xEA39,0x6A21,0xE910,
-  0x2719,0xC510,0x2300,0x6500,0x2919,0x8A21,0xAD4A,0x906B,0xEE52,0xC808,0x0C3A,0x3CE7,
-  0xFFFF,0x76AD,0x2E5B,0x39C6,0x5DE7,0x4B42,0xE810,0x8B21,0xC908,0xA608,0x7284,0xFFFF,
-  0x7284,0x7284,0xBEF7,0x9EF7,0x76A5,0xBACE,0xDFFF,0x7194,0x2621,0x4F63,0x95AD,0xAC52,
-  0x6B19,0x0811,0x4300,0x8508,0x0911,0x6700,0xE810,0x6A19,0xAC21,0xAC29,0x8B21,0x2919,
-  0x0811,0xE710,0x6408,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B19,0x4A19,0x4B19,0x6B19,
-  0xC708,0x4821,0xEA39,0xC931,0xC931,0x0A3A,0xEA31,0xC931,0xC931,0x6829,0xE818,0xE810,
-  0x8708,0xE618,0x6921,0x2919,0xCE52,0xBACE,0xFFFF,0xFFFF,0xDEF7,0x9063,0x6921,0x7ACE,
-  0xFFFF,0xFFFF,0xB6AD,0x79CE,0x7DEF,0xAC4A,0xE810,0x2A19,0x0911,0x6921,0xD49C,0xFFFF,
-  0xB494,0xA929,0xD494,0xBEF7,0xDFFF,0x9EF7,0xF49C,0x0521,0xA708,0x0819,0x2100,0x4300,
-  0x4A19,0x0911,0x0911,0x4B19,0x8B21,0xAB21,0x6B21,0x2A19,0x0819,0xC710,0x8408,0x4200,
-  0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x4A19,0x4A19,0x4A19,
-  0x4A19,0x2919,0x4921,0xAA29,0xA931,0x8929,0x0811,0xE710,0x2919,0x4921,0x2B3A,0x8F6B,
-  0xF494,0x7DEF,0xB8B5,0x5284,0xDBD6,0xFFFF,0x34A5,0xB7B5,0xFFFF,0x19C6,0x2E5B,0xB7B5,
-  0xDFFF,0xFFFF,0x9EEF,0xDFFF,0x3CE7,0x0D5B,0xC808,0x0911,0x738C,0x3CE7,0xDFFF,0xFFFF,
-  0x6F63,0x6600,0xC610,0x6A52,0xAB5A,0x0729,0x4208,0xA608,0x4A19,0x2919,0xE810,0x4B19,
-  0x6B19,0x6B21,0x6B21,0x4A19,0x0819,0xC710,0xA508,0x4208,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0919,0x6B19,0x4A19,
-  0x4A19,0xC808,0x4700,0x4600,0x8708,0x4919,0xAC4A,0xAF6B,0x6921,0x5063,0x5DEF,0x9DEF,
-  0xDEF7,0xBEF7,0xD394,0x96AD,0xFFFF,0x55A5,0x0321,0xA831,0xBBD6,0x5CE7,0x517C,0x55A5,
-  0xBEF7,0x359D,0x9AD6,0xFFFF,0x5DEF,0x127C,0xC808,0x0811,0xF083,0x79D6,0x18BE,0x6D73,
-  0xE518,0xE810,0xE910,0x8508,0x4300,0x2400,0xC708,0x4B19,0x6B21,0x6B19,0x6B21,0x4A19,
-  0x0811,0xC610,0x8408,0x4200,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x4A19,0x6B19,0x4A19,
-  0x4A19,0xAA29,0x8D4A,0x9484,0x337C,0x2C3A,0x39C6,0x3CE7,0xEE5A,0x6C42,0x38C6,0x1CE7,
-  0xFFFF,0x1184,0x4621,0x15A5,0xDFFF,0xF07B,0x0000,0x6400,0x5ACE,0x5CE7,0x1074,0x149D,
-  0xFFFF,0x4E63,0x6F6B,0x3CE7,0x1CDF,0x4F63,0xE810,0x2919,0x6929,0x8731,0x4529,0x6310,
-  0xA608,0x6B19,0x8C21,0x2A19,0x2A19,0x6B19,0x8C21,0x2A19,0xE810,0xC610,0x8408,0x4308,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA508,0x6B21,0x2A19,0x0911,
-  0x8C4A,0x149D,0xBAD6,0xFFF7,0xD7B5,0x2A42,0x3DE7,0xFFFF,0xF273,0x6508,0xC831,0xB394,
-  0xFFFF,0x4E6B,0x0300,0x748C,0xFFFF,0x39C6,0xCE52,0x5284,0xFFFF,0x39C6,0xE939,0x928C,
-  0xFBE6,0xAD5A,0x0719,0x4E63,0x2D63,0x4721,0x0911,0x4A19,0xC908,0x2500,0x4400,0x0811,
-  0x8C21,0x6B19,0x4A19,0x6A21,0x4921,0x0811,0x8508,0x6308,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8408,0x6A21,0x2A19,0xC808,
-  0x8F6B,0xBEF7,0xDFFF,0x38C6,0x8F6B,0x8829,0x18BE,0xFFF7,0xB16B,0x0300,0x8408,0x3184,
-  0xFFFF,0x55A5,0xE810,0xEF52,0x5DE7,0xFFFF,0xBDEF,0xFFFF,0x1CE7,0x6F73,0x6410,0xED52,
-  0xEC62,0x8831,0xC810,0x4400,0x0200,0xA708,0x6B19,0x6B19,0x8B21,0xCC29,0xAC29,0x8B21,
-  0x0819,0xC710,0xA510,0x6308,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6408,0x4A19,0x4A19,0xE810,
-  0xED52,0x5DEF,0xDBD6,0x96A5,0x928C,0x0A3A,0xF7B5,0xFFFF,0x1284,0x6608,0xAA29,0x5284,
-  0xFFFF,0x96AD,0x2819,0x8608,0x4E63,0xF8BD,0xDBCE,0xB6AD,0x4A4A,0x8508,0x0811,0xE810,
-  0x0200,0xA608,0x4B19,0x8C21,0x8B21,0x8B21,0x6B19,0x4A19,0x0919,0xC710,0x8508,0x6308,
-  0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x4919,0x4B19,0xE810,
-  0xCD52,0x1CE7,0xFFFF,0xBEF7,0x76A5,0xC931,0x559D,0xDFFF,0x1CDF,0x7AC6,0x76AD,0xF073,
-  0xFFFF,0x35A5,0x6921,0xA808,0xE710,0xA410,0xC410,0x6208,0x4300,0xE810,0x6B19,0x4A19,
-  0x6B21,0x6B21,0x6B19,0x4B19,0x2919,0xE710,0x8508,0x4308,0x2100,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x0819,0x4B19,0xE810,
-  0x2B3A,0xDBDE,0x9DF7,0x39C6,0x76A5,0xF17B,0x76AD,0xFFFF,0xFFFF,0xFBDE,0x7294,0xA939,
-  0x2B52,0x4629,0x0811,0x4B19,0x0911,0xA708,0xA608,0xE810,0x2A19,0x6B21,0x6B21,0x4A19,
-  0x2919,0xE818,0xA508,0x6300,0x2100,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0819,0x4B19,0xE810,
-  0xEA31,0x5DE7,0xFFFF,0xBEEF,0xBBCE,0x938C,0x4E63,0xF07B,0x2D63,0xC739,0x0521,0xA610,
-  0x0400,0x6500,0x2919,0x8C21,0x8C21,0xAD21,0x8C21,0x8B21,0x2919,0xC710,0xA508,0x6408,
-  0x4200,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x0819,0x6B19,0x0911,
-  0xAB29,0x76AD,0xB7BD,0xD39C,0xAE73,0xE831,0xE618,0x6500,0x0300,0x0200,0x8608,0x4A19,
-  0x6B19,0x8C21,0x6B19,0x2A19,0x0919,0xC710,0xA508,0x6308,0x4200,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xE710,0x6B19,0x2A19,
-  0x4B19,0xC931,0xC518,0x0100,0x0000,0x4400,0x0911,0x2919,0x6B21,0xCD29,0xAC29,0x4A19,
-  0x4A19,0x0819,0xC610,0x8508,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x4100,0x4100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2100,0xC610,0x6B19,0x4A19,
-  0x2A19,0xA608,0xA708,0x4A19,0x8B21,0x8C21,0x6B21,0x6B21,0x4A19,0x0811,0xC610,0x8408,
-  0x4200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x2000,0xA410,0xA410,0x2000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA610,0x6C21,0x4A19,
-  0x4B19,0x6B21,0x6B21,0x6B19,0x4A19,0xE810,0xC610,0x8408,0x4200,0x2100,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x2919,0x4B19,
-  0x2919,0x0819,0xC610,0x8408,0x4200,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4200,0x8408,
-  0x6208,0x2100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// Delta 2: 86x82 at (16, 22), 3500 bytes
+static const uint8_t spaceman_delta_2_rle[3500] PROGMEM = {
+  0xE5,0x80,0x00,0x00,0x10,0x80,0x00,0x00,0x10,0x80,0x00,0xE7,0xE0,0x00,0x00,0x81,
+  0x01,0xF0,0xDE,0x00,0x10,0xD6,0x00,0x10,0xDD,0xDA,0x01,0x01,0xF8,0xD9,0x00,0x10,
+  0xCC,0x04,0x26,0x26,0x20,0xE8,0xD7,0x00,0x10,0xC8,0x00,0x20,0x82,0x06,0x80,0x07,
+  0x00,0x60,0xC4,0x00,0x70,0x81,0x06,0x00,0x20,0xE1,0xD5,0x00,0x10,0xC9,0x00,0x60,
+  0xD4,0x00,0x60,0xC7,0x00,0x10,0xD4,0xDD,0x00,0x60,0xC6,0x80,0x07,0x03,0x67,0x67,
+  0x80,0x06,0x01,0x76,0xC6,0x00,0x60,0xC8,0x00,0x20,0xD3,0xD9,0x00,0x20,0x80,0x06,
+  0xCB,0x81,0x06,0x00,0x70,0xC5,0x00,0x70,0xE1,0xD0,0x00,0x00,0x85,0x02,0xC9,0x02,
+  0x7A,0xE0,0xC9,0x80,0x0A,0x00,0x60,0xE2,0xD0,0x81,0x02,0xC3,0x00,0x60,0xC7,0x00,
+  0xA0,0xDB,0x00,0x60,0xD6,0xCE,0x01,0x02,0xC4,0x00,0x60,0xC6,0x00,0xA0,0xC5,0x80,
+  0x0D,0xC7,0x00,0xD0,0xC7,0x00,0x60,0xDC,0xCD,0x00,0x00,0xC5,0x00,0x60,0x82,0x07,
+  0x80,0x06,0x00,0xA0,0xC3,0x00,0xB0,0xD1,0x00,0xD0,0xC3,0x00,0xB0,0xC5,0x00,0x70,
+  0xD4,0xCC,0x00,0x00,0x80,0x02,0x00,0x40,0x80,0x02,0x00,0x40,0xD3,0x82,0x0D,0xCE,
+  0x00,0xB0,0xD9,0xCB,0x00,0x00,0xC4,0x00,0x40,0xC4,0x00,0x60,0xCC,0x05,0xD7,0x68,
+  0x76,0x81,0x05,0x01,0x76,0x80,0x0D,0x00,0xC0,0xC8,0x00,0xA0,0xC4,0x00,0x60,0xD1,
+  0xCA,0x03,0x01,0x24,0x80,0x02,0x00,0x40,0x82,0x07,0x80,0x06,0x81,0x0B,0x00,0xD0,
+  0xC8,0x02,0x76,0xA0,0x83,0x08,0x80,0x05,0x01,0x9A,0x81,0x07,0x80,0x0D,0xDF,0xCA,
+  0x05,0x14,0x24,0x24,0x82,0x07,0x01,0x6A,0xC7,0x00,0xE0,0x80,0x07,0x82,0x06,0x00,
+  0x90,0x81,0x08,0x81,0x0A,0x01,0x85,0x81,0x08,0x80,0x06,0x81,0x07,0x00,0xD0,0xC3,
+  0x00,0xD0,0xC7,0x00,0x40,0xCF,0xC9,0x00,0x10,0x80,0x04,0x80,0x02,0x00,0x30,0x82,
+  0x07,0x01,0x6A,0x81,0x0B,0x82,0x0C,0x00,0xE0,0xC5,0x04,0x3A,0x58,0xA0,0xC3,0x03,
+  0x95,0x8A,0x81,0x08,0x00,0xA0,0x80,0x06,0xDE,0xC8,0x01,0x03,0x80,0x02,0x01,0x32,
+  0x82,0x07,0x01,0x6A,0x80,0x0B,0x00,0xD0,0x81,0x0C,0x00,0xD0,0x80,0x07,0x01,0x64,
+  0x80,0x01,0x02,0x25,0xA0,0x81,0x08,0x03,0xBD,0xBD,0x80,0x0A,0x01,0x85,0x81,0x08,
+  0x03,0x59,0x85,0x80,0x06,0xDC,0xCA,0x03,0x43,0x25,0xC3,0x00,0xA0,0xC4,0x02,0xCE,
+  0x70,0x80,0x06,0x00,0x10,0x81,0x02,0x01,0x68,0x81,0x05,0x00,0x80,0x80,0x0A,0x03,
+  0x9A,0x89,0x80,0x08,0x80,0x0A,0x80,0x08,0x05,0x5A,0x81,0x47,0xC7,0x00,0xB0,0x80,
+  0x06,0x81,0x07,0xC4,0x00,0x10,0xC7,0xC8,0x03,0x34,0x23,0xC4,0x00,0xA0,0x80,0x0B,
+  0x00,0xD0,0x81,0x0C,0x80,0x07,0x02,0x64,0x10,0x81,0x02,0x01,0x48,0x80,0x05,0x01,
+  0x35,0x80,0x08,0x01,0x58,0x80,0x05,0x01,0x85,0x80,0x08,0x01,0xB9,0x82,0x08,0x01,
+  0x51,0xC9,0x00,0xB0,0xC3,0x00,0x60,0xCC,0xC7,0x03,0x32,0x42,0xC4,0x00,0x90,0x81,
+  0x0B,0x81,0x0C,0x03,0x7E,0x62,0xC4,0x06,0x65,0x35,0xBE,0xB0,0x80,0x0A,0x80,0x08,
+  0xC3,0x80,0x08,0x00,0xA0,0x81,0x08,0x01,0xA5,0x80,0x02,0x03,0x14,0x7E,0xC5,0x00,
+  0xA0,0xD0,0xC7,0x04,0x23,0x23,0x50,0x81,0x07,0x00,0x60,0x81,0x0B,0x81,0x0C,0x03,
+  0xE7,0x62,0xC5,0x00,0x80,0x80,0x05,0x01,0xAE,0xC3,0x84,0x0B,0x01,0xA9,0x83,0x08,
+  0x01,0x54,0x80,0x02,0x01,0x15,0xC7,0x01,0x96,0x81,0x07,0xC3,0x00,0x10,0xC6,0xC5,
+  0x01,0x03,0x81,0x04,0x00,0x30,0xC3,0x00,0xA0,0xC3,0x02,0xCE,0x70,0xC7,0x04,0x48,
+  0x58,0xB0,0x80,0x0E,0xCA,0x02,0xA8,0x50,0x81,0x08,0x00,0x50,0x82,0x02,0x00,0x40,
+  0x80,0x07,0x00,0xD0,0xC5,0x00,0x60,0x80,0x07,0x00,0x10,0x80,0x02,0x00,0x40,0xC7,
+  0xC6,0x04,0x32,0x84,0x50,0x80,0x07,0x80,0x06,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x00,
+  0xD0,0xC9,0x04,0x48,0x5A,0xE0,0xCC,0x01,0xBA,0x80,0x08,0x00,0xB0,0x80,0x05,0x00,
+  0x20,0xC5,0x00,0xE0,0xC4,0x01,0xA6,0x81,0x07,0x80,0x02,0x00,0x40,0xC7,0xC4,0x04,
+  0x01,0x42,0x30,0xC6,0x00,0xB0,0x81,0x0C,0xC9,0x01,0x26,0x80,0x05,0x01,0xAE,0xCC,
+  0x02,0xAB,0xA0,0x80,0x05,0x02,0x85,0x30,0x83,0x02,0x02,0x67,0x60,0x81,0x0C,0xC5,
+  0x00,0x50,0x81,0x02,0x00,0x30,0xC5,0xC3,0x05,0x01,0x32,0x32,0xC3,0x00,0x60,0xC3,
+  0x04,0xC7,0xD6,0x10,0x82,0x02,0xC3,0x03,0x53,0xAB,0x84,0x0E,0xC7,0x05,0xB7,0xA5,
+  0x85,0x80,0x03,0x00,0x20,0xC4,0x00,0x60,0xC5,0x00,0xB0,0xC3,0x04,0x32,0x42,0x10,
+  0xC4,0xC2,0x80,0x00,0x00,0x10,0x80,0x04,0x01,0x23,0xC5,0x00,0xB0,0x80,0x0C,0x00,
+  0xD0,0xC4,0x01,0x24,0x80,0x02,0x00,0x60,0x80,0x02,0x00,0x30,0x80,0x05,0x00,0xA0,
+  0x81,0x0E,0x02,0xBE,0xB0,0xC7,0x00,0xB0,0x80,0x0A,0x80,0x05,0x03,0x35,0x32,0xC4,
+  0x00,0x50,0xC3,0x00,0xC0,0xC5,0x02,0x52,0x40,0xC6,0xC2,0x00,0x00,0x80,0x01,0x03,
+  0x43,0x25,0x80,0x07,0x80,0x06,0xC3,0x03,0xC7,0x64,0xC5,0x00,0x20,0xC3,0x01,0x58,
+  0x82,0x0E,0x00,0xF0,0x80,0x0E,0xC4,0x00,0xF0,0x81,0x0E,0x01,0x7B,0x81,0x05,0x02,
+  0x31,0x20,0xC4,0x00,0x20,0xC6,0x00,0xA0,0xC3,0x03,0x12,0x41,0xC4,0xC2,0x02,0x13,
+  0x40,0x80,0x02,0x01,0x15,0xC4,0x00,0xB0,0x80,0x0C,0x05,0xDE,0x64,0x24,0x80,0x02,
+  0x00,0x40,0x83,0x02,0x02,0x35,0xA0,0x80,0x0D,0x81,0x09,0x00,0xD0,0x80,0x0E,0xC3,
+  0x80,0x0D,0x01,0xED,0xC4,0x00,0x30,0x80,0x02,0xC7,0x00,0x70,0x81,0x0C,0xC4,0x01,
+  0x71,0xC7,0xC2,0x01,0x32,0x80,0x03,0x01,0x24,0x81,0x07,0x00,0x60,0xC3,0x00,0xC0,
+  0x80,0x07,0x00,0x60,0x86,0x02,0x00,0x60,0x80,0x02,0x03,0x35,0xAD,0x80,0x0A,0x81,
+  0x05,0x01,0x9D,0x80,0x0E,0x01,0xDA,0x82,0x09,0x03,0xFD,0x9A,0x80,0x05,0x01,0x32,
+  0xC5,0x02,0x26,0x70,0xC4,0x00,0x90,0xCB,0xC1,0x02,0x13,0x40,0x80,0x02,0x01,0x3A,
+  0x80,0x07,0x01,0x6A,0xC3,0x02,0xDE,0x60,0x82,0x02,0x02,0x42,0x40,0x83,0x02,0x04,
+  0x35,0x87,0xA0,0x80,0x0B,0x00,0x70,0x80,0x05,0x04,0x9D,0x9A,0xB0,0xC3,0x02,0x9D,
+  0x80,0x81,0x05,0x00,0x10,0x81,0x02,0x00,0x60,0xCA,0x00,0xB0,0xC3,0x03,0x32,0x41,
+  0xC3,0xC1,0x02,0x12,0x40,0x80,0x03,0x07,0x8A,0xB7,0x6A,0xBE,0x80,0x0C,0x01,0xD7,
+  0xC4,0x81,0x02,0x00,0x40,0x81,0x02,0x04,0x41,0x5A,0x80,0x80,0x0A,0x80,0x0B,0x04,
+  0x75,0x8B,0x80,0x82,0x0A,0x80,0x05,0x00,0x80,0x81,0x0A,0x01,0x53,0xC6,0x80,0x02,
+  0x00,0x40,0x80,0x07,0x81,0x0C,0xC4,0x01,0x78,0xC6,0xC1,0x04,0x13,0x41,0x40,0x80,
+  0x0A,0x05,0x7A,0x6A,0xBD,0x80,0x0C,0x00,0x70,0xC7,0x80,0x02,0x00,0x60,0x80,0x02,
+  0x80,0x06,0x00,0x50,0x80,0x0A,0x01,0x57,0x80,0x0B,0x81,0x0A,0x03,0xEA,0x57,0x80,
+  0x0B,0x02,0x7A,0x80,0x80,0x0A,0x80,0x05,0x00,0x10,0x85,0x02,0x00,0x60,0xC8,0x01,
+  0x96,0x80,0x07,0x80,0x03,0x01,0x23,0xC3,0xC1,0x01,0x14,0x80,0x02,0x07,0x3A,0xB7,
+  0xAD,0xAB,0x81,0x0C,0x06,0x76,0x42,0x42,0x40,0x80,0x02,0x02,0x42,0x60,0x80,0x04,
+  0x01,0x9C,0x80,0x08,0x04,0xBA,0x57,0xA0,0xC3,0x00,0xA0,0x81,0x05,0x02,0xAB,0x70,
+  0x80,0x0A,0x05,0x5A,0x50,0x14,0x80,0x02,0x00,0x60,0xC3,0x80,0x06,0x01,0xE6,0xC3,
+  0x01,0x96,0x80,0x07,0x02,0x13,0x40,0xC4,0xC1,0x07,0x13,0x41,0x37,0xAB,0x81,0x0A,
+  0x00,0xB0,0x80,0x0C,0x00,0xE0,0xC4,0x02,0x24,0x20,0x80,0x06,0x06,0x9C,0x9C,0x9F,
+  0x90,0x80,0x0A,0x02,0xEB,0xA0,0xC4,0x04,0xB7,0x5A,0x70,0x83,0x0A,0x80,0x05,0x03,
+  0x48,0x96,0xC8,0x00,0xE0,0xC3,0x01,0xA6,0x80,0x07,0x01,0x51,0x80,0x02,0xC3,0xC2,
+  0x0F,0x34,0x23,0x5B,0x7D,0xAB,0xED,0xCD,0x76,0x80,0x02,0x03,0x42,0x36,0x80,0x0D,
+  0x00,0xC0,0x82,0x0D,0x02,0x9C,0xA0,0x81,0x0E,0x02,0xBA,0xB0,0xC3,0x83,0x0A,0x01,
+  0xB7,0xC3,0x81,0x0D,0x01,0xC6,0xC4,0x01,0x24,0xC3,0x00,0xD0,0x80,0x0B,0x00,0x60,
+  0x80,0x07,0x04,0x52,0x43,0x10,0xC2,0xC2,0x01,0x32,0x80,0x03,0x00,0x50,0x80,0x0E,
+  0x06,0x7E,0xBE,0xDC,0xE0,0x80,0x06,0x05,0x24,0x23,0x6C,0x80,0x0D,0x00,0x90,0x81,
+  0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x80,0x0E,0x01,0xA7,0xC6,0x00,0xB0,0xC4,0x81,
+  0x05,0x04,0x8D,0xFD,0xC0,0x80,0x0D,0x00,0x60,0x80,0x02,0x00,0x60,0x80,0x02,0x00,
+  0x60,0xC4,0x00,0xB0,0xC6,0x01,0x31,0xC1,0xC2,0x06,0x34,0x21,0x5E,0x70,0x80,0x0A,
+  0x80,0x0B,0x01,0xCD,0x80,0x07,0x80,0x02,0x02,0x39,0xD0,0xC3,0x82,0x0F,0x81,0x0D,
+  0x02,0x9A,0xE0,0x82,0x0A,0x01,0xE7,0x84,0x0A,0x00,0xE0,0x80,0x0A,0x81,0x05,0x84,
+  0x0D,0x03,0xFD,0xC6,0xC3,0x01,0xED,0x80,0x0C,0x80,0x0B,0xC3,0x05,0x32,0x32,0x43,
+  0xC0,0xC3,0x80,0x04,0x01,0x25,0x80,0x0E,0x03,0xAE,0xBE,0x80,0x0D,0x00,0xE0,0x80,
+  0x06,0x03,0x26,0xDF,0x80,0x0D,0x80,0x0F,0x00,0xC0,0xC3,0x03,0xFD,0x9A,0x80,0x0E,
+  0x05,0xA9,0xDE,0xDE,0xC3,0x06,0xEA,0xB7,0x53,0x80,0x80,0x09,0x81,0x0D,0x00,0xC0,
+  0x80,0x0D,0x02,0xFD,0x90,0x80,0x02,0x80,0x07,0x00,0xD0,0x80,0x0C,0xC5,0x81,0x03,
+  0x03,0x24,0x23,0xC3,0x03,0x42,0x13,0x81,0x0E,0x02,0xAB,0xA0,0x80,0x0D,0x05,0xE7,
+  0x21,0x9A,0x80,0x0D,0x00,0xF0,0x82,0x0D,0x81,0x0F,0x00,0xD0,0xC4,0x01,0xBE,0x80,
+  0x0D,0xC3,0x80,0x0E,0x01,0xA7,0x80,0x0A,0x81,0x05,0x01,0x8C,0x84,0x0D,0x80,0x0F,
+  0x05,0xD4,0x26,0x7D,0x80,0x0C,0x80,0x0B,0x00,0x60,0x81,0x07,0x80,0x0A,0x01,0x51,
+  0x80,0x04,0x00,0x30,0xC4,0x04,0x42,0x1A,0xE0,0x80,0x0A,0x80,0x0E,0x80,0x0D,0x06,
+  0x76,0x45,0xEA,0x90,0x83,0x0D,0x82,0x0F,0xC7,0x00,0xE0,0x80,0x0A,0x01,0xDA,0x80,
+  0x0E,0x00,0xB0,0x83,0x0A,0x04,0x8C,0xEF,0xC0,0xC3,0x00,0xD0,0x80,0x0F,0x80,0x0D,
+  0x01,0x47,0xC8,0x00,0xB0,0x80,0x0E,0x04,0x53,0x23,0x20,0xC2,0x07,0x13,0x43,0x17,
+  0xEB,0x81,0x0E,0x00,0xF0,0x80,0x0E,0x04,0x76,0xAE,0xA0,0x82,0x0D,0x82,0x0F,0x04,
+  0xCD,0xFD,0xF0,0xC7,0x00,0xB0,0x81,0x0E,0x84,0x0A,0x00,0xD0,0x81,0x0F,0x04,0xDE,
+  0xFD,0xC0,0x80,0x0D,0x08,0xFD,0xC9,0x67,0xDC,0xE0,0x80,0x0B,0x00,0x60,0x81,0x0A,
+  0x06,0xEA,0x53,0x24,0x10,0xC2,0x01,0x02,0xC3,0x00,0xB0,0xC6,0x04,0x7A,0xEA,0x90,
+  0x80,0x0D,0x01,0xFD,0x82,0x0F,0x02,0xDC,0xF0,0x82,0x0D,0x01,0x9A,0x81,0x0E,0xC4,
+  0x81,0x0A,0x00,0x50,0x80,0x0A,0x02,0xDF,0xD0,0x81,0x0F,0xC3,0x81,0x0D,0x02,0x96,
+  0x70,0x81,0x0D,0x81,0x0B,0x83,0x0A,0x00,0x50,0x80,0x01,0x00,0x40,0x80,0x03,0xC3,
+  0x05,0x14,0x31,0x5A,0xC6,0x81,0x0E,0x00,0xA0,0x82,0x0D,0x01,0xFD,0x80,0x0F,0x03,
+  0xCF,0xDF,0xC4,0x80,0x0A,0x80,0x0E,0x03,0xAB,0xEB,0x80,0x0A,0x07,0x78,0xB7,0xED,
+  0xFD,0x81,0x0F,0x00,0xC0,0x81,0x0D,0x00,0xC0,0x82,0x0D,0x05,0xE7,0xDC,0xEB,0x80,
+  0x0A,0x80,0x0E,0x07,0x75,0x03,0x43,0x20,0xC3,0x00,0x30,0x80,0x04,0x02,0x21,0xA0,
+  0x87,0x0E,0x80,0x0A,0x80,0x09,0x00,0xC0,0x81,0x0D,0x01,0xFC,0x80,0x0D,0xC3,0x00,
+  0xC0,0x80,0x0D,0x02,0x5A,0xB0,0x81,0x0A,0x00,0xE0,0xC4,0x81,0x0A,0x00,0xD0,0x80,
+  0x0F,0x00,0xD0,0xC5,0x82,0x0D,0x81,0x0E,0x80,0x0C,0x02,0xEB,0xA0,0x80,0x0E,0x08,
+  0xA5,0x13,0x24,0x21,0x00,0xC4,0x01,0x32,0x80,0x03,0x00,0xA0,0x87,0x0E,0x00,0x70,
+  0x80,0x0D,0x01,0xC9,0x80,0x0D,0x04,0xCD,0xFD,0xF0,0x84,0x0D,0x81,0x0A,0x00,0x50,
+  0x80,0x0A,0xC3,0x01,0x5B,0x81,0x0A,0x01,0xDF,0x80,0x0D,0x02,0xFC,0xD0,0xC5,0x01,
+  0xCA,0x80,0x0E,0x02,0x6C,0xD0,0x80,0x0A,0x80,0x0E,0x01,0xA5,0x80,0x01,0x80,0x04,
+  0x02,0x31,0x00,0xC0,0xC4,0x05,0x34,0x23,0x5B,0x84,0x0E,0x02,0xB7,0xA0,0x81,0x0D,
+  0x80,0x09,0x80,0x0D,0x00,0x90,0x82,0x0D,0x04,0xCD,0xCD,0x90,0x82,0x0A,0x05,0x5A,
+  0x8A,0x87,0x81,0x0A,0x06,0x7B,0xDF,0xCF,0xD0,0x80,0x0F,0x04,0xDF,0xCD,0xF0,0x80,
+  0x09,0x82,0x0E,0x08,0xDE,0x7A,0xEB,0x71,0x30,0x80,0x04,0x01,0x21,0x80,0x00,0xC0,
+  0xC3,0x0B,0x02,0x43,0x15,0x7E,0xBE,0xBE,0x80,0x0A,0x02,0xED,0x90,0x81,0x0D,0x81,
+  0x09,0x00,0xC0,0x80,0x0D,0x00,0xC0,0x81,0x0D,0x80,0x09,0x00,0x80,0xCD,0x02,0xDF,
+  0xD0,0xC3,0x00,0xF0,0x82,0x0D,0x02,0xCA,0xB0,0x83,0x0E,0x80,0x0A,0x08,0xBA,0x70,
+  0x13,0x42,0x10,0x81,0x00,0xC0,0xC3,0x0E,0x03,0x42,0x35,0x7A,0x7A,0x7A,0xEF,0xD0,
+  0x81,0x09,0x00,0xC0,0x83,0x09,0x00,0xC0,0x80,0x09,0x80,0x0D,0x01,0x9C,0x80,0x08,
+  0x01,0xA5,0x80,0x0A,0xC4,0x80,0x0A,0x00,0x70,0x80,0x0A,0x01,0xDF,0x81,0x0D,0x07,
+  0xCD,0xFD,0xFC,0xDA,0x84,0x0E,0x01,0xA7,0x80,0x0A,0x00,0x50,0x80,0x01,0x80,0x04,
+  0x00,0x30,0x81,0x00,0xC2,0xC3,0x01,0x01,0xC3,0x00,0x80,0x81,0x0A,0x83,0x0D,0x80,
+  0x08,0x0B,0x98,0x9C,0x89,0x49,0x89,0xCD,0x80,0x09,0x80,0x08,0xC5,0x0A,0x75,0xA5,
+  0xA5,0x9D,0xFD,0xC0,0x82,0x0D,0x00,0xC0,0x81,0x0D,0x02,0x9B,0xE0,0xC3,0x00,0xB0,
+  0x80,0x0A,0x02,0xB7,0x00,0x80,0x03,0x02,0x42,0x10,0x81,0x00,0xC2,0xC4,0x00,0x10,
+  0xC4,0x00,0xA0,0xC5,0x01,0xC8,0x81,0x04,0x01,0x84,0x80,0x09,0x00,0xC0,0x82,0x08,
+  0x80,0x09,0x04,0x48,0x57,0x50,0x80,0x0A,0x80,0x05,0x05,0xA5,0xA7,0x5A,0xC5,0x00,
+  0xD0,0xC3,0x00,0xD0,0xC5,0x0A,0xBE,0x7B,0x7A,0x03,0x24,0x20,0x81,0x00,0xC4,0xC5,
+  0x80,0x03,0x04,0x23,0x8C,0xD0,0x80,0x09,0x01,0xD9,0x80,0x0D,0x00,0x90,0x80,0x04,
+  0x00,0x80,0x88,0x04,0x02,0x84,0x80,0xC5,0x00,0xA0,0x82,0x05,0x00,0x90,0x85,0x0D,
+  0x06,0xCD,0xCD,0xCD,0x90,0x81,0x0E,0x08,0xBE,0x7B,0x7A,0x50,0x10,0x80,0x04,0x00,
+  0x20,0x81,0x00,0xC5,0xC3,0x0B,0x01,0x32,0x41,0x39,0xD9,0xC9,0x80,0x0D,0x04,0xF8,
+  0x23,0x90,0x80,0x0C,0x05,0x34,0x89,0x48,0x83,0x04,0x01,0x53,0xC6,0x01,0x58,0x80,
+  0x09,0x02,0xC9,0xC0,0x81,0x09,0x00,0x80,0x84,0x09,0x02,0xBA,0xE0,0x80,0x0A,0x03,
+  0xB7,0xA5,0x80,0x01,0x80,0x04,0x01,0x31,0x80,0x00,0xC6,0xC2,0x81,0x00,0x1A,0x14,
+  0x23,0x14,0x9D,0x9D,0xCD,0xC8,0x41,0xCF,0xE1,0xDF,0xC9,0xC8,0x90,0x80,0x04,0x82,
+  0x03,0x01,0x53,0x83,0x05,0x86,0x08,0x02,0x49,0x40,0x80,0x09,0x01,0xC9,0x81,0x0A,
+  0x0A,0xB7,0xB7,0xA3,0x13,0x42,0x30,0x81,0x00,0xC7,0xC2,0x81,0x00,0x03,0x14,0x32,
+  0x80,0x03,0x00,0x80,0x82,0x09,0x80,0x08,0x06,0xC4,0x19,0xFD,0x40,0x80,0x0F,0x03,
+  0x9D,0xFC,0x80,0x0F,0x01,0x43,0x80,0x0D,0x80,0x03,0xC3,0x80,0x03,0x01,0x43,0x82,
+  0x04,0x08,0x84,0x98,0xC8,0x49,0xC0,0x83,0x0A,0x09,0xEA,0x51,0x24,0x23,0x10,0xC9,
+  0xC2,0x81,0x00,0x03,0x13,0x24,0x80,0x03,0x84,0x04,0x04,0x98,0x21,0xD0,0x80,0x0F,
+  0x03,0xDF,0x94,0x80,0x0F,0x00,0x40,0x80,0x0F,0x01,0x49,0x80,0x0F,0x80,0x03,0x03,
+  0xDF,0x91,0xC3,0x00,0x30,0x80,0x04,0x00,0x80,0x83,0x04,0x04,0x84,0x8D,0xF0,0x81,
+  0x0A,0x03,0x7A,0xD4,0x80,0x03,0x00,0x40,0x80,0x01,0x00,0x00,0xCA,0xC1,0x81,0x00,
+  0x06,0x13,0x23,0x42,0x30,0x80,0x04,0x04,0x84,0x84,0x80,0x80,0x04,0x01,0x1C,0x81,
+  0x0F,0x05,0xD1,0xDF,0xD3,0x80,0x0F,0x00,0x90,0x80,0x0F,0x02,0x43,0xD0,0x80,0x0F,
+  0x00,0xD0,0x81,0x03,0x04,0x4F,0xD4,0x30,0xC3,0x83,0x04,0x00,0xD0,0x80,0x0F,0x02,
+  0xDA,0xE0,0x80,0x0D,0x80,0x04,0x03,0x24,0x10,0xCB,0xC1,0x81,0x00,0x00,0x10,0x80,
+  0x04,0x00,0x20,0x82,0x01,0x80,0x03,0x82,0x04,0x03,0x84,0x29,0x81,0x0F,0x01,0x13,
+  0x80,0x0F,0x01,0x82,0x82,0x0F,0x02,0x81,0xD0,0x82,0x0F,0x03,0x13,0x19,0x80,0x0F,
+  0x01,0x34,0x80,0x03,0x02,0xCF,0xC0,0x81,0x03,0x01,0x4D,0x80,0x0F,0x83,0x0D,0x80,
+  0x03,0x01,0x43,0xCD,0xC0,0x82,0x00,0x05,0x14,0x23,0x69,0x81,0x04,0x84,0x03,0x80,
+  0x01,0x00,0x40,0x80,0x0D,0x06,0x41,0x8F,0xD3,0x40,0x81,0x0F,0x02,0xC1,0x90,0x80,
+  0x0F,0x09,0xDF,0xD3,0x23,0xDF,0xC1,0x80,0x03,0x00,0x90,0x81,0x0F,0x00,0x40,0x80,
+  0x03,0x04,0x4D,0xFC,0x90,0x81,0x0D,0x04,0x82,0x14,0x20,0xCD,0xC0,0x81,0x00,0x02,
+  0x13,0x20,0x80,0x03,0x00,0xD0,0x81,0x0F,0x03,0x94,0x98,0x80,0x03,0x80,0x04,0x02,
+  0x31,0x00,0x80,0x01,0x01,0x23,0x80,0x09,0x01,0x24,0x80,0x0F,0x02,0xD3,0x80,0x84,
+  0x0F,0x80,0x01,0x00,0x40,0x80,0x0F,0x03,0x41,0x38,0x82,0x0F,0x00,0x40,0x80,0x03,
+  0x02,0x8C,0xD0,0x82,0x09,0x05,0xC8,0x32,0x43,0xCD,0x82,0x00,0x01,0x14,0x80,0x03,
+  0x00,0x80,0x81,0x0F,0x00,0xD0,0x80,0x09,0x05,0xFD,0x4C,0xFC,0x80,0x09,0x01,0x41,
+  0x80,0x03,0x03,0x10,0x13,0x80,0x01,0x07,0x31,0x39,0xF9,0x4E,0x80,0x0F,0x02,0x21,
+  0xC0,0x80,0x0F,0x02,0x83,0x40,0x80,0x0F,0x00,0xD0,0x80,0x0F,0x04,0x43,0x49,0xC0,
+  0x82,0x09,0x05,0xC9,0x82,0x34,0x80,0x01,0xCC,0x82,0x00,0x00,0x30,0x80,0x02,0x01,
+  0x1D,0x80,0x0F,0x02,0xD8,0x20,0x80,0x0F,0x02,0xC3,0xD0,0x82,0x0F,0x03,0xE4,0xDF,
+  0x80,0x0D,0x02,0x42,0x30,0x81,0x01,0x02,0x31,0x00,0x80,0x01,0x00,0x30,0x80,0x08,
+  0x02,0x23,0xD0,0x88,0x0F,0x0F,0x43,0x89,0x89,0x8C,0x89,0x84,0x32,0x41,0xCD,0x81,
+  0x00,0x04,0x13,0x41,0x40,0x82,0x0F,0x01,0x94,0x80,0x0F,0x03,0x41,0x3E,0x80,0x0F,
+  0x01,0x9C,0x83,0x0F,0x02,0xD3,0x40,0x80,0x0D,0x05,0x62,0x45,0x32,0x80,0x01,0x00,
+  0x20,0x81,0x01,0x80,0x08,0x80,0x09,0x80,0x0D,0x01,0x8C,0x80,0x0F,0x03,0x43,0x48,
+  0x83,0x04,0x00,0x80,0x80,0x04,0x03,0x23,0x23,0xCD,0x81,0x00,0x04,0x14,0x23,0x90,
+  0x81,0x0F,0x0C,0xD4,0x9F,0xD3,0x13,0xEF,0x81,0xD0,0x80,0x0F,0x01,0x49,0x80,0x0F,
+  0x01,0x94,0x80,0x0F,0x01,0x94,0x80,0x0F,0x04,0x42,0x41,0x20,0x80,0x04,0x00,0x30,
+  0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x30,0x80,0x01,0x80,0x09,0x00,0x40,0xC3,0x80,
+  0x04,0x00,0x80,0x80,0x04,0x05,0x84,0x32,0x31,0xCD,0xC0,0x80,0x00,0x04,0x32,0x32,
+  0x90,0x81,0x0F,0x01,0xD9,0x81,0x0F,0x02,0x94,0x90,0x80,0x0F,0x01,0x34,0x80,0x0F,
+  0x02,0x40,0x30,0x80,0x0F,0x01,0x9D,0x80,0x0F,0x01,0xD9,0x80,0x0F,0x01,0x31,0x80,
+  0x04,0x0F,0x39,0xF9,0x14,0x98,0x41,0x31,0x01,0x34,0x80,0x03,0x81,0x04,0x80,0x03,
+  0x82,0x04,0x02,0x32,0x10,0xCD,0xC2,0x07,0x34,0x23,0x48,0x9D,0x80,0x09,0x00,0xD0,
+  0x81,0x0F,0x05,0xDC,0xFD,0x14,0x80,0x0F,0x02,0x93,0x90,0x80,0x0F,0x00,0x60,0x84,
+  0x0F,0x05,0x92,0x34,0x14,0x80,0x0F,0x01,0x94,0x82,0x0F,0x06,0xD4,0x24,0x94,0x20,
+  0x88,0x03,0x01,0x23,0x80,0x04,0x00,0x10,0xCC,0xC1,0x15,0x12,0x34,0x31,0x01,0x01,
+  0x21,0x49,0x84,0xDF,0x82,0x4D,0x83,0x0F,0x00,0x90,0xC3,0x81,0x0F,0x05,0x42,0x32,
+  0x38,0x80,0x0F,0x00,0x90,0x81,0x0F,0x00,0xD0,0x80,0x0F,0x09,0x93,0xDF,0x91,0x9D,
+  0x82,0x80,0x04,0x81,0x03,0x05,0x14,0x23,0x21,0xCC,0xC2,0x07,0x32,0x42,0x42,0x42,
+  0x80,0x03,0x85,0x01,0x04,0x34,0x13,0xD0,0x81,0x0F,0x05,0x94,0xDF,0x9C,0x80,0x0F,
+  0x03,0xD4,0x23,0x80,0x01,0x03,0xCF,0xDC,0x80,0x0F,0x05,0x10,0xDF,0xD8,0x80,0x0F,
+  0x05,0x43,0xDF,0xC4,0x80,0x0F,0x03,0x43,0xC9,0x80,0x03,0x02,0x43,0x10,0xCC,0xC3,
+  0x82,0x01,0x80,0x03,0x00,0x20,0x80,0x04,0x07,0x24,0x23,0x23,0x12,0x80,0x03,0x80,
+  0x01,0x08,0x35,0x31,0x39,0xD3,0x40,0x80,0x0F,0x03,0xD1,0x3C,0x80,0x0D,0x80,0x0F,
+  0x09,0x9D,0xFD,0x01,0xDF,0xD9,0x81,0x0F,0x00,0xD0,0x80,0x0F,0x01,0x49,0x80,0x0F,
+  0x80,0x09,0x05,0xFD,0x42,0x42,0xCD,0xC8,0x01,0x10,0x81,0x01,0x80,0x03,0x02,0x43,
+  0x20,0x80,0x04,0x00,0x20,0x80,0x04,0x83,0x01,0x01,0x31,0x81,0x03,0x05,0x58,0x42,
+  0x19,0x81,0x0F,0x02,0xD3,0xD0,0x80,0x0F,0x01,0x9D,0x80,0x0F,0x01,0x9C,0x83,0x0F,
+  0x01,0xD4,0x81,0x0F,0x80,0x0D,0x05,0xFD,0x13,0x41,0xCD,0xCE,0x01,0x10,0x81,0x01,
+  0x80,0x03,0x01,0x23,0x80,0x04,0x00,0x20,0x80,0x04,0x80,0x02,0x02,0x12,0x30,0x80,
+  0x01,0x0A,0x24,0x21,0x8D,0x94,0x14,0xD0,0x82,0x0F,0x01,0x98,0x80,0x0F,0x01,0x89,
+  0x80,0x0F,0x01,0x94,0x84,0x0F,0x04,0x43,0x23,0x10,0xCD,0xD5,0x82,0x01,0x01,0x32,
+  0x80,0x03,0x81,0x04,0x00,0x20,0x81,0x04,0x01,0x34,0x80,0x01,0x00,0x00,0x80,0x01,
+  0x03,0x21,0x39,0x80,0x0D,0x06,0x81,0x6F,0xD1,0x40,0x80,0x0F,0x03,0x4D,0xFD,0x82,
+  0x0F,0x03,0x23,0x42,0xCE,0xDC,0x01,0x10,0x80,0x01,0x01,0x32,0x80,0x03,0x00,0x20,
+  0xC3,0x82,0x04,0x0D,0x10,0x10,0x12,0x48,0x43,0x9F,0x94,0x80,0x0F,0x01,0x4D,0x80,
+  0x0F,0x03,0xD1,0x34,0x80,0x01,0xCD,0xE6,0x00,0x10,0x80,0x03,0x02,0x24,0x20,0x80,
+  0x04,0x04,0x32,0x32,0x30,0x80,0x01,0x01,0x23,0x81,0x01,0x00,0x40,0x80,0x08,0x08,
+  0x18,0xFD,0x42,0x42,0x10,0xCE,0xE8,0x80,0x00,0x81,0x01,0x02,0x32,0x30,0x81,0x04,
+  0x06,0x24,0x24,0x21,0x20,0x81,0x01,0x00,0x20,0x80,0x01,0x80,0x03,0x02,0x42,0x30,
+  0xCF,0xEB,0x82,0x00,0x82,0x01,0x82,0x03,0x00,0x20,0x81,0x04,0x03,0x23,0x42,0x80,
+  0x01,0x02,0x32,0x40,0x80,0x01,0xCE,0xEF,0x85,0x00,0x82,0x01,0x80,0x03,0x01,0x23,
+  0x84,0x04,0x00,0x10,0xCF,0xF3,0x87,0x00,0x82,0x01,0x03,0x21,0x23,0xD0,0xF7,0x89,
+  0x00,0x00,0x10,0xD1,0xFA,0x85,0x00,0xD3,0xFE,0x00,0x00,0xD5,
 };
 
-const uint16_t* spaceman_frames[5] = {
-  spaceman_frame_0,
-  spaceman_frame_1,
-  spaceman_frame_2,
-  spaceman_frame_3,
-  spaceman_frame_4
+// Delta 3: 85x80 at (18, 22), 3937 bytes
+static const uint8_t spaceman_delta_3_rle[3937] PROGMEM = {
+  0xE5,0x00,0x00,0xC4,0x00,0x10,0xE7,0xDF,0x80,0x00,0x81,0x01,0xC9,0x00,0x20,0x81,
+  0x01,0xE1,0xDB,0x80,0x00,0x80,0x01,0xD3,0x00,0x20,0x80,0x01,0xDD,0xD9,0x01,0x01,
+  0xDA,0x80,0x02,0xDB,0xD6,0x80,0x00,0x00,0x10,0xCC,0x81,0x02,0xCF,0x00,0x20,0xD9,
+  0xD4,0x80,0x00,0x00,0x10,0xC8,0x00,0x20,0x83,0x06,0x81,0x07,0x01,0x67,0x80,0x06,
+  0xCD,0x00,0x20,0xD7,0xD3,0x01,0x01,0xC6,0x80,0x02,0x81,0x06,0xDB,0x00,0x20,0xD5,
+  0xD1,0x01,0x01,0xC6,0x80,0x02,0x00,0x60,0xC7,0x81,0x07,0x00,0x60,0x82,0x07,0xD1,
+  0x00,0x10,0xD3,0xD0,0x01,0x01,0xC5,0x00,0x20,0x80,0x06,0xC3,0x80,0x07,0xC7,0x00,
+  0x60,0xCC,0x00,0x70,0xC7,0x00,0x20,0xD2,0xCF,0x00,0x00,0xC5,0x00,0x20,0x80,0x06,
+  0x83,0x07,0x82,0x06,0x80,0x0A,0xD5,0x00,0x60,0xC5,0x00,0x20,0xD1,0xCD,0x01,0x01,
+  0xC4,0x00,0x20,0x80,0x06,0x83,0x07,0x81,0x06,0x00,0xA0,0xD5,0x00,0x60,0xDC,0xCD,
+  0x00,0x10,0x84,0x02,0x00,0x60,0x82,0x07,0x81,0x06,0x00,0xA0,0xC4,0x80,0x0B,0x80,
+  0x0D,0xCD,0x01,0xBA,0xC5,0x01,0x74,0xD5,0xCC,0x00,0x10,0x84,0x02,0x00,0x60,0x82,
+  0x07,0x80,0x06,0x00,0xA0,0xC3,0x01,0xBD,0xD5,0x00,0xA0,0x81,0x06,0x81,0x07,0x00,
+  0x60,0xC4,0x00,0x40,0xCE,0xCB,0x00,0x00,0x84,0x02,0x82,0x07,0x81,0x06,0x82,0x0B,
+  0xC6,0x81,0x0C,0x81,0x0D,0x00,0xC0,0xC8,0x00,0xD0,0xC9,0x00,0x70,0xD3,0xCA,0x00,
+  0x00,0x83,0x02,0x00,0x60,0x82,0x07,0x80,0x06,0x00,0xE0,0x81,0x0B,0xC4,0x80,0x0C,
+  0x81,0x09,0x01,0x76,0x80,0x07,0x04,0x67,0xE7,0xE0,0x81,0x0D,0xC4,0x00,0xD0,0x82,
+  0x0B,0x80,0x06,0x82,0x07,0x80,0x02,0x02,0x42,0x40,0xCD,0xC9,0x00,0x00,0x83,0x02,
+  0x00,0x60,0xC4,0x00,0x60,0x81,0x0B,0x00,0xD0,0x82,0x0C,0x03,0xD9,0xA7,0x81,0x05,
+  0x05,0x9A,0x6A,0x6A,0x81,0x06,0x81,0x07,0x02,0xE6,0xD0,0xC3,0x00,0xD0,0x81,0x0B,
+  0x00,0x90,0xC3,0x00,0x70,0xD1,0xC8,0x00,0x00,0x84,0x02,0xC3,0x01,0x6E,0x81,0x0B,
+  0x82,0x0C,0x03,0xDA,0x76,0x81,0x08,0x80,0x05,0x85,0x08,0x02,0x65,0x10,0xC5,0x00,
+  0xD0,0x82,0x0C,0x81,0x0B,0x00,0xA0,0x80,0x06,0x81,0x07,0x80,0x02,0x02,0x42,0x40,
+  0xCB,0xC7,0x01,0x01,0x82,0x02,0x00,0x60,0xC3,0x01,0x6A,0x81,0x0B,0x81,0x0C,0x06,
+  0xDE,0x76,0x9A,0x80,0x80,0x0A,0x04,0x98,0x58,0xA0,0x80,0x08,0x07,0x58,0xA5,0x30,
+  0x12,0xC3,0x01,0x6D,0xC5,0x00,0xA0,0xC3,0x00,0x70,0x80,0x02,0x00,0x40,0xCC,0xC7,
+  0x00,0x10,0x83,0x02,0x00,0x60,0x80,0x07,0x80,0x06,0x81,0x0B,0x00,0xD0,0x81,0x0C,
+  0x00,0xE0,0x80,0x07,0x01,0x6A,0x80,0x08,0x01,0xA9,0x81,0x0A,0x01,0x85,0x80,0x0A,
+  0x02,0x8A,0x50,0x81,0x08,0x00,0x40,0x80,0x02,0x80,0x01,0xC3,0x00,0xD0,0x81,0x0C,
+  0x00,0xD0,0x80,0x0B,0x00,0xA0,0x80,0x06,0x80,0x07,0x01,0x53,0x80,0x02,0x00,0x40,
+  0xCA,0xC6,0x01,0x01,0x82,0x02,0x00,0x60,0x81,0x07,0x01,0x6A,0x80,0x0B,0x00,0xD0,
+  0x81,0x0C,0x01,0xE7,0x81,0x06,0x80,0x08,0x81,0x0A,0x02,0xB9,0xA0,0x81,0x08,0x00,
+  0xB0,0x84,0x08,0x01,0x54,0x81,0x02,0x02,0x12,0x60,0xC5,0x00,0xD0,0x80,0x0B,0x00,
+  0xA0,0xC3,0x00,0x50,0x80,0x02,0x00,0x40,0xCA,0xC5,0x03,0x01,0x24,0x80,0x02,0x00,
+  0x60,0x81,0x07,0x01,0x6A,0x80,0x0B,0x00,0xD0,0x81,0x0C,0x04,0x7E,0x62,0x30,0x81,
+  0x08,0x80,0x0A,0x02,0xDA,0x90,0x80,0x08,0x80,0x05,0x00,0x80,0x80,0x0A,0x80,0x08,
+  0x03,0x58,0xA4,0x83,0x02,0x04,0x14,0x67,0xE0,0x81,0x0C,0x00,0xD0,0x80,0x0B,0x01,
+  0xA6,0x81,0x07,0x00,0x30,0x80,0x02,0x01,0x31,0xC8,0xC5,0x01,0x03,0x81,0x02,0x00,
+  0x40,0x81,0x07,0x80,0x06,0x80,0x0B,0x00,0xD0,0x81,0x0C,0x80,0x07,0x00,0x60,0x80,
+  0x01,0x05,0x5A,0x8A,0x9A,0x81,0x08,0x04,0x58,0x58,0xA0,0x85,0x08,0x01,0x54,0x84,
+  0x02,0x01,0x46,0x80,0x07,0x81,0x0C,0x00,0xD0,0x80,0x0B,0x01,0x96,0x81,0x07,0x80,
+  0x03,0x80,0x04,0xC8,0xC4,0x03,0x01,0x24,0x80,0x02,0x00,0x50,0x80,0x07,0x80,0x06,
+  0x81,0x0B,0x81,0x0C,0x06,0x7E,0x61,0x24,0x80,0x81,0x05,0x80,0x08,0x03,0x58,0xA8,
+  0x81,0x0B,0x09,0xEB,0xAB,0xA5,0xA5,0x85,0x85,0x02,0x03,0x46,0x7E,0x81,0x0C,0x81,
+  0x0B,0xC3,0x03,0x54,0x24,0xC8,0xC4,0x02,0x02,0x40,0x80,0x02,0x00,0x40,0x81,0x07,
+  0x00,0x60,0x81,0x0B,0x81,0x0C,0x80,0x07,0x01,0x61,0x80,0x02,0x06,0x58,0x35,0x8B,
+  0xA0,0x81,0x0B,0x01,0xEB,0xC4,0x80,0x0A,0x81,0x08,0x80,0x05,0x00,0x30,0x81,0x02,
+  0xC3,0x03,0x26,0x7E,0x81,0x0C,0x81,0x0B,0x00,0x60,0x81,0x07,0x04,0x52,0x42,0x10,
+  0xC6,0xC3,0x03,0x01,0x24,0x80,0x02,0x81,0x07,0x80,0x06,0x80,0x0B,0x81,0x0C,0x03,
+  0xE7,0x61,0x81,0x02,0x00,0x80,0x80,0x05,0x00,0xA0,0x81,0x0E,0xC9,0x02,0xB7,0xB0,
+  0x81,0x05,0x80,0x03,0x81,0x02,0xC3,0x04,0x24,0x67,0xD0,0x81,0x0C,0x80,0x0B,0x80,
+  0x06,0x80,0x07,0x01,0x51,0x80,0x04,0xC7,0xC3,0x05,0x03,0x24,0x25,0x81,0x07,0x00,
+  0x60,0x81,0x0B,0x80,0x0C,0x02,0xD7,0x60,0xC3,0x01,0x48,0x80,0x05,0x00,0xB0,0x81,
+  0x0E,0xCA,0x06,0xAB,0x85,0x35,0x30,0x82,0x02,0xC6,0x01,0x7D,0xC3,0x01,0xB6,0x81,
+  0x07,0x05,0x12,0x42,0x31,0xC4,0xC2,0x03,0x01,0x24,0x80,0x02,0x00,0x50,0x80,0x07,
+  0x01,0x6A,0x80,0x0B,0x81,0x0C,0x02,0x76,0x40,0xC3,0x03,0x48,0x58,0x82,0x0E,0xC9,
+  0x05,0xBA,0x7B,0x58,0x80,0x05,0x00,0x10,0x82,0x02,0x00,0x60,0x82,0x02,0x03,0x67,
+  0x6D,0x80,0x0C,0x80,0x0B,0x01,0x96,0x80,0x07,0x01,0x51,0x80,0x04,0x00,0x20,0x80,
+  0x04,0x00,0x30,0xC2,0xC2,0x05,0x01,0x43,0x25,0x81,0x07,0x00,0x60,0x80,0x0B,0x00,
+  0xD0,0x80,0x0C,0x03,0x7E,0x61,0x82,0x02,0x03,0x45,0x85,0x89,0x0E,0x00,0xB0,0x83,
+  0x0E,0x05,0xA9,0xA8,0x53,0x81,0x02,0xC5,0x80,0x06,0x01,0x7D,0x80,0x0C,0x00,0xD0,
+  0x80,0x0B,0x00,0x60,0x81,0x07,0x00,0x10,0x80,0x02,0x80,0x03,0x02,0x24,0x10,0xC1,
+  0xC1,0x80,0x00,0x01,0x24,0x80,0x02,0x00,0x50,0x80,0x07,0x01,0x67,0x80,0x0B,0x81,
+  0x0C,0x02,0xE6,0x10,0xC4,0x00,0x40,0x80,0x05,0x01,0x8B,0x81,0x0E,0x00,0xB0,0x81,
+  0x0E,0xC4,0x00,0xF0,0x82,0x0D,0x01,0x9A,0x80,0x05,0x00,0x30,0x81,0x02,0xC4,0x02,
+  0x62,0x40,0x80,0x07,0x81,0x0C,0x80,0x0B,0x01,0x96,0x80,0x07,0x80,0x03,0x05,0x51,
+  0x23,0x24,0xC1,0xC0,0x80,0x00,0x04,0x13,0x42,0x30,0x81,0x07,0x00,0x60,0x80,0x0B,
+  0x00,0xD0,0x80,0x0C,0x02,0xE7,0x40,0x85,0x02,0x02,0x45,0x80,0x87,0x0E,0x00,0xB0,
+  0x80,0x0E,0x01,0xD9,0x80,0x08,0x03,0x9D,0xA8,0x80,0x05,0x00,0x30,0x80,0x02,0xC3,
+  0x00,0x60,0x82,0x02,0x02,0x67,0xE0,0x80,0x0C,0x00,0xE0,0x80,0x0B,0x00,0x60,0x81,
+  0x07,0x02,0x8A,0x80,0x80,0x03,0x02,0x43,0x10,0xC0,0xC0,0x80,0x00,0x02,0x14,0x20,
+  0x80,0x03,0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x02,0x76,0x30,0xC6,0x00,0x40,
+  0x80,0x05,0x00,0xB0,0x81,0x0E,0x03,0xFD,0xED,0x81,0x0E,0x01,0xDA,0x82,0x05,0x01,
+  0x8B,0x80,0x0A,0x04,0x53,0x12,0x60,0xC7,0x00,0x40,0x80,0x07,0x81,0x0C,0x80,0x0B,
+  0x00,0x60,0x81,0x07,0x06,0xBE,0xA3,0x24,0x20,0xC1,0x81,0x00,0x04,0x34,0x32,0x50,
+  0x80,0x07,0x01,0x6A,0x80,0x0B,0x80,0x0C,0x02,0xE7,0x60,0x82,0x02,0x04,0x42,0x62,
+  0x40,0x80,0x05,0x01,0xAE,0x80,0x0D,0x07,0x89,0x89,0xED,0x9A,0x80,0x0B,0x03,0x7A,
+  0x75,0x80,0x0A,0x80,0x05,0x06,0x14,0x9C,0x96,0x40,0xC4,0x03,0x26,0x7F,0x80,0x0C,
+  0x80,0x0B,0x01,0x96,0x80,0x07,0x07,0xEA,0x71,0x34,0x31,0xC0,0x80,0x00,0x04,0x13,
+  0x24,0x20,0x81,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x02,0x76,0x30,0x80,
+  0x02,0xC3,0x81,0x02,0x07,0x15,0xAD,0x9A,0x58,0x80,0x05,0x03,0x89,0xA5,0x80,0x0A,
+  0x00,0xB0,0x83,0x0A,0x81,0x05,0x00,0x90,0x81,0x0D,0x01,0xCF,0x80,0x0C,0x80,0x06,
+  0x04,0x42,0x67,0xD0,0x80,0x0C,0x04,0xEB,0xE6,0x70,0x81,0x0A,0x04,0x31,0x32,0x30,
+  0xC1,0x80,0x00,0x04,0x13,0x21,0x30,0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x01,
+  0xE6,0x81,0x02,0x00,0x40,0x84,0x02,0x05,0x35,0xAD,0xAB,0x80,0x0A,0x04,0x75,0x8B,
+  0xE0,0x80,0x05,0x00,0x70,0x84,0x0A,0x81,0x05,0x01,0xDF,0x83,0x0D,0x80,0x0F,0x03,
+  0xD9,0x23,0x80,0x07,0x80,0x0C,0x00,0xE0,0x80,0x0B,0x09,0x6A,0xBA,0x50,0x34,0x21,
+  0xC1,0x80,0x00,0x01,0x13,0x80,0x04,0x00,0x30,0x80,0x07,0x01,0x5A,0x80,0x0B,0x80,
+  0x0C,0x02,0xD7,0x60,0x84,0x02,0x00,0x60,0x81,0x02,0x01,0x45,0x80,0x08,0x02,0xAB,
+  0xA0,0x81,0x0B,0x03,0x5A,0xEA,0x81,0x05,0x00,0x70,0x81,0x0A,0x00,0x70,0x80,0x05,
+  0x00,0x80,0x83,0x0D,0x00,0xC0,0x80,0x0D,0x81,0x0F,0x00,0x90,0x80,0x06,0x00,0xE0,
+  0x80,0x0D,0x00,0xE0,0x80,0x0B,0x00,0xA0,0x80,0x0E,0x02,0x75,0x10,0x80,0x04,0x00,
+  0x10,0xC2,0x80,0x00,0x04,0x12,0x48,0x50,0x80,0x07,0x01,0x6A,0x80,0x0B,0x80,0x0C,
+  0x02,0xE7,0x40,0x80,0x02,0x00,0x40,0x86,0x02,0x01,0x35,0x80,0x0A,0x0E,0x57,0xAB,
+  0x7A,0xBE,0xBA,0x7A,0xBA,0xB0,0x80,0x0A,0x04,0x53,0x8D,0x90,0x84,0x0D,0x80,0x0F,
+  0x80,0x0D,0x80,0x06,0x03,0x7E,0xDC,0x80,0x0B,0x01,0xAE,0x80,0x0A,0x80,0x01,0x02,
+  0x24,0x10,0xC2,0xC0,0x01,0x01,0x81,0x04,0x00,0x50,0x80,0x07,0x03,0x6A,0xBD,0x80,
+  0x0C,0x00,0x70,0x80,0x06,0x82,0x02,0x00,0x40,0x83,0x02,0x03,0x43,0x57,0x81,0x0A,
+  0x03,0x5A,0x7A,0xC5,0x00,0xB0,0x80,0x0E,0x80,0x0A,0x80,0x05,0x80,0x08,0x02,0xCD,
+  0xC0,0x82,0x0D,0x07,0xCF,0xDC,0x96,0xDE,0x80,0x0C,0x00,0xE0,0x80,0x0A,0x03,0xEA,
+  0x51,0x80,0x04,0x80,0x01,0xC2,0xC0,0x05,0x03,0x42,0x15,0x80,0x07,0x03,0x6A,0xBD,
+  0x80,0x0C,0x02,0xE7,0x60,0x80,0x02,0x00,0x40,0x81,0x02,0x00,0x60,0x81,0x02,0x07,
+  0x69,0x85,0xBE,0xAB,0x81,0x0A,0x80,0x0E,0xC3,0x80,0x0A,0x02,0xE7,0xB0,0x80,0x05,
+  0x02,0x39,0xF0,0x85,0x0D,0x00,0xC0,0x80,0x0D,0x05,0xFD,0xEA,0xCD,0x80,0x0A,0x80,
+  0x0E,0x00,0x70,0x80,0x01,0x03,0x32,0x10,0xC2,0xC0,0x02,0x01,0x40,0x80,0x02,0x00,
+  0x50,0x80,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x01,0x76,0x82,0x02,0x00,
+  0x40,0x82,0x02,0x02,0x62,0x40,0x80,0x0D,0x01,0x8A,0x81,0x0E,0x80,0x0A,0x01,0xBA,
+  0xC4,0x00,0x90,0x83,0x0A,0x01,0x5D,0x80,0x0F,0x00,0xD0,0x80,0x0F,0x87,0x0D,0x01,
+  0xEA,0x80,0x0D,0x05,0xEA,0xBA,0x50,0x80,0x04,0x00,0x10,0x81,0x00,0xC1,0xC0,0x02,
+  0x01,0x40,0x80,0x03,0x81,0x07,0x00,0x60,0x80,0x0B,0x81,0x0C,0x04,0x76,0x42,0x40,
+  0x80,0x02,0x00,0x40,0x80,0x02,0x01,0x46,0x80,0x09,0x00,0xC0,0x80,0x0D,0x00,0x90,
+  0x80,0x0E,0x82,0x0A,0x01,0xEA,0x80,0x0E,0x00,0xD0,0x80,0x0A,0x06,0xE7,0xB7,0x5B,
+  0xD0,0x83,0x0F,0x84,0x0D,0x02,0xC9,0xA0,0x82,0x0E,0x81,0x0A,0x00,0x70,0x80,0x01,
+  0x02,0x42,0x10,0x82,0x00,0xC0,0xC1,0x00,0x30,0x81,0x02,0x00,0x50,0x80,0x07,0x00,
+  0x60,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x01,0x76,0x81,0x02,0x00,0x40,0x80,0x02,0x00,
+  0x40,0x80,0x06,0x80,0x0C,0x80,0x0D,0x06,0x9D,0x9A,0xEB,0xA0,0x80,0x09,0xC3,0x00,
+  0x90,0x80,0x0E,0x00,0xB0,0x83,0x0A,0x81,0x0D,0x81,0x0F,0x00,0xC0,0x84,0x0D,0x00,
+  0xA0,0x83,0x0E,0x00,0x70,0x80,0x0A,0x01,0x51,0x80,0x04,0x00,0x10,0x83,0x00,0xC0,
+  0xC4,0x00,0x30,0x81,0x07,0x00,0x60,0x80,0x0B,0x00,0xD0,0x80,0x0C,0x0B,0xE7,0x24,
+  0x24,0x24,0x6C,0xD9,0x83,0x0D,0x01,0xCA,0x81,0x0E,0x80,0x0A,0x00,0xE0,0x80,0x0D,
+  0x80,0x0A,0x80,0x0E,0xC3,0x01,0x7B,0x80,0x0D,0x03,0xFD,0xFC,0x82,0x0D,0x03,0xFC,
+  0x9A,0x82,0x0E,0x80,0x0A,0x01,0xB7,0x80,0x01,0x01,0x42,0x84,0x00,0xC0,0xC0,0x01,
+  0x42,0x81,0x03,0x00,0xA0,0x80,0x07,0x00,0x60,0x80,0x0B,0x00,0xE0,0x80,0x0C,0x04,
+  0x76,0x42,0x40,0x80,0x02,0x00,0x40,0x83,0x0D,0x02,0xFD,0xF0,0x81,0x0D,0x00,0xA0,
+  0xC4,0x02,0xBE,0xA0,0x81,0x0E,0xC4,0x01,0xAD,0x80,0x0F,0x80,0x0D,0x80,0x0F,0x02,
+  0xDF,0xC0,0x80,0x0D,0x00,0xA0,0x83,0x0E,0x07,0xB7,0xA5,0x12,0x41,0x84,0x00,0xC0,
+  0x0C,0x13,0x42,0x38,0xAB,0x76,0xAB,0xD0,0x80,0x0C,0x00,0x70,0x80,0x06,0x81,0x02,
+  0x01,0x46,0x80,0x0D,0x01,0xCD,0x83,0x0F,0x80,0x0D,0x01,0x98,0xC3,0x80,0x0E,0x00,
+  0xB0,0x81,0x0E,0xC4,0x04,0xA9,0xDF,0xD0,0x81,0x0F,0x01,0xCF,0x80,0x0D,0x00,0x90,
+  0x83,0x0E,0x81,0x0A,0x04,0x50,0x14,0x30,0x85,0x00,0xC0,0x04,0x12,0x42,0x30,0x81,
+  0x0A,0x04,0x76,0xAB,0xE0,0x80,0x0C,0x01,0xE7,0x80,0x02,0x80,0x04,0x00,0x60,0x81,
+  0x0D,0x00,0xF0,0x80,0x0D,0x82,0x0F,0x00,0xC0,0x81,0x0D,0xC3,0x80,0x0E,0x00,0xA0,
+  0x80,0x0E,0x81,0x0A,0x01,0x7B,0x80,0x0A,0x01,0xEF,0x80,0x0D,0x01,0xFC,0x80,0x0F,
+  0x80,0x0D,0x01,0xCA,0x81,0x0E,0x04,0xBE,0x7B,0x70,0x80,0x01,0x80,0x04,0x00,0x10,
+  0x84,0x00,0xC1,0x06,0x13,0x43,0x15,0xE0,0x80,0x0A,0x03,0xEA,0xBD,0x80,0x0C,0x05,
+  0xE7,0x62,0x36,0x81,0x0D,0x00,0xF0,0x81,0x0D,0x80,0x0F,0x00,0xC0,0x80,0x0F,0x82,
+  0x0D,0x00,0x80,0x80,0x0A,0x80,0x0E,0x83,0x0A,0x02,0x5B,0x70,0x80,0x0A,0x80,0x0D,
+  0x01,0xFC,0x80,0x0D,0x00,0xC0,0xC3,0x00,0x90,0x81,0x0E,0x80,0x0A,0x06,0xBA,0x51,
+  0x34,0x20,0x85,0x00,0xC1,0xC0,0x02,0x14,0x20,0x80,0x03,0x01,0x7B,0x81,0x0A,0x80,
+  0x0B,0x01,0xFC,0x80,0x07,0x02,0x62,0x40,0x82,0x0D,0x01,0xFC,0x80,0x0D,0x80,0x0F,
+  0x80,0x0D,0x00,0xF0,0x81,0x0D,0x03,0xF9,0x87,0x83,0x0A,0x01,0x87,0x81,0x0A,0x03,
+  0x7A,0xDF,0x80,0x0D,0xC3,0x00,0xC0,0x80,0x0D,0x0C,0x9B,0xEB,0x7B,0x78,0x13,0x42,
+  0x10,0x84,0x00,0xC2,0xC0,0x0B,0x13,0x42,0x15,0xAE,0x7A,0xEB,0x81,0x0D,0x05,0xE6,
+  0x23,0x9A,0x82,0x0D,0x83,0x0F,0x02,0xCD,0xF0,0x82,0x0D,0x80,0x0A,0x04,0x5A,0x8A,
+  0x80,0xC4,0x02,0xA9,0xF0,0x80,0x0D,0x00,0xC0,0x81,0x0D,0x00,0xC0,0x81,0x09,0x82,
+  0x0A,0x04,0xE7,0xA5,0x10,0x80,0x04,0x80,0x01,0x83,0x00,0xC3,0xC1,0x01,0x34,0x81,
+  0x03,0x06,0xAE,0xA7,0xEB,0xA0,0x80,0x0D,0x06,0xE7,0x41,0xAE,0xA0,0x81,0x0D,0x82,
+  0x0F,0x05,0xCD,0xFD,0xFC,0x80,0x0D,0x80,0x0A,0x01,0xB7,0x80,0x05,0x01,0xA5,0x81,
+  0x0A,0x01,0x5A,0x84,0x0D,0x00,0xC0,0x82,0x09,0x0A,0xC9,0xAB,0x7B,0x7E,0x94,0x20,
+  0x80,0x03,0x00,0x10,0x82,0x00,0xC4,0xC1,0x05,0x12,0x42,0x15,0x80,0x0E,0x03,0xAE,
+  0xBA,0x80,0x0D,0x80,0x07,0x01,0x64,0x80,0x0E,0x03,0x9D,0xFD,0x81,0x0F,0x80,0x0D,
+  0x00,0xF0,0x80,0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x80,0x0A,0x00,0x70,0xC4,0x80,
+  0x0A,0x02,0x5A,0x90,0x83,0x0D,0x00,0x90,0x81,0x08,0x08,0xC8,0x9D,0xA7,0xB7,0xA0,
+  0x80,0x0D,0x80,0x03,0x02,0x24,0x10,0x80,0x00,0xC6,0xC2,0x01,0x32,0x81,0x03,0x04,
+  0xAE,0xAE,0xB0,0x80,0x0E,0x08,0xFE,0x76,0xAE,0xA9,0xC0,0x80,0x0D,0x80,0x0C,0x01,
+  0xDF,0x84,0x0D,0x80,0x09,0x04,0xA5,0xA5,0xA0,0xC3,0x03,0x75,0x89,0x80,0x0D,0x00,
+  0xC0,0x80,0x09,0x03,0x48,0x49,0x80,0x08,0x04,0x9D,0xFE,0xA0,0x82,0x0D,0x01,0x32,
+  0x80,0x03,0x00,0x10,0x80,0x00,0xC6,0xC6,0x01,0x1A,0x80,0x0E,0x00,0x70,0x84,0x0E,
+  0x00,0xA0,0x80,0x0E,0x07,0xA9,0xD9,0xDF,0xDC,0x81,0x0D,0x02,0xCD,0xC0,0x80,0x09,
+  0x00,0x80,0x80,0x0A,0x01,0x5A,0x80,0x05,0x02,0xA5,0xA0,0x80,0x05,0x82,0x09,0x01,
+  0x84,0x80,0x08,0x03,0x4C,0x48,0x80,0x04,0x00,0xD0,0x80,0x0F,0x82,0x0D,0x05,0xC4,
+  0x32,0x41,0xC8,0xC2,0x00,0x00,0x80,0x03,0x05,0x41,0x3A,0xEB,0x87,0x0E,0x08,0xAD,
+  0xC9,0xC9,0xD9,0xC0,0x84,0x0D,0x00,0x90,0x80,0x08,0x03,0x5A,0x5A,0x83,0x05,0x80,
+  0x08,0x01,0x98,0x80,0x04,0x04,0x84,0x94,0x30,0x82,0x04,0x00,0x90,0x80,0x0F,0x00,
+  0xC0,0x81,0x0D,0x04,0x98,0x23,0x40,0x80,0x01,0xC7,0xC2,0x02,0x01,0x20,0x80,0x04,
+  0x01,0x15,0x88,0x0E,0x80,0x0A,0x81,0x0D,0x83,0x09,0x03,0xDC,0x9C,0x81,0x09,0x00,
+  0x80,0xC5,0x82,0x05,0x01,0x38,0x81,0x03,0x01,0x48,0x81,0x04,0x00,0x80,0x81,0x04,
+  0x01,0x34,0x80,0x0D,0x83,0x09,0x00,0x40,0x80,0x03,0x01,0x42,0xC8,0xC3,0x00,0x00,
+  0x80,0x03,0x03,0x42,0x17,0x87,0x0E,0x02,0x7A,0xC0,0x81,0x0D,0x83,0x09,0x80,0x08,
+  0x81,0x09,0x00,0x40,0x80,0x08,0xC4,0x01,0x35,0x80,0x03,0x00,0x50,0x80,0x03,0x03,
+  0x48,0x34,0x80,0x03,0x02,0xCF,0xD0,0x81,0x03,0x03,0x8C,0xDC,0x80,0x09,0x01,0xC9,
+  0x80,0x04,0x02,0x24,0x30,0xC8,0xC3,0x01,0x01,0x80,0x02,0x81,0x03,0x00,0xB0,0x85,
+  0x0E,0x02,0xAB,0xD0,0x80,0x09,0x08,0xD9,0xC9,0x64,0x94,0x90,0x81,0x04,0x00,0x80,
+  0x80,0x04,0xC4,0x84,0x03,0x02,0x8F,0xC0,0x81,0x03,0x00,0x80,0x81,0x0F,0x00,0x40,
+  0x80,0x03,0x01,0x4C,0x80,0x09,0x01,0x84,0x80,0x08,0x80,0x04,0x03,0x34,0x21,0xC7,
+  0xC3,0x80,0x00,0x80,0x03,0x04,0x41,0x37,0xA0,0x83,0x0E,0x07,0xBA,0xFD,0x96,0x98,
+  0x81,0x09,0x01,0x4C,0x83,0x04,0x82,0x03,0x01,0x89,0x80,0x03,0x02,0xDF,0x90,0x80,
+  0x03,0x01,0x19,0x80,0x0F,0x81,0x03,0x00,0xC0,0x81,0x0F,0x03,0xD1,0x49,0x80,0x08,
+  0x01,0x48,0x81,0x04,0x02,0x84,0x20,0x80,0x03,0x01,0x41,0xC6,0xC2,0x81,0x00,0x0D,
+  0x13,0x24,0x15,0xAB,0xEB,0xA7,0xAF,0x80,0x0D,0x80,0x04,0x00,0x80,0x80,0x04,0x00,
+  0x20,0x81,0x04,0x80,0x08,0x81,0x09,0x03,0xCD,0x38,0x80,0x0F,0x01,0x19,0x81,0x0F,
+  0x03,0x13,0x19,0x80,0x0F,0x80,0x01,0x00,0x40,0x80,0x0F,0x05,0xDF,0xD4,0x39,0x87,
+  0x04,0x04,0x34,0x24,0x30,0xC6,0xC2,0x82,0x00,0x05,0x34,0x24,0x35,0x80,0x0A,0x02,
+  0x7B,0xA0,0x82,0x0D,0x00,0x90,0x81,0x04,0x80,0x09,0x07,0x83,0x9D,0xCD,0xF9,0x80,
+  0x0F,0x04,0x4C,0xF9,0x30,0x82,0x0F,0x08,0x43,0x19,0xFD,0x31,0x90,0x83,0x0F,0x03,
+  0x92,0x48,0x84,0x04,0x80,0x03,0x04,0x12,0x32,0x40,0xC6,0xC2,0x82,0x00,0x04,0x13,
+  0x42,0x10,0x80,0x05,0x81,0x0A,0x84,0x0D,0x80,0x04,0x04,0x3C,0xFC,0x30,0x80,0x0F,
+  0x80,0x0D,0x01,0xF4,0x80,0x0F,0x80,0x0D,0x02,0xF3,0x40,0x80,0x0F,0x05,0xDF,0xD3,
+  0x1C,0x80,0x0F,0x80,0x0D,0x80,0x0F,0x81,0x0D,0x02,0xF4,0x30,0x80,0x04,0x01,0x32,
+  0x84,0x03,0x82,0x04,0x00,0x20,0xC6,0xC1,0x84,0x00,0x05,0x14,0x34,0x15,0x80,0x0A,
+  0x80,0x0D,0x08,0x9D,0xCD,0xF9,0x31,0x90,0x80,0x0F,0x07,0x4F,0xD4,0xDF,0x49,0x81,
+  0x0F,0x02,0xD1,0xD0,0x83,0x0F,0x02,0x21,0x90,0x81,0x0F,0x80,0x0D,0x06,0x93,0x03,
+  0x13,0x10,0x83,0x03,0x03,0x48,0x43,0x80,0x0D,0x04,0x91,0x43,0x10,0xC5,0xC1,0x85,
+  0x00,0x06,0x24,0x23,0x49,0xD0,0x80,0x09,0x01,0xC9,0x81,0x0D,0x03,0x94,0x14,0x80,
+  0x0F,0x03,0xDF,0x94,0x80,0x0F,0x80,0x04,0x81,0x0F,0x01,0x94,0x80,0x0F,0x80,0x0D,
+  0x80,0x0F,0x06,0x41,0x48,0x43,0x10,0x80,0x00,0x01,0x13,0x80,0x01,0x82,0x04,0x80,
+  0x0D,0x04,0x4D,0xFD,0x30,0x80,0x0F,0x03,0x92,0x42,0xC6,0xC1,0x85,0x00,0x08,0x14,
+  0x34,0x13,0x9D,0x90,0x80,0x0D,0x80,0x09,0x05,0x8C,0x82,0x3D,0x81,0x0F,0x01,0x43,
+  0x80,0x0F,0x01,0x43,0x80,0x0F,0x04,0xD4,0x8D,0x90,0x82,0x01,0x01,0x32,0x83,0x01,
+  0x09,0x8C,0x94,0x29,0xFD,0x34,0x80,0x0F,0x01,0x4D,0x80,0x0F,0x00,0x90,0x80,0x0F,
+  0x04,0x61,0x43,0x10,0xC5,0xC0,0x86,0x00,0x08,0x13,0x23,0x21,0x39,0xC0,0x80,0x09,
+  0x00,0x60,0x80,0x04,0x00,0x90,0x80,0x04,0x01,0x19,0x80,0x0F,0x0F,0xD1,0x4F,0xD4,
+  0x34,0x83,0x14,0x10,0x13,0x80,0x01,0x01,0x24,0x80,0x09,0x01,0x34,0x82,0x0F,0x02,
+  0xD4,0x90,0x80,0x0F,0x05,0x4D,0xFD,0x8D,0x83,0x0F,0x04,0x42,0x42,0x10,0xC5,0xC0,
+  0x87,0x00,0x00,0x10,0x81,0x04,0x03,0x31,0x36,0x81,0x04,0x02,0x84,0x80,0x82,0x04,
+  0x80,0x0D,0x01,0x82,0x80,0x03,0x80,0x01,0x00,0x40,0x81,0x01,0x03,0x31,0x39,0x82,
+  0x04,0x06,0x19,0xFD,0x8D,0xF0,0x80,0x0D,0x80,0x0F,0x01,0xD8,0x83,0x0F,0x01,0xD4,
+  0x84,0x0F,0x01,0x91,0x80,0x04,0xC6,0xC0,0x88,0x00,0x04,0x12,0x34,0x20,0x80,0x03,
+  0x01,0x48,0x84,0x04,0x03,0x23,0x10,0x81,0x01,0x82,0x03,0x0C,0x28,0xD9,0x2D,0xFC,
+  0x12,0x42,0x90,0x80,0x0F,0x00,0x90,0x80,0x0F,0x02,0x40,0xD0,0x80,0x0F,0x00,0x90,
+  0x80,0x0F,0x00,0xD0,0x81,0x0F,0x00,0x40,0x80,0x0F,0x00,0x80,0x81,0x0F,0x04,0x42,
+  0x42,0x10,0xC5,0xC0,0x89,0x00,0x04,0x32,0x34,0x20,0x81,0x03,0x01,0x43,0x80,0x04,
+  0x82,0x03,0x80,0x04,0x02,0x34,0x90,0x80,0x0F,0x03,0xD4,0x3D,0x80,0x0F,0x0B,0x4D,
+  0xFD,0x14,0x21,0x9F,0xDC,0x80,0x0F,0x17,0x30,0xDF,0xD9,0xFD,0x38,0xFD,0x4D,0xF4,
+  0x8F,0xD4,0x34,0x31,0xC5,0x89,0x00,0x03,0x13,0x42,0x80,0x03,0x80,0x01,0x81,0x03,
+  0x03,0x43,0x49,0x80,0x0D,0x80,0x0F,0x01,0x8D,0x83,0x0F,0x01,0x3D,0x81,0x0F,0x07,
+  0xDF,0x92,0x43,0x19,0x80,0x0F,0x00,0x80,0x80,0x0F,0x01,0x98,0x80,0x0F,0x08,0x8C,
+  0xFD,0x18,0xFD,0x40,0x80,0x09,0x08,0x21,0x21,0x32,0x42,0x10,0xC5,0xC0,0x88,0x00,
+  0x03,0x14,0x23,0x80,0x04,0x07,0x6C,0x84,0xDF,0x49,0x82,0x0F,0x80,0x0D,0x80,0x0F,
+  0x01,0x38,0x80,0x0F,0x01,0x9D,0x83,0x0F,0x09,0x92,0x42,0x4D,0xFD,0x4D,0x82,0x0F,
+  0x0B,0xD1,0x4D,0x62,0x43,0x13,0x10,0x80,0x03,0x00,0x10,0x80,0x03,0x81,0x04,0xC6,
+  0xC1,0x87,0x00,0x00,0x10,0x80,0x04,0x01,0x26,0x81,0x0F,0x01,0xD8,0x80,0x0F,0x02,
+  0x84,0x80,0x80,0x0F,0x01,0xD1,0x80,0x0F,0x02,0x90,0x30,0x80,0x0F,0x03,0x9D,0xFD,
+  0x81,0x0F,0x03,0x92,0x3D,0x81,0x0F,0x03,0xC1,0x49,0x80,0x0D,0x00,0x80,0x80,0x01,
+  0x00,0x40,0x80,0x01,0x01,0x32,0x80,0x01,0x03,0x42,0x32,0x80,0x04,0x03,0x24,0x23,
+  0x80,0x01,0xC5,0xC6,0x82,0x00,0x04,0x14,0x21,0xC0,0x80,0x0F,0x02,0xD8,0x40,0x80,
+  0x0F,0x0B,0x43,0x0D,0xF9,0x0D,0xFD,0x18,0x80,0x0F,0x02,0x8D,0xF0,0x80,0x09,0x80,
+  0x0F,0x03,0x91,0x28,0x80,0x0D,0x0E,0x83,0x13,0x13,0x10,0x14,0x31,0x34,0x30,0x83,
+  0x04,0x02,0x31,0x30,0x81,0x01,0xC8,0xCA,0x00,0x10,0x80,0x04,0x01,0x19,0x80,0x0F,
+  0x02,0xD4,0x80,0x80,0x0F,0x07,0x41,0x3D,0xFD,0x1D,0x80,0x0F,0x00,0xD0,0x80,0x0F,
+  0x03,0xC4,0xDF,0x80,0x04,0x04,0xD9,0x42,0x30,0x83,0x01,0x80,0x04,0x00,0x20,0x80,
+  0x01,0x81,0x04,0x05,0x24,0x23,0x23,0x81,0x01,0x01,0x01,0xCD,0xCA,0x04,0x14,0x23,
+  0xD0,0x81,0x0F,0x01,0xD4,0x80,0x0F,0x02,0xC8,0x40,0x80,0x0F,0x03,0xC1,0x4D,0x81,
+  0x0F,0x00,0xD0,0x80,0x01,0x00,0x80,0x80,0x04,0x00,0x30,0x81,0x01,0x02,0x42,0x40,
+  0x80,0x01,0x80,0x04,0x01,0x23,0x81,0x04,0x03,0x23,0x13,0x81,0x01,0x83,0x00,0xCF,
+  0xCA,0x04,0x14,0x21,0xD0,0x80,0x0F,0x00,0xD0,0x80,0x09,0x00,0xD0,0x81,0x0F,0x0C,
+  0x9D,0xF8,0x21,0x34,0x83,0x01,0x40,0x81,0x01,0x81,0x04,0x02,0x24,0x30,0x81,0x04,
+  0x06,0x23,0x13,0x10,0x10,0x8B,0x00,0xCE,0xCA,0x01,0x14,0x80,0x03,0x00,0xD0,0x82,
+  0x0F,0x06,0x9C,0xED,0x94,0x30,0x80,0x01,0x02,0x32,0x30,0x81,0x01,0x0B,0x24,0x24,
+  0x24,0x23,0x23,0x13,0x80,0x01,0x92,0x00,0xCF,0xCA,0x08,0x14,0x23,0x6D,0x98,0x40,
+  0x80,0x03,0x80,0x01,0x00,0x00,0x81,0x01,0x00,0x20,0x81,0x04,0x03,0x23,0x24,0x82,
+  0x03,0x81,0x01,0x80,0x00,0x00,0x10,0x94,0x00,0xD0,0xCA,0x04,0x13,0x23,0x20,0x86,
+  0x01,0x00,0x20,0x82,0x04,0x01,0x32,0x81,0x03,0x82,0x01,0x80,0x00,0x00,0x10,0xC4,
+  0x95,0x00,0xCF,0xCA,0x00,0x10,0x81,0x04,0x03,0x31,0x32,0x84,0x04,0x01,0x32,0x82,
+  0x01,0xD5,0x8D,0x00,0xD0,0xCA,0x08,0x14,0x23,0x42,0x43,0x20,0x83,0x01,0xE1,0x86,
+  0x00,0xCF,0x00,0x10,0xC0,0xCB,0x02,0x13,0x20,0x81,0x01,0xEE,0x00,0x00,0xD0,0x80,
+  0x01,
 };
 
-#endif // SPACEMAN_GIF_H
+// Delta 4: 84x81 at (18, 24), 3569 bytes
+static const uint8_t spaceman_delta_4_rle[3569] PROGMEM = {
+  0xDD,0x00,0x00,0xD5,0x00,0x20,0xDD,0xDB,0x00,0x10,0xF6,0xD9,0x00,0x10,0xDF,0x00,
+  0x10,0xD7,0xD7,0x00,0x10,0xC9,0x00,0x20,0xC3,0x00,0x60,0xC8,0x00,0x60,0xC9,0x00,
+  0x10,0xD5,0xD5,0x00,0x10,0xC9,0x00,0x70,0xD1,0x01,0x62,0xDD,0xD2,0x01,0x01,0xC8,
+  0x00,0x60,0xCC,0x00,0x60,0xC7,0x00,0x70,0x80,0x06,0xDB,0xF0,0x00,0x60,0xC5,0x80,
+  0x06,0xC6,0x00,0x10,0xD1,0xD0,0x00,0x10,0xD0,0x01,0xE7,0xC9,0x01,0xE7,0xC8,0x01,
+  0x74,0xD7,0xCE,0x00,0x00,0xC5,0x00,0x20,0xDC,0x00,0xD0,0xC6,0x00,0x70,0xC6,0x00,
+  0x10,0xCE,0xCD,0x00,0x00,0xCA,0x00,0x70,0x81,0x06,0xC9,0x00,0xD0,0xC3,0x01,0xFB,
+  0xC9,0x00,0x60,0xC3,0x00,0x60,0x81,0x02,0x00,0x40,0xD0,0xCC,0x00,0x00,0xE4,0x00,
+  0xE0,0xC6,0x82,0x07,0x01,0x54,0x80,0x02,0x00,0x40,0xCF,0xD2,0x00,0x60,0xC9,0x00,
+  0xB0,0xC7,0x83,0x0D,0xCD,0x00,0xA0,0x80,0x06,0xC8,0x00,0x40,0xCC,0xD0,0x01,0x26,
+  0xC8,0x00,0xD0,0xC5,0x80,0x0D,0x05,0x67,0xE7,0x67,0xC5,0x00,0xC0,0xC4,0x00,0xC0,
+  0xC9,0x02,0x32,0x40,0x80,0x02,0x00,0x30,0xCB,0xCA,0x00,0x10,0xC3,0x00,0x20,0x82,
+  0x07,0xC4,0x00,0xB0,0xC3,0x01,0xCD,0x80,0x08,0x02,0x76,0xA0,0x80,0x06,0x03,0xA6,
+  0xA6,0xC6,0x00,0xD0,0xC4,0x00,0xC0,0x81,0x0B,0x00,0xA0,0x80,0x06,0x81,0x07,0x00,
+  0x30,0x80,0x02,0x00,0x40,0xCC,0xC9,0x00,0x10,0xC4,0x00,0x60,0x81,0x07,0x01,0x6D,
+  0xC6,0x03,0xC9,0x76,0x80,0x05,0x02,0x39,0xA0,0xC3,0x02,0x68,0x30,0x80,0x01,0x00,
+  0x20,0x81,0x06,0x80,0x07,0x00,0xE0,0xC7,0x00,0xB0,0xC4,0x04,0x13,0x24,0x20,0xCA,
+  0xCD,0x01,0x26,0x81,0x07,0x80,0x06,0xC5,0x03,0xCD,0x79,0x80,0x08,0x01,0x98,0x80,
+  0x05,0x01,0x8A,0x84,0x08,0x00,0x50,0x83,0x01,0x80,0x06,0x80,0x07,0x00,0xE0,0xC3,
+  0x00,0xC0,0x81,0x0B,0x80,0x06,0x81,0x07,0x00,0x30,0x80,0x02,0x80,0x03,0xC9,0xC7,
+  0x00,0x00,0xC7,0x02,0x76,0xD0,0x81,0x0B,0x81,0x0C,0x03,0xD7,0x69,0x80,0x08,0x82,
+  0x0A,0x80,0x08,0x81,0x0A,0x80,0x08,0x03,0x5A,0x85,0x80,0x02,0xC3,0x01,0x26,0x80,
+  0x07,0xC6,0x00,0xB0,0xC3,0x04,0x71,0x43,0x20,0xC9,0xCF,0x81,0x06,0x81,0x0B,0x81,
+  0x0C,0x03,0xD7,0xEA,0x80,0x08,0x80,0x0A,0x08,0xBA,0x9A,0x58,0xA9,0xA0,0x80,0x08,
+  0x00,0x50,0x80,0x08,0x00,0x50,0x84,0x02,0x05,0x14,0x67,0xED,0x81,0x0C,0x81,0x0B,
+  0xC3,0x00,0x70,0x80,0x04,0x01,0x24,0xC8,0xC8,0x81,0x02,0x00,0x40,0xC3,0x00,0xD0,
+  0x81,0x0B,0x81,0x0C,0x01,0xE7,0x80,0x06,0x01,0x85,0x80,0x0A,0xC3,0x80,0x08,0x02,
+  0x58,0xA0,0x85,0x08,0x01,0x42,0xC4,0x01,0x24,0x81,0x07,0x82,0x0C,0xC6,0x04,0x54,
+  0x34,0x20,0xC7,0xC6,0x00,0x10,0x82,0x02,0xC6,0x00,0xB0,0x81,0x0C,0x0C,0x67,0x63,
+  0x5A,0x89,0xBD,0xA9,0x80,0x81,0x05,0x03,0x8A,0x8A,0x81,0x08,0x04,0xA5,0x83,0x20,
+  0xC5,0x04,0x26,0x7E,0xD0,0xC4,0x00,0xA0,0xC3,0x06,0x12,0x43,0x10,0x10,0xC4,0xC7,
+  0x81,0x02,0x00,0x60,0x81,0x07,0xC6,0x05,0xE7,0x61,0x3A,0x81,0x08,0x00,0x90,0xC3,
+  0x01,0x8A,0x80,0x0B,0x04,0xEB,0xAB,0x50,0x80,0x08,0x80,0x05,0x01,0x32,0xC6,0x01,
+  0x26,0x80,0x07,0x00,0xD0,0x80,0x0C,0x00,0xD0,0x80,0x0B,0x80,0x06,0x80,0x07,0x02,
+  0x53,0x20,0x80,0x04,0x03,0x31,0x31,0xC2,0xC5,0x01,0x12,0xC6,0x00,0xA0,0xC4,0x06,
+  0xD7,0x62,0x16,0x80,0x81,0x05,0x81,0x08,0x02,0xBA,0xB0,0x83,0x0E,0x03,0xBA,0xB8,
+  0x81,0x05,0x80,0x03,0x82,0x02,0x00,0x60,0xC5,0x00,0x70,0xC6,0x00,0x60,0x80,0x07,
+  0x01,0x51,0x80,0x02,0x80,0x04,0x02,0x23,0x10,0xC1,0xC4,0x00,0x00,0xC3,0x00,0x50,
+  0xC8,0x03,0xD7,0x63,0x80,0x02,0x00,0x80,0x81,0x05,0x00,0xA0,0x80,0x0B,0x01,0xEB,
+  0x81,0x0E,0x00,0xB0,0xC3,0x81,0x0A,0x00,0x50,0xC3,0x00,0x20,0xC7,0x03,0x26,0x7E,
+  0xC4,0x00,0xD0,0xC3,0x07,0x32,0x32,0x32,0x41,0xC1,0xC4,0x04,0x12,0x42,0x40,0xCB,
+  0x03,0x61,0x24,0x81,0x05,0x01,0xAE,0xCB,0x03,0xBA,0xBA,0x81,0x05,0x01,0x32,0xC7,
+  0x00,0x40,0x80,0x06,0xC3,0x00,0xD0,0xC5,0x02,0x51,0x50,0x80,0x03,0x80,0x04,0x00,
+  0x20,0xC1,0xC3,0x00,0x00,0xC7,0x00,0x60,0xC4,0x03,0xE7,0x61,0x80,0x02,0x01,0x48,
+  0x80,0x05,0x00,0xB0,0xCD,0x00,0x70,0x81,0x0A,0x80,0x08,0x00,0x50,0x82,0x02,0x00,
+  0x60,0x83,0x02,0x00,0x40,0x80,0x06,0x00,0x70,0xC4,0x01,0xA6,0x81,0x07,0x07,0xAE,
+  0xA5,0x24,0x31,0xC0,0xC4,0x01,0x24,0x80,0x02,0xC5,0x00,0xB0,0x80,0x0C,0x02,0xD7,
+  0x60,0x82,0x02,0x04,0x48,0x58,0xE0,0xC9,0x00,0xB0,0x80,0x0E,0x00,0xF0,0x81,0x0E,
+  0x01,0x9A,0x80,0x05,0x01,0x32,0xC6,0x00,0x60,0x80,0x02,0xC4,0x00,0xC0,0xC5,0x06,
+  0xBE,0x73,0x12,0x30,0xC1,0xC3,0x00,0x10,0xC6,0x00,0x60,0xC4,0x02,0x76,0x40,0xC3,
+  0x04,0x48,0x58,0xB0,0x83,0x0E,0x00,0xB0,0x80,0x0E,0x00,0xB0,0xC3,0x01,0xD9,0x80,
+  0x0D,0x04,0x98,0xA5,0x30,0xC8,0x81,0x02,0x80,0x07,0x00,0xD0,0xC3,0x01,0xA6,0x80,
+  0x07,0x07,0xAE,0x70,0x34,0x31,0xC0,0xC2,0x02,0x03,0x40,0x80,0x02,0x00,0x50,0x80,
+  0x07,0x01,0x6A,0x80,0x0B,0x80,0x0C,0x03,0xDE,0x61,0xC4,0x80,0x05,0x00,0x80,0x82,
+  0x0E,0x00,0xB0,0xC4,0x80,0x0E,0x02,0xD9,0x80,0x80,0x05,0x00,0x90,0x80,0x0A,0x80,
+  0x05,0x80,0x01,0x00,0x20,0x80,0x06,0x80,0x02,0x01,0x62,0xC4,0x01,0x67,0x80,0x0C,
+  0x00,0xD0,0x80,0x0B,0x00,0x60,0x82,0x0A,0x04,0x51,0x32,0x30,0x80,0x00,0xC3,0x02,
+  0x24,0x20,0xC6,0x00,0xD0,0x80,0x0C,0x80,0x07,0x00,0x20,0xC5,0x81,0x05,0x00,0xB0,
+  0x86,0x0E,0x03,0xBE,0xDA,0xC4,0x81,0x0A,0x80,0x05,0x05,0x38,0xDC,0x9C,0x82,0x06,
+  0x00,0x40,0x80,0x02,0x04,0x7E,0xDC,0xD0,0x80,0x0B,0x00,0xD0,0x80,0x0A,0x00,0xB0,
+  0x80,0x05,0x00,0x10,0x80,0x04,0x01,0x10,0xC0,0xC2,0x01,0x14,0x80,0x02,0x00,0x30,
+  0xC7,0x00,0xD0,0xC5,0x81,0x02,0x00,0x40,0x80,0x05,0x00,0xA0,0x82,0x0E,0x81,0x0D,
+  0x80,0x0E,0x00,0xD0,0x80,0x0A,0x03,0xB7,0xB7,0x81,0x0A,0x81,0x05,0x06,0x8D,0xFC,
+  0xDF,0xD0,0x80,0x0F,0x08,0xCD,0x82,0x67,0x6F,0xD0,0x81,0x0B,0x00,0xA0,0x80,0x0E,
+  0x05,0x50,0x32,0x31,0x80,0x00,0xC1,0x05,0x01,0x43,0x25,0x80,0x07,0x01,0x6A,0x80,
+  0x0B,0x80,0x0C,0x02,0xE7,0x40,0xC7,0x00,0x30,0x80,0x05,0x02,0xBE,0xD0,0x80,0x08,
+  0x80,0x05,0x09,0x8A,0x98,0x7A,0xBA,0xB7,0x80,0x0A,0x00,0xB0,0x80,0x05,0x00,0x90,
+  0x81,0x0D,0x00,0x90,0x80,0x0D,0x00,0xC0,0x80,0x0F,0x80,0x0D,0x03,0x96,0x7E,0x81,
+  0x0D,0x80,0x0B,0x04,0xAE,0x75,0x10,0x80,0x04,0x00,0x10,0x80,0x00,0xC0,0xC4,0x01,
+  0x32,0xC8,0x02,0x76,0x40,0xC7,0x00,0x10,0x80,0x05,0x80,0x0D,0x03,0xA7,0xA7,0x80,
+  0x05,0x02,0xAE,0xA0,0x81,0x05,0x00,0x70,0xC3,0x81,0x05,0x00,0x90,0x80,0x0D,0xC4,
+  0x00,0xD0,0x81,0x0F,0x08,0x94,0x67,0xEC,0xDB,0xA0,0x80,0x0E,0x05,0x75,0x12,0x41,
+  0x80,0x00,0xC0,0xC4,0x01,0x21,0x81,0x07,0x00,0x60,0xC4,0x00,0xE0,0xC9,0x00,0x30,
+  0x80,0x05,0x80,0x0A,0xC3,0x03,0x7A,0x5B,0xC3,0x81,0x0A,0x01,0xB7,0x81,0x05,0x80,
+  0x09,0x00,0xC0,0x84,0x0D,0x02,0xFD,0xC0,0x81,0x0D,0x80,0x0E,0x80,0x0C,0x05,0xBA,
+  0xEB,0x50,0x80,0x03,0x00,0x10,0x80,0x00,0xC1,0xC2,0x01,0x32,0x80,0x03,0x80,0x07,
+  0x80,0x06,0xC3,0x02,0xD7,0x60,0xC9,0x03,0x15,0xA8,0x80,0x0A,0x00,0xB0,0xC3,0x00,
+  0xA0,0xC5,0x00,0xE0,0xC5,0x00,0x80,0x80,0x0D,0x00,0xC0,0x81,0x0D,0x00,0xC0,0x82,
+  0x0D,0x05,0xFD,0xEA,0xCD,0x80,0x0A,0x06,0xE7,0x50,0x42,0x10,0x80,0x00,0xC1,0xC2,
+  0x03,0x34,0x23,0x81,0x07,0x00,0x90,0x80,0x0B,0x80,0x0C,0x02,0xE7,0x40,0xC3,0x82,
+  0x02,0x01,0x42,0x80,0x03,0x00,0x50,0x80,0x0A,0x02,0x57,0xA0,0xC5,0x00,0xB0,0xC3,
+  0x00,0xA0,0xC3,0x02,0x3D,0xF0,0x80,0x0D,0x00,0xF0,0x86,0x0D,0x80,0x0E,0x02,0xAD,
+  0xE0,0x80,0x0A,0x05,0xB5,0x13,0x43,0x81,0x00,0xC1,0xC1,0x03,0x12,0x32,0xC5,0x00,
+  0xB0,0x80,0x0C,0x00,0x60,0xC5,0x00,0x40,0xC4,0x0A,0x41,0x5A,0xBA,0x7A,0x5A,0xB0,
+  0x81,0x0E,0x01,0x7B,0x85,0x0A,0x00,0x50,0x80,0x0D,0x82,0x0F,0xC3,0x80,0x0D,0x02,
+  0xC9,0xA0,0x82,0x0E,0x07,0xA7,0xA5,0x13,0x21,0x80,0x00,0xC2,0xC3,0x01,0x48,0xC3,
+  0x00,0xA0,0xC3,0x00,0xE0,0xC4,0x00,0x20,0xC3,0x80,0x02,0x0A,0x49,0x85,0xAE,0xBA,
+  0xBA,0xE0,0x83,0x0A,0x02,0x9A,0xE0,0x81,0x0A,0x01,0x7A,0xCC,0x00,0xA0,0x83,0x0E,
+  0x80,0x0A,0x06,0x75,0x14,0x31,0x00,0xC3,0xC3,0x80,0x04,0x00,0x50,0x80,0x07,0x01,
+  0x6A,0x80,0x0B,0x80,0x0C,0x02,0xE7,0x60,0x80,0x02,0x00,0x40,0xC3,0x00,0x60,0x80,
+  0x02,0x00,0x40,0x80,0x0D,0x01,0x8A,0x81,0x0E,0x01,0x7B,0x80,0x0A,0x04,0xBA,0xED,
+  0xA0,0x80,0x0E,0x00,0x70,0x82,0x0A,0x81,0x0D,0xC3,0x00,0xC0,0xC3,0x01,0xDA,0x82,
+  0x0E,0x07,0xA7,0xB5,0x13,0x21,0x80,0x00,0xC3,0xC0,0x05,0x01,0x42,0x15,0x81,0x07,
+  0xC4,0x02,0x67,0x60,0xC4,0x00,0x60,0x80,0x02,0x00,0x40,0x80,0x06,0x01,0x9D,0xC3,
+  0x00,0xE0,0x80,0x0A,0x01,0x9D,0x80,0x0E,0x80,0x0D,0x00,0xA0,0x80,0x0E,0x81,0x0A,
+  0x09,0x5B,0xAF,0xDF,0xCF,0xDF,0x80,0x0D,0x03,0xFC,0x9E,0xC3,0x08,0xB7,0xA0,0x14,
+  0x31,0x00,0xC4,0xC0,0x02,0x03,0x40,0x80,0x02,0x00,0x50,0x80,0x07,0x01,0x6A,0x80,
+  0x0B,0x80,0x0C,0x02,0xE6,0x40,0x85,0x02,0x02,0x46,0xC0,0xC7,0x03,0xBA,0x9E,0x80,
+  0x0D,0x00,0x90,0xC6,0x81,0x0A,0x01,0xDF,0x80,0x0D,0x80,0x0F,0x01,0xDF,0x81,0x0D,
+  0x00,0xA0,0x81,0x0E,0x09,0xB7,0xEA,0x51,0x34,0x10,0xC5,0xC0,0x05,0x01,0x43,0x25,
+  0x80,0x07,0x03,0x6A,0xBD,0x80,0x0C,0x02,0xE6,0x40,0x80,0x02,0x80,0x04,0x80,0x02,
+  0x03,0x69,0xD9,0x80,0x0D,0x00,0xC0,0x80,0x0D,0x01,0x9A,0x82,0x0E,0x02,0xAB,0xA0,
+  0x82,0x0E,0x00,0xB0,0x80,0x0A,0x01,0x5B,0x80,0x0A,0x00,0xD0,0x80,0x0F,0x07,0xDF,
+  0xDF,0xDF,0xC9,0xC4,0x08,0xA7,0xA0,0x34,0x21,0x00,0xC5,0x80,0x00,0x05,0x13,0x21,
+  0x57,0xC3,0x00,0xB0,0x80,0x0C,0x04,0x67,0x62,0x40,0x80,0x02,0x80,0x04,0x83,0x0D,
+  0x02,0xFD,0xE0,0x80,0x0D,0x00,0x90,0x81,0x0A,0xC3,0x01,0xEA,0xC3,0x00,0x70,0x81,
+  0x0A,0x08,0xED,0xFC,0xFC,0xDF,0xC0,0x81,0x0D,0x00,0xA0,0x80,0x0E,0x04,0xB7,0xBA,
+  0x50,0x80,0x03,0x02,0x41,0x00,0xC6,0x80,0x00,0x00,0x10,0x80,0x04,0x02,0x23,0x70,
+  0xC3,0x00,0xB0,0xC3,0x00,0x60,0x80,0x02,0x03,0x42,0x46,0x80,0x0D,0x00,0xC0,0xC4,
+  0x81,0x0D,0x00,0x90,0xC5,0x05,0xEA,0xBE,0x78,0x81,0x0A,0x02,0x7A,0xF0,0x83,0x0D,
+  0x00,0xC0,0x82,0x0D,0x03,0xAE,0xB7,0x81,0x0A,0x05,0x51,0x34,0x10,0xC6,0x80,0x00,
+  0x04,0x34,0x23,0x50,0x81,0x07,0x00,0x90,0x80,0x0B,0x80,0x0C,0x04,0xD7,0x62,0x40,
+  0x80,0x02,0x01,0x49,0x80,0x0D,0x01,0xFD,0x84,0x0F,0x81,0x0D,0x00,0x90,0xC3,0x00,
+  0xB0,0xC3,0x05,0x8A,0xB7,0xB9,0x80,0x0F,0x01,0xDC,0x82,0x0D,0x02,0x9C,0x90,0x80,
+  0x0A,0x00,0xE0,0x82,0x0A,0x05,0x92,0x14,0x21,0xC6,0xC6,0x80,0x07,0x80,0x06,0x01,
+  0xAB,0x80,0x0C,0x04,0xD7,0x64,0x20,0x80,0x04,0x00,0x90,0x80,0x0D,0x00,0xF0,0x81,
+  0x0D,0x80,0x0F,0xC4,0x80,0x0D,0x00,0x90,0x80,0x0A,0x00,0x70,0x80,0x0A,0x09,0x9A,
+  0x5A,0x7B,0x7A,0x9D,0xC4,0x84,0x09,0x04,0xA7,0xB7,0xA0,0x80,0x0D,0x01,0x32,0x80,
+  0x04,0x00,0x10,0xC6,0xC0,0x02,0x34,0x20,0x80,0x03,0x80,0x0A,0x08,0xBA,0x6A,0xBF,
+  0xCD,0x70,0x80,0x06,0x03,0x23,0x9F,0x80,0x0D,0x00,0xF0,0x81,0x0D,0xC4,0x0B,0xFC,
+  0xDF,0xD8,0x78,0xA8,0x75,0x81,0x0A,0x04,0x7A,0x8D,0xF0,0x81,0x0D,0x02,0xC9,0x80,
+  0x81,0x09,0x02,0xCD,0xB0,0x81,0x0A,0x81,0x0D,0x04,0x31,0x42,0x10,0xC6,0xC0,0x01,
+  0x13,0x80,0x02,0x00,0x30,0x80,0x0A,0x01,0x7E,0x80,0x0A,0x01,0xBE,0x80,0x0C,0x05,
+  0xE7,0x62,0x49,0x84,0x0D,0x82,0x0F,0x02,0xCD,0xF0,0x80,0x0D,0x09,0xC9,0xAB,0xA5,
+  0xA5,0xA7,0x80,0x0A,0x80,0x05,0x00,0xA0,0xC3,0x80,0x09,0x01,0x48,0x80,0x09,0x04,
+  0x49,0xDF,0xE0,0x83,0x0D,0x04,0x43,0x24,0x30,0xC6,0xC0,0x06,0x13,0x43,0x13,0xE0,
+  0x80,0x07,0x01,0xAE,0x80,0x0B,0x01,0xDC,0x80,0x07,0x04,0x62,0x49,0xA0,0x82,0x0D,
+  0x82,0x0F,0x02,0xCD,0xF0,0x82,0x0D,0x00,0x90,0x80,0x0A,0x00,0x70,0xC3,0x05,0x5A,
+  0x5B,0x59,0x80,0x0D,0x01,0xC9,0x81,0x08,0x01,0x4C,0x81,0x04,0x00,0xC0,0x80,0x0F,
+  0x83,0x0D,0x05,0x83,0x24,0x31,0xC5,0xC1,0x09,0x12,0x42,0x15,0xBE,0x7A,0x80,0x0B,
+  0x09,0xED,0xFE,0x72,0x3A,0xEA,0x81,0x0D,0x82,0x0F,0x80,0x0D,0x00,0xF0,0x80,0x0D,
+  0x08,0xCD,0x9A,0x5A,0x5A,0x50,0x80,0x0A,0x05,0x57,0x58,0x9C,0x80,0x08,0x03,0x48,
+  0x4C,0x81,0x04,0x04,0x83,0x8D,0xF0,0x80,0x0D,0x82,0x09,0x04,0x23,0x42,0x10,0xC5,
+  0xC1,0x07,0x13,0x42,0x35,0xAE,0x80,0x0A,0x02,0xEB,0xE0,0x80,0x0D,0x06,0x67,0x64,
+  0xEA,0x90,0x80,0x0D,0x07,0xFC,0xDC,0xDF,0xDC,0x81,0x0D,0x80,0x09,0x01,0x85,0x80,
+  0x0A,0x01,0x5B,0x80,0x05,0x00,0x70,0x80,0x05,0x07,0x89,0x84,0x84,0x84,0x82,0x03,
+  0x02,0x43,0x40,0x80,0x0D,0x00,0xC0,0x80,0x09,0x07,0xC9,0x82,0x14,0x31,0xC5,0xC2,
+  0x01,0x14,0x80,0x03,0x05,0x15,0xAE,0xAE,0x80,0x0B,0x80,0x0D,0x80,0x0E,0x80,0x06,
+  0x04,0xAE,0x9D,0xC0,0x80,0x0D,0x00,0xF0,0xC7,0x01,0xC8,0x80,0x0A,0x80,0x05,0x00,
+  0x70,0xC3,0x80,0x05,0x01,0x48,0x81,0x03,0x80,0x04,0x01,0x34,0x80,0x0D,0x04,0x83,
+  0x23,0x90,0x80,0x0D,0x03,0x89,0x49,0x81,0x04,0x03,0x24,0x31,0xC4,0xC3,0x05,0x32,
+  0x42,0x1A,0x80,0x0E,0x03,0xAE,0xAE,0x80,0x0F,0x01,0xE7,0x80,0x0E,0x00,0xA0,0xC3,
+  0x80,0x0D,0x01,0x9C,0x81,0x0D,0x00,0xC0,0x80,0x0D,0x00,0x90,0x80,0x08,0xC7,0x00,
+  0x50,0x81,0x03,0x01,0x48,0x80,0x04,0x80,0x03,0x00,0x90,0x80,0x0F,0x03,0xD3,0x14,
+  0x81,0x09,0x01,0x49,0x80,0x04,0x00,0x80,0x80,0x04,0x04,0x32,0x43,0x10,0xC3,0xC3,
+  0x00,0x10,0x80,0x03,0x02,0x41,0x50,0x80,0x0E,0x01,0x7A,0xC5,0x80,0x0E,0x80,0x0A,
+  0x03,0xDC,0x9C,0x81,0x09,0x00,0xD0,0x82,0x09,0x03,0xC9,0x84,0xC3,0x80,0x05,0x01,
+  0x31,0x82,0x03,0x02,0x9F,0x90,0x80,0x03,0x01,0x4C,0x81,0x0F,0x05,0x41,0x49,0x48,
+  0x84,0x04,0x05,0x34,0x32,0x41,0xC3,0xC6,0x04,0x42,0x17,0xE0,0xC6,0x81,0x0E,0x80,
+  0x0A,0x81,0x0D,0x80,0x09,0x01,0xC6,0x80,0x09,0x01,0x49,0x80,0x08,0x02,0x48,0x40,
+  0x80,0x05,0x05,0x13,0x13,0x89,0x82,0x03,0x05,0xCF,0xC3,0x18,0x80,0x0F,0x05,0xDF,
+  0xD2,0x49,0x85,0x04,0x80,0x03,0x00,0x20,0x80,0x03,0x02,0x23,0x10,0xC2,0xC4,0x01,
+  0x13,0x80,0x04,0x80,0x01,0x01,0xAE,0xC4,0x81,0x0E,0x02,0xB7,0x90,0x81,0x0D,0x00,
+  0xC0,0x81,0x09,0x02,0x4C,0x90,0x82,0x04,0x82,0x03,0x80,0x09,0x01,0x38,0x80,0x0F,
+  0x00,0x90,0x80,0x03,0x03,0x19,0xFD,0x80,0x01,0x00,0x90,0x83,0x0F,0x03,0x82,0x48,
+  0x81,0x04,0x83,0x03,0x82,0x04,0x00,0x30,0xC3,0xCA,0x02,0x0A,0xB0,0x85,0x0E,0x80,
+  0x0A,0x00,0xD0,0x84,0x09,0x01,0x69,0x81,0x04,0x00,0x80,0x80,0x04,0x80,0x09,0x05,
+  0x38,0xFD,0x39,0x81,0x0F,0x05,0x41,0x39,0xFD,0x80,0x03,0x00,0xD0,0x80,0x0F,0x05,
+  0xDF,0xD9,0x14,0x80,0x03,0x00,0x10,0x80,0x03,0x00,0x80,0x80,0x03,0x02,0xDF,0x80,
+  0x80,0x02,0x01,0x31,0xC2,0xC7,0x00,0x20,0x80,0x04,0x01,0x15,0x84,0x0E,0x01,0xBA,
+  0x80,0x0E,0x05,0xD9,0x49,0x48,0x81,0x04,0x80,0x08,0x0A,0x9C,0xD9,0xFC,0x4C,0xF8,
+  0x40,0x80,0x0F,0x05,0xDF,0x82,0x19,0x84,0x0F,0x05,0x41,0x34,0x31,0x80,0x04,0x00,
+  0x80,0x80,0x04,0x0A,0x9F,0xC3,0xDF,0x91,0x42,0x10,0xC2,0xCA,0x03,0x41,0x7B,0x80,
+  0x0E,0x01,0xBE,0x80,0x0A,0x05,0xEF,0xC8,0x48,0x80,0x04,0x0F,0x94,0x3C,0xDC,0xDF,
+  0x9D,0xF9,0xDF,0x38,0x83,0x0F,0x02,0x41,0x90,0x80,0x0F,0x04,0xDC,0x81,0x00,0x80,
+  0x01,0x08,0x04,0x82,0x3D,0xF8,0xC0,0x80,0x0F,0x07,0x9D,0xFC,0x12,0x41,0xC2,0xC8,
+  0x06,0x32,0x41,0x57,0xB0,0x80,0x0A,0x02,0x7A,0xE0,0x81,0x0D,0x00,0xC0,0x81,0x04,
+  0x0A,0x9F,0xC1,0xDF,0x9D,0xF8,0xC0,0x82,0x0F,0x01,0x3C,0x83,0x0F,0x05,0x82,0x48,
+  0x43,0x80,0x00,0x00,0x10,0x80,0x04,0x01,0x34,0x80,0x0F,0x01,0x34,0x80,0x0F,0x01,
+  0x49,0x83,0x0F,0x04,0x92,0x34,0x10,0xC2,0xC8,0x05,0x14,0x23,0x15,0x81,0x0A,0x00,
+  0xB0,0x81,0x0D,0x00,0xC0,0x80,0x0D,0x03,0x83,0x19,0x80,0x0F,0x00,0x40,0x80,0x0F,
+  0x04,0x4D,0xF6,0x40,0x81,0x0F,0x08,0x93,0xDF,0x93,0x98,0x40,0x80,0x02,0x81,0x01,
+  0x01,0x3D,0x80,0x0F,0x00,0xD0,0x80,0x04,0x80,0x0F,0x01,0x89,0x80,0x0F,0x01,0x8C,
+  0x83,0x0F,0x04,0xD1,0x24,0x10,0xC2,0xC9,0x08,0x34,0x23,0x15,0x7A,0x90,0x80,0x0D,
+  0x00,0x90,0x82,0x0D,0x0D,0x41,0x4D,0xFD,0xFD,0x1D,0xF9,0x1D,0x80,0x0F,0x03,0x84,
+  0x98,0x83,0x01,0x02,0x34,0x90,0x80,0x04,0x00,0xD0,0x82,0x0F,0x02,0xD8,0xD0,0x83,
+  0x0F,0x02,0x89,0xF0,0x80,0x0D,0x80,0x0F,0x04,0xD2,0x34,0x10,0xC2,0xC8,0x03,0x01,
+  0x43,0x80,0x02,0x02,0x39,0xD0,0x81,0x09,0x00,0xC0,0x81,0x0D,0x80,0x09,0x02,0x21,
+  0xC0,0x81,0x0F,0x16,0x91,0xDF,0xD1,0x4D,0x81,0x41,0x01,0x23,0x21,0x4D,0xF9,0xD0,
+  0x80,0x0F,0x01,0x49,0x80,0x0F,0x01,0xCD,0x80,0x0F,0x00,0xD0,0x80,0x0F,0x0B,0x94,
+  0xFD,0x4D,0xF8,0x23,0x42,0xC2,0xC9,0x01,0x01,0x80,0x04,0x81,0x03,0x00,0x90,0x80,
+  0x0D,0x01,0x9D,0x80,0x09,0x00,0x80,0x80,0x09,0x02,0x41,0x40,0x81,0x0F,0x06,0x81,
+  0x9D,0x43,0x40,0x82,0x01,0x02,0x39,0xD0,0x81,0x04,0x09,0x24,0xDF,0x9D,0xFD,0x01,
+  0x80,0x0F,0x04,0x9D,0xF9,0x00,0x80,0x0F,0x03,0xC4,0xE9,0x80,0x03,0x80,0x01,0x03,
+  0x32,0x43,0xC2,0xCB,0x05,0x32,0x32,0x13,0x80,0x09,0x00,0xC0,0x80,0x09,0x81,0x04,
+  0x00,0x80,0x81,0x04,0x02,0xDF,0x90,0x80,0x02,0x80,0x01,0x05,0x02,0x13,0x8D,0x80,
+  0x04,0x80,0x0F,0x01,0x42,0x80,0x03,0x03,0x4D,0xFD,0x80,0x0F,0x02,0xD3,0x40,0x80,
+  0x0F,0x07,0x8D,0xF9,0x19,0xD4,0x80,0x03,0x01,0x12,0x80,0x01,0x03,0x34,0x34,0x80,
+  0x01,0xC1,0xCB,0x02,0x12,0x40,0x80,0x03,0x01,0x13,0x80,0x08,0x81,0x04,0x02,0x94,
+  0x80,0x80,0x04,0x00,0x20,0x82,0x01,0x00,0x30,0x80,0x04,0x03,0x98,0x24,0x80,0x0F,
+  0x01,0xD9,0x80,0x0F,0x08,0x43,0x42,0x19,0xF9,0xC0,0x80,0x0F,0x00,0xD0,0x80,0x0F,
+  0x04,0xD3,0x6D,0x80,0x80,0x02,0x80,0x01,0x03,0x31,0x23,0x81,0x04,0x03,0x21,0x21,
+  0xC2,0xCA,0x80,0x00,0x06,0x32,0x42,0x41,0x20,0x85,0x04,0x80,0x03,0x81,0x01,0x80,
+  0x03,0x00,0x80,0x82,0x0F,0x01,0x94,0x81,0x0F,0x00,0xD0,0x80,0x0F,0x09,0x82,0x31,
+  0x4D,0xFD,0x4D,0x81,0x0F,0x03,0xD3,0x13,0x80,0x01,0x80,0x03,0x01,0x23,0x81,0x04,
+  0x01,0x23,0x80,0x01,0x80,0x00,0xC4,0xCA,0x81,0x00,0x03,0x13,0x42,0x80,0x03,0x81,
+  0x04,0x83,0x03,0x05,0x49,0xDF,0xDC,0x80,0x0F,0x00,0xD0,0x81,0x0F,0x01,0x4D,0x83,
+  0x0F,0x03,0x82,0x39,0x81,0x0F,0x00,0x90,0x80,0x01,0x80,0x08,0x07,0x40,0x14,0x21,
+  0x42,0x80,0x04,0x01,0x23,0x80,0x01,0x83,0x00,0xC5,0xCA,0x81,0x00,0x04,0x13,0x23,
+  0x40,0x82,0x01,0x04,0x48,0x93,0x90,0x82,0x0F,0x80,0x0D,0x03,0xFD,0x13,0x80,0x0F,
+  0x03,0x9D,0xFD,0x81,0x0F,0x03,0xC1,0x29,0x80,0x0F,0x03,0x83,0x23,0x82,0x01,0x80,
+  0x04,0x03,0x34,0x23,0x80,0x01,0x88,0x00,0xC4,0xCA,0x81,0x00,0x04,0x13,0x42,0x30,
+  0x80,0x04,0x04,0xD9,0x4D,0xF0,0x80,0x04,0x81,0x0F,0x06,0xD3,0xDF,0x90,0x10,0x80,
+  0x0F,0x02,0x9D,0xF0,0x80,0x09,0x80,0x0F,0x01,0x82,0x81,0x03,0x81,0x01,0x07,0x32,
+  0x42,0x34,0x23,0x81,0x01,0x88,0x00,0xC7,0xCA,0x81,0x00,0x05,0x14,0x23,0x4D,0x80,
+  0x0F,0x01,0xD8,0x80,0x0F,0x07,0xC1,0x3D,0xF9,0x0D,0x80,0x0F,0x01,0x69,0x80,0x0F,
+  0x0A,0x4D,0xF8,0x28,0x93,0x23,0x20,0x80,0x01,0x03,0x34,0x24,0x80,0x03,0x00,0x20,
+  0x80,0x01,0x87,0x00,0xCC,0xCA,0x81,0x00,0x00,0x10,0x80,0x03,0x01,0x29,0x81,0x0F,
+  0x01,0x92,0x80,0x0F,0x00,0x90,0x80,0x01,0x04,0x9F,0xD2,0x60,0x83,0x0F,0x0A,0x91,
+  0x48,0x32,0x10,0x14,0x20,0x82,0x04,0x01,0x13,0x80,0x01,0x84,0x00,0xD3,0xCA,0x81,
+  0x00,0x04,0x13,0x21,0x80,0x80,0x0F,0x11,0xDC,0x3D,0xFD,0x14,0x9F,0xD3,0x19,0xDF,
+  0xD4,0x80,0x01,0x00,0x30,0x80,0x01,0x00,0x30,0x80,0x04,0x01,0x24,0x80,0x03,0x81,
+  0x01,0x81,0x00,0xDA,0xCA,0x81,0x00,0x04,0x13,0x42,0x80,0x81,0x0F,0x02,0xD4,0xD0,
+  0x81,0x0F,0x07,0xD9,0xFD,0x42,0x13,0x81,0x01,0x08,0x34,0x23,0x42,0x42,0x30,0x80,
+  0x01,0xE1,0xCA,0x82,0x00,0x03,0x32,0x14,0x81,0x0F,0x02,0xD9,0xD0,0x81,0x0F,0x02,
+  0x94,0x80,0x81,0x03,0x00,0x20,0x80,0x01,0x80,0x03,0x00,0x20,0x80,0x04,0x02,0x23,
+  0x10,0xE6,0xCA,0x81,0x00,0x80,0x01,0x02,0x43,0x40,0x82,0x0F,0x00,0xD0,0x81,0x09,
+  0x80,0x03,0x81,0x01,0x00,0x20,0x83,0x04,0x01,0x23,0x80,0x01,0xE9,0xCA,0x82,0x00,
+  0x08,0x32,0x34,0xDF,0xD9,0x30,0x81,0x01,0x03,0x01,0x42,0x80,0x04,0x02,0x23,0x20,
+  0x80,0x01,0xED,0xCA,0x82,0x00,0x05,0x32,0x42,0x41,0x80,0x00,0x02,0x12,0x30,0x82,
+  0x04,0x80,0x03,0x80,0x01,0xF0,0x00,0x00,0xCB,0x81,0x00,0x03,0x14,0x34,0x80,0x01,
+  0x82,0x04,0x02,0x24,0x20,0x81,0x01,0xF4,0xCE,0x02,0x14,0x20,0x81,0x04,0x02,0x23,
+  0x20,0x80,0x01,0xF9,0xCE,0x04,0x13,0x23,0x20,0x80,0x01,0xFD,0xCF,0x80,0x01,0xFF,
+  0xC1,
+};
+
+static const RleFrame spaceman_keyframe = { 0, 0, 120, 120, spaceman_palette, 16, 4, spaceman_key_rle, 3741, false };
+
+static const RleFrame spaceman_deltas[SPACEMAN_FRAME_COUNT] = {
+  { 18, 22, 85, 83, spaceman_palette, 16, 4, spaceman_delta_0_rle, 3875, true },
+  { 16, 22, 86, 82, spaceman_palette, 16, 4, spaceman_delta_1_rle, 3885, true },
+  { 16, 22, 86, 82, spaceman_palette, 16, 4, spaceman_delta_2_rle, 3500, true },
+  { 18, 22, 85, 80, spaceman_palette, 16, 4, spaceman_delta_3_rle, 3937, true },
+  { 18, 24, 84, 81, spaceman_palette, 16, 4, spaceman_delta_4_rle, 3569, true },
+};
+
+extern const RleAnimation spaceman_rle;
+const RleAnimation spaceman_rle = { 120, 120, SPACEMAN_FRAME_COUNT, &spaceman_keyframe, spaceman_deltas };
+
+static const AnimationFrame spaceman_animation_frames[SPACEMAN_FRAME_COUNT] = {
+  { &spaceman_deltas[0], 200 },
+  { &spaceman_deltas[1], 200 },
+  { &spaceman_deltas[2], 200 },
+  { &spaceman_deltas[3], 200 },
+  { &spaceman_deltas[4], 200 },
+};
+
+extern const Animation spaceman_animation;
+const Animation spaceman_animation = { spaceman_animation_frames, SPACEMAN_FRAME_COUNT, true, &spaceman_keyframe };
+
+#endif // SPACEMAN_RLE_H
@@ -0,0 +1,44 @@
+/*
+ * Timing helpers shared by the host/target benchmarks in this directory.
+ * On the C3 (`pio test -e c3-bench`) times come from micros(); on the
+ * host (`pio test -e native`) from the steady clock.
+ */
+
+#ifndef TEST_BENCH_H
+#define TEST_BENCH_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <unity.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+inline uint32_t benchMicros() { return micros(); }
+#else
+#include <chrono>
+inline uint32_t benchMicros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+// Keeps benchmark results alive so the loops are not optimized away
+static volatile uint32_t benchSink;
+
+// Average microseconds per call of fn() over `runs` calls
+template <typename Fn>
+float benchRun(uint16_t runs, Fn fn) {
+  fn();  // Warm caches (flash on the C3)
+  uint32_t start = benchMicros();
+  for (uint16_t i = 0; i < runs; i++) fn();
+  return (float)(benchMicros() - start) / runs;
+}
+
+inline void benchReport(const char* name, float before, float after) {
+  char line[96];
+  snprintf(line, sizeof(line), "%s: %.1f us -> %.1f us (%.1fx)", name, before, after,
+           after > 0 ? before / after : 0.0f);
+  TEST_MESSAGE(line);
+}
+
+#endif // TEST_BENCH_H
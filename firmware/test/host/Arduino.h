@@ -0,0 +1,42 @@
+/*
+ * Host stand-in for the few Arduino-core names the pure modules use
+ * (FixedMath, PixelKernels, RleFrame, AssetPack, TextFormat, ...), so they
+ * build for `pio test -e native`. Flash and RAM are one address space on
+ * the host, and Serial goes to stdout.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define memcpy_P          memcpy
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+struct HostSerial {
+  void println(const char* text) { puts(text); }
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+  }
+};
+static HostSerial Serial __attribute__((unused));
+
+#endif // HOST_ARDUINO_H
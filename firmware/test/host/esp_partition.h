@@ -0,0 +1,61 @@
+/*
+ * Host stand-in for the ESP-IDF partition API that AssetPack maps its
+ * partition with. Tests hand it a buffer with hostPartitionSet(); "mapping"
+ * returns a pointer into that buffer.
+ */
+
+#ifndef HOST_ESP_PARTITION_H
+#define HOST_ESP_PARTITION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int esp_err_t;
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+enum esp_partition_type_t { ESP_PARTITION_TYPE_DATA = 0x01 };
+enum esp_partition_subtype_t { ESP_PARTITION_SUBTYPE_DATA_SPIFFS = 0x82 };
+enum spi_flash_mmap_memory_t { SPI_FLASH_MMAP_DATA };
+
+struct esp_partition_t {
+  uint32_t size;
+};
+
+struct HostPartition {
+  esp_partition_t partition;
+  const uint8_t* data;  // nullptr: no partition
+  int mapped;           // Mappings not yet released
+};
+
+inline HostPartition& hostPartition() {
+  static HostPartition state = { { 0 }, nullptr, 0 };
+  return state;
+}
+
+inline void hostPartitionSet(const uint8_t* data, uint32_t size) {
+  hostPartition().data = data;
+  hostPartition().partition.size = size;
+}
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t,
+                                                       const char*) {
+  return hostPartition().data ? &hostPartition().partition : nullptr;
+}
+
+inline esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                                    spi_flash_mmap_memory_t, const void** out, spi_flash_mmap_handle_t* handle) {
+  if (offset + size > partition->size) return ESP_FAIL;
+  *out = hostPartition().data + offset;
+  *handle = 1;
+  hostPartition().mapped++;
+  return ESP_OK;
+}
+
+inline void spi_flash_munmap(spi_flash_mmap_handle_t) {
+  hostPartition().mapped--;
+}
+
+#endif // HOST_ESP_PARTITION_H
@@ -0,0 +1,297 @@
+/*
+ * AssetPack against a pack image in the tools/asset_pack.py layout, mapped
+ * from RAM through test/host/esp_partition.h: a good pack plays back its
+ * source frames (keyframe plus deltas, over two loops), and damaged records
+ * are refused at begin() or at the asset's first lookup instead of being
+ * decoded.
+ *
+ *   pio test -e native -f test_asset_pack
+ *
+ * Host only: on the board AssetPack maps the real partition.
+ */
+
+#include <string.h>
+#include <vector>
+#include <unity.h>
+#include "AssetPack.h"
+
+static const uint16_t W = 6;
+static const uint16_t H = 4;
+static const uint8_t FRAMES = 3;
+static const uint32_t PARTITION_SIZE = 4096;
+
+// Source frames, as palette indices
+static const uint8_t SOURCE[FRAMES][H * W] = {
+  { 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0,
+    0, 1, 2, 2, 1, 0,
+    0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0,
+    0, 1, 3, 3, 1, 0,
+    0, 1, 2, 2, 1, 0,
+    0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 3,
+    0, 1, 3, 3, 1, 0,
+    0, 1, 2, 2, 1, 0,
+    0, 0, 0, 0, 0, 3 },
+};
+static const uint16_t PALETTE[4] = { 0x0000, 0xFFFF, 0x1F00, 0xE007 };
+
+// Offsets in the pack, for the damage tests
+static uint32_t animOffset;
+static uint32_t frameRecord(uint8_t i) { return animOffset + 16 + 20 * i; }
+
+static std::vector<uint8_t> pack;
+static uint8_t partition[PARTITION_SIZE];
+
+static void put16(std::vector<uint8_t>& b, uint16_t v) { b.push_back(v & 0xFF); b.push_back(v >> 8); }
+static void put32(std::vector<uint8_t>& b, uint32_t v) { put16(b, v & 0xFFFF); put16(b, v >> 16); }
+static void patch16(uint32_t at, uint16_t v) { pack[at] = v & 0xFF; pack[at + 1] = v >> 8; }
+static void patch32(uint32_t at, uint32_t v) { patch16(at, v & 0xFFFF); patch16(at + 2, v >> 16); }
+static void align4(std::vector<uint8_t>& b) { while (b.size() % 4) b.push_back(0); }
+
+struct Coded {
+  uint16_t x, y, w, h;
+  std::vector<uint8_t> tokens;
+};
+
+// Like rle_frames.py, minus runs: literals for the pixels to write, copy
+// tokens (skips) for the ones a delta leaves alone
+static Coded encode(const uint8_t* prev, const uint8_t* frame) {
+  Coded c = { 0, 0, W, H, std::vector<uint8_t>() };
+  if (prev) {
+    uint16_t x0 = W, y0 = H, x1 = 0, y1 = 0;
+    for (uint16_t y = 0; y < H; y++) {
+      for (uint16_t x = 0; x < W; x++) {
+        if (prev[y * W + x] == frame[y * W + x]) continue;
+        x0 = min(x0, x); y0 = min(y0, y); x1 = max(x1, x); y1 = max(y1, y);
+      }
+    }
+    if (x0 > x1) {
+      c.w = c.h = 0;
+      return c;
+    }
+    c.x = x0; c.y = y0; c.w = x1 - x0 + 1; c.h = y1 - y0 + 1;
+  }
+  for (uint16_t y = c.y; y < c.y + c.h; y++) {
+    uint16_t x = c.x;
+    while (x < c.x + c.w) {
+      bool write = !prev || prev[y * W + x] != frame[y * W + x];
+      uint16_t n = 1;
+      while (x + n < c.x + c.w && (!prev || prev[y * W + x + n] != frame[y * W + x + n]) == write) n++;
+      if (write) {
+        c.tokens.push_back(n - 1);
+        for (uint16_t i = 0; i < n; i++) c.tokens.push_back(frame[y * W + x + i]);
+      } else {
+        c.tokens.push_back(0xC0 + n - 1);
+      }
+      x += n;
+    }
+  }
+  return c;
+}
+
+static void buildPack() {
+  Coded coded[FRAMES + 1];
+  coded[0] = encode(nullptr, SOURCE[0]);
+  for (uint8_t i = 0; i < FRAMES; i++) {
+    coded[i + 1] = encode(SOURCE[(i + FRAMES - 1) % FRAMES], SOURCE[i]);  // deltas[0]: last into first
+  }
+
+  pack.assign((const uint8_t*)"KAP2", (const uint8_t*)"KAP2" + 4);
+  put32(pack, 0);  // Size, patched below
+  put16(pack, 1);
+  put16(pack, 0);
+  const char name[ASSET_NAME_SIZE] = "blink";
+  pack.insert(pack.end(), name, name + ASSET_NAME_SIZE);
+  animOffset = pack.size() + 4;
+  put32(pack, animOffset);
+
+  uint32_t records = 16 + 20 * (FRAMES + 1);
+  std::vector<uint8_t> blobs;
+  uint32_t paletteOffset = animOffset + records;
+  for (uint16_t c : PALETTE) put16(blobs, c);
+  align4(blobs);
+
+  put16(pack, W);
+  put16(pack, H);
+  put16(pack, FRAMES);
+  put16(pack, 4);
+  pack.push_back(8);
+  pack.push_back(1);  // Loops
+  put16(pack, 0);
+  put32(pack, paletteOffset);
+  for (uint8_t i = 0; i <= FRAMES; i++) {
+    uint32_t data = coded[i].tokens.empty() ? 0 : animOffset + records + blobs.size();
+    blobs.insert(blobs.end(), coded[i].tokens.begin(), coded[i].tokens.end());
+    align4(blobs);
+    put16(pack, coded[i].x);
+    put16(pack, coded[i].y);
+    put16(pack, coded[i].w);
+    put16(pack, coded[i].h);
+    put16(pack, i ? 100 : 0);
+    pack.push_back(i ? 1 : 0);
+    pack.push_back(0);
+    put32(pack, data);
+    put32(pack, coded[i].tokens.size());
+  }
+  pack.insert(pack.end(), blobs.begin(), blobs.end());
+  patch32(4, pack.size());
+}
+
+static void mapPack() {
+  memset(partition, 0xFF, sizeof(partition));  // Erased flash
+  memcpy(partition, pack.data(), pack.size());
+  hostPartitionSet(partition, sizeof(partition));
+}
+
+void setUp() {
+  buildPack();
+  mapPack();
+}
+
+void tearDown() {
+  hostPartitionSet(nullptr, 0);
+}
+
+static RleDecoder decoder;
+
+// What drawRleFrame() does to the screen, on an index canvas
+static void apply(const RleFrame* frame, uint8_t* canvas) {
+  decoder.begin(frame);
+  while (decoder.nextRow()) {
+    uint16_t y = frame->y + decoder.rowIndex();
+    for (uint8_t s = 0; s < decoder.spans(); s++) {
+      for (uint8_t x = decoder.spanStart(s); x < decoder.spanEnd(s); x++) {
+        canvas[y * W + frame->x + x] = decoder.row()[x];
+      }
+    }
+  }
+}
+
+static void test_plays_source_frames() {
+  AssetPack assets;
+  TEST_ASSERT_TRUE(assets.begin());
+  TEST_ASSERT_EQUAL_UINT16(1, assets.getAssetCount());
+  const Animation* anim = assets.findAnimation("blink");
+  TEST_ASSERT_NOT_NULL(anim);
+  TEST_ASSERT_EQUAL_UINT8(FRAMES, anim->frameCount);
+  TEST_ASSERT_TRUE(anim->loop);
+  TEST_ASSERT_EQUAL_UINT16(PALETTE[2], anim->keyframe->palette[2]);
+
+  uint8_t canvas[H * W];
+  memset(canvas, 0xAA, sizeof(canvas));
+  apply(anim->keyframe, canvas);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(SOURCE[0], canvas, sizeof(canvas));
+  // AnimationPlayer's order: frames[i] turns frame i - 1 into frame i, and
+  // frames[0] wraps the last frame around
+  for (uint8_t step = 1; step <= 2 * FRAMES; step++) {
+    uint8_t i = step % FRAMES;
+    apply(anim->frames[i].image, canvas);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(SOURCE[i], canvas, sizeof(canvas));
+    TEST_ASSERT_EQUAL_UINT16(100, anim->frames[i].delay_ms);
+  }
+}
+
+static void test_lookup() {
+  AssetPack assets;
+  TEST_ASSERT_TRUE(assets.begin());
+  const Animation* anim = assets.findAnimation("blink");
+  TEST_ASSERT_TRUE(anim == assets.findAnimation("blink"));  // Built once
+  const RleAnimation* clip = assets.findClip("blink");
+  TEST_ASSERT_NOT_NULL(clip);
+  TEST_ASSERT_TRUE(clip->keyframe == anim->keyframe);
+  TEST_ASSERT_NULL(assets.findAnimation("missing"));
+}
+
+static void test_unmaps() {
+  {
+    AssetPack assets;
+    TEST_ASSERT_TRUE(assets.begin());
+    TEST_ASSERT_EQUAL_INT(1, hostPartition().mapped);
+  }
+  TEST_ASSERT_EQUAL_INT(0, hostPartition().mapped);
+}
+
+static void test_rejects_bad_header() {
+  AssetPack none;
+  hostPartitionSet(nullptr, 0);
+  TEST_ASSERT_FALSE(none.begin());
+
+  pack[3] = '1';  // Old layout, frame records without a length
+  mapPack();
+  AssetPack old;
+  TEST_ASSERT_FALSE(old.begin());
+  TEST_ASSERT_EQUAL_INT(0, hostPartition().mapped);
+
+  buildPack();
+  patch32(4, PARTITION_SIZE + 4);
+  mapPack();
+  AssetPack oversized;
+  TEST_ASSERT_FALSE(oversized.begin());
+
+  buildPack();
+  patch16(8, 200);  // Directory runs past the pack
+  mapPack();
+  AssetPack directory;
+  TEST_ASSERT_FALSE(directory.begin());
+}
+
+// Damage one field, then the asset must not load
+static void expectDamaged(uint32_t at, uint32_t value, bool wide) {
+  buildPack();
+  if (wide) patch32(at, value); else patch16(at, value);
+  mapPack();
+  AssetPack assets;
+  TEST_ASSERT_TRUE(assets.begin());
+  TEST_ASSERT_NULL(assets.findAnimation("blink"));
+  TEST_ASSERT_NULL(assets.findClip("blink"));
+}
+
+static void test_rejects_damaged_asset() {
+  uint32_t entry = 12 + ASSET_NAME_SIZE;
+  expectDamaged(entry, animOffset + 2, true);          // Misaligned record
+  expectDamaged(entry, pack.size(), true);             // Record past the pack
+  expectDamaged(animOffset + 4, 0, false);             // No frames
+  expectDamaged(animOffset + 4, 200, false);           // Frame records past the pack
+  expectDamaged(animOffset + 0, RLE_MAX_WIDTH + 1, false);
+  expectDamaged(animOffset + 6, 0, false);             // No colors
+  expectDamaged(animOffset + 6, 257, false);
+  expectDamaged(animOffset + 8, 5, false);             // 5-bit indices (and loop 0)
+  expectDamaged(animOffset + 12, pack.size() - 2, true);  // Palette past the pack
+  expectDamaged(frameRecord(1) + 0, W, false);         // Rectangle outside the animation
+  expectDamaged(frameRecord(1) + 6, H + 1, false);
+}
+
+static void test_rejects_stream_past_pack() {
+  uint32_t size = pack.size();
+  uint32_t data = pack[frameRecord(2) + 12] | pack[frameRecord(2) + 13] << 8;
+  expectDamaged(frameRecord(2) + 12, size + 1, true);  // Data starts past the end
+  expectDamaged(frameRecord(2) + 16, size - data + 1, true);  // Length runs past the end
+  expectDamaged(frameRecord(2) + 16, 0xFFFFFFFF, true);       // data + length wraps around
+  expectDamaged(frameRecord(0) + 16, 0, true);         // Keyframe pixels with no tokens
+  expectDamaged(frameRecord(0) + 12, 0, true);
+
+  // Ending exactly at the pack's end is fine
+  buildPack();
+  patch32(frameRecord(2) + 16, size - data);
+  mapPack();
+  AssetPack assets;
+  TEST_ASSERT_TRUE(assets.begin());
+  TEST_ASSERT_NOT_NULL(assets.findAnimation("blink"));
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_plays_source_frames);
+  RUN_TEST(test_lookup);
+  RUN_TEST(test_unmaps);
+  RUN_TEST(test_rejects_bad_header);
+  RUN_TEST(test_rejects_damaged_asset);
+  RUN_TEST(test_rejects_stream_past_pack);
+  return UNITY_END();
+}
+
+int main() {
+  return runTests();
+}
@@ -0,0 +1,127 @@
+/*
+ * FixedMath: accuracy against libm and the per-frame cost of the progress
+ * ring's arc end points, soft-float (the code it replaced) vs Q15.
+ *
+ *   pio test -e native -f test_fixed_math     host
+ *   pio test -e c3-bench -f test_fixed_math   on the C3, where float is soft
+ */
+
+#include <math.h>
+#include <unity.h>
+#include "FixedMath.h"
+#include "../bench.h"
+
+// A 100% ring as drawProgressRing() draws it: thickness + 2 arcs, -90 to
+// 270 degrees in 2-degree segments
+// (volatile so the compiler cannot fold the float version away)
+static volatile int16_t RING_R = 100;
+static const int16_t RING_LAYERS = 10;
+
+void setUp() {}
+void tearDown() {}
+
+static void test_sin_matches_libm() {
+  float worst = 0;
+  for (int32_t a = 0; a < FX_ANGLE_FULL; a++) {
+    float expected = sinf(a * 2 * (float)M_PI / FX_ANGLE_FULL);
+    worst = fmaxf(worst, fabsf(fxSin(a) / 32767.0f - expected));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, worst);
+}
+
+static void test_atan2_matches_libm() {
+  for (int32_t y = -120; y <= 120; y += 3) {
+    for (int32_t x = -120; x <= 120; x += 3) {
+      if (x == 0 && y == 0) continue;
+      int32_t expected = lroundf(atan2f(y, x) * FX_ANGLE_FULL / (2 * (float)M_PI)) & FX_ANGLE_MASK;
+      int32_t diff = (fxAtan2(y, x) - expected) & FX_ANGLE_MASK;
+      if (diff > FX_ANGLE_HALF) diff -= FX_ANGLE_FULL;
+      TEST_ASSERT_INT_WITHIN(2, 0, diff);
+    }
+  }
+}
+
+static void test_sqrt_is_exact() {
+  for (uint32_t v = 0; v < 200000; v++) {
+    uint32_t r = fxSqrt(v);
+    TEST_ASSERT_TRUE(r * r <= v && (r + 1) * (r + 1) > v);
+  }
+  TEST_ASSERT_EQUAL_UINT32(65535, fxSqrt(0xFFFFFFFFUL));
+}
+
+// The replaced drawArc(): four float trig calls per segment
+static uint32_t ringFloat() {
+  uint32_t sum = 0;
+  int16_t outer = RING_R;
+  for (int16_t i = 0; i < RING_LAYERS; i++) {
+    int16_t r = outer - i + 1;
+    for (int angle = -90; angle < 270; angle += 2) {
+      float rad1 = angle * (float)M_PI / 180.0f;
+      float rad2 = (angle + 2) * (float)M_PI / 180.0f;
+      int16_t x1 = 120 + r * cosf(rad1);
+      int16_t y1 = 120 + r * sinf(rad1);
+      int16_t x2 = 120 + r * cosf(rad2);
+      int16_t y2 = 120 + r * sinf(rad2);
+      sum += x1 + y1 + x2 + y2;
+    }
+  }
+  return sum;
+}
+
+// The current drawArc(): one fxPolar() per segment, end points carried over
+static uint32_t ringFixed() {
+  uint32_t sum = 0;
+  int16_t outer = RING_R;
+  for (int16_t i = 0; i < RING_LAYERS; i++) {
+    int16_t r = outer - i + 1;
+    int16_t x1, y1;
+    fxPolar(120, 120, r, fxDegToAngle(-90), x1, y1);
+    for (int angle = -90; angle < 270; angle += 2) {
+      int16_t x2, y2;
+      fxPolar(120, 120, r, fxDegToAngle(angle + 2), x2, y2);
+      sum += x1 + y1 + x2 + y2;
+      x1 = x2;
+      y1 = y2;
+    }
+  }
+  return sum;
+}
+
+static void test_ring_points_agree() {
+  for (int angle = -90; angle <= 270; angle++) {
+    float rad = angle * (float)M_PI / 180.0f;
+    int16_t x, y;
+    fxPolar(120, 120, RING_R, fxDegToAngle(angle), x, y);
+    TEST_ASSERT_INT_WITHIN(1, (int16_t)lroundf(120 + RING_R * cosf(rad)), x);
+    TEST_ASSERT_INT_WITHIN(1, (int16_t)lroundf(120 + RING_R * sinf(rad)), y);
+  }
+}
+
+static void bench_ring_frame() {
+  float before = benchRun(50, []() { benchSink += ringFloat(); });
+  float after = benchRun(50, []() { benchSink += ringFixed(); });
+  benchReport("progress ring end points per frame", before, after);
+  TEST_ASSERT_TRUE(after > 0);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_sin_matches_libm);
+  RUN_TEST(test_atan2_matches_libm);
+  RUN_TEST(test_sqrt_is_exact);
+  RUN_TEST(test_ring_points_agree);
+  RUN_TEST(bench_ring_frame);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+  delay(2000);  // Let the USB CDC port come up
+  runTests();
+}
+void loop() {}
+#else
+int main() {
+  return runTests();
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Glow mask compositing (pxMaskShades/pxMaskRow, as used by
+ * DisplayDriver::drawAlphaMask): the idle screen redraws its glow every
+ * frame into a back buffer that is never cleared, so drawing the same mask
+ * again must leave the pixels exactly as they were.
+ *
+ *   pio test -e native -f test_glow_mask
+ */
+
+#include <string.h>
+#include <unity.h>
+#include "PixelKernels.h"
+
+static const int16_t W = 37;  // Odd, so rows end on a half byte
+static const int16_t H = 9;
+static const int16_t STRIDE = (W + 1) / 2;
+static const uint16_t COLOR = 0x07FF;
+static const uint16_t BG = 0x0841;
+
+static uint8_t mask[STRIDE * H];
+static uint16_t frame[W * H];
+
+void setUp() {
+  // A soft bar: opaque in the middle, fading out towards the edges
+  memset(mask, 0, sizeof(mask));
+  for (int16_t y = 0; y < H; y++) {
+    for (int16_t x = 0; x < W; x++) {
+      int16_t d = abs(y - H / 2) * 3 + abs(x - W / 2) / 2;
+      uint8_t a = d < 15 ? 15 - d : 0;
+      mask[y * STRIDE + x / 2] |= a << ((x & 1) * 4);
+    }
+  }
+  // Background with something already drawn on it
+  for (int16_t i = 0; i < W * H; i++) {
+    frame[i] = pxSwap(i % 7 ? BG : 0xF800);
+  }
+}
+
+void tearDown() {}
+
+static uint8_t maskAt(int16_t x, int16_t y) {
+  return (mask[y * STRIDE + x / 2] >> ((x & 1) * 4)) & 0x0F;
+}
+
+static void drawGlow(uint16_t color) {
+  uint16_t shades[16];
+  pxMaskShades(shades, color, BG, true);
+  for (int16_t y = 0; y < H; y++) {
+    pxMaskRow(frame + y * W, mask + y * STRIDE, 0, W, shades);
+  }
+}
+
+static void test_redraw_is_identical() {
+  drawGlow(COLOR);
+  uint16_t first[W * H];
+  memcpy(first, frame, sizeof(frame));
+  for (int i = 0; i < 10; i++) {
+    drawGlow(COLOR);  // A second of idle frames at 10 FPS
+  }
+  TEST_ASSERT_EQUAL_MEMORY(first, frame, sizeof(frame));
+}
+
+static void test_shades_over_background() {
+  uint16_t before[W * H];
+  memcpy(before, frame, sizeof(frame));
+  drawGlow(COLOR);
+  for (int16_t y = 0; y < H; y++) {
+    for (int16_t x = 0; x < W; x++) {
+      uint8_t a = maskAt(x, y);
+      uint16_t expected = a ? pxBlend(COLOR, BG, a * 17) : pxSwap(before[y * W + x]);
+      TEST_ASSERT_EQUAL_HEX16(expected, pxSwap(frame[y * W + x]));
+    }
+  }
+  TEST_ASSERT_EQUAL_HEX16(COLOR, pxSwap(frame[(H / 2) * W + W / 2]));
+}
+
+static void test_clipped_row_keeps_mask_phase() {
+  // Start one pixel into the mask (odd x): the nibbles must not shift
+  uint16_t shades[16];
+  uint16_t line[W];
+  pxMaskShades(shades, COLOR, BG, false);
+  memset(line, 0, sizeof(line));
+  pxMaskRow(line, mask + (H / 2) * STRIDE, 1, W - 1, shades);
+  for (int16_t x = 1; x < W; x++) {
+    uint8_t a = maskAt(x, H / 2);
+    TEST_ASSERT_EQUAL_HEX16(a ? shades[a] : 0, line[x - 1]);
+  }
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_redraw_is_identical);
+  RUN_TEST(test_shades_over_background);
+  RUN_TEST(test_clipped_row_keeps_mask_phase);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+  delay(2000);  // Let the USB CDC port come up
+  runTests();
+}
+void loop() {}
+#else
+int main() {
+  return runTests();
+}
+#endif
@@ -0,0 +1,134 @@
+/*
+ * PixelKernels: accuracy against the divide-based code they replaced, and
+ * full-frame timings (240x240, sprite byte order) scalar vs SWAR.
+ *
+ *   pio test -e native -f test_pixel_kernels     host
+ *   pio test -e c3-bench -f test_pixel_kernels   on the C3
+ */
+
+#include <stdlib.h>
+#include <unity.h>
+#include "PixelKernels.h"
+#include "../bench.h"
+
+static const size_t FRAME = 240 * 240;
+
+static uint16_t frame[FRAME];
+
+void setUp() {
+  for (size_t i = 0; i < FRAME; i++) {
+    frame[i] = pxSwap((uint16_t)(i * 2654435761UL >> 16));
+  }
+}
+
+void tearDown() {}
+
+// The old DisplayDriver::dimColor()
+static uint16_t scalarDim(uint16_t color, uint8_t amount) {
+  uint8_t r = (color >> 11) & 0x1F;
+  uint8_t g = (color >> 5) & 0x3F;
+  uint8_t b = color & 0x1F;
+  r = (r * amount) / 255;
+  g = (g * amount) / 255;
+  b = (b * amount) / 255;
+  return (r << 11) | (g << 5) | b;
+}
+
+// Per-channel divide blend, what the SWAR blend stands in for
+static uint16_t scalarBlend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint8_t inv = 255 - alpha;
+  uint8_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * inv) / 255;
+  uint8_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * inv) / 255;
+  uint8_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * inv) / 255;
+  return (r << 11) | (g << 5) | b;
+}
+
+// Largest channel difference, in steps of that channel
+static void assertClose(uint16_t expected, uint16_t actual) {
+  TEST_ASSERT_INT_WITHIN(1, (expected >> 11) & 0x1F, (actual >> 11) & 0x1F);
+  TEST_ASSERT_INT_WITHIN(2, (expected >> 5) & 0x3F, (actual >> 5) & 0x3F);  // One 5-bit step
+  TEST_ASSERT_INT_WITHIN(1, expected & 0x1F, actual & 0x1F);
+}
+
+static void test_dim_matches_scalar() {
+  static const uint8_t amounts[] = { 0, 1, 8, 64, 128, 200, 254, 255 };
+  for (uint32_t c = 0; c < 0x10000; c++) {
+    for (uint8_t amount : amounts) {
+      assertClose(scalarDim(c, amount), pxDim(c, amount));
+    }
+  }
+}
+
+static void test_blend_matches_scalar() {
+  static const uint8_t alphas[] = { 0, 17, 100, 128, 238, 255 };
+  for (uint32_t c = 0; c < 0x10000; c += 3) {
+    uint16_t bg = (uint16_t)(c * 40503);
+    for (uint8_t alpha : alphas) {
+      assertClose(scalarBlend(c, bg, alpha), pxBlend(c, bg, alpha));
+    }
+  }
+  TEST_ASSERT_EQUAL_HEX16(0x1234, pxBlend(0xFFFF, 0x1234, 0));
+  TEST_ASSERT_EQUAL_HEX16(0xFFFF, pxBlend(0xFFFF, 0x1234, 255));
+}
+
+static void test_buffers_match_single_pixels() {
+  // Odd start and length: both unaligned ends go through the single path
+  uint16_t ref[101];
+  for (size_t i = 0; i < 101; i++) ref[i] = pxSwap(pxDim(pxSwap(frame[i + 1]), 77));
+  pxDimBuffer(frame + 1, 101, 77, true);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(ref, frame + 1, 101);
+
+  for (size_t i = 0; i < 101; i++) ref[i] = pxBlend(0x07E0, frame[i + 1], 150);
+  pxBlendBuffer(frame + 1, 101, 0x07E0, 150, false);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(ref, frame + 1, 101);
+
+  uint16_t to[101];
+  for (size_t i = 0; i < 101; i++) {
+    to[i] = (uint16_t)(i * 613);
+    ref[i] = pxBlend(to[i], frame[i], 90);
+  }
+  pxCrossfade(frame, frame, to, 101, 90, false);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(ref, frame, 101);
+}
+
+static void bench_frame_dim() {
+  float before = benchRun(20, []() {
+    for (size_t i = 0; i < FRAME; i++) frame[i] = pxSwap(scalarDim(pxSwap(frame[i]), 200));
+  });
+  float after = benchRun(20, []() { pxDimBuffer(frame, FRAME, 200, true); });
+  benchSink += frame[FRAME / 2];
+  benchReport("dim 240x240", before, after);
+  TEST_ASSERT_TRUE(after > 0);
+}
+
+static void bench_frame_blend() {
+  float before = benchRun(20, []() {
+    for (size_t i = 0; i < FRAME; i++) frame[i] = pxSwap(scalarBlend(0xFD20, pxSwap(frame[i]), 96));
+  });
+  float after = benchRun(20, []() { pxBlendBuffer(frame, FRAME, 0xFD20, 96, true); });
+  benchSink += frame[FRAME / 2];
+  benchReport("blend 240x240", before, after);
+  TEST_ASSERT_TRUE(after > 0);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_dim_matches_scalar);
+  RUN_TEST(test_blend_matches_scalar);
+  RUN_TEST(test_buffers_match_single_pixels);
+  RUN_TEST(bench_frame_dim);
+  RUN_TEST(bench_frame_blend);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+  delay(2000);  // Let the USB CDC port come up
+  runTests();
+}
+void loop() {}
+#else
+int main() {
+  return runTests();
+}
+#endif
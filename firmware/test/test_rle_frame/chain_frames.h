@@ -0,0 +1,61 @@
+// Source frames of chain_rle.h, which is generated from this file (in tools/):
+//   python3 rle_frames.py ../firmware/test/test_rle_frame/chain_frames.h ../firmware/test/test_rle_frame/chain_rle.h chain 16 8
+// Frame 1 changes two pixels (a delta with skips), frame 2 fills a block
+// (coded as a whole rectangle), and frame 3 changes every pixel, so the
+// delta back to frame 0 is the whole frame: the keyframe's own tokens.
+#ifndef CHAIN_FRAMES_H
+#define CHAIN_FRAMES_H
+
+#include <Arduino.h>
+
+#define CHAIN_SOURCE_FRAMES 4
+
+static const uint16_t chain_frame_0[128] PROGMEM = {
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,
+};
+
+static const uint16_t chain_frame_1[128] PROGMEM = {
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0xCCCC,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xCCCC,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,
+};
+
+static const uint16_t chain_frame_2[128] PROGMEM = {
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0x51B1,0x6A50,
+  0x00FF,0x199E,0xCCCC,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0xB42D,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x00FF,0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,
+  0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,
+};
+
+static const uint16_t chain_frame_3[128] PROGMEM = {
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x199E,0x323D,0x4ADC,0x637B,0x7C1A,0x94B9,0xAD58,0xC5F7,0xDE96,0xF735,0x0FD4,0x2073,0x3912,0x51B1,0x6A50,0x00FF,
+  0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,0x9B8E,0xB42D,0xCCCC,0x82EF,
+};
+
+static const uint16_t* const chain_frames[CHAIN_SOURCE_FRAMES] = {
+  chain_frame_0, chain_frame_1, chain_frame_2, chain_frame_3,
+};
+
+#endif // CHAIN_FRAMES_H
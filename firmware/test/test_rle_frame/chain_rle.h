@@ -0,0 +1,55 @@
+// Generated by tools/rle_frames.py from chain_frames.h - do not edit
+#ifndef CHAIN_RLE_H
+#define CHAIN_RLE_H
+
+#include "RleFrame.h"
+
+#define CHAIN_FRAME_COUNT 4
+#define CHAIN_WIDTH 16
+#define CHAIN_HEIGHT 8
+
+// 20 colors (8-bit indices), byte-swapped RGB565
+static const uint16_t chain_palette[20] PROGMEM = {
+  0xFF00,0xD40F,0x9E19,0x7320,0x3D32,0x1239,0xDC4A,0xB151,0x7B63,0x506A,0x1A7C,0xEF82,0xB994,0x8E9B,0x58AD,0x2DB4,
+  0xF7C5,0xCCCC,0x96DE,0x35F7,
+};
+
+// Keyframe: 40 bytes
+static const uint8_t chain_key_rle[40] PROGMEM = {
+  0x0F,0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x13,0x01,0x03,0x05,0x07,
+  0x09,0xCF,0xCF,0xCF,0xCF,0xCF,0xCF,0x0F,0x0B,0x0D,0x0F,0x11,0x0B,0x0D,0x0F,0x11,
+  0x0B,0x0D,0x0F,0x11,0x0B,0x0D,0x0F,0x11,
+};
+
+// Delta 0: the keyframe
+
+// Delta 1: 8x3 at (2, 2), 7 bytes
+static const uint8_t chain_delta_1_rle[7] PROGMEM = {
+  0x00,0x11,0xC6,0xC7,0xC6,0x00,0x11,
+};
+
+// Delta 2: 6x4 at (8, 1), 5 bytes
+static const uint8_t chain_delta_2_rle[5] PROGMEM = {
+  0x84,0x0F,0xC5,0xC5,0xC5,
+};
+
+// Delta 3: 16x8 at (0, 0), 40 bytes
+static const uint8_t chain_delta_3_rle[40] PROGMEM = {
+  0x0F,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x13,0x01,0x03,0x05,0x07,0x09,
+  0x00,0xCF,0xCF,0xCF,0xCF,0xCF,0xCF,0x0F,0x0D,0x0F,0x11,0x0B,0x0D,0x0F,0x11,0x0B,
+  0x0D,0x0F,0x11,0x0B,0x0D,0x0F,0x11,0x0B,
+};
+
+static const RleFrame chain_keyframe = { 0, 0, 16, 8, chain_palette, 20, 8, chain_key_rle, 40, false };
+
+static const RleFrame chain_deltas[CHAIN_FRAME_COUNT] = {
+  { 0, 0, 16, 8, chain_palette, 20, 8, chain_key_rle, 40, false },
+  { 2, 2, 8, 3, chain_palette, 20, 8, chain_delta_1_rle, 7, true },
+  { 8, 1, 6, 4, chain_palette, 20, 8, chain_delta_2_rle, 5, false },
+  { 0, 0, 16, 8, chain_palette, 20, 8, chain_delta_3_rle, 40, false },
+};
+
+extern const RleAnimation chain_rle;
+const RleAnimation chain_rle = { 16, 8, CHAIN_FRAME_COUNT, &chain_keyframe, chain_deltas };
+
+#endif // CHAIN_RLE_H
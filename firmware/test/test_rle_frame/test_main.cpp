@@ -0,0 +1,203 @@
+/*
+ * RleDecoder: a keyframe plus delta chain made by tools/rle_frames.py
+ * (chain_rle.h) must play back its source frames (chain_frames.h), and a
+ * frame whose token data ends early (a damaged or truncated asset pack)
+ * must stop decoding at the end of its bytes instead of reading whatever
+ * follows them in flash.
+ *
+ *   pio test -e native -f test_rle_frame
+ */
+
+#include <string.h>
+#include <unity.h>
+#include "RleFrame.h"
+#include "chain_frames.h"
+#include "chain_rle.h"
+
+static const uint16_t PALETTE[256] = { 0 };
+static const uint8_t POISON = 0xEE;  // Index only the bytes past the end hold
+
+// 4x3, 8-bit: a literal row, a run row, then a copy and a literal
+static const uint8_t STREAM8[] = {
+  0x03, 1, 2, 3, 4,
+  0x82, 5,
+  0xC1, 0x01, 6, 7,
+};
+static const uint16_t ROW_ENDS8[] = { 5, 7, 11 };
+
+// 5x3, 4-bit: an odd literal (padded to a whole byte), a run row, then a
+// copy and a literal that starts on a byte of its own
+static const uint8_t STREAM4[] = {
+  0x04, 0x12, 0x34, 0x5F,
+  0x83, 0x09,
+  0xC1, 0x02, 0xAB, 0xC0,
+};
+static const uint16_t ROW_ENDS4[] = { 4, 6, 10 };
+
+static RleDecoder decoder;  // Too big for a small stack
+
+static uint16_t swap16(uint16_t v) { return (v << 8) | (v >> 8); }
+
+// What drawRleFrame() writes, on a canvas of panel colors
+static void apply(const RleFrame* frame, uint16_t* canvas, uint16_t width) {
+  decoder.begin(frame);
+  while (decoder.nextRow()) {
+    uint16_t y = frame->y + decoder.rowIndex();
+    for (uint8_t s = 0; s < decoder.spans(); s++) {
+      for (uint8_t x = decoder.spanStart(s); x < decoder.spanEnd(s); x++) {
+        canvas[y * width + frame->x + x] = decoder.color(decoder.row()[x]);
+      }
+    }
+  }
+}
+
+static void assertFrame(uint8_t index, const uint16_t* canvas) {
+  for (uint16_t i = 0; i < CHAIN_WIDTH * CHAIN_HEIGHT; i++) {
+    TEST_ASSERT_EQUAL_HEX16(chain_frames[index][i], swap16(canvas[i]));
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+static RleFrame makeFrame(const uint8_t* data, uint32_t size, uint16_t width, uint16_t height, uint8_t bits) {
+  RleFrame frame = { 0, 0, width, height, PALETTE, 256, bits, data, size, false };
+  return frame;
+}
+
+static void test_chain_loops() {
+  uint16_t canvas[CHAIN_WIDTH * CHAIN_HEIGHT];
+  memset(canvas, 0, sizeof(canvas));
+  apply(chain_rle.keyframe, canvas, CHAIN_WIDTH);
+  assertFrame(0, canvas);
+  // deltas[i] turns frame i - 1 into frame i; deltas[0] wraps around
+  for (uint8_t step = 1; step <= 2 * CHAIN_FRAME_COUNT; step++) {
+    uint8_t i = step % CHAIN_FRAME_COUNT;
+    apply(&chain_rle.deltas[i], canvas, CHAIN_WIDTH);
+    assertFrame(i, canvas);
+  }
+}
+
+static void test_chain_skip_delta() {
+  // Two changed pixels: only they are written
+  const RleFrame* delta = &chain_rle.deltas[1];
+  TEST_ASSERT_TRUE(delta->delta);
+  decoder.begin(delta);
+  uint16_t written = 0;
+  while (decoder.nextRow()) {
+    for (uint8_t s = 0; s < decoder.spans(); s++) {
+      written += decoder.spanEnd(s) - decoder.spanStart(s);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT16(2, written);
+}
+
+static void test_chain_whole_rectangle() {
+  // The filled block is coded whole: copies come from the row above and
+  // every row is written across the rectangle
+  const RleFrame* delta = &chain_rle.deltas[2];
+  TEST_ASSERT_FALSE(delta->delta);
+  TEST_ASSERT_TRUE(delta->width < CHAIN_WIDTH && delta->height < CHAIN_HEIGHT);
+  decoder.begin(delta);
+  while (decoder.nextRow()) {
+    TEST_ASSERT_EQUAL_UINT8(1, decoder.spans());
+    TEST_ASSERT_EQUAL_UINT8(0, decoder.spanStart(0));
+    TEST_ASSERT_EQUAL_UINT8(delta->width, decoder.spanEnd(0));
+    TEST_ASSERT_EQUAL_UINT8(decoder.row()[0], decoder.row()[delta->width - 1]);
+  }
+}
+
+static void test_chain_reuses_keyframe() {
+  // Frame 3 differs everywhere: the way back to frame 0 is the keyframe
+  const RleFrame* delta = &chain_rle.deltas[0];
+  TEST_ASSERT_TRUE(delta->data == chain_rle.keyframe->data);
+  TEST_ASSERT_EQUAL_UINT32(chain_rle.keyframe->size, delta->size);
+  TEST_ASSERT_FALSE(delta->delta);
+  TEST_ASSERT_EQUAL_UINT16(CHAIN_WIDTH, delta->width);
+  TEST_ASSERT_EQUAL_UINT16(CHAIN_HEIGHT, delta->height);
+}
+
+static void test_complete_stream() {
+  RleFrame frame = makeFrame(STREAM8, sizeof(STREAM8), 4, 3, 8);
+  static const uint8_t expected[3][4] = { { 1, 2, 3, 4 }, { 5, 5, 5, 5 }, { 5, 5, 6, 7 } };
+  decoder.begin(&frame);
+  for (int y = 0; y < 3; y++) {
+    TEST_ASSERT_TRUE(decoder.nextRow());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected[y], decoder.row(), 4);
+  }
+  TEST_ASSERT_FALSE(decoder.nextRow());
+}
+
+static void test_complete_stream_4bit() {
+  RleFrame frame = makeFrame(STREAM4, sizeof(STREAM4), 5, 3, 4);
+  static const uint8_t expected[3][5] = { { 1, 2, 3, 4, 5 }, { 9, 9, 9, 9, 9 }, { 9, 9, 10, 11, 12 } };
+  decoder.begin(&frame);
+  for (int y = 0; y < 3; y++) {
+    TEST_ASSERT_TRUE(decoder.nextRow());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected[y], decoder.row(), 5);
+    // The padding nibble is not a pixel: every row is written whole
+    TEST_ASSERT_EQUAL_UINT8(1, decoder.spans());
+    TEST_ASSERT_EQUAL_UINT8(5, decoder.spanEnd(0));
+  }
+  TEST_ASSERT_FALSE(decoder.nextRow());
+}
+
+// Every shorter length, with a run of POISON right behind the cut
+static void checkTruncated(const uint8_t* stream, uint16_t length, const uint16_t* rowEnds,
+                           uint16_t width, uint16_t height, uint8_t bits) {
+  uint8_t buffer[64];
+  for (uint16_t cut = 0; cut < length; cut++) {
+    memcpy(buffer, stream, cut);
+    for (uint16_t i = cut; i + 1 < (uint16_t)sizeof(buffer); i += 2) {
+      buffer[i] = 0x80 + 30;
+      buffer[i + 1] = POISON;
+    }
+    RleFrame frame = makeFrame(buffer, cut, width, height, bits);
+    decoder.begin(&frame);
+
+    uint16_t complete = 0;
+    while (complete < height && rowEnds[complete] <= cut) complete++;
+    uint16_t rows = 0;
+    while (decoder.nextRow()) {
+      for (uint16_t x = 0; x < width; x++) {
+        TEST_ASSERT_NOT_EQUAL(POISON, decoder.row()[x]);
+      }
+      rows++;
+    }
+    TEST_ASSERT_EQUAL_UINT16(complete, rows);
+    TEST_ASSERT_FALSE(decoder.nextRow());  // Stays stopped
+  }
+}
+
+static void test_truncated_8bit() {
+  checkTruncated(STREAM8, sizeof(STREAM8), ROW_ENDS8, 4, 3, 8);
+}
+
+static void test_truncated_4bit() {
+  checkTruncated(STREAM4, sizeof(STREAM4), ROW_ENDS4, 5, 3, 4);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_chain_loops);
+  RUN_TEST(test_chain_skip_delta);
+  RUN_TEST(test_chain_whole_rectangle);
+  RUN_TEST(test_chain_reuses_keyframe);
+  RUN_TEST(test_complete_stream);
+  RUN_TEST(test_complete_stream_4bit);
+  RUN_TEST(test_truncated_8bit);
+  RUN_TEST(test_truncated_4bit);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+  delay(2000);  // Let the USB CDC port come up
+  runTests();
+}
+void loop() {}
+#else
+int main() {
+  return runTests();
+}
+#endif
@@ -0,0 +1,164 @@
+/*
+ * TextFormat: the integer formatters against snprintf, their edge cases
+ * (rounding, "-0", ellipsis widths, duration units), and the cost of the
+ * temperature label the data screen draws, float snprintf vs fmt chain.
+ *
+ *   pio test -e native -f test_text_format     host
+ *   pio test -e c3-bench -f test_text_format   on the C3, where float is soft
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include "TextFormat.h"
+#include "../bench.h"
+
+// Readings as they arrive from Klipper
+// (volatile so the compiler cannot fold the snprintf version away)
+static volatile float HOTEND = 214.6f;
+static volatile float TARGET = 215.0f;
+
+static char out[32];
+
+void setUp() {}
+void tearDown() {}
+
+static void test_fixed_rounds_half_away_from_zero() {
+  fmtFixed(out, 2155, 1, 0);
+  TEST_ASSERT_EQUAL_STRING("216", out);
+  fmtFixed(out, 2154, 1, 0);
+  TEST_ASSERT_EQUAL_STRING("215", out);
+  fmtFixed(out, -2155, 1, 0);
+  TEST_ASSERT_EQUAL_STRING("-216", out);
+  fmtFixed(out, 12345, 3, 2);
+  TEST_ASSERT_EQUAL_STRING("12.35", out);
+  fmtFixed(out, -12345, 3, 2);
+  TEST_ASSERT_EQUAL_STRING("-12.35", out);
+  fmtFixed(out, 995, 3, 2);
+  TEST_ASSERT_EQUAL_STRING("1.00", out);  // Carries into the integer part
+  fmtFixed(out, 1205, 3, 3);
+  TEST_ASSERT_EQUAL_STRING("1.205", out);
+  fmtFixed(out, 1205, 1, 3);
+  TEST_ASSERT_EQUAL_STRING("120.5", out);  // decimals clamped to scale
+  fmtFixed(out, INT32_MIN, 0, 0);
+  TEST_ASSERT_EQUAL_STRING("-2147483648", out);
+}
+
+static void test_fixed_has_no_negative_zero() {
+  fmtFixed(out, -4, 1, 0);
+  TEST_ASSERT_EQUAL_STRING("0", out);
+  fmtFixed(out, -5, 1, 0);
+  TEST_ASSERT_EQUAL_STRING("-1", out);
+  fmtFixed(out, -4, 3, 2);
+  TEST_ASSERT_EQUAL_STRING("0.00", out);
+  fmtFixed(out, -5, 3, 2);
+  TEST_ASSERT_EQUAL_STRING("-0.01", out);
+  fmtFixed(out, 0, 2, 2);
+  TEST_ASSERT_EQUAL_STRING("0.00", out);
+  fmtInt(out, 0);
+  TEST_ASSERT_EQUAL_STRING("0", out);
+}
+
+// Z heights, -200.00 to 3000.00 mm in 0.01 steps, as "%.1f" prints them.
+// Exact halves (snprintf rounds the nearest double, often down) and "-0.0"
+// are where the two differ on purpose.
+static void test_fixed_matches_snprintf() {
+  char expected[16];
+  for (int32_t v = -20000; v <= 300000; v++) {
+    if (v % 10 == 5 || v % 10 == -5) continue;
+    snprintf(expected, sizeof(expected), "%.1f", v / 100.0);
+    if (strcmp(expected, "-0.0") == 0) strcpy(expected, "0.0");
+    fmtFixed(out, v, 2, 1);
+    TEST_ASSERT_EQUAL_STRING(expected, out);
+  }
+}
+
+static void test_pieces_append() {
+  char* end = fmtText(fmtTemp(out, 2146), "/");
+  end = fmtTemp(end, 2150);
+  TEST_ASSERT_EQUAL_STRING("215/215", out);
+  TEST_ASSERT_EQUAL_PTR(out + strlen(out), end);
+  end = fmtPercent(out, 42);
+  TEST_ASSERT_EQUAL_STRING("42%", out);
+  TEST_ASSERT_EQUAL_PTR(out + 3, end);
+}
+
+static void test_ellipsis() {
+  fmtEllipsis(out, "benchy.gcode", 12);
+  TEST_ASSERT_EQUAL_STRING("benchy.gcode", out);
+  fmtEllipsis(out, "benchy.gcode", 11);
+  TEST_ASSERT_EQUAL_STRING("benchy.g...", out);
+  fmtEllipsis(out, "benchy.gcode", 4);
+  TEST_ASSERT_EQUAL_STRING("b...", out);
+  fmtEllipsis(out, "", 0);
+  TEST_ASSERT_EQUAL_STRING("", out);
+}
+
+static void test_ellipsis_narrower_than_dots() {
+  // Never wider than maxChars, even with no room for any text
+  static const char* const expected[] = { "", ".", "..", "..." };
+  for (uint8_t maxChars = 0; maxChars <= 3; maxChars++) {
+    char* end = fmtEllipsis(out, "benchy.gcode", maxChars);
+    TEST_ASSERT_EQUAL_STRING(expected[maxChars], out);
+    TEST_ASSERT_EQUAL_PTR(out + maxChars, end);
+  }
+  fmtEllipsis(out, "ab", 2);
+  TEST_ASSERT_EQUAL_STRING("ab", out);
+}
+
+static void test_duration_units() {
+  static const struct { uint32_t seconds; const char* text; } cases[] = {
+    { 0, "0s" },
+    { 59, "59s" },
+    { 60, "1m 0s" },
+    { 61, "1m 1s" },
+    { 3599, "59m 59s" },
+    { 3600, "1h 0m" },
+    { 3659, "1h 0m" },  // Seconds are dropped once there are hours
+    { 3660, "1h 1m" },
+    { 86399, "23h 59m" },
+    { 360000, "100h 0m" },
+  };
+  for (const auto& c : cases) {
+    fmtDuration(out, c.seconds);
+    TEST_ASSERT_EQUAL_STRING(c.text, out);
+  }
+}
+
+// The data screen's hotend label, as it was and as it is
+static void bench_temperature_label() {
+  float before = benchRun(2000, []() {
+    benchSink += snprintf(out, sizeof(out), "%.0f/%.0f", HOTEND, TARGET);
+  });
+  float after = benchRun(2000, []() {
+    char* end = fmtText(fmtTemp(out, fmtDeci(HOTEND)), "/");
+    benchSink += fmtTemp(end, fmtDeci(TARGET)) - out;
+  });
+  benchReport("\"%.0f/%.0f\" temperature label", before, after);
+  TEST_ASSERT_EQUAL_STRING("215/215", out);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fixed_rounds_half_away_from_zero);
+  RUN_TEST(test_fixed_has_no_negative_zero);
+  RUN_TEST(test_fixed_matches_snprintf);
+  RUN_TEST(test_pieces_append);
+  RUN_TEST(test_ellipsis);
+  RUN_TEST(test_ellipsis_narrower_than_dots);
+  RUN_TEST(test_duration_units);
+  RUN_TEST(bench_temperature_label);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+  delay(2000);  // Let the USB CDC port come up
+  runTests();
+}
+void loop() {}
+#else
+int main() {
+  return runTests();
+}
+#endif
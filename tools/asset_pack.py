@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Build the flash asset pack (see firmware/src/AssetPack.h)
+
+Compresses raw RGB565 animation headers exactly like rle_frames.py, but
+writes them into one binary image for the `spiffs` data partition instead
+of C headers. The firmware memory-maps that partition and looks assets up
+by name, so animations can be added or replaced without rebuilding the
+firmware:
+
+  python asset_pack.py assets.bin spaceman=raw_frames.h:120x120:200
+  esptool.py --chip esp32c3 write_flash 0x350000 assets.bin
+
+Each asset is given as name=header:WIDTHxHEIGHT[:delay_ms] (delay defaults
+to 100 ms per frame). Pure Python, no dependencies.
+
+Layout (little endian; offsets from the start of the pack, 4-byte aligned):
+  header     "KAP2", uint32 pack size, uint16 asset count, uint16 reserved
+  directory  per asset: char name[24] (NUL padded), uint32 animation offset
+  animation  uint16 width, height, frame count, colors; uint8 index bits,
+             loop; uint16 reserved; uint32 palette offset; then a frame
+             record for the keyframe and one per frame (its delta)
+  frame      uint16 x, y, width, height, delay_ms; uint8 delta, reserved;
+             uint32 token data offset (0: no change), uint32 token data length
+  palette    colors x uint16, byte-swapped RGB565
+  data       token streams as in RleFrame.h
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+from rle_frames import PALETTE_SIZE, compress, load_frames, swap
+
+MAGIC = b"KAP2"  # KAP1 frame records had no data length
+NAME_SIZE = 24
+PARTITION_SIZE = 0x100000  # c3_partitions.csv
+SPEC_RE = re.compile(r"^(\w+)=(.+):(\d+)x(\d+)(?::(\d+))?$")
+
+
+def align(blob):
+    blob.extend(b"\0" * (-len(blob) % 4))
+
+
+class Pack:
+    def __init__(self):
+        self.assets = []
+
+    def add(self, name, width, height, delay_ms, palette, bits, key, deltas, loop=True):
+        self.assets.append((name, width, height, delay_ms, palette, bits, key, deltas, loop))
+
+    def build(self):
+        header_size = 12 + len(self.assets) * (NAME_SIZE + 4)
+        body = bytearray()
+        offsets = []
+        for name, width, height, delay_ms, palette, bits, key, deltas, loop in self.assets:
+            base = header_size + len(body)
+            offsets.append(base)
+            records = 16 + 20 * (1 + len(deltas))
+
+            # Everything the records point at follows them
+            blobs = bytearray()
+            palette_offset = base + records
+            blobs += b"".join(struct.pack("<H", swap(c)) for c in palette)
+            align(blobs)
+
+            placed = {}
+
+            def place(tokens):
+                if not tokens:
+                    return 0
+                data = bytes(tokens)
+                if data not in placed:
+                    placed[data] = base + records + len(blobs)
+                    blobs.extend(data)
+                    align(blobs)
+                return placed[data]
+
+            frames = [struct.pack("<HHHHHBBII", 0, 0, width, height, 0, 0, 0, place(key), len(key))]
+            for x, y, w, h, tokens, skips in deltas:
+                frames.append(struct.pack("<HHHHHBBII", x, y, w, h, delay_ms, 1 if skips else 0, 0,
+                                          place(tokens), len(tokens)))
+
+            body += struct.pack("<HHHHBBHI", width, height, len(deltas), len(palette), bits,
+                                1 if loop else 0, 0, palette_offset)
+            body += b"".join(frames)
+            body += blobs
+
+        header = bytearray(MAGIC)
+        header += struct.pack("<IHH", header_size + len(body), len(self.assets), 0)
+        for (name, *_), offset in zip(self.assets, offsets):
+            header += name.encode().ljust(NAME_SIZE, b"\0") + struct.pack("<I", offset)
+        return bytes(header + body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the flash asset pack for the spiffs partition")
+    parser.add_argument("output", help="pack image to write")
+    parser.add_argument("assets", nargs="+", help="name=raw.h:WIDTHxHEIGHT[:delay_ms]")
+    parser.add_argument("--colors", type=int, default=PALETTE_SIZE,
+                        help="palette size per asset, 2-256 (16 or fewer stores 4-bit indices)")
+    parser.add_argument("--no-dither", action="store_true",
+                        help="map reduced colors to the nearest entry instead of error diffusion")
+    args = parser.parse_args()
+    if not 2 <= args.colors <= PALETTE_SIZE:
+        parser.error("--colors must be 2-256")
+
+    pack = Pack()
+    names = set()
+    for spec in args.assets:
+        match = SPEC_RE.match(spec)
+        if not match:
+            parser.error(f"bad asset '{spec}', expected name=raw.h:WIDTHxHEIGHT[:delay_ms]")
+        name, path = match.group(1), match.group(2)
+        width, height = int(match.group(3)), int(match.group(4))
+        delay_ms = int(match.group(5) or 100)
+        if len(name) >= NAME_SIZE:
+            parser.error(f"asset name '{name}' is longer than {NAME_SIZE - 1} characters")
+        if name in names:
+            parser.error(f"asset '{name}' given twice")
+        if width > 240 or height > 240:
+            parser.error(f"asset '{name}' is larger than the 240x240 panel")
+        names.add(name)
+
+        print(f"{name}: ", end="")
+        frames = load_frames(path, width, height)
+        if len(frames) > 255:
+            sys.exit(f"{path} has {len(frames)} frames, at most 255 fit an Animation")
+        palette, bits, key, deltas = compress(frames, width, height, args.colors, not args.no_dither)
+        pack.add(name, width, height, delay_ms, palette, bits, key, deltas)
+        print(f"{len(frames)} frames, {width}x{height}, {len(palette)} colors")
+
+    image = pack.build()
+    if len(image) > PARTITION_SIZE:
+        sys.exit(f"Pack is {len(image)} bytes, the partition holds {PARTITION_SIZE}")
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print(f"{os.path.basename(args.output)}: {len(pack.assets)} assets, {len(image) / 1024:.1f} KB "
+          f"of {PARTITION_SIZE // 1024} KB")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,18 +1,21 @@
 #!/usr/bin/env python3
 """
-Convert GIF animation to C header file with RGB565 format for ESP32 display
+Convert GIF animation to C header file of RLE frames for ESP32 display
+(a keyframe plus per-frame deltas, see rle_frames.py)
 """
 
 from PIL import Image
 import sys
 import os
 
+from rle_frames import write_header
+
 def rgb888_to_rgb565(r, g, b):
     """Convert RGB888 to RGB565 format"""
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
-def convert_gif_to_header(gif_path, output_path, var_name="spaceman"):
-    """Convert GIF to C header file with RGB565 pixel data"""
+def convert_gif_to_header(gif_path, output_path, var_name="spaceman", delay_ms=None, colors=256):
+    """Convert GIF to C header file with RLE-compressed frames"""
     
     print(f"Loading GIF: {gif_path}")
     img = Image.open(gif_path)
@@ -32,63 +35,22 @@ def convert_gif_to_header(gif_path, output_path, var_name="spaceman"):
     target_width = 240
     target_height = 240
     
-    # Open output file
-    with open(output_path, 'w') as f:
-        # Write header
-        f.write(f"#ifndef {var_name.upper()}_GIF_H\n")
-        f.write(f"#define {var_name.upper()}_GIF_H\n\n")
-        f.write("#include <Arduino.h>\n\n")
-        f.write(f"#define {var_name.upper()}_FRAME_COUNT {frame_count}\n\n")
-        
-        # Process each frame
-        for frame_idx in range(frame_count):
-            print(f"Processing frame {frame_idx + 1}/{frame_count}...")
-            
-            img.seek(frame_idx)
-            
-            # Convert to RGB and resize to 240x240
-            frame = img.convert('RGB')
-            frame = frame.resize((target_width, target_height), Image.Resampling.LANCZOS)
-            
-            # Write frame data
-            f.write(f"const uint16_t {var_name}_frame_{frame_idx}[{target_width * target_height}] PROGMEM = {{\n")
-            
-            pixels = frame.load()
-            pixel_count = 0
-            
-            for y in range(target_height):
-                for x in range(target_width):
-                    r, g, b = pixels[x, y]
-                    rgb565 = rgb888_to_rgb565(r, g, b)
-                    
-                    if pixel_count % 12 == 0:
-                        f.write("  ")
-                    
-                    f.write(f"0x{rgb565:04X}")
-                    
-                    if pixel_count < (target_width * target_height - 1):
-                        f.write(",")
-                    
-                    if pixel_count % 12 == 11:
-                        f.write("\n")
-                    
-                    pixel_count += 1
-            
-            if pixel_count % 12 != 0:
-                f.write("\n")
-            
-            f.write("};\n\n")
+    # Process each frame
+    frames = []
+    for frame_idx in range(frame_count):
+        print(f"Processing frame {frame_idx + 1}/{frame_count}...")
         
-        # Write frame array pointer
-        f.write(f"const uint16_t* {var_name}_frames[{frame_count}] = {{\n")
-        for frame_idx in range(frame_count):
-            f.write(f"  {var_name}_frame_{frame_idx}")
-            if frame_idx < frame_count - 1:
-                f.write(",")
-            f.write("\n")
-        f.write("};\n\n")
+        img.seek(frame_idx)
         
-        f.write(f"#endif // {var_name.upper()}_GIF_H\n")
+        # Convert to RGB and resize to 240x240
+        frame = img.convert('RGB')
+        frame = frame.resize((target_width, target_height), Image.Resampling.LANCZOS)
+        rgb = frame.tobytes()
+        frames.append([rgb888_to_rgb565(*rgb[i:i + 3]) for i in range(0, len(rgb), 3)])
+    
+    # Keyframe plus deltas, straight into the firmware format
+    write_header(frames, output_path, var_name, target_width, target_height, delay_ms,
+                 source=os.path.basename(gif_path), tool="gif_to_header.py", colors=colors)
     
     print(f"✅ Conversion complete! Output: {output_path}")
     print(f"   Frames: {frame_count}")
@@ -100,15 +62,17 @@ def convert_gif_to_header(gif_path, output_path, var_name="spaceman"):
 
 if __name__ == "__main__":
     if len(sys.argv) < 2:
-        print("Usage: python gif_to_header.py <input.gif> [output.h] [var_name]")
+        print("Usage: python gif_to_header.py <input.gif> [output.h] [var_name] [delay_ms] [colors]")
         sys.exit(1)
     
     input_gif = sys.argv[1]
     output_h = sys.argv[2] if len(sys.argv) > 2 else "animation.h"
     var_name = sys.argv[3] if len(sys.argv) > 3 else "spaceman"
+    delay_ms = int(sys.argv[4]) if len(sys.argv) > 4 else None
+    colors = int(sys.argv[5]) if len(sys.argv) > 5 else 256
     
     if not os.path.exists(input_gif):
         print(f"❌ Error: File not found: {input_gif}")
         sys.exit(1)
     
-    convert_gif_to_header(input_gif, output_h, var_name)
+    convert_gif_to_header(input_gif, output_h, var_name, delay_ms, colors)
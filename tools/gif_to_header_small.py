@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 """
-Convert GIF animation to C header file with RGB565 format for ESP32 display
+Convert GIF animation to C header file of RLE frames for ESP32 display
+(a keyframe plus per-frame deltas, see rle_frames.py)
 This version uses smaller resolution (120x120) to fit in flash
 """
 
@@ -8,14 +9,14 @@ from PIL import Image
 import sys
 import os
 
+from rle_frames import write_header
+
 def rgb888_to_rgb565(r, g, b):
-    """Convert RGB888 to RGB565 format with byte swap for ESP32"""
-    rgb565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
-    # Swap bytes for correct display on ESP32/LovyanGFX
-    return ((rgb565 & 0xFF) << 8) | ((rgb565 >> 8) & 0xFF)
+    """Convert RGB888 to RGB565 format"""
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
-def convert_gif_to_header(gif_path, output_path, var_name="spaceman", max_frames=5, size=120):
-    """Convert GIF to C header file with RGB565 pixel data"""
+def convert_gif_to_header(gif_path, output_path, var_name="spaceman", max_frames=5, size=120, delay_ms=None, colors=256):
+    """Convert GIF to C header file with RLE-compressed frames"""
     
     print(f"Loading GIF: {gif_path}")
     img = Image.open(gif_path)
@@ -38,65 +39,22 @@ def convert_gif_to_header(gif_path, output_path, var_name="spaceman", max_frames
     print(f"Selecting {len(selected_frames)} frames: {selected_frames}")
     print(f"Target size: {size}x{size}")
     
-    # Open output file
-    with open(output_path, 'w') as f:
-        # Write header
-        f.write(f"#ifndef {var_name.upper()}_GIF_H\n")
-        f.write(f"#define {var_name.upper()}_GIF_H\n\n")
-        f.write("#include <Arduino.h>\n\n")
-        f.write(f"#define {var_name.upper()}_FRAME_COUNT {len(selected_frames)}\n")
-        f.write(f"#define {var_name.upper()}_WIDTH {size}\n")
-        f.write(f"#define {var_name.upper()}_HEIGHT {size}\n\n")
-        
-        # Process selected frames
-        for idx, frame_num in enumerate(selected_frames):
-            print(f"Processing frame {idx + 1}/{len(selected_frames)} (original frame {frame_num})...")
-            
-            img.seek(frame_num)
-            
-            # Convert to RGB and resize
-            frame = img.convert('RGB')
-            frame = frame.resize((size, size), Image.Resampling.LANCZOS)
-            
-            # Write frame data
-            f.write(f"const uint16_t {var_name}_frame_{idx}[{size * size}] PROGMEM = {{\n")
-            
-            pixels = frame.load()
-            pixel_count = 0
-            
-            for y in range(size):
-                for x in range(size):
-                    r, g, b = pixels[x, y]
-                    rgb565 = rgb888_to_rgb565(r, g, b)
-                    
-                    if pixel_count % 12 == 0:
-                        f.write("  ")
-                    
-                    f.write(f"0x{rgb565:04X}")
-                    
-                    if pixel_count < (size * size - 1):
-                        f.write(",")
-                    
-                    if pixel_count % 12 == 11:
-                        f.write("\n")
-                    
-                    pixel_count += 1
-            
-            if pixel_count % 12 != 0:
-                f.write("\n")
-            
-            f.write("};\n\n")
+    # Process selected frames
+    frames = []
+    for idx, frame_num in enumerate(selected_frames):
+        print(f"Processing frame {idx + 1}/{len(selected_frames)} (original frame {frame_num})...")
         
-        # Write frame array pointer
-        f.write(f"const uint16_t* {var_name}_frames[{len(selected_frames)}] = {{\n")
-        for idx in range(len(selected_frames)):
-            f.write(f"  {var_name}_frame_{idx}")
-            if idx < len(selected_frames) - 1:
-                f.write(",")
-            f.write("\n")
-        f.write("};\n\n")
+        img.seek(frame_num)
         
-        f.write(f"#endif // {var_name.upper()}_GIF_H\n")
+        # Convert to RGB and resize
+        frame = img.convert('RGB')
+        frame = frame.resize((size, size), Image.Resampling.LANCZOS)
+        rgb = frame.tobytes()
+        frames.append([rgb888_to_rgb565(*rgb[i:i + 3]) for i in range(0, len(rgb), 3)])
+    
+    # Keyframe plus deltas, straight into the firmware format
+    write_header(frames, output_path, var_name, size, size, delay_ms,
+                 source=os.path.basename(gif_path), tool="gif_to_header_small.py", colors=colors)
     
     print(f"✅ Conversion complete! Output: {output_path}")
     print(f"   Frames: {len(selected_frames)} (reduced from {total_frames})")
@@ -108,7 +66,7 @@ def convert_gif_to_header(gif_path, output_path, var_name="spaceman", max_frames
 
 if __name__ == "__main__":
     if len(sys.argv) < 2:
-        print("Usage: python gif_to_header_small.py <input.gif> [output.h] [var_name] [max_frames] [size]")
+        print("Usage: python gif_to_header_small.py <input.gif> [output.h] [var_name] [max_frames] [size] [delay_ms] [colors]")
         sys.exit(1)
     
     input_gif = sys.argv[1]
@@ -116,9 +74,11 @@ if __name__ == "__main__":
     var_name = sys.argv[3] if len(sys.argv) > 3 else "spaceman"
     max_frames = int(sys.argv[4]) if len(sys.argv) > 4 else 5
     size = int(sys.argv[5]) if len(sys.argv) > 5 else 120
+    delay_ms = int(sys.argv[6]) if len(sys.argv) > 6 else None
+    colors = int(sys.argv[7]) if len(sys.argv) > 7 else 256
     
     if not os.path.exists(input_gif):
         print(f"❌ Error: File not found: {input_gif}")
         sys.exit(1)
     
-    convert_gif_to_header(input_gif, output_h, var_name, max_frames, size)
+    convert_gif_to_header(input_gif, output_h, var_name, max_frames, size, delay_ms, colors)
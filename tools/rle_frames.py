@@ -0,0 +1,519 @@
+#!/usr/bin/env python3
+"""
+Compress RGB565 animation headers into the firmware's RLE frame format
+
+Reads a header made by one of the gif_to_* / image_to_header converters (raw
+RGB565 PROGMEM arrays, one per frame, in frame order) and writes a header of
+compressed frames plus an RleFrame table (see firmware/src/RleFrame.h).
+Pure Python, no dependencies.
+
+All frames share one palette of up to 256 colors (--colors sets fewer).
+The sources are GIFs, so this is usually their own color count; frames
+that picked up extra colors when they were resized, or that are cut down
+to a smaller palette, are reduced with median cut and Floyd-Steinberg
+dithering (--no-dither maps to the nearest color instead). Palettes of 16
+colors or fewer store 4-bit indices.
+
+Every row is coded on its own as a stream of tokens (one control byte):
+  0x00-0x7F  literal: (ctl + 1) palette indices follow, one per byte or
+             for 4-bit indices two per byte (high nibble first)
+  0x80-0xBF  run: (ctl - 0x80 + 2) copies of the index that follows
+  0xC0-0xFF  copy: (ctl - 0xC0 + 1) indices unchanged from the row above
+The palette is stored byte-swapped (panel byte order) so the decoder can
+expand rows straight into DMA line buffers.
+
+Only frame 0 is stored whole (the keyframe). Every frame then gets a delta
+from the one before it, the first frame's delta starting from the last so
+the animation loops. A delta codes the bounding rectangle of the changed
+pixels, and in it copy tokens mean skip: leave the previous frame's pixel.
+Unchanged stretches shorter than MIN_SKIP are sent again instead, since a
+new span costs the panel a new address window, and each row is limited to
+MAX_SPANS written spans.
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import Counter
+
+MAX_LITERAL = 128
+MAX_RUN = 65
+MAX_COPY = 64
+PALETTE_SIZE = 256
+MIN_SKIP = 4
+MAX_SPANS = 16  # RLE_MAX_SPANS in RleFrame.h
+
+ARRAY_RE = re.compile(r"const\s+uint16_t\s+(\w+)\s*\[[^\]]*\]\s*PROGMEM\s*=\s*\{([^}]*)\}", re.S)
+
+
+def swap(px):
+    return ((px << 8) | (px >> 8)) & 0xFFFF
+
+
+def to_rgb(px):
+    return ((px >> 11) & 0x1F) << 3, ((px >> 5) & 0x3F) << 2, (px & 0x1F) << 3
+
+
+def to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def median_cut(counts, size):
+    """Palette of `size` colors for a {color: pixel count} histogram"""
+    boxes = [list(counts.items())]
+    while len(boxes) < size:
+        # Split the box with the widest channel, weighted by its pixels
+        best = None
+        for index, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            rgb = [to_rgb(c) for c, _ in box]
+            ranges = [max(p[k] for p in rgb) - min(p[k] for p in rgb) for k in range(3)]
+            channel = ranges.index(max(ranges))
+            score = ranges[channel] * sum(n for _, n in box)
+            if best is None or score > best[0]:
+                best = (score, index, channel)
+        if best is None:
+            break
+        _, index, channel = best
+        box = sorted(boxes[index], key=lambda cn: to_rgb(cn[0])[channel])
+        half = sum(n for _, n in box) / 2
+        seen = 0
+        split = 1
+        for split, (_, n) in enumerate(box, 1):
+            seen += n
+            if seen >= half:
+                break
+        split = min(max(split, 1), len(box) - 1)
+        boxes[index:index + 1] = [box[:split], box[split:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        mean = [sum(to_rgb(c)[k] * n for c, n in box) // total for k in range(3)]
+        palette.append(to_565(*mean))
+    return palette
+
+
+class Nearest:
+    """Closest palette index to an RGB888 color, memoized"""
+
+    def __init__(self, palette):
+        self.rgb = [to_rgb(c) for c in palette]
+        self.cache = {}
+
+    def __call__(self, r, g, b):
+        key = (r, g, b)
+        index = self.cache.get(key)
+        if index is None:
+            index = min(range(len(self.rgb)), key=lambda i: (self.rgb[i][0] - r) ** 2 +
+                        (self.rgb[i][1] - g) ** 2 + (self.rgb[i][2] - b) ** 2)
+            self.cache[key] = index
+        return index
+
+
+def dither(frames, palette, width, height):
+    """Floyd-Steinberg onto the palette. A pixel whose source color is the
+    same as in the previous frame keeps that frame's index (its error still
+    diffuses), so the pattern does not crawl between frames and the deltas
+    stay limited to real motion."""
+    nearest = Nearest(palette)
+    result = []
+    previous = None
+    for index, pixels in enumerate(frames):
+        source = [list(to_rgb(c)) for c in pixels]
+        indices = [0] * len(pixels)
+        for y in range(height):
+            for x in range(width):
+                i = y * width + x
+                r, g, b = (min(max(int(round(v)), 0), 255) for v in source[i])
+                if previous is not None and pixels[i] == frames[index - 1][i]:
+                    choice = previous[i]
+                else:
+                    choice = nearest(r, g, b)
+                indices[i] = choice
+                pr, pg, pb = nearest.rgb[choice]
+                error = (r - pr, g - pg, b - pb)
+                for dx, dy, weight in ((1, 0, 7), (-1, 1, 3), (0, 1, 5), (1, 1, 1)):
+                    nx, ny = x + dx, y + dy
+                    if 0 <= nx < width and ny < height:
+                        target = source[ny * width + nx]
+                        for k in range(3):
+                            target[k] += error[k] * weight / 16
+        result.append(indices)
+        previous = indices
+    return result
+
+
+def quantize(frames, width, height, colors=PALETTE_SIZE, dithered=True):
+    """(palette, frames as palette indices). Frames with more colors than
+    the palette holds are reduced with median cut and, unless dithered is
+    False, error-diffused onto it."""
+    counts = Counter()
+    for pixels in frames:
+        counts.update(pixels)
+    if len(counts) <= colors:
+        palette = sorted(counts)
+        lookup = {c: i for i, c in enumerate(palette)}
+        return palette, [[lookup[c] for c in pixels] for pixels in frames]
+
+    palette = median_cut(counts, colors)
+    if dithered:
+        return palette, dither(frames, palette, width, height)
+    nearest = Nearest(palette)
+    return palette, [[nearest(*to_rgb(c)) for c in pixels] for pixels in frames]
+
+
+def pack(indices, bits):
+    """Literal payload: one index per byte, or two (high nibble first)"""
+    if bits == 8:
+        return list(indices)
+    padded = list(indices) + [0] * (len(indices) % 2)
+    return [(padded[i] << 4) | padded[i + 1] for i in range(0, len(padded), 2)]
+
+
+def unpack(data, pos, count, bits):
+    """(count literal indices at data[pos], position after them)"""
+    if bits == 8:
+        return data[pos:pos + count], pos + count
+    indices = []
+    for i in range(count):
+        byte = data[pos + i // 2]
+        indices.append(byte & 0x0F if i % 2 else byte >> 4)
+    return indices, pos + (count + 1) // 2
+
+
+def encode_row(row, above, bits):
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(pack(chunk, bits))
+
+    i = 0
+    n = len(row)
+    while i < n:
+        copy = 0
+        if above is not None:
+            while i + copy < n and copy < MAX_COPY and row[i + copy] == above[i + copy]:
+                copy += 1
+        run = 1
+        while i + run < n and run < MAX_RUN and row[i + run] == row[i]:
+            run += 1
+
+        if copy >= 2 and copy >= run:
+            flush_literal()
+            out.append(0xC0 + copy - 1)
+            i += copy
+        elif run >= 2:
+            flush_literal()
+            out.append(0x80 + run - 2)
+            out.append(row[i])
+            i += run
+        else:
+            literal.append(row[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def decode(data, width, height, bits):
+    """Token stream -> palette indices (for verification)"""
+    rows = []
+    row = [0] * width
+    pos = 0
+    for _ in range(height):
+        x = 0
+        while x < width:
+            ctl = data[pos]
+            pos += 1
+            if ctl < 0x80:
+                count = ctl + 1
+                row[x:x + count], pos = unpack(data, pos, count, bits)
+            elif ctl < 0xC0:
+                count = ctl - 0x80 + 2
+                row[x:x + count] = [data[pos]] * count
+                pos += 1
+            else:
+                count = ctl - 0xC0 + 1
+            x += count
+        rows.extend(row)
+    return rows
+
+
+def changed_spans(row, before):
+    """[start, end) stretches of row to write over before"""
+    spans = []
+    for x, (new, old) in enumerate(zip(row, before)):
+        if new == old:
+            continue
+        if spans and x - spans[-1][1] < MIN_SKIP:
+            spans[-1][1] = x + 1
+        else:
+            spans.append([x, x + 1])
+    while len(spans) > MAX_SPANS:
+        # Resend the shortest unchanged gap
+        gap = min(range(len(spans) - 1), key=lambda i: spans[i + 1][0] - spans[i][1])
+        spans[gap][1] = spans[gap + 1][1]
+        del spans[gap + 1]
+    return spans
+
+
+def encode_skip(out, count):
+    while count > 0:
+        chunk = min(count, MAX_COPY)
+        out.append(0xC0 + chunk - 1)
+        count -= chunk
+
+
+def encode_delta(indices, previous, width, height, bits):
+    """(x, y, w, h, tokens, skips) turning previous into indices"""
+    changed = [i for i in range(width * height) if indices[i] != previous[i]]
+    if not changed:
+        return 0, 0, 0, 0, [], True
+    x0 = min(i % width for i in changed)
+    x1 = max(i % width for i in changed) + 1
+    y0 = changed[0] // width
+    y1 = changed[-1] // width + 1
+
+    data = []
+    written = 0
+    for y in range(y0, y1):
+        row = indices[y * width + x0:y * width + x1]
+        before = previous[y * width + x0:y * width + x1]
+        x = 0
+        for start, end in changed_spans(row, before):
+            encode_skip(data, start - x)
+            data.extend(encode_row(row[start:end], None, bits))
+            written += end - start
+            x = end
+        encode_skip(data, len(row) - x)
+
+    # Where most of the rectangle is rewritten anyway, coding it whole (with
+    # copies from the row above) is usually smaller for the same traffic
+    w, h = x1 - x0, y1 - y0
+    if written * 4 > w * h * 3:
+        rect = [indices[y * width + x] for y in range(y0, y1) for x in range(x0, x1)]
+        whole = encode(rect, w, h, bits)
+        if len(whole) < len(data):
+            return x0, y0, w, h, whole, False
+    return x0, y0, w, h, data, True
+
+
+def decode_delta(data, x0, y0, w, h, previous, width, bits):
+    """previous with a delta applied (for verification)"""
+    pixels = list(previous)
+    pos = 0
+    for y in range(y0, y0 + h):
+        x = 0
+        while x < w:
+            ctl = data[pos]
+            pos += 1
+            if ctl < 0x80:
+                count = ctl + 1
+                start = y * width + x0 + x
+                pixels[start:start + count], pos = unpack(data, pos, count, bits)
+            elif ctl < 0xC0:
+                count = ctl - 0x80 + 2
+                pixels[y * width + x0 + x:y * width + x0 + x + count] = [data[pos]] * count
+                pos += 1
+            else:
+                count = ctl - 0xC0 + 1
+            x += count
+    return pixels
+
+
+def encode(indices, width, height, bits):
+    data = []
+    above = None
+    for y in range(height):
+        row = indices[y * width:(y + 1) * width]
+        data.extend(encode_row(row, above, bits))
+        above = row
+    return data
+
+
+def parse_frames(text):
+    """All raw PROGMEM uint16_t arrays in a header, in order"""
+    frames = []
+    for match in ARRAY_RE.finditer(text):
+        frames.append([int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", match.group(2))])
+    return frames
+
+
+def write_values(out, values, digits):
+    for start in range(0, len(values), 16):
+        row = ",".join(f"0x{v:0{digits}X}" for v in values[start:start + 16])
+        out.append(f"  {row},")
+
+
+def load_frames(input_path, width, height, swapped=False):
+    """Frames of a raw header as RGB565. swapped: the header holds them
+    byte-swapped (panel order), as gif_to_header_small.py wrote them."""
+    with open(input_path) as f:
+        frames = parse_frames(f.read())
+    if not frames:
+        sys.exit(f"No PROGMEM uint16_t arrays found in {input_path}")
+    for index, pixels in enumerate(frames):
+        if len(pixels) != width * height:
+            sys.exit(f"Frame {index} has {len(pixels)} pixels, expected {width}x{height}")
+    if swapped:
+        frames = [[swap(px) for px in pixels] for pixels in frames]
+    return frames
+
+
+def compress(frames, width, height, colors=PALETTE_SIZE, dithered=True):
+    """(palette, bits, keyframe tokens, deltas as (x, y, w, h, tokens, skips)),
+    each checked by decoding it again"""
+    palette, indexed = quantize(frames, width, height, colors, dithered)
+    bits = 4 if len(palette) <= 16 else 8
+
+    key = encode(indexed[0], width, height, bits)
+    if decode(key, width, height, bits) != indexed[0]:
+        sys.exit("Keyframe does not round-trip")
+
+    deltas = []
+    for index, indices in enumerate(indexed):
+        previous = indexed[index - 1]
+        x, y, w, h, data, skips = encode_delta(indices, previous, width, height, bits)
+        if skips:
+            result = decode_delta(data, x, y, w, h, previous, width, bits)
+        else:
+            result = list(previous)
+            rect = decode(data, w, h, bits)
+            for row in range(h):
+                result[(y + row) * width + x:(y + row) * width + x + w] = rect[row * w:(row + 1) * w]
+        if result != indices:
+            sys.exit(f"Delta {index} does not round-trip")
+        deltas.append((x, y, w, h, data, skips))
+    return palette, bits, key, deltas
+
+
+def report(frames, width, height, palette, bits, packed_bytes, deltas):
+    raw_bytes = sum(len(p) for p in frames) * 2
+    area = sum(w * h for _, _, w, h, _, _ in deltas) / len(deltas)
+    print(f"{len(frames)} frames, {len(palette)} colors ({bits}-bit): {raw_bytes / 1024:.1f} KB raw -> "
+          f"{packed_bytes / 1024:.1f} KB ({raw_bytes / packed_bytes:.1f}x), "
+          f"deltas cover {100 * area / (width * height):.0f}% of a frame on average")
+
+
+def convert(input_path, output_path, name, width, height, delay_ms=None, colors=PALETTE_SIZE,
+            dithered=True, swapped=False):
+    frames = load_frames(input_path, width, height, swapped)
+    write_header(frames, output_path, name, width, height, delay_ms, colors, dithered,
+                 source=os.path.basename(input_path))
+
+
+def write_header(frames, output_path, name, width, height, delay_ms=None, colors=PALETTE_SIZE,
+                 dithered=True, source=None, tool="rle_frames.py"):
+    """Header of RleFrames for frames (lists of RGB565 pixels). delay_ms, a
+    delay for every frame or a list of one per frame, also emits an
+    AnimationPlayer Animation <name>_animation."""
+    palette, bits, key, deltas = compress(frames, width, height, colors, dithered)
+    if isinstance(delay_ms, int):
+        delay_ms = [delay_ms] * len(frames)
+
+    upper = name.upper()
+    guard = f"{upper}_RLE_H"
+    out = [
+        f"// Generated by tools/{tool}" + (f" from {source}" if source else "") + " - do not edit",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "RleFrame.h"',
+    ]
+    if delay_ms is not None:
+        out.append('#include "AnimationPlayer.h"')
+    out += [
+        "",
+        f"#define {upper}_FRAME_COUNT {len(frames)}",
+        f"#define {upper}_WIDTH {width}",
+        f"#define {upper}_HEIGHT {height}",
+        "",
+        f"// {len(palette)} colors ({bits}-bit indices), byte-swapped RGB565",
+        f"static const uint16_t {name}_palette[{len(palette)}] PROGMEM = {{",
+    ]
+    write_values(out, [swap(c) for c in palette], 4)
+    out += ["};", ""]
+
+    packed_bytes = len(palette) * 2 + len(key)
+    out.append(f"// Keyframe: {len(key)} bytes")
+    out.append(f"static const uint8_t {name}_key_rle[{len(key)}] PROGMEM = {{")
+    write_values(out, key, 2)
+    out += ["};", ""]
+
+    arrays = []
+    for index, (x, y, w, h, data, _) in enumerate(deltas):
+        if not data:
+            arrays.append(None)
+            out += [f"// Delta {index}: no change", ""]
+            continue
+        if data == key:
+            # Whole frame over again: (the last frame into) the first one
+            arrays.append(f"{name}_key_rle")
+            out += [f"// Delta {index}: the keyframe", ""]
+            continue
+        arrays.append(f"{name}_delta_{index}_rle")
+        packed_bytes += len(data)
+        out.append(f"// Delta {index}: {w}x{h} at ({x}, {y}), {len(data)} bytes")
+        out.append(f"static const uint8_t {name}_delta_{index}_rle[{len(data)}] PROGMEM = {{")
+        write_values(out, data, 2)
+        out += ["};", ""]
+
+    out.append(f"static const RleFrame {name}_keyframe = "
+               f"{{ 0, 0, {width}, {height}, {name}_palette, {len(palette)}, {bits}, {name}_key_rle, {len(key)}, "
+               f"false }};")
+    out.append("")
+    out.append(f"static const RleFrame {name}_deltas[{upper}_FRAME_COUNT] = {{")
+    for (x, y, w, h, tokens, skips), data in zip(deltas, arrays):
+        out.append(f"  {{ {x}, {y}, {w}, {h}, {name}_palette, {len(palette)}, {bits}, "
+                   f"{data or 'nullptr'}, {len(tokens)}, {'true' if skips else 'false'} }},")
+    out += ["};", ""]
+
+    out.append(f"extern const RleAnimation {name}_rle;")
+    out.append(f"const RleAnimation {name}_rle = "
+               f"{{ {width}, {height}, {upper}_FRAME_COUNT, &{name}_keyframe, {name}_deltas }};")
+    out.append("")
+
+    if delay_ms is not None:
+        out.append(f"static const AnimationFrame {name}_animation_frames[{upper}_FRAME_COUNT] = {{")
+        for index in range(len(frames)):
+            out.append(f"  {{ &{name}_deltas[{index}], {delay_ms[index]} }},")
+        out += ["};", ""]
+        out.append(f"extern const Animation {name}_animation;")
+        out.append(f"const Animation {name}_animation = "
+                   f"{{ {name}_animation_frames, {upper}_FRAME_COUNT, true, &{name}_keyframe }};")
+        out.append("")
+
+    out.append(f"#endif // {guard}")
+    with open(output_path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    report(frames, width, height, palette, bits, packed_bytes, deltas)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compress RGB565 animation headers into RLE frames")
+    parser.add_argument("input", help="header of raw PROGMEM uint16_t frames")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("name", help="C name prefix")
+    parser.add_argument("width", type=int)
+    parser.add_argument("height", type=int)
+    parser.add_argument("delay", type=int, nargs="?",
+                        help="frame delay in ms; also emits an AnimationPlayer Animation <name>_animation")
+    parser.add_argument("--colors", type=int, default=PALETTE_SIZE,
+                        help="palette size, 2-256 (16 or fewer stores 4-bit indices)")
+    parser.add_argument("--no-dither", action="store_true",
+                        help="map reduced colors to the nearest entry instead of error diffusion")
+    parser.add_argument("--swapped", action="store_true",
+                        help="input pixels are byte-swapped (gif_to_header_small.py output)")
+    args = parser.parse_args()
+    if not 2 <= args.colors <= PALETTE_SIZE:
+        parser.error("--colors must be 2-256")
+    convert(args.input, args.output, args.name, args.width, args.height, args.delay,
+            args.colors, not args.no_dither, args.swapped)